@@ -0,0 +1,89 @@
+//******************************************************************************************************
+//  BufferPool.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __BUFFER_POOL_H
+#define __BUFFER_POOL_H
+
+#include "CommonTypes.h"
+
+namespace GSF
+{
+    // Thread-safe pool of reusable byte buffers.
+    //
+    // Buffers are handed out by value so that ownership can be moved through
+    // queues without copying; returning a buffer to the pool keeps its capacity
+    // for the next acquisition. Buffers larger than the maximum retained
+    // capacity are released to the heap instead of being pooled.
+    class BufferPool // NOLINT
+    {
+    private:
+        Mutex m_mutex;
+        std::vector<std::vector<uint8_t>> m_buffers;
+        const uint32_t m_maximumPooledBuffers;
+        const uint32_t m_maximumRetainedCapacity;
+
+    public:
+        BufferPool(uint32_t maximumPooledBuffers = 32, uint32_t maximumRetainedCapacity = 65536) :
+            m_maximumPooledBuffers(maximumPooledBuffers),
+            m_maximumRetainedCapacity(maximumRetainedCapacity)
+        {
+        }
+
+        // Gets a buffer from the pool holding a copy of the given data.
+        std::vector<uint8_t> Acquire(const uint8_t* data, uint32_t length)
+        {
+            std::vector<uint8_t> buffer;
+
+            if (length <= m_maximumRetainedCapacity)
+            {
+                ScopeLock lock(m_mutex);
+
+                if (!m_buffers.empty())
+                {
+                    buffer = std::move(m_buffers.back());
+                    m_buffers.pop_back();
+                }
+            }
+
+            buffer.assign(data, data + length);
+            return buffer;
+        }
+
+        // Returns a buffer to the pool for reuse.
+        void Release(std::vector<uint8_t>&& buffer)
+        {
+            if (buffer.capacity() == 0 || buffer.capacity() > m_maximumRetainedCapacity)
+                return;
+
+            ScopeLock lock(m_mutex);
+
+            if (m_buffers.size() < m_maximumPooledBuffers)
+            {
+                buffer.clear();
+                m_buffers.push_back(std::move(buffer));
+            }
+        }
+    };
+}
+
+#endif
@@ -352,14 +352,28 @@ namespace GSF
         }
     };
 
+    // Copies all remaining data from the source stream buffer to the end of the sink in blocks,
+    // reserve sink capacity in advance when the final size is known to avoid reallocation
     template<class T, class TElem = char>
     void CopyStream(T* source, std::vector<uint8_t>& sink)
     {
-        std::istreambuf_iterator<TElem> it{ source };
-        std::istreambuf_iterator<TElem> eos{};
+        static constexpr std::streamsize BlockSize = 65536;
+        size_t length = sink.size();
 
-        for (; it != eos; ++it)
-            sink.push_back(static_cast<uint8_t>(*it));
+        while (true)
+        {
+            if (sink.size() < length + BlockSize)
+                sink.resize(std::max(length + BlockSize, sink.capacity()));
+
+            const std::streamsize count = source->sgetn(reinterpret_cast<TElem*>(sink.data() + length), BlockSize);
+
+            if (count <= 0)
+                break;
+
+            length += static_cast<size_t>(count);
+        }
+
+        sink.resize(length);
     }
 
     template<class T, class TElem = char>
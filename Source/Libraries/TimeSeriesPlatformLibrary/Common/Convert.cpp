@@ -499,9 +499,108 @@ const char* GSF::Coalesce(const char* data, const char* nonEmptyValue)
     return data;
 }
 
+// Parses fixed-layout ISO 8601 timestamps, e.g., 2018-03-14T19:23:11.665-04:00, without locale based stream
+// parsing; returns false for any other layout so caller can fall back on the general purpose parser
+static bool TryParseISOTimestamp(const char* time, datetime_t& timestamp, bool parseAsUTC)
+{
+    const auto readDigits = [&time](int32_t count, int32_t& value)
+    {
+        value = 0;
+
+        for (int32_t i = 0; i < count; i++, time++)
+        {
+            if (*time < '0' || *time > '9')
+                return false;
+
+            value = value * 10 + (*time - '0');
+        }
+
+        return true;
+    };
+
+    int32_t year, month, day, hour, minute, second;
+
+    if (!readDigits(4, year) || *time++ != '-' || !readDigits(2, month) || *time++ != '-' || !readDigits(2, day))
+        return false;
+
+    if (*time != 'T' && *time != ' ')
+        return false;
+
+    time++;
+
+    if (!readDigits(2, hour) || *time++ != ':' || !readDigits(2, minute) || *time++ != ':' || !readDigits(2, second))
+        return false;
+
+    int64_t microseconds = 0;
+
+    if (*time == '.')
+    {
+        int32_t digits = 0;
+        time++;
+
+        while (*time >= '0' && *time <= '9')
+        {
+            if (digits++ < 6)
+                microseconds = microseconds * 10 + (*time - '0');
+
+            time++;
+        }
+
+        if (digits == 0)
+            return false;
+
+        for (; digits < 6; digits++)
+            microseconds *= 10;
+    }
+
+    int32_t offsetMinutes = 0;
+
+    if (*time == '+' || *time == '-')
+    {
+        const int32_t sign = *time++ == '-' ? -1 : 1;
+        int32_t offsetHours;
+
+        if (!readDigits(2, offsetHours))
+            return false;
+
+        if (*time == ':')
+            time++;
+
+        if (!readDigits(2, offsetMinutes))
+            return false;
+
+        offsetMinutes = sign * (offsetHours * 60 + offsetMinutes);
+    }
+    else if (*time == 'Z')
+    {
+        time++;
+    }
+
+    if (*time != '\0' || month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 59)
+        return false;
+
+    try
+    {
+        timestamp = datetime_t(boost::gregorian::date(year, month, day), time_duration(hour, minute, second) + boost::posix_time::microseconds(microseconds));
+    }
+    catch (const std::out_of_range&)
+    {
+        return false;
+    }
+
+    // Remove time zone offset for conversion to UTC
+    if (parseAsUTC)
+        timestamp -= boost::posix_time::minutes(offsetMinutes);
+
+    return true;
+}
+
 // Attempt to parse a timestamp string, e.g.: 2018-03-14T19:23:11.665-04:00
 bool GSF::TryParseTimestamp(const char* time, datetime_t& timestamp, const datetime_t& defaultValue, bool parseAsUTC)
 {
+    if (TryParseISOTimestamp(time, timestamp, parseAsUTC))
+        return true;
+
     static const locale formats[] = {
         locale(locale::classic(), new time_input_facet("%Y-%m-%d %H:%M:%S%F")),
         locale(locale::classic(), new time_input_facet("%Y%m%dT%H%M%S%F"))
@@ -0,0 +1,509 @@
+//******************************************************************************************************
+//  Decimal128.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "Decimal128.h"
+
+using namespace std;
+using namespace GSF;
+
+static_assert(sizeof(Decimal128) == 16, "Decimal128 is expected to be 16 bytes");
+
+// Intermediate results use a 192-bit integer, large enough for the product
+// of two coefficients or for a coefficient scaled up by 10^28
+static const int32_t WideLimbs = 6;
+
+struct WideInteger
+{
+    uint32_t Limbs[WideLimbs];
+};
+
+// Coefficients with more significant digits can never be reduced to fit
+static const int32_t MaxWideDigits = 57;
+
+static const uint32_t Powers10[] =
+{
+    1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U
+};
+
+static WideInteger ToWide(const uint32_t low, const uint32_t middle, const uint32_t high)
+{
+    return { { low, middle, high, 0U, 0U, 0U } };
+}
+
+static bool IsZero(const WideInteger& value)
+{
+    for (int32_t i = 0; i < WideLimbs; i++)
+    {
+        if (value.Limbs[i] != 0U)
+            return false;
+    }
+
+    return true;
+}
+
+static bool FitsCoefficient(const WideInteger& value)
+{
+    return value.Limbs[3] == 0U && value.Limbs[4] == 0U && value.Limbs[5] == 0U;
+}
+
+// Computes value * factor + addend, returns false on overflow
+static bool MultiplyAdd(WideInteger& value, const uint32_t factor, const uint32_t addend = 0U)
+{
+    uint64_t carry = addend;
+
+    for (int32_t i = 0; i < WideLimbs; i++)
+    {
+        const uint64_t product = static_cast<uint64_t>(value.Limbs[i]) * factor + carry;
+        value.Limbs[i] = static_cast<uint32_t>(product);
+        carry = product >> 32;
+    }
+
+    return carry == 0U;
+}
+
+// Multiplies value by 10^power, returns false on overflow
+static bool ScaleUp(WideInteger& value, int32_t power)
+{
+    while (power > 9)
+    {
+        if (!MultiplyAdd(value, Powers10[9]))
+            return false;
+
+        power -= 9;
+    }
+
+    return MultiplyAdd(value, Powers10[power]);
+}
+
+// Divides value by divisor in place, returning the remainder
+static uint32_t Divide(WideInteger& value, const uint32_t divisor)
+{
+    uint64_t remainder = 0U;
+
+    for (int32_t i = WideLimbs - 1; i >= 0; i--)
+    {
+        const uint64_t dividend = remainder << 32 | value.Limbs[i];
+        value.Limbs[i] = static_cast<uint32_t>(dividend / divisor);
+        remainder = dividend % divisor;
+    }
+
+    return static_cast<uint32_t>(remainder);
+}
+
+static int32_t Compare(const WideInteger& left, const WideInteger& right)
+{
+    for (int32_t i = WideLimbs - 1; i >= 0; i--)
+    {
+        if (left.Limbs[i] != right.Limbs[i])
+            return left.Limbs[i] < right.Limbs[i] ? -1 : 1;
+    }
+
+    return 0;
+}
+
+static void Add(WideInteger& left, const WideInteger& right)
+{
+    uint64_t carry = 0U;
+
+    for (int32_t i = 0; i < WideLimbs; i++)
+    {
+        const uint64_t sum = static_cast<uint64_t>(left.Limbs[i]) + right.Limbs[i] + carry;
+        left.Limbs[i] = static_cast<uint32_t>(sum);
+        carry = sum >> 32;
+    }
+}
+
+// Subtracts right from left, left must not be less than right
+static void Subtract(WideInteger& left, const WideInteger& right)
+{
+    uint64_t borrow = 0U;
+
+    for (int32_t i = 0; i < WideLimbs; i++)
+    {
+        const uint64_t difference = static_cast<uint64_t>(left.Limbs[i]) - right.Limbs[i] - borrow;
+        left.Limbs[i] = static_cast<uint32_t>(difference);
+        borrow = difference >> 63;
+    }
+}
+
+// Scales the value with the smaller scale so both share a common scale, which is returned
+static int32_t Align(WideInteger& left, const int32_t leftScale, WideInteger& right, const int32_t rightScale)
+{
+    if (leftScale < rightScale)
+    {
+        ScaleUp(left, rightScale - leftScale);
+        return rightScale;
+    }
+
+    if (rightScale < leftScale)
+        ScaleUp(right, leftScale - rightScale);
+
+    return leftScale;
+}
+
+// Drops trailing zeros until value fits a coefficient with a valid scale,
+// returns false when value cannot be represented without rounding
+static bool Normalize(WideInteger& value, int32_t& scale)
+{
+    constexpr int32_t maxScale = Decimal128::MaxScale;
+
+    if (IsZero(value))
+    {
+        scale = min(scale, maxScale);
+        return true;
+    }
+
+    while (scale > 0 && (scale > maxScale || !FitsCoefficient(value)))
+    {
+        WideInteger quotient = value;
+
+        if (Divide(quotient, 10U) != 0U)
+            break;
+
+        value = quotient;
+        scale--;
+    }
+
+    return scale <= maxScale && FitsCoefficient(value);
+}
+
+Decimal128::Decimal128() :
+    m_low(0U),
+    m_middle(0U),
+    m_high(0U),
+    m_scale(0U),
+    m_negative(false)
+{
+}
+
+Decimal128::Decimal128(const int32_t value) :
+    Decimal128(static_cast<int64_t>(value))
+{
+}
+
+Decimal128::Decimal128(const int64_t value) :
+    m_high(0U),
+    m_scale(0U),
+    m_negative(value < 0)
+{
+    const uint64_t magnitude = m_negative ? 0U - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+
+    m_low = static_cast<uint32_t>(magnitude);
+    m_middle = static_cast<uint32_t>(magnitude >> 32);
+}
+
+Decimal128::Decimal128(const uint32_t low, const uint32_t middle, const uint32_t high, const int32_t scale, const bool negative) :
+    m_low(low),
+    m_middle(middle),
+    m_high(high),
+    m_scale(static_cast<uint8_t>(scale)),
+    m_negative(negative && !(low == 0U && middle == 0U && high == 0U))
+{
+}
+
+int32_t Decimal128::Scale() const
+{
+    return m_scale;
+}
+
+bool Decimal128::IsNegative() const
+{
+    return m_negative;
+}
+
+bool Decimal128::IsZero() const
+{
+    return m_low == 0U && m_middle == 0U && m_high == 0U;
+}
+
+decimal_t Decimal128::ToDecimal() const
+{
+    return decimal_t(ToString());
+}
+
+string Decimal128::ToString() const
+{
+    WideInteger value = ToWide(m_low, m_middle, m_high);
+    char digits[MaxScale + 8];
+    int32_t count = 0;
+
+    // Extract digits, least significant first, nine at a time
+    while (!::IsZero(value))
+    {
+        uint32_t chunk = Divide(value, Powers10[9]);
+        const bool last = ::IsZero(value);
+
+        for (int32_t i = 0; i < 9 && !(last && chunk == 0U); i++)
+        {
+            digits[count++] = static_cast<char>('0' + chunk % 10U);
+            chunk /= 10U;
+        }
+    }
+
+    // Pad with zeros so there is always an integer digit
+    while (count <= m_scale)
+        digits[count++] = '0';
+
+    string result;
+    result.reserve(count + 2);
+
+    if (m_negative)
+        result.push_back('-');
+
+    for (int32_t i = count - 1; i >= 0; i--)
+    {
+        result.push_back(digits[i]);
+
+        if (i == m_scale && i > 0)
+            result.push_back('.');
+    }
+
+    return result;
+}
+
+Decimal128 Decimal128::operator-() const
+{
+    return Decimal128(m_low, m_middle, m_high, m_scale, !m_negative);
+}
+
+bool Decimal128::operator==(const Decimal128& other) const
+{
+    return Compare(*this, other) == 0;
+}
+
+bool Decimal128::operator!=(const Decimal128& other) const
+{
+    return Compare(*this, other) != 0;
+}
+
+bool Decimal128::operator<(const Decimal128& other) const
+{
+    return Compare(*this, other) < 0;
+}
+
+bool Decimal128::operator<=(const Decimal128& other) const
+{
+    return Compare(*this, other) <= 0;
+}
+
+bool Decimal128::operator>(const Decimal128& other) const
+{
+    return Compare(*this, other) > 0;
+}
+
+bool Decimal128::operator>=(const Decimal128& other) const
+{
+    return Compare(*this, other) >= 0;
+}
+
+int32_t Decimal128::Compare(const Decimal128& left, const Decimal128& right)
+{
+    // Zero values are never negative, so differing signs decide the result
+    if (left.m_negative != right.m_negative)
+        return left.m_negative ? -1 : 1;
+
+    int32_t result;
+
+    if (left.m_scale == right.m_scale)
+    {
+        if (left.m_high != right.m_high)
+            result = left.m_high < right.m_high ? -1 : 1;
+        else if (left.m_middle != right.m_middle)
+            result = left.m_middle < right.m_middle ? -1 : 1;
+        else if (left.m_low != right.m_low)
+            result = left.m_low < right.m_low ? -1 : 1;
+        else
+            result = 0;
+    }
+    else
+    {
+        WideInteger leftValue = ToWide(left.m_low, left.m_middle, left.m_high);
+        WideInteger rightValue = ToWide(right.m_low, right.m_middle, right.m_high);
+
+        Align(leftValue, left.m_scale, rightValue, right.m_scale);
+        result = ::Compare(leftValue, rightValue);
+    }
+
+    return left.m_negative ? -result : result;
+}
+
+bool Decimal128::TryAdd(const Decimal128& left, const Decimal128& right, Decimal128& result)
+{
+    WideInteger leftValue = ToWide(left.m_low, left.m_middle, left.m_high);
+    WideInteger rightValue = ToWide(right.m_low, right.m_middle, right.m_high);
+    int32_t scale = Align(leftValue, left.m_scale, rightValue, right.m_scale);
+    bool negative = left.m_negative;
+
+    if (left.m_negative == right.m_negative)
+    {
+        Add(leftValue, rightValue);
+    }
+    else if (::Compare(leftValue, rightValue) >= 0)
+    {
+        Subtract(leftValue, rightValue);
+    }
+    else
+    {
+        Subtract(rightValue, leftValue);
+        leftValue = rightValue;
+        negative = right.m_negative;
+    }
+
+    if (!Normalize(leftValue, scale))
+        return false;
+
+    result = Decimal128(leftValue.Limbs[0], leftValue.Limbs[1], leftValue.Limbs[2], scale, negative);
+    return true;
+}
+
+bool Decimal128::TrySubtract(const Decimal128& left, const Decimal128& right, Decimal128& result)
+{
+    return TryAdd(left, -right, result);
+}
+
+bool Decimal128::TryMultiply(const Decimal128& left, const Decimal128& right, Decimal128& result)
+{
+    const uint32_t leftLimbs[] = { left.m_low, left.m_middle, left.m_high };
+    const uint32_t rightLimbs[] = { right.m_low, right.m_middle, right.m_high };
+    WideInteger product = ToWide(0U, 0U, 0U);
+
+    for (int32_t i = 0; i < 3; i++)
+    {
+        uint64_t carry = 0U;
+
+        for (int32_t j = 0; j < 3; j++)
+        {
+            const uint64_t partial = static_cast<uint64_t>(leftLimbs[i]) * rightLimbs[j] + product.Limbs[i + j] + carry;
+            product.Limbs[i + j] = static_cast<uint32_t>(partial);
+            carry = partial >> 32;
+        }
+
+        product.Limbs[i + 3] = static_cast<uint32_t>(carry);
+    }
+
+    int32_t scale = left.m_scale + right.m_scale;
+
+    if (!Normalize(product, scale))
+        return false;
+
+    result = Decimal128(product.Limbs[0], product.Limbs[1], product.Limbs[2], scale, left.m_negative != right.m_negative);
+    return true;
+}
+
+bool Decimal128::TryParse(const string& text, Decimal128& result)
+{
+    const size_t length = text.size();
+    size_t index = 0;
+    bool negative = false;
+
+    if (index < length && (text[index] == '-' || text[index] == '+'))
+        negative = text[index++] == '-';
+
+    WideInteger coefficient = ToWide(0U, 0U, 0U);
+    int32_t significantDigits = 0;
+    int32_t fractionDigits = 0;
+    bool hasDigits = false;
+    bool hasPoint = false;
+
+    for (; index < length; index++)
+    {
+        const char digit = text[index];
+
+        if (digit >= '0' && digit <= '9')
+        {
+            if ((digit != '0' || significantDigits > 0) && ++significantDigits > MaxWideDigits)
+                return false;
+
+            MultiplyAdd(coefficient, 10U, static_cast<uint32_t>(digit - '0'));
+            hasDigits = true;
+
+            if (hasPoint)
+                fractionDigits++;
+        }
+        else if (digit == '.' && !hasPoint)
+        {
+            hasPoint = true;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (!hasDigits)
+        return false;
+
+    int32_t exponent = 0;
+
+    if (index < length && (text[index] == 'e' || text[index] == 'E'))
+    {
+        bool negativeExponent = false;
+
+        if (++index < length && (text[index] == '-' || text[index] == '+'))
+            negativeExponent = text[index++] == '-';
+
+        const size_t start = index;
+
+        for (; index < length && text[index] >= '0' && text[index] <= '9'; index++)
+        {
+            if (index - start >= 4)
+                return false;
+
+            exponent = exponent * 10 + (text[index] - '0');
+        }
+
+        if (index == start)
+            return false;
+
+        if (negativeExponent)
+            exponent = -exponent;
+    }
+
+    if (index != length)
+        return false;
+
+    int32_t scale = fractionDigits - exponent;
+
+    if (::IsZero(coefficient))
+    {
+        scale = 0;
+    }
+    else if (scale < 0)
+    {
+        if (-scale > MaxWideDigits || !ScaleUp(coefficient, -scale))
+            return false;
+
+        scale = 0;
+    }
+
+    if (!Normalize(coefficient, scale))
+        return false;
+
+    result = Decimal128(coefficient.Limbs[0], coefficient.Limbs[1], coefficient.Limbs[2], scale, negative);
+    return true;
+}
+
+bool Decimal128::TryConvert(const decimal_t& value, Decimal128& result)
+{
+    return TryParse(value.str(), result);
+}
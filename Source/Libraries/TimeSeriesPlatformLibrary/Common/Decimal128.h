@@ -0,0 +1,93 @@
+//******************************************************************************************************
+//  Decimal128.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __DECIMAL128_H
+#define __DECIMAL128_H
+
+#include "CommonTypes.h"
+
+namespace GSF
+{
+    // Compact fixed-point decimal with the range of the .NET decimal type, i.e., a 96-bit
+    // coefficient scaled by a power of ten from 0 to 28. Operations are exact, those whose
+    // result cannot be represented fail so callers can fall back on arbitrary precision decimal_t.
+    class Decimal128
+    {
+    private:
+        uint32_t m_low;
+        uint32_t m_middle;
+        uint32_t m_high;
+        uint8_t m_scale;
+        bool m_negative;
+
+        Decimal128(uint32_t low, uint32_t middle, uint32_t high, int32_t scale, bool negative);
+
+    public:
+        // Maximum number of fractional digits
+        static constexpr int32_t MaxScale = 28;
+
+        // Creates a new zero valued instance
+        Decimal128();
+
+        // Creates a new instance from an integer value
+        Decimal128(int32_t value);
+        Decimal128(int64_t value);
+
+        int32_t Scale() const;
+        bool IsNegative() const;
+        bool IsZero() const;
+
+        // Gets value as an arbitrary precision decimal
+        decimal_t ToDecimal() const;
+
+        // Gets value as text retaining all scaled digits, e.g., "-12.340"
+        std::string ToString() const;
+
+        Decimal128 operator-() const;
+
+        bool operator==(const Decimal128& other) const;
+        bool operator!=(const Decimal128& other) const;
+        bool operator<(const Decimal128& other) const;
+        bool operator<=(const Decimal128& other) const;
+        bool operator>(const Decimal128& other) const;
+        bool operator>=(const Decimal128& other) const;
+
+        // Compares two values numerically, ignoring scale, returns -1, 0 or 1
+        static int32_t Compare(const Decimal128& left, const Decimal128& right);
+
+        // Exact arithmetic, returns false when result cannot be represented
+        static bool TryAdd(const Decimal128& left, const Decimal128& right, Decimal128& result);
+        static bool TrySubtract(const Decimal128& left, const Decimal128& right, Decimal128& result);
+        static bool TryMultiply(const Decimal128& left, const Decimal128& right, Decimal128& result);
+
+        // Parses a decimal number with optional sign, fraction and exponent, returns
+        // false when text is malformed or value cannot be exactly represented
+        static bool TryParse(const std::string& text, Decimal128& result);
+
+        // Converts an arbitrary precision decimal, returns false when
+        // value cannot be exactly represented
+        static bool TryConvert(const decimal_t& value, Decimal128& result);
+    };
+}
+
+#endif
@@ -99,7 +99,7 @@ namespace GSF
     void ThreadSafeQueue<T>::Enqueue(T item)
     {
         ScopeLock lock(m_mutex);
-        m_queue.push(item);
+        m_queue.push(std::move(item));
         m_dataWaitHandle.notify_one();
     }
 
@@ -109,7 +109,7 @@ namespace GSF
     T ThreadSafeQueue<T>::Dequeue()
     {
         ScopeLock lock(m_mutex);
-        T item = m_queue.front();
+        T item = std::move(m_queue.front());
         m_queue.pop();
         return item;
     }
@@ -35,6 +35,11 @@ using namespace GSF::FilterExpressions;
 
 const DataRowPtr DataRow::NullPtr = nullptr;
 
+// Decimal values are stored with a leading format byte, compact
+// when value can be exactly represented, otherwise as text
+static const uint8_t CompactDecimalFormat = 0;
+static const uint8_t TextDecimalFormat = 1;
+
 DataRow::DataRow(DataTablePtr parent) :
     m_parent(std::move(parent)),
     m_values(m_parent->ColumnCount())
@@ -88,6 +93,10 @@ DataColumnPtr DataRow::ValidateColumnType(const int32_t columnIndex, DataType ta
     if (!read && column->Computed())
         throw DataSetException("Cannot assign value to DataColumn \"" + column->Name() + " for table \"" + m_parent->Name() + "\", column is computed with an expression");
 
+    // All value assignments are validated here, so any index on the column is now stale
+    if (!read)
+        m_parent->ValueChanged(columnIndex);
+
     return column;
 }
 
@@ -757,12 +766,19 @@ Nullable<decimal_t> DataRow::ValueAsDecimal(const int32_t columnIndex)
     if (column->Computed())
         return Cast<decimal_t>(GetComputedValue(column, DataType::Decimal));
 
-    const char* value = static_cast<const char*>(m_values[columnIndex]);
+    const uint8_t* value = static_cast<const uint8_t*>(m_values[columnIndex]);
 
-    if (value)
-        return decimal_t(value);
+    if (value == nullptr)
+        return nullptr;
 
-    return nullptr;
+    if (*value == CompactDecimalFormat)
+    {
+        Decimal128 compact;
+        memcpy(&compact, value + 1, sizeof(Decimal128));
+        return compact.ToDecimal();
+    }
+
+    return decimal_t(reinterpret_cast<const char*>(value + 1));
 }
 
 Nullable<decimal_t> DataRow::ValueAsDecimal(const string& columnName)
@@ -779,13 +795,26 @@ void DataRow::SetDecimalValue(const int32_t columnIndex, const Nullable<decimal_
 
     if (value.HasValue())
     {
-        // The boost decimal type has a very complex internal representation,
-        // although slower, it's safer just to store this as a string for now
+        // The boost decimal type has a very complex internal representation, so value is
+        // stored in compact form when it fits, otherwise it is stored as a string
         const string& strval = value.GetValueOrDefault().str();
-        const uint32_t length = ConvertUInt32(strval.size() + 1);
-        char* copy = static_cast<char*>(malloc(length * sizeof(char)));
-        strcpy_s(copy, length, strval.c_str());
-        m_values[columnIndex] = copy;
+        Decimal128 compact;
+
+        if (Decimal128::TryParse(strval, compact))
+        {
+            uint8_t* copy = static_cast<uint8_t*>(malloc(1 + sizeof(Decimal128)));
+            copy[0] = CompactDecimalFormat;
+            memcpy(copy + 1, &compact, sizeof(Decimal128));
+            m_values[columnIndex] = copy;
+        }
+        else
+        {
+            const uint32_t length = ConvertUInt32(strval.size() + 1);
+            char* copy = static_cast<char*>(malloc((length + 1) * sizeof(char)));
+            copy[0] = static_cast<char>(TextDecimalFormat);
+            strcpy_s(copy + 1, length, strval.c_str());
+            m_values[columnIndex] = copy;
+        }
     }
     else
     {
@@ -798,6 +827,22 @@ void DataRow::SetDecimalValue(const string& columnName, const Nullable<decimal_t
     SetDecimalValue(GetColumnIndex(columnName), value);
 }
 
+bool DataRow::TryGetCompactDecimal(const int32_t columnIndex, Decimal128& value)
+{
+    const DataColumnPtr& column = ValidateColumnType(columnIndex, DataType::Decimal, true);
+
+    if (column->Computed())
+        return false;
+
+    const uint8_t* storedValue = static_cast<const uint8_t*>(m_values[columnIndex]);
+
+    if (storedValue == nullptr || *storedValue != CompactDecimalFormat)
+        return false;
+
+    memcpy(&value, storedValue + 1, sizeof(Decimal128));
+    return true;
+}
+
 Nullable<GSF::Guid> DataRow::ValueAsGuid(const int32_t columnIndex)
 {
     const DataColumnPtr& column = ValidateColumnType(columnIndex, DataType::Guid, true);
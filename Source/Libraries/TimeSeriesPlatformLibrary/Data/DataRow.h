@@ -26,6 +26,7 @@
 
 #include "../Common/CommonTypes.h"
 #include "../Common/Nullable.h"
+#include "../Common/Decimal128.h"
 #include "DataColumn.h"
 
 namespace GSF {
@@ -36,6 +37,8 @@ namespace FilterExpressions
 
     class ExpressionTree;
     typedef GSF::SharedPtr<ExpressionTree> ExpressionTreePtr;
+
+    class ExpressionProgram;
 }}
 
 namespace GSF {
@@ -107,6 +110,9 @@ namespace Data
         void SetDecimalValue(int32_t columnIndex, const GSF::Nullable<GSF::decimal_t>& value);
         void SetDecimalValue(const std::string& columnName, const GSF::Nullable<GSF::decimal_t>& value);
 
+        // Gets decimal value in compact form, returns false when value is null, computed or too precise for compact form
+        bool TryGetCompactDecimal(int32_t columnIndex, GSF::Decimal128& value);
+
         GSF::Nullable<GSF::Guid> ValueAsGuid(int32_t columnIndex);
         GSF::Nullable<GSF::Guid> ValueAsGuid(const std::string& columnName);
         void SetGuidValue(int32_t columnIndex, const GSF::Nullable<GSF::Guid>& value);
@@ -155,6 +161,7 @@ namespace Data
         static const DataRowPtr NullPtr;
 
         friend class DataTable;
+        friend class GSF::FilterExpressions::ExpressionProgram;
     };
 }}
 
@@ -32,7 +32,8 @@ const DataTablePtr DataTable::NullPtr = nullptr;
 
 DataTable::DataTable(DataSetPtr parent, string name) :
     m_parent(std::move(parent)),
-    m_name(std::move(name))
+    m_name(std::move(name)),
+    m_indexCount(0)
 {
     if (m_parent == nullptr)
         throw DataSetException("DataSet parent is null");
@@ -111,6 +112,11 @@ const DataRowPtr& DataTable::Row(int32_t index)
 void DataTable::AddRow(DataRowPtr row)
 {
     m_rows.push_back(std::move(row));
+
+    ScopeLock lock(m_indexesLock);
+
+    for (auto& index : m_indexes)
+        index.second->m_valid = false;
 }
 
 DataRowPtr DataTable::CreateRow()
@@ -184,3 +190,74 @@ int32_t DataTable::RowCount() const
 {
     return ConvertInt32(m_rows.size());
 }
+
+DataTableIndexPtr DataTable::CreateIndex(const string& columnName)
+{
+    const DataColumnPtr& column = Column(columnName);
+
+    if (column == nullptr)
+        throw DataSetException("Column name \"" + columnName + "\" was not found in table \"" + m_name + "\"");
+
+    ScopeLock lock(m_indexesLock);
+    const auto iterator = m_indexes.find(column->Index());
+
+    if (iterator != m_indexes.end())
+        return iterator->second;
+
+    // Index is built on first use
+    DataTableIndexPtr index = NewSharedPtr<DataTableIndex, DataColumnPtr>(column);
+    m_indexes[column->Index()] = index;
+    m_indexCount = ConvertInt32(m_indexes.size());
+
+    return index;
+}
+
+bool DataTable::RemoveIndex(const string& columnName)
+{
+    const DataColumnPtr& column = Column(columnName);
+
+    if (column == nullptr)
+        return false;
+
+    ScopeLock lock(m_indexesLock);
+
+    if (m_indexes.erase(column->Index()) == 0)
+        return false;
+
+    m_indexCount = ConvertInt32(m_indexes.size());
+    return true;
+}
+
+bool DataTable::HasIndex(const int32_t columnIndex) const
+{
+    ScopeLock lock(m_indexesLock);
+    return m_indexes.find(columnIndex) != m_indexes.end();
+}
+
+DataTableIndexPtr DataTable::Index(const int32_t columnIndex)
+{
+    ScopeLock lock(m_indexesLock);
+    const auto iterator = m_indexes.find(columnIndex);
+
+    if (iterator == m_indexes.end())
+        return DataTableIndex::NullPtr;
+
+    DataTableIndexPtr index = iterator->second;
+
+    if (!index->m_valid)
+        index->Build(m_rows);
+
+    return index;
+}
+
+void DataTable::ValueChanged(const int32_t columnIndex)
+{
+    if (m_indexCount == 0)
+        return;
+
+    ScopeLock lock(m_indexesLock);
+    const auto iterator = m_indexes.find(columnIndex);
+
+    if (iterator != m_indexes.end())
+        iterator->second->m_valid = false;
+}
@@ -27,6 +27,8 @@
 #include "../Common/CommonTypes.h"
 #include "DataColumn.h"
 #include "DataRow.h"
+#include "DataTableIndex.h"
+#include <atomic>
 
 namespace GSF {
 namespace Data
@@ -47,6 +49,11 @@ namespace Data
         GSF::StringMap<int32_t> m_columnIndexes;
         std::vector<DataColumnPtr> m_columns;
         std::vector<DataRowPtr> m_rows;
+        std::unordered_map<int32_t, DataTableIndexPtr> m_indexes;
+        std::atomic<int32_t> m_indexCount; // Lets value changes skip the lock when nothing is indexed
+        mutable GSF::Mutex m_indexesLock;  // Tables are shared by concurrent filter evaluations
+
+        void ValueChanged(int32_t columnIndex);
 
     public:
         DataTable(DataSetPtr parent, std::string name);
@@ -82,7 +89,22 @@ namespace Data
 
         int32_t RowCount() const;
 
+        // Creates, or returns existing, hash index for the specified column. Indexes are built on
+        // first use and are rebuilt on next use after rows are added or indexed values change.
+        // Index creation and builds are synchronized, so readers of a shared table can use them.
+        DataTableIndexPtr CreateIndex(const std::string& columnName);
+
+        bool RemoveIndex(const std::string& columnName);
+
+        bool HasIndex(int32_t columnIndex) const;
+
+        // Gets current index for the specified column, or NullPtr if the column is not indexed. Index
+        // is returned by value so it remains valid if it is concurrently removed from the table.
+        DataTableIndexPtr Index(int32_t columnIndex);
+
         static const DataTablePtr NullPtr;
+
+        friend class DataRow;
     };
 
     typedef GSF::SharedPtr<DataTable> DataTablePtr;
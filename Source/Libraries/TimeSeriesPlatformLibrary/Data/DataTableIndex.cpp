@@ -0,0 +1,246 @@
+//******************************************************************************************************
+//  DataTableIndex.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#include "DataTableIndex.h"
+#include "DataSet.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+
+const DataTableIndexPtr DataTableIndex::NullPtr = nullptr;
+
+template<class TKey, class TMap>
+static const vector<int32_t>* FindRows(const TMap& rowMap, const TKey& value)
+{
+    const auto iterator = rowMap.find(value);
+
+    if (iterator == rowMap.end())
+        return nullptr;
+
+    return &iterator->second;
+}
+
+DataTableIndex::DataTableIndex(DataColumnPtr column) :
+    m_column(std::move(column)),
+    m_valid(false)
+{
+    if (m_column == nullptr)
+        throw DataSetException("DataTableIndex column is null");
+
+    if (m_column->Computed())
+        throw DataSetException("Cannot index DataColumn \"" + m_column->Name() + "\", column is computed with an expression");
+
+    if (!IsSupportedType(m_column->Type()))
+        throw DataSetException("Cannot index DataColumn \"" + m_column->Name() + "\", column data type \"" + string(EnumName(m_column->Type())) + "\" is not supported");
+}
+
+void DataTableIndex::Build(const vector<DataRowPtr>& rows)
+{
+    const int32_t columnIndex = m_column->Index();
+    const int32_t rowCount = ConvertInt32(rows.size());
+
+    m_integerRows.clear();
+    m_doubleRows.clear();
+    m_stringRows.clear();
+    m_guidRows.clear();
+
+    for (int32_t i = 0; i < rowCount; i++)
+    {
+        const DataRowPtr& row = rows[i];
+
+        if (row == nullptr)
+            continue;
+
+        // Null values never compare as equal, so they are not indexed
+        switch (m_column->Type())
+        {
+            case DataType::String:
+            {
+                const Nullable<string> value = row->ValueAsString(columnIndex);
+
+                if (value.HasValue())
+                    m_stringRows[value.GetValueOrDefault()].push_back(i);
+
+                break;
+            }
+            case DataType::Boolean:
+            {
+                const Nullable<bool> value = row->ValueAsBoolean(columnIndex);
+
+                if (value.HasValue())
+                    m_integerRows[value.GetValueOrDefault() ? 1 : 0].push_back(i);
+
+                break;
+            }
+            case DataType::Single:
+            {
+                const Nullable<float32_t> value = row->ValueAsSingle(columnIndex);
+
+                if (value.HasValue())
+                    m_doubleRows[static_cast<float64_t>(value.GetValueOrDefault())].push_back(i);
+
+                break;
+            }
+            case DataType::Double:
+            {
+                const Nullable<float64_t> value = row->ValueAsDouble(columnIndex);
+
+                if (value.HasValue())
+                    m_doubleRows[value.GetValueOrDefault()].push_back(i);
+
+                break;
+            }
+            case DataType::Guid:
+            {
+                const Nullable<Guid> value = row->ValueAsGuid(columnIndex);
+
+                if (value.HasValue())
+                    m_guidRows[value.GetValueOrDefault()].push_back(i);
+
+                break;
+            }
+            case DataType::Int8:
+            {
+                const Nullable<int8_t> value = row->ValueAsInt8(columnIndex);
+
+                if (value.HasValue())
+                    m_integerRows[value.GetValueOrDefault()].push_back(i);
+
+                break;
+            }
+            case DataType::Int16:
+            {
+                const Nullable<int16_t> value = row->ValueAsInt16(columnIndex);
+
+                if (value.HasValue())
+                    m_integerRows[value.GetValueOrDefault()].push_back(i);
+
+                break;
+            }
+            case DataType::Int32:
+            {
+                const Nullable<int32_t> value = row->ValueAsInt32(columnIndex);
+
+                if (value.HasValue())
+                    m_integerRows[value.GetValueOrDefault()].push_back(i);
+
+                break;
+            }
+            case DataType::Int64:
+            {
+                const Nullable<int64_t> value = row->ValueAsInt64(columnIndex);
+
+                if (value.HasValue())
+                    m_integerRows[value.GetValueOrDefault()].push_back(i);
+
+                break;
+            }
+            case DataType::UInt8:
+            {
+                const Nullable<uint8_t> value = row->ValueAsUInt8(columnIndex);
+
+                if (value.HasValue())
+                    m_integerRows[value.GetValueOrDefault()].push_back(i);
+
+                break;
+            }
+            case DataType::UInt16:
+            {
+                const Nullable<uint16_t> value = row->ValueAsUInt16(columnIndex);
+
+                if (value.HasValue())
+                    m_integerRows[value.GetValueOrDefault()].push_back(i);
+
+                break;
+            }
+            case DataType::UInt32:
+            {
+                const Nullable<uint32_t> value = row->ValueAsUInt32(columnIndex);
+
+                if (value.HasValue())
+                    m_integerRows[value.GetValueOrDefault()].push_back(i);
+
+                break;
+            }
+            default:
+                throw DataSetException("Unexpected column data type encountered");
+        }
+    }
+
+    m_valid = true;
+}
+
+const DataColumnPtr& DataTableIndex::Column() const
+{
+    return m_column;
+}
+
+int32_t DataTableIndex::KeyCount() const
+{
+    return ConvertInt32(m_integerRows.size() + m_doubleRows.size() + m_stringRows.size() + m_guidRows.size());
+}
+
+const vector<int32_t>* DataTableIndex::FindRowsByInteger(const int64_t value) const
+{
+    return FindRows(m_integerRows, value);
+}
+
+const vector<int32_t>* DataTableIndex::FindRowsByDouble(const float64_t value) const
+{
+    return FindRows(m_doubleRows, value);
+}
+
+const vector<int32_t>* DataTableIndex::FindRowsByString(const string& value) const
+{
+    return FindRows(m_stringRows, value);
+}
+
+const vector<int32_t>* DataTableIndex::FindRowsByGuid(const Guid& value) const
+{
+    return FindRows(m_guidRows, value);
+}
+
+bool DataTableIndex::IsSupportedType(const DataType type)
+{
+    switch (type)
+    {
+        case DataType::String:
+        case DataType::Boolean:
+        case DataType::Single:
+        case DataType::Double:
+        case DataType::Guid:
+        case DataType::Int8:
+        case DataType::Int16:
+        case DataType::Int32:
+        case DataType::Int64:
+        case DataType::UInt8:
+        case DataType::UInt16:
+        case DataType::UInt32:
+            return true;
+        default:
+            // DateTime, Decimal and UInt64 values are not indexed
+            return false;
+    }
+}
@@ -0,0 +1,76 @@
+//******************************************************************************************************
+//  DataTableIndex.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#ifndef __DATA_TABLE_INDEX_H
+#define __DATA_TABLE_INDEX_H
+
+#include "../Common/CommonTypes.h"
+#include "DataColumn.h"
+#include "DataRow.h"
+
+namespace GSF {
+namespace Data
+{
+    class DataTableIndex;
+    typedef GSF::SharedPtr<DataTableIndex> DataTableIndexPtr;
+
+    // Hash index of the rows of a table keyed by the non-null values of one column. Rows are
+    // referenced by their position in the table and are listed in ascending order for each key.
+    // Integer and boolean columns are keyed as int64_t, floating point columns as float64_t and
+    // strings are keyed without regard to case.
+    class DataTableIndex // NOLINT
+    {
+    private:
+        DataColumnPtr m_column;
+        std::unordered_map<int64_t, std::vector<int32_t>> m_integerRows;
+        std::unordered_map<GSF::float64_t, std::vector<int32_t>> m_doubleRows;
+        GSF::StringMap<std::vector<int32_t>> m_stringRows;
+        std::unordered_map<GSF::Guid, std::vector<int32_t>> m_guidRows;
+        bool m_valid;
+
+        void Build(const std::vector<DataRowPtr>& rows);
+
+    public:
+        DataTableIndex(DataColumnPtr column);
+
+        const DataColumnPtr& Column() const;
+
+        // Gets the number of distinct non-null values in the indexed column
+        int32_t KeyCount() const;
+
+        // Find functions return nullptr when no rows have the value
+        const std::vector<int32_t>* FindRowsByInteger(int64_t value) const;
+        const std::vector<int32_t>* FindRowsByDouble(GSF::float64_t value) const;
+        const std::vector<int32_t>* FindRowsByString(const std::string& value) const;
+        const std::vector<int32_t>* FindRowsByGuid(const GSF::Guid& value) const;
+
+        static bool IsSupportedType(DataType type);
+
+        static const DataTableIndexPtr NullPtr;
+
+        friend class DataTable;
+    };
+}}
+
+#endif
@@ -0,0 +1,1194 @@
+//******************************************************************************************************
+//  ExpressionProgram.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#include "ExpressionProgram.h"
+#include <algorithm>
+#include <locale>
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+using namespace GSF::FilterExpressions;
+
+typedef ExpressionProgram::OpCode OpCode;
+typedef ExpressionProgram::Register Register;
+
+// Compares characters with the same ctype facet upper-casing used by the boost case-insensitive
+// string algorithms, but resolves the facet once per operation instead of once per character
+class CharComparer
+{
+private:
+    const locale m_locale;
+    const ctype<char>& m_charType;
+    const bool m_ignoreCase;
+
+public:
+    explicit CharComparer(const bool ignoreCase) :
+        m_charType(use_facet<ctype<char>>(m_locale)),
+        m_ignoreCase(ignoreCase)
+    {
+    }
+
+    char Normalize(const char value) const
+    {
+        return m_ignoreCase ? m_charType.toupper(value) : value;
+    }
+
+    bool operator()(const char left, const char right) const
+    {
+        return Normalize(left) == Normalize(right);
+    }
+};
+
+static bool StringEquals(const char* left, const size_t leftLength, const char* right, const size_t rightLength, const bool ignoreCase)
+{
+    return leftLength == rightLength && equal(left, left + leftLength, right, CharComparer(ignoreCase));
+}
+
+static bool StringLessThan(const char* left, const size_t leftLength, const char* right, const size_t rightLength)
+{
+    const CharComparer comparer(true);
+
+    return lexicographical_compare(left, left + leftLength, right, right + rightLength, [&comparer](const char leftValue, const char rightValue)
+    {
+        return comparer.Normalize(leftValue) < comparer.Normalize(rightValue);
+    });
+}
+
+static bool StringStartsWith(const char* value, const size_t valueLength, const char* pattern, const size_t patternLength, const bool ignoreCase)
+{
+    return valueLength >= patternLength && equal(pattern, pattern + patternLength, value, CharComparer(ignoreCase));
+}
+
+static bool StringEndsWith(const char* value, const size_t valueLength, const char* pattern, const size_t patternLength, const bool ignoreCase)
+{
+    return valueLength >= patternLength && equal(pattern, pattern + patternLength, value + valueLength - patternLength, CharComparer(ignoreCase));
+}
+
+static bool StringContains(const char* value, const size_t valueLength, const char* pattern, const size_t patternLength, const bool ignoreCase)
+{
+    return search(value, value + valueLength, pattern, pattern + patternLength, CharComparer(ignoreCase)) != value + valueLength;
+}
+
+static bool IsWildcard(const char value)
+{
+    return value == '*' || value == '%';
+}
+
+template<class T, class V>
+static void LoadValue(const void* source, bool& isNull, V& value)
+{
+    const T* data = static_cast<const T*>(source);
+    isNull = data == nullptr;
+
+    if (data)
+        value = static_cast<V>(*data);
+}
+
+template<class T>
+static void SetNumericValue(Register& target, const ExpressionValueType targetValueType, const T value)
+{
+    switch (targetValueType)
+    {
+        case ExpressionValueType::Int32:
+            target.Int32Value = static_cast<int32_t>(value);
+            break;
+        case ExpressionValueType::Int64:
+            target.Int64Value = static_cast<int64_t>(value);
+            break;
+        case ExpressionValueType::Double:
+            target.DoubleValue = static_cast<float64_t>(value);
+            break;
+        default:
+            throw ExpressionTreeException("Unexpected expression value type encountered");
+    }
+}
+
+template<class T>
+static T Arithmetic(const OpCode code, const T left, const T right)
+{
+    switch (code)
+    {
+        case OpCode::Multiply:
+            return left * right;
+        case OpCode::Divide:
+            return left / right;
+        case OpCode::Add:
+            return left + right;
+        case OpCode::Subtract:
+            return left - right;
+        default:
+            throw ExpressionTreeException("Unexpected operator type encountered");
+    }
+}
+
+template<class T>
+static T IntegerArithmetic(const OpCode code, const T left, const T right)
+{
+    switch (code)
+    {
+        case OpCode::Modulus:
+            return left % right;
+        case OpCode::BitwiseAnd:
+            return left & right;
+        case OpCode::BitwiseOr:
+            return left | right;
+        case OpCode::BitwiseXor:
+            return left ^ right;
+        default:
+            return Arithmetic<T>(code, left, right);
+    }
+}
+
+static void EvaluateArithmetic(const OpCode code, const Register& left, const Register& right, Register& target)
+{
+    // If left or right value is Null, result is Null
+    target.IsNull = left.IsNull || right.IsNull;
+
+    if (target.IsNull)
+        return;
+
+    switch (target.ValueType)
+    {
+        case ExpressionValueType::Int32:
+            target.Int32Value = IntegerArithmetic<int32_t>(code, left.Int32Value, right.Int32Value);
+            break;
+        case ExpressionValueType::Int64:
+            target.Int64Value = IntegerArithmetic<int64_t>(code, left.Int64Value, right.Int64Value);
+            break;
+        case ExpressionValueType::Double:
+            target.DoubleValue = Arithmetic<float64_t>(code, left.DoubleValue, right.DoubleValue);
+            break;
+        default:
+            throw ExpressionTreeException("Unexpected expression value type encountered");
+    }
+}
+
+template<class T>
+static bool CompareOrdered(const OpCode code, const T& left, const T& right)
+{
+    switch (code)
+    {
+        case OpCode::LessThan:
+            return left < right;
+        case OpCode::LessThanOrEqual:
+            return left <= right;
+        case OpCode::GreaterThan:
+            return left > right;
+        case OpCode::GreaterThanOrEqual:
+            return left >= right;
+        case OpCode::Equal:
+            return left == right; //-V550
+        case OpCode::NotEqual:
+            return left != right; //-V550
+        default:
+            throw ExpressionTreeException("Unexpected operator type encountered");
+    }
+}
+
+static bool CompareStrings(const OpCode code, const Register& left, const Register& right, const bool exactMatch)
+{
+    // Ordering is always case-insensitive, matching GSF::Compare
+    switch (code)
+    {
+        case OpCode::LessThan:
+            return StringLessThan(left.StringValue, left.StringLength, right.StringValue, right.StringLength);
+        case OpCode::LessThanOrEqual:
+            return !StringLessThan(right.StringValue, right.StringLength, left.StringValue, left.StringLength);
+        case OpCode::GreaterThan:
+            return StringLessThan(right.StringValue, right.StringLength, left.StringValue, left.StringLength);
+        case OpCode::GreaterThanOrEqual:
+            return !StringLessThan(left.StringValue, left.StringLength, right.StringValue, right.StringLength);
+        case OpCode::Equal:
+            return StringEquals(left.StringValue, left.StringLength, right.StringValue, right.StringLength, !exactMatch);
+        case OpCode::NotEqual:
+            return !StringEquals(left.StringValue, left.StringLength, right.StringValue, right.StringLength, !exactMatch);
+        default:
+            throw ExpressionTreeException("Unexpected operator type encountered");
+    }
+}
+
+static void EvaluateComparison(const OpCode code, const Register& left, const Register& right, const bool exactMatch, Register& target)
+{
+    // If left or right value is Null, result is Null
+    target.IsNull = left.IsNull || right.IsNull;
+
+    if (target.IsNull)
+        return;
+
+    // Operands have already been converted to the comparison value type
+    switch (left.ValueType)
+    {
+        case ExpressionValueType::Boolean:
+            target.BooleanValue = CompareOrdered(code, left.BooleanValue, right.BooleanValue);
+            break;
+        case ExpressionValueType::Int32:
+            target.BooleanValue = CompareOrdered(code, left.Int32Value, right.Int32Value);
+            break;
+        case ExpressionValueType::Int64:
+            target.BooleanValue = CompareOrdered(code, left.Int64Value, right.Int64Value);
+            break;
+        case ExpressionValueType::Double:
+            target.BooleanValue = CompareOrdered(code, left.DoubleValue, right.DoubleValue);
+            break;
+        case ExpressionValueType::String:
+            target.BooleanValue = CompareStrings(code, left, right, exactMatch);
+            break;
+        case ExpressionValueType::Guid:
+            target.BooleanValue = CompareOrdered(code, left.GuidValue, right.GuidValue);
+            break;
+        case ExpressionValueType::DateTime:
+            target.BooleanValue = CompareOrdered(code, left.DateTimeValue, right.DateTimeValue);
+            break;
+        default:
+            throw ExpressionTreeException("Unexpected expression value type encountered");
+    }
+}
+
+static bool InListContains(const InListSet& inListSet, const Register& value)
+{
+    switch (value.ValueType)
+    {
+        case ExpressionValueType::Boolean:
+            return inListSet.ContainsInteger(value.BooleanValue ? 1 : 0);
+        case ExpressionValueType::Int32:
+            return inListSet.ContainsInteger(value.Int32Value);
+        case ExpressionValueType::Int64:
+            return inListSet.ContainsInteger(value.Int64Value);
+        case ExpressionValueType::Double:
+            return inListSet.ContainsDouble(value.DoubleValue);
+        case ExpressionValueType::String:
+            return inListSet.ContainsString(string(value.StringValue, value.StringLength));
+        case ExpressionValueType::Guid:
+            return inListSet.ContainsGuid(value.GuidValue);
+        default:
+            throw ExpressionTreeException("Unexpected expression value type encountered");
+    }
+}
+
+ExpressionProgram::Register::Register(const ExpressionValueType valueType) :
+    ValueType(valueType),
+    IsNull(true),
+    Int64Value(0LL),
+    StringValue(nullptr),
+    StringLength(0),
+    GuidValue(Empty::Guid),
+    DateTimeValue(Empty::DateTime)
+{
+}
+
+ExpressionProgram::ExpressionProgram() :
+    m_resultRegister(-1)
+{
+}
+
+int32_t ExpressionProgram::AddRegister(const ExpressionValueType valueType, const bool constant)
+{
+    const int32_t index = static_cast<int32_t>(m_registers.size());
+
+    m_registers.emplace_back(valueType);
+    m_constantRegisters.push_back(constant);
+    m_unstableRegisters.push_back(false);
+
+    return index;
+}
+
+void ExpressionProgram::Emit(const OpCode code, const ExpressionValueType valueType, const int32_t target, const int32_t left, const int32_t right, const int32_t operand, const bool flag)
+{
+    m_instructions.push_back({ code, valueType, flag, target, left, right, operand });
+}
+
+int32_t ExpressionProgram::CompileExpression(const ExpressionTree& tree, const ExpressionPtr& expression)
+{
+    if (expression == nullptr)
+        return -1;
+
+    switch (expression->Type)
+    {
+        case ExpressionType::Value:
+            return CompileValue(CastSharedPtr<ValueExpression>(expression));
+        case ExpressionType::Unary:
+            return CompileUnary(tree, CastSharedPtr<UnaryExpression>(expression));
+        case ExpressionType::Column:
+            return CompileColumn(CastSharedPtr<ColumnExpression>(expression));
+        case ExpressionType::InList:
+            return CompileInList(tree, CastSharedPtr<InListExpression>(expression));
+        case ExpressionType::Operator:
+            return CompileOperator(tree, CastSharedPtr<OperatorExpression>(expression));
+        default:
+            // Functions are left to the interpreter
+            return -1;
+    }
+}
+
+int32_t ExpressionProgram::CompileOperand(const ExpressionTree& tree, const ExpressionPtr& expression, const bool allowUnstable)
+{
+    const int32_t operand = CompileExpression(tree, expression);
+
+    // Operand value types must be known at compile time unless operation validates type at run-time
+    if (operand < 0 || (m_unstableRegisters[operand] && !allowUnstable))
+        return -1;
+
+    return operand;
+}
+
+int32_t ExpressionProgram::CompileValue(const ValueExpressionPtr& valueExpression)
+{
+    const ExpressionValueType valueType = valueExpression->ValueType;
+
+    // Undefined NULL literals evaluate to a Null of the default Boolean target type
+    if (valueType == ExpressionValueType::Undefined)
+        return AddRegister(ExpressionValueType::Boolean, true);
+
+    if (valueType == ExpressionValueType::Decimal)
+        return -1;
+
+    const int32_t index = AddRegister(valueType, true);
+
+    if (valueExpression->IsNull())
+        return index;
+
+    Register& value = m_registers[index];
+    value.IsNull = false;
+
+    switch (valueType)
+    {
+        case ExpressionValueType::Boolean:
+            value.BooleanValue = valueExpression->ValueAsBoolean();
+            break;
+        case ExpressionValueType::Int32:
+            value.Int32Value = valueExpression->ValueAsInt32();
+            break;
+        case ExpressionValueType::Int64:
+            value.Int64Value = valueExpression->ValueAsInt64();
+            break;
+        case ExpressionValueType::Double:
+            value.DoubleValue = valueExpression->ValueAsDouble();
+            break;
+        case ExpressionValueType::String:
+            m_strings.push_back(valueExpression->ValueAsString());
+            value.StringValue = m_strings.back().c_str();
+            value.StringLength = m_strings.back().size();
+            break;
+        case ExpressionValueType::Guid:
+            value.GuidValue = valueExpression->ValueAsGuid();
+            break;
+        case ExpressionValueType::DateTime:
+            value.DateTimeValue = valueExpression->ValueAsDateTime();
+            break;
+        default:
+            return -1;
+    }
+
+    return index;
+}
+
+int32_t ExpressionProgram::CompileUnary(const ExpressionTree& tree, const UnaryExpressionPtr& unaryExpression)
+{
+    const int32_t value = CompileOperand(tree, unaryExpression->Value);
+
+    if (value < 0)
+        return -1;
+
+    const ExpressionValueType valueType = m_registers[value].ValueType;
+    const ExpressionUnaryType unaryType = unaryExpression->UnaryType;
+    OpCode code;
+
+    switch (valueType)
+    {
+        case ExpressionValueType::Boolean:
+            if (unaryType != ExpressionUnaryType::Not)
+                return -1;
+
+            code = OpCode::Not;
+            break;
+        case ExpressionValueType::Int32:
+        case ExpressionValueType::Int64:
+            if (unaryType == ExpressionUnaryType::Plus)
+                return value;
+
+            code = unaryType == ExpressionUnaryType::Minus ? OpCode::Negate : OpCode::Complement;
+            break;
+        case ExpressionValueType::Double:
+            if (unaryType == ExpressionUnaryType::Plus)
+                return value;
+
+            if (unaryType != ExpressionUnaryType::Minus)
+                return -1;
+
+            code = OpCode::Negate;
+            break;
+        default:
+            return -1;
+    }
+
+    const int32_t target = AddRegister(valueType);
+    Emit(code, valueType, target, value);
+
+    return target;
+}
+
+int32_t ExpressionProgram::CompileColumn(const ColumnExpressionPtr& columnExpression)
+{
+    const DataColumnPtr& column = columnExpression->DataColumn;
+
+    // Computed columns are evaluated through their own expression trees
+    if (column == nullptr || column->Computed())
+        return -1;
+
+    ExpressionValueType valueType;
+    OpCode code;
+
+    // Map column DataType to ExpressionValueType, matching ExpressionTree::EvaluateColumn
+    switch (column->Type())
+    {
+        case DataType::String:
+            valueType = ExpressionValueType::String;
+            code = OpCode::LoadString;
+            break;
+        case DataType::Boolean:
+            valueType = ExpressionValueType::Boolean;
+            code = OpCode::LoadBoolean;
+            break;
+        case DataType::DateTime:
+            valueType = ExpressionValueType::DateTime;
+            code = OpCode::LoadDateTime;
+            break;
+        case DataType::Single:
+            valueType = ExpressionValueType::Double;
+            code = OpCode::LoadSingle;
+            break;
+        case DataType::Double:
+            valueType = ExpressionValueType::Double;
+            code = OpCode::LoadDouble;
+            break;
+        case DataType::Guid:
+            valueType = ExpressionValueType::Guid;
+            code = OpCode::LoadGuid;
+            break;
+        case DataType::Int8:
+            valueType = ExpressionValueType::Int32;
+            code = OpCode::LoadInt8;
+            break;
+        case DataType::Int16:
+            valueType = ExpressionValueType::Int32;
+            code = OpCode::LoadInt16;
+            break;
+        case DataType::Int32:
+            valueType = ExpressionValueType::Int32;
+            code = OpCode::LoadInt32;
+            break;
+        case DataType::UInt8:
+            valueType = ExpressionValueType::Int32;
+            code = OpCode::LoadUInt8;
+            break;
+        case DataType::UInt16:
+            valueType = ExpressionValueType::Int32;
+            code = OpCode::LoadUInt16;
+            break;
+        case DataType::Int64:
+            valueType = ExpressionValueType::Int64;
+            code = OpCode::LoadInt64;
+            break;
+        case DataType::UInt32:
+            valueType = ExpressionValueType::Int64;
+            code = OpCode::LoadUInt32;
+            break;
+        default:
+            // UInt64 value type depends on value and Decimal is not supported
+            return -1;
+    }
+
+    const int32_t target = AddRegister(valueType);
+    Emit(code, valueType, target, -1, -1, column->Index());
+
+    return target;
+}
+
+int32_t ExpressionProgram::CompileInList(const ExpressionTree& tree, const InListExpressionPtr& inListExpression)
+{
+    const int32_t value = CompileOperand(tree, inListExpression->Value);
+
+    if (value < 0)
+        return -1;
+
+    const ExpressionValueType valueType = m_registers[value].ValueType;
+    const int32_t target = AddRegister(ExpressionValueType::Boolean);
+    const int32_t start = static_cast<int32_t>(m_instructions.size());
+    vector<int32_t> matches;
+
+    // Null test value results in a Null of the test value type
+    m_unstableRegisters[target] = valueType != ExpressionValueType::Boolean;
+
+    // Use hashed lookup when tree prepared a set of constant arguments
+    const auto inListSet = tree.m_inListSets.find(inListExpression.get());
+
+    if (inListSet != tree.m_inListSets.end() && inListSet->second->ValueType == valueType)
+    {
+        Emit(OpCode::InListLookup, ExpressionValueType::Boolean, target, value, -1, static_cast<int32_t>(m_inListSets.size()), inListExpression->HasNotKeyword);
+        m_inListSets.push_back(inListSet->second);
+        return target;
+    }
+
+    Emit(OpCode::InListStart, ExpressionValueType::Boolean, target, value);
+
+    for (const ExpressionPtr& argument : *inListExpression->Arguments)
+    {
+        const int32_t argumentValue = CompileOperand(tree, argument);
+
+        if (argumentValue < 0)
+            return -1;
+
+        ExpressionValueType comparisonValueType;
+
+        try
+        {
+            comparisonValueType = tree.DeriveComparisonOperationValueType(ExpressionOperatorType::Equal, valueType, m_registers[argumentValue].ValueType);
+        }
+        catch (const ExpressionTreeException&)
+        {
+            return -1;
+        }
+
+        const int32_t left = CompileConvert(value, comparisonValueType, argumentValue);
+        const int32_t right = CompileConvert(argumentValue, comparisonValueType, value);
+
+        if (left < 0 || right < 0)
+            return -1;
+
+        const int32_t result = AddRegister(ExpressionValueType::Boolean);
+        Emit(OpCode::Equal, ExpressionValueType::Boolean, result, left, right, -1, inListExpression->ExactMatch);
+
+        matches.push_back(static_cast<int32_t>(m_instructions.size()));
+        Emit(OpCode::InListMatch, ExpressionValueType::Boolean, target, result);
+    }
+
+    const int32_t end = static_cast<int32_t>(m_instructions.size());
+    Emit(OpCode::InListEnd, ExpressionValueType::Boolean, target, -1, -1, -1, inListExpression->HasNotKeyword);
+
+    // Null test values skip the list, matches jump to final NOT handling
+    m_instructions[start].Operand = end + 1;
+
+    for (const int32_t match : matches)
+        m_instructions[match].Operand = end;
+
+    return target;
+}
+
+int32_t ExpressionProgram::CompileOperator(const ExpressionTree& tree, const OperatorExpressionPtr& operatorExpression)
+{
+    const ExpressionOperatorType operatorType = operatorExpression->OperatorType;
+    const bool booleanOperation = operatorType == ExpressionOperatorType::And || operatorType == ExpressionOperatorType::Or;
+    const bool nullOperation = operatorType == ExpressionOperatorType::IsNull || operatorType == ExpressionOperatorType::IsNotNull;
+    const int32_t left = CompileOperand(tree, operatorExpression->LeftValue, booleanOperation || nullOperation);
+
+    if (left < 0)
+        return -1;
+
+    if (nullOperation)
+    {
+        const int32_t target = AddRegister(ExpressionValueType::Boolean);
+        Emit(operatorType == ExpressionOperatorType::IsNull ? OpCode::IsNull : OpCode::IsNotNull, ExpressionValueType::Boolean, target, left);
+        return target;
+    }
+
+    const int32_t right = CompileOperand(tree, operatorExpression->RightValue, booleanOperation);
+
+    if (right < 0)
+        return -1;
+
+    const ExpressionValueType leftValueType = m_registers[left].ValueType;
+    const ExpressionValueType rightValueType = m_registers[right].ValueType;
+    ExpressionValueType valueType;
+
+    try
+    {
+        valueType = tree.DeriveOperationValueType(operatorType, leftValueType, rightValueType);
+    }
+    catch (const ExpressionTreeException&)
+    {
+        return -1;
+    }
+
+    ExpressionValueType resultValueType = ExpressionValueType::Boolean;
+    bool arithmetic = true;
+    bool exactMatch = false;
+    OpCode code;
+
+    switch (operatorType)
+    {
+        case ExpressionOperatorType::Multiply:
+            code = OpCode::Multiply;
+            resultValueType = valueType;
+            break;
+        case ExpressionOperatorType::Divide:
+            code = OpCode::Divide;
+            resultValueType = valueType;
+            break;
+        case ExpressionOperatorType::Modulus:
+            code = OpCode::Modulus;
+            resultValueType = valueType;
+            break;
+        case ExpressionOperatorType::Add:
+            code = OpCode::Add;
+            resultValueType = valueType;
+            break;
+        case ExpressionOperatorType::Subtract:
+            code = OpCode::Subtract;
+            resultValueType = valueType;
+            break;
+        case ExpressionOperatorType::BitwiseAnd:
+            code = OpCode::BitwiseAnd;
+            resultValueType = valueType;
+            break;
+        case ExpressionOperatorType::BitwiseOr:
+            code = OpCode::BitwiseOr;
+            resultValueType = valueType;
+            break;
+        case ExpressionOperatorType::BitwiseXor:
+            code = OpCode::BitwiseXor;
+            resultValueType = valueType;
+            break;
+        case ExpressionOperatorType::LessThan:
+            code = OpCode::LessThan;
+            arithmetic = false;
+            break;
+        case ExpressionOperatorType::LessThanOrEqual:
+            code = OpCode::LessThanOrEqual;
+            arithmetic = false;
+            break;
+        case ExpressionOperatorType::GreaterThan:
+            code = OpCode::GreaterThan;
+            arithmetic = false;
+            break;
+        case ExpressionOperatorType::GreaterThanOrEqual:
+            code = OpCode::GreaterThanOrEqual;
+            arithmetic = false;
+            break;
+        case ExpressionOperatorType::Equal:
+        case ExpressionOperatorType::EqualExactMatch:
+            code = OpCode::Equal;
+            exactMatch = operatorType == ExpressionOperatorType::EqualExactMatch;
+            arithmetic = false;
+            break;
+        case ExpressionOperatorType::NotEqual:
+        case ExpressionOperatorType::NotEqualExactMatch:
+            code = OpCode::NotEqual;
+            exactMatch = operatorType == ExpressionOperatorType::NotEqualExactMatch;
+            arithmetic = false;
+            break;
+        case ExpressionOperatorType::Like:
+        case ExpressionOperatorType::LikeExactMatch:
+            code = OpCode::Like;
+            exactMatch = operatorType == ExpressionOperatorType::LikeExactMatch;
+            arithmetic = false;
+            break;
+        case ExpressionOperatorType::NotLike:
+        case ExpressionOperatorType::NotLikeExactMatch:
+            code = OpCode::NotLike;
+            exactMatch = operatorType == ExpressionOperatorType::NotLikeExactMatch;
+            arithmetic = false;
+            break;
+        case ExpressionOperatorType::And:
+            code = OpCode::And;
+            arithmetic = false;
+            break;
+        case ExpressionOperatorType::Or:
+            code = OpCode::Or;
+            arithmetic = false;
+            break;
+        default:
+            // Bit shifts are left to the interpreter
+            return -1;
+    }
+
+    int32_t leftOperand = left;
+    int32_t rightOperand = right;
+
+    switch (code)
+    {
+        case OpCode::Like:
+        case OpCode::NotLike:
+            if (leftValueType != ExpressionValueType::String || rightValueType != ExpressionValueType::String)
+                return -1;
+
+            break;
+        case OpCode::And:
+        case OpCode::Or:
+            break;
+        default:
+            // Arithmetic on Boolean and Decimal, String concatenation and Decimal comparisons are left to the interpreter
+            if (arithmetic && valueType != ExpressionValueType::Int32 && valueType != ExpressionValueType::Int64 && valueType != ExpressionValueType::Double)
+                return -1;
+
+            if (valueType == ExpressionValueType::Decimal || valueType == ExpressionValueType::Undefined)
+                return -1;
+
+            // Each conversion is guarded by the opposite operand so that a Null on either
+            // side produces a Null result without attempting a conversion, as interpreted
+            leftOperand = CompileConvert(left, valueType, right);
+            rightOperand = CompileConvert(right, valueType, left);
+
+            if (leftOperand < 0 || rightOperand < 0)
+                return -1;
+
+            break;
+    }
+
+    const int32_t target = AddRegister(resultValueType);
+    Emit(code, resultValueType, target, leftOperand, rightOperand, -1, exactMatch);
+
+    return target;
+}
+
+int32_t ExpressionProgram::CompileConvert(const int32_t source, const ExpressionValueType targetValueType, const int32_t guard)
+{
+    const Register value = m_registers[source];
+
+    if (value.ValueType == targetValueType)
+        return source;
+
+    // Constant conversions are folded, Null constants convert to a Null of any type
+    if (m_constantRegisters[source])
+    {
+        if (!value.IsNull && !IsSupportedConversion(value.ValueType, targetValueType))
+            return -1;
+
+        const int32_t target = AddRegister(targetValueType, true);
+
+        try
+        {
+            ConvertRegister(value, m_registers[target], targetValueType);
+        }
+        catch (...)
+        {
+            // Conversion will fail at run-time, leave exception handling to the interpreter
+            return -1;
+        }
+
+        return target;
+    }
+
+    if (!IsSupportedConversion(value.ValueType, targetValueType))
+        return -1;
+
+    const int32_t target = AddRegister(targetValueType);
+    Emit(OpCode::Convert, targetValueType, target, source, guard);
+
+    return target;
+}
+
+bool ExpressionProgram::IsSupportedConversion(const ExpressionValueType sourceValueType, const ExpressionValueType targetValueType)
+{
+    switch (sourceValueType)
+    {
+        case ExpressionValueType::Boolean:
+        case ExpressionValueType::Int32:
+            return targetValueType == ExpressionValueType::Int32 || targetValueType == ExpressionValueType::Int64 || targetValueType == ExpressionValueType::Double;
+        case ExpressionValueType::Int64:
+            return targetValueType == ExpressionValueType::Int64 || targetValueType == ExpressionValueType::Double;
+        case ExpressionValueType::String:
+            return targetValueType != ExpressionValueType::Decimal && targetValueType != ExpressionValueType::Undefined;
+        default:
+            return sourceValueType == targetValueType;
+    }
+}
+
+void ExpressionProgram::ConvertRegister(const Register& source, Register& target, const ExpressionValueType targetValueType)
+{
+    target.ValueType = targetValueType;
+    target.IsNull = source.IsNull;
+
+    // If source value is Null, result is Null, regardless of target type
+    if (source.IsNull)
+        return;
+
+    switch (source.ValueType)
+    {
+        case ExpressionValueType::Boolean:
+            SetNumericValue(target, targetValueType, source.BooleanValue ? 1 : 0);
+            break;
+        case ExpressionValueType::Int32:
+            SetNumericValue(target, targetValueType, source.Int32Value);
+            break;
+        case ExpressionValueType::Int64:
+            SetNumericValue(target, targetValueType, source.Int64Value);
+            break;
+        case ExpressionValueType::Double:
+            SetNumericValue(target, targetValueType, source.DoubleValue);
+            break;
+        case ExpressionValueType::String:
+            switch (targetValueType)
+            {
+                case ExpressionValueType::Boolean:
+                    target.BooleanValue = ParseBoolean(string(source.StringValue, source.StringLength));
+                    break;
+                case ExpressionValueType::Int32:
+                    target.Int32Value = stoi(string(source.StringValue, source.StringLength));
+                    break;
+                case ExpressionValueType::Int64:
+                    target.Int64Value = stoll(string(source.StringValue, source.StringLength));
+                    break;
+                case ExpressionValueType::Double:
+                    target.DoubleValue = stod(string(source.StringValue, source.StringLength));
+                    break;
+                case ExpressionValueType::String:
+                    target.StringValue = source.StringValue;
+                    target.StringLength = source.StringLength;
+                    break;
+                case ExpressionValueType::Guid:
+                    target.GuidValue = ParseGuid(source.StringValue);
+                    break;
+                case ExpressionValueType::DateTime:
+                    target.DateTimeValue = ParseTimestamp(source.StringValue);
+                    break;
+                default:
+                    throw ExpressionTreeException("Cannot convert \"String\" to \"" + string(EnumName(targetValueType)) + "\"");
+            }
+            break;
+        default:
+            throw ExpressionTreeException("Cannot convert \"" + string(EnumName(source.ValueType)) + "\" to \"" + string(EnumName(targetValueType)) + "\"");
+    }
+}
+
+bool ExpressionProgram::Like(const Register& left, const Register& right, const bool exactMatch)
+{
+    if (right.IsNull)
+        throw ExpressionTreeException("Right operand of \"LIKE\" expression is null");
+
+    const char* patternStart = right.StringValue;
+    const char* patternEnd = right.StringValue + right.StringLength;
+    const bool startsWithWildcard = patternStart < patternEnd && IsWildcard(*patternStart);
+    const bool endsWithWildcard = patternStart < patternEnd && IsWildcard(*(patternEnd - 1));
+
+    if (startsWithWildcard)
+        patternStart++;
+
+    if (endsWithWildcard && patternStart < patternEnd)
+        patternEnd--;
+
+    // "*" or "**" expression means match everything
+    if (patternStart == patternEnd)
+        return true;
+
+    // Wild cards in the middle of the string are not supported
+    if (std::find_if(patternStart, patternEnd, IsWildcard) != patternEnd)
+        throw ExpressionTreeException("Right operand of \"LIKE\" expression \"" + string(right.StringValue, right.StringLength) + "\" has an invalid pattern");
+
+    const size_t patternLength = patternEnd - patternStart;
+    const bool ignoreCase = !exactMatch;
+
+    if (startsWithWildcard && StringEndsWith(left.StringValue, left.StringLength, patternStart, patternLength, ignoreCase))
+        return true;
+
+    if (endsWithWildcard && StringStartsWith(left.StringValue, left.StringLength, patternStart, patternLength, ignoreCase))
+        return true;
+
+    if (startsWithWildcard && endsWithWildcard && StringContains(left.StringValue, left.StringLength, patternStart, patternLength, ignoreCase))
+        return true;
+
+    return false;
+}
+
+ExpressionProgramPtr ExpressionProgram::Compile(const ExpressionTree& tree, const ExpressionPtr& root)
+{
+    // Standalone values and columns gain nothing from compilation
+    if (root == nullptr || root->Type == ExpressionType::Value || root->Type == ExpressionType::Column)
+        return nullptr;
+
+    ExpressionProgramPtr program = NewSharedPtr<ExpressionProgram>();
+    program->m_resultRegister = program->CompileExpression(tree, root);
+
+    if (program->m_resultRegister < 0)
+        return nullptr;
+
+    program->m_scratchRegisters = program->m_registers;
+
+    return program;
+}
+
+const Register& ExpressionProgram::Execute(const DataRow& row)
+{
+    return Execute(row, m_scratchRegisters);
+}
+
+const Register& ExpressionProgram::Execute(const DataRow& row, vector<Register>& registers) const
+{
+    const vector<void*>& values = row.m_values;
+    const int32_t count = static_cast<int32_t>(m_instructions.size());
+    int32_t index = 0;
+
+    while (index < count)
+    {
+        const Instruction& instruction = m_instructions[index++];
+        Register& target = registers[instruction.Target];
+
+        target.ValueType = instruction.ValueType;
+
+        switch (instruction.Code)
+        {
+            case OpCode::LoadString:
+            {
+                const char* value = static_cast<const char*>(values[instruction.Operand]);
+                target.IsNull = value == nullptr;
+
+                if (value)
+                {
+                    target.StringValue = value;
+                    target.StringLength = strlen(value);
+                }
+
+                break;
+            }
+            case OpCode::LoadBoolean:
+                LoadValue<uint8_t>(values[instruction.Operand], target.IsNull, target.BooleanValue);
+                break;
+            case OpCode::LoadDateTime:
+                LoadValue<datetime_t>(values[instruction.Operand], target.IsNull, target.DateTimeValue);
+                break;
+            case OpCode::LoadSingle:
+                LoadValue<float32_t>(values[instruction.Operand], target.IsNull, target.DoubleValue);
+                break;
+            case OpCode::LoadDouble:
+                LoadValue<float64_t>(values[instruction.Operand], target.IsNull, target.DoubleValue);
+                break;
+            case OpCode::LoadGuid:
+                LoadValue<Guid>(values[instruction.Operand], target.IsNull, target.GuidValue);
+                break;
+            case OpCode::LoadInt8:
+                LoadValue<int8_t>(values[instruction.Operand], target.IsNull, target.Int32Value);
+                break;
+            case OpCode::LoadInt16:
+                LoadValue<int16_t>(values[instruction.Operand], target.IsNull, target.Int32Value);
+                break;
+            case OpCode::LoadInt32:
+                LoadValue<int32_t>(values[instruction.Operand], target.IsNull, target.Int32Value);
+                break;
+            case OpCode::LoadUInt8:
+                LoadValue<uint8_t>(values[instruction.Operand], target.IsNull, target.Int32Value);
+                break;
+            case OpCode::LoadUInt16:
+                LoadValue<uint16_t>(values[instruction.Operand], target.IsNull, target.Int32Value);
+                break;
+            case OpCode::LoadInt64:
+                LoadValue<int64_t>(values[instruction.Operand], target.IsNull, target.Int64Value);
+                break;
+            case OpCode::LoadUInt32:
+                LoadValue<uint32_t>(values[instruction.Operand], target.IsNull, target.Int64Value);
+                break;
+            case OpCode::Convert:
+                if (instruction.Right > -1 && registers[instruction.Right].IsNull)
+                    target.IsNull = true;
+                else
+                    ConvertRegister(registers[instruction.Left], target, instruction.ValueType);
+
+                break;
+            case OpCode::Negate:
+            case OpCode::Complement:
+            {
+                const Register& value = registers[instruction.Left];
+                target.IsNull = value.IsNull;
+
+                if (value.IsNull)
+                    break;
+
+                const bool negate = instruction.Code == OpCode::Negate;
+
+                if (instruction.ValueType == ExpressionValueType::Int32)
+                    target.Int32Value = negate ? -value.Int32Value : ~value.Int32Value;
+                else if (instruction.ValueType == ExpressionValueType::Int64)
+                    target.Int64Value = negate ? -value.Int64Value : ~value.Int64Value;
+                else
+                    target.DoubleValue = -value.DoubleValue;
+
+                break;
+            }
+            case OpCode::Not:
+            {
+                const Register& value = registers[instruction.Left];
+                target.IsNull = value.IsNull;
+                target.BooleanValue = !value.BooleanValue;
+                break;
+            }
+            case OpCode::Multiply:
+            case OpCode::Divide:
+            case OpCode::Modulus:
+            case OpCode::Add:
+            case OpCode::Subtract:
+            case OpCode::BitwiseAnd:
+            case OpCode::BitwiseOr:
+            case OpCode::BitwiseXor:
+                EvaluateArithmetic(instruction.Code, registers[instruction.Left], registers[instruction.Right], target);
+                break;
+            case OpCode::LessThan:
+            case OpCode::LessThanOrEqual:
+            case OpCode::GreaterThan:
+            case OpCode::GreaterThanOrEqual:
+            case OpCode::Equal:
+            case OpCode::NotEqual:
+                EvaluateComparison(instruction.Code, registers[instruction.Left], registers[instruction.Right], instruction.Flag, target);
+                break;
+            case OpCode::IsNull:
+                target.IsNull = false;
+                target.BooleanValue = registers[instruction.Left].IsNull;
+                break;
+            case OpCode::IsNotNull:
+                target.IsNull = false;
+                target.BooleanValue = !registers[instruction.Left].IsNull;
+                break;
+            case OpCode::Like:
+            case OpCode::NotLike:
+            {
+                const Register& left = registers[instruction.Left];
+
+                // If left value is Null, result is Null
+                target.IsNull = left.IsNull;
+
+                if (left.IsNull)
+                    break;
+
+                const bool result = Like(left, registers[instruction.Right], instruction.Flag);
+                target.BooleanValue = instruction.Code == OpCode::Like ? result : !result;
+                break;
+            }
+            case OpCode::And:
+            case OpCode::Or:
+            {
+                const Register& left = registers[instruction.Left];
+                const Register& right = registers[instruction.Right];
+
+                // A Null IN list result takes the type of its test value, which is not a valid boolean operand
+                if (left.ValueType != ExpressionValueType::Boolean || right.ValueType != ExpressionValueType::Boolean)
+                    throw ExpressionTreeException("Cannot perform \"" + string(EnumName(instruction.Code == OpCode::And ? ExpressionOperatorType::And : ExpressionOperatorType::Or)) + "\" operation on \"" + string(EnumName(left.ValueType)) + "\" and \"" + string(EnumName(right.ValueType)) + "\"");
+
+                // If left or right value is Null, result is Null
+                target.IsNull = left.IsNull || right.IsNull;
+
+                if (instruction.Code == OpCode::And)
+                    target.BooleanValue = left.BooleanValue && right.BooleanValue;
+                else
+                    target.BooleanValue = left.BooleanValue || right.BooleanValue;
+
+                break;
+            }
+            case OpCode::InListStart:
+            {
+                const Register& value = registers[instruction.Left];
+
+                // If in list test value is Null, result is Null of test value type
+                if (value.IsNull)
+                {
+                    target.ValueType = value.ValueType;
+                    target.IsNull = true;
+                    index = instruction.Operand;
+                }
+                else
+                {
+                    target.IsNull = false;
+                    target.BooleanValue = false;
+                }
+
+                break;
+            }
+            case OpCode::InListMatch:
+            {
+                const Register& result = registers[instruction.Left];
+
+                if (!result.IsNull && result.BooleanValue)
+                {
+                    target.BooleanValue = true;
+                    index = instruction.Operand;
+                }
+
+                break;
+            }
+            case OpCode::InListEnd:
+                if (instruction.Flag)
+                    target.BooleanValue = !target.BooleanValue;
+
+                break;
+            case OpCode::InListLookup:
+            {
+                const Register& value = registers[instruction.Left];
+
+                // If in list test value is Null, result is Null of test value type
+                if (value.IsNull)
+                {
+                    target.ValueType = value.ValueType;
+                    target.IsNull = true;
+                    break;
+                }
+
+                target.IsNull = false;
+                target.BooleanValue = InListContains(*m_inListSets[instruction.Operand], value) != instruction.Flag;
+                break;
+            }
+            default:
+                throw ExpressionTreeException("Unexpected instruction encountered");
+        }
+    }
+
+    return registers[m_resultRegister];
+}
+
+vector<Register> ExpressionProgram::CreateRegisters() const
+{
+    return m_registers;
+}
+
+int32_t ExpressionProgram::InstructionCount() const
+{
+    return static_cast<int32_t>(m_instructions.size());
+}
+
+int32_t ExpressionProgram::RegisterCount() const
+{
+    return static_cast<int32_t>(m_registers.size());
+}
+
+ValueExpressionPtr ExpressionProgram::ToValueExpression(const Register& result)
+{
+    if (result.IsNull)
+        return ExpressionTree::NullValue(result.ValueType);
+
+    switch (result.ValueType)
+    {
+        case ExpressionValueType::Boolean:
+            return result.BooleanValue ? ExpressionTree::True : ExpressionTree::False;
+        case ExpressionValueType::Int32:
+            return NewSharedPtr<ValueExpression>(ExpressionValueType::Int32, result.Int32Value);
+        case ExpressionValueType::Int64:
+            return NewSharedPtr<ValueExpression>(ExpressionValueType::Int64, result.Int64Value);
+        case ExpressionValueType::Double:
+            return NewSharedPtr<ValueExpression>(ExpressionValueType::Double, result.DoubleValue);
+        case ExpressionValueType::String:
+            return NewSharedPtr<ValueExpression>(ExpressionValueType::String, string(result.StringValue, result.StringLength));
+        case ExpressionValueType::Guid:
+            return NewSharedPtr<ValueExpression>(ExpressionValueType::Guid, result.GuidValue);
+        case ExpressionValueType::DateTime:
+            return NewSharedPtr<ValueExpression>(ExpressionValueType::DateTime, result.DateTimeValue);
+        default:
+            throw ExpressionTreeException("Unexpected expression value type encountered");
+    }
+}
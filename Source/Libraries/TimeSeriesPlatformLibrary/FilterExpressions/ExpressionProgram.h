@@ -0,0 +1,169 @@
+//******************************************************************************************************
+//  ExpressionProgram.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#ifndef __EXPRESSION_PROGRAM_H
+#define __EXPRESSION_PROGRAM_H
+
+#include "ExpressionTree.h"
+#include <deque>
+
+namespace GSF {
+namespace FilterExpressions
+{
+    // Represents an expression tree compiled into a flat, register-based instruction
+    // list. Column references are resolved to indexes at compile time and typed values
+    // are evaluated in place so that no value expressions are allocated per row.
+    class ExpressionProgram // NOLINT
+    {
+    public:
+        enum class OpCode : uint8_t
+        {
+            LoadString,
+            LoadBoolean,
+            LoadDateTime,
+            LoadSingle,
+            LoadDouble,
+            LoadGuid,
+            LoadInt8,
+            LoadInt16,
+            LoadInt32,
+            LoadUInt8,
+            LoadUInt16,
+            LoadInt64,
+            LoadUInt32,
+            Convert,
+            Negate,
+            Complement,
+            Not,
+            Multiply,
+            Divide,
+            Modulus,
+            Add,
+            Subtract,
+            BitwiseAnd,
+            BitwiseOr,
+            BitwiseXor,
+            LessThan,
+            LessThanOrEqual,
+            GreaterThan,
+            GreaterThanOrEqual,
+            Equal,
+            NotEqual,
+            IsNull,
+            IsNotNull,
+            Like,
+            NotLike,
+            And,
+            Or,
+            InListStart,
+            InListMatch,
+            InListEnd,
+            InListLookup
+        };
+
+        // Typed evaluation slot, strings reference row or program owned storage
+        struct Register
+        {
+            ExpressionValueType ValueType;
+            bool IsNull;
+
+            union
+            {
+                bool BooleanValue;
+                int32_t Int32Value;
+                int64_t Int64Value;
+                GSF::float64_t DoubleValue;
+            };
+
+            const char* StringValue;
+            size_t StringLength;
+            GSF::Guid GuidValue;
+            GSF::datetime_t DateTimeValue;
+
+            Register(ExpressionValueType valueType = ExpressionValueType::Undefined);
+        };
+
+        struct Instruction
+        {
+            OpCode Code;
+            ExpressionValueType ValueType;
+            bool Flag;          // Exact match for comparisons, NOT keyword for IN lists
+            int32_t Target;
+            int32_t Left;
+            int32_t Right;      // Right operand or, for conversions, null guard register
+            int32_t Operand;    // Column index, jump target or IN list set index
+        };
+
+    private:
+        std::vector<Instruction> m_instructions;
+        std::vector<Register> m_registers;
+        std::vector<Register> m_scratchRegisters;
+        std::vector<bool> m_constantRegisters;
+        std::vector<bool> m_unstableRegisters;
+        std::deque<std::string> m_strings;
+        std::vector<InListSetPtr> m_inListSets;
+        int32_t m_resultRegister;
+
+        int32_t AddRegister(ExpressionValueType valueType, bool constant = false);
+        void Emit(OpCode code, ExpressionValueType valueType, int32_t target, int32_t left = -1, int32_t right = -1, int32_t operand = -1, bool flag = false);
+
+        // Compilers return target register or -1 when expression is not supported
+        int32_t CompileExpression(const ExpressionTree& tree, const ExpressionPtr& expression);
+        int32_t CompileOperand(const ExpressionTree& tree, const ExpressionPtr& expression, bool allowUnstable = false);
+        int32_t CompileValue(const ValueExpressionPtr& valueExpression);
+        int32_t CompileUnary(const ExpressionTree& tree, const UnaryExpressionPtr& unaryExpression);
+        int32_t CompileColumn(const ColumnExpressionPtr& columnExpression);
+        int32_t CompileInList(const ExpressionTree& tree, const InListExpressionPtr& inListExpression);
+        int32_t CompileOperator(const ExpressionTree& tree, const OperatorExpressionPtr& operatorExpression);
+        int32_t CompileConvert(int32_t source, ExpressionValueType targetValueType, int32_t guard);
+
+        static bool IsSupportedConversion(ExpressionValueType sourceValueType, ExpressionValueType targetValueType);
+        static void ConvertRegister(const Register& source, Register& target, ExpressionValueType targetValueType);
+        static bool Like(const Register& left, const Register& right, bool exactMatch);
+    public:
+        ExpressionProgram();
+
+        // Compiles prepared expression tree root, returns nullptr when tree uses expressions not supported
+        // by the compiler, e.g., functions or decimal values, in which case tree should be interpreted
+        static SharedPtr<ExpressionProgram> Compile(const ExpressionTree& tree, const ExpressionPtr& root);
+
+        // Evaluates program against row using internal registers, not thread-safe
+        const Register& Execute(const GSF::Data::DataRow& row);
+
+        // Evaluates program against row using provided registers, see CreateRegisters
+        const Register& Execute(const GSF::Data::DataRow& row, std::vector<Register>& registers) const;
+
+        // Creates a register set, with initialized constants, for use with Execute
+        std::vector<Register> CreateRegisters() const;
+
+        int32_t InstructionCount() const;
+        int32_t RegisterCount() const;
+
+        static ValueExpressionPtr ToValueExpression(const Register& result);
+    };
+
+    typedef SharedPtr<ExpressionProgram> ExpressionProgramPtr;
+}}
+
+#endif
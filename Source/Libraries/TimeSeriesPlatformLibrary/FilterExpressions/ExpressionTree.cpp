@@ -22,6 +22,7 @@
 //******************************************************************************************************
 
 #include "ExpressionTree.h"
+#include "ExpressionProgram.h"
 #include <regex>
 
 using namespace std;
@@ -159,6 +160,59 @@ TimeInterval ParseTimeInterval(const string& intervalName)
     throw ExpressionTreeException("Time interval \"" + intervalName + "\" is not recognized");
 }
 
+template<class T>
+static const T* FindPreparedOperand(const unordered_map<const Expression*, SharedPtr<T>>& preparedOperands, const ExpressionPtr& expression)
+{
+    const auto iterator = preparedOperands.find(expression.get());
+    return iterator == preparedOperands.end() ? nullptr : iterator->second.get();
+}
+
+static bool TryGetColumnValueType(const DataColumnPtr& column, ExpressionValueType& valueType)
+{
+    switch (column->Type())
+    {
+        case DataType::String:
+            valueType = ExpressionValueType::String;
+            return true;
+        case DataType::Boolean:
+            valueType = ExpressionValueType::Boolean;
+            return true;
+        case DataType::DateTime:
+            valueType = ExpressionValueType::DateTime;
+            return true;
+        case DataType::Single:
+        case DataType::Double:
+            valueType = ExpressionValueType::Double;
+            return true;
+        case DataType::Decimal:
+            valueType = ExpressionValueType::Decimal;
+            return true;
+        case DataType::Guid:
+            valueType = ExpressionValueType::Guid;
+            return true;
+        case DataType::Int8:
+        case DataType::Int16:
+        case DataType::Int32:
+        case DataType::UInt8:
+        case DataType::UInt16:
+            valueType = ExpressionValueType::Int32;
+            return true;
+        case DataType::Int64:
+        case DataType::UInt32:
+            valueType = ExpressionValueType::Int64;
+            return true;
+        default:
+            // UInt64 value type depends on magnitude of the value
+            return false;
+    }
+}
+
+// Decimal operations use compact arithmetic when both operands are held in compact form
+static bool TryGetCompactDecimals(const ValueExpressionPtr& left, const ValueExpressionPtr& right, Decimal128& leftValue, Decimal128& rightValue)
+{
+    return left->TryGetCompactDecimal(leftValue) && right->TryGetCompactDecimal(rightValue);
+}
+
 ExpressionTreeException::ExpressionTreeException(string message) noexcept :
     m_message(std::move(message))
 {
@@ -204,7 +258,7 @@ bool ValueExpression::IsNull() const
         case ExpressionValueType::Int64:
             return !ValueAsNullableInt64().HasValue();
         case ExpressionValueType::Decimal:
-            return !ValueAsNullableDecimal().HasValue();
+            return Value.type() != typeid(Decimal128) && !ValueAsNullableDecimal().HasValue();
         case ExpressionValueType::Double:
             return !ValueAsNullableDouble().HasValue();
         case ExpressionValueType::String:
@@ -311,6 +365,9 @@ decimal_t ValueExpression::ValueAsDecimal() const
 {
     ValidateValueType(ExpressionValueType::Decimal);
 
+    if (Value.type() == typeid(Decimal128))
+        return Cast<Decimal128>(Value).ToDecimal();
+
     if (ValueIsNullable)
         return Cast<Nullable<decimal_t>>(Value).GetValueOrDefault();
 
@@ -321,12 +378,24 @@ Nullable<decimal_t> ValueExpression::ValueAsNullableDecimal() const
 {
     ValidateValueType(ExpressionValueType::Decimal);
 
+    if (Value.type() == typeid(Decimal128))
+        return Cast<Decimal128>(Value).ToDecimal();
+
     if (ValueIsNullable)
         return Cast<Nullable<decimal_t>>(Value);
 
     return Cast<decimal_t>(Value);
 }
 
+bool ValueExpression::TryGetCompactDecimal(Decimal128& value) const
+{
+    if (ValueType != ExpressionValueType::Decimal || Value.type() != typeid(Decimal128))
+        return false;
+
+    value = Cast<Decimal128>(Value);
+    return true;
+}
+
 float64_t ValueExpression::ValueAsDouble() const
 {
     ValidateValueType(ExpressionValueType::Double);
@@ -444,6 +513,105 @@ FunctionExpression::FunctionExpression(const ExpressionFunctionType functionType
 {
 }
 
+InListSet::InListSet(const ExpressionValueType valueType, const bool exactMatch) :
+    ValueType(valueType),
+    ExactMatch(exactMatch)
+{
+    if (!IsSupportedType(valueType))
+        throw ExpressionTreeException("Cannot create IN list set for \"" + string(EnumName(valueType)) + "\" values");
+}
+
+void InListSet::Add(const ValueExpressionPtr& value)
+{
+    switch (ValueType)
+    {
+        case ExpressionValueType::Boolean:
+            m_integerValues.insert(value->ValueAsBoolean() ? 1 : 0);
+            break;
+        case ExpressionValueType::Int32:
+            m_integerValues.insert(value->ValueAsInt32());
+            break;
+        case ExpressionValueType::Int64:
+            m_integerValues.insert(value->ValueAsInt64());
+            break;
+        case ExpressionValueType::Double:
+            m_doubleValues.insert(value->ValueAsDouble());
+            break;
+        case ExpressionValueType::String:
+            if (ExactMatch)
+                m_stringValues.insert(value->ValueAsString());
+            else
+                m_ignoreCaseStringValues.insert(value->ValueAsString());
+
+            break;
+        case ExpressionValueType::Guid:
+            m_guidValues.insert(value->ValueAsGuid());
+            break;
+        default:
+            throw ExpressionTreeException("Unexpected expression value type encountered");
+    }
+}
+
+bool InListSet::Contains(const ValueExpressionPtr& value) const
+{
+    switch (ValueType)
+    {
+        case ExpressionValueType::Boolean:
+            return ContainsInteger(value->ValueAsBoolean() ? 1 : 0);
+        case ExpressionValueType::Int32:
+            return ContainsInteger(value->ValueAsInt32());
+        case ExpressionValueType::Int64:
+            return ContainsInteger(value->ValueAsInt64());
+        case ExpressionValueType::Double:
+            return ContainsDouble(value->ValueAsDouble());
+        case ExpressionValueType::String:
+            return ContainsString(value->ValueAsString());
+        case ExpressionValueType::Guid:
+            return ContainsGuid(value->ValueAsGuid());
+        default:
+            throw ExpressionTreeException("Unexpected expression value type encountered");
+    }
+}
+
+bool InListSet::ContainsInteger(const int64_t value) const
+{
+    return m_integerValues.find(value) != m_integerValues.end();
+}
+
+bool InListSet::ContainsDouble(const float64_t value) const
+{
+    return m_doubleValues.find(value) != m_doubleValues.end();
+}
+
+bool InListSet::ContainsString(const string& value) const
+{
+    if (ExactMatch)
+        return m_stringValues.find(value) != m_stringValues.end();
+
+    return m_ignoreCaseStringValues.find(value) != m_ignoreCaseStringValues.end();
+}
+
+bool InListSet::ContainsGuid(const Guid& value) const
+{
+    return m_guidValues.find(value) != m_guidValues.end();
+}
+
+bool InListSet::IsSupportedType(const ExpressionValueType valueType)
+{
+    switch (valueType)
+    {
+        case ExpressionValueType::Boolean:
+        case ExpressionValueType::Int32:
+        case ExpressionValueType::Int64:
+        case ExpressionValueType::Double:
+        case ExpressionValueType::String:
+        case ExpressionValueType::Guid:
+            return true;
+        default:
+            return false;
+    }
+}
+
 ValueExpressionPtr ExpressionTree::Evaluate(const ExpressionPtr& expression, const ExpressionValueType targetValueType) const
 {
     if (expression == nullptr)
@@ -545,9 +713,17 @@ ValueExpressionPtr ExpressionTree::EvaluateColumn(const ExpressionPtr& expressio
             value = m_currentRow->ValueAsDouble(columnIndex);
             break;
         case DataType::Decimal:
+        {
+            Decimal128 compact;
             valueType = ExpressionValueType::Decimal;
-            value = m_currentRow->ValueAsDecimal(columnIndex);
+
+            if (m_currentRow->TryGetCompactDecimal(columnIndex, compact))
+                value = compact;
+            else
+                value = m_currentRow->ValueAsDecimal(columnIndex);
+
             break;
+        }
         case DataType::Guid:
             valueType = ExpressionValueType::Guid;
             value = m_currentRow->ValueAsGuid(columnIndex);
@@ -624,6 +800,12 @@ ValueExpressionPtr ExpressionTree::EvaluateInList(const ExpressionPtr& expressio
     if (inListValue->IsNull())
         return NullValue(inListValue->ValueType);
 
+    const InListSet* inListSet = FindPreparedOperand(m_inListSets, expression);
+
+    // Constant arguments of the test value type are matched with a hashed lookup
+    if (inListSet != nullptr && inListSet->ValueType == inListValue->ValueType)
+        return inListSet->Contains(inListValue) != hasNotKeyword ? ExpressionTree::True : ExpressionTree::False;
+
     const size_t argumentCount = inListExpression->Arguments->size();
 
     for (size_t i = 0; i < argumentCount; i++)
@@ -792,12 +974,12 @@ ValueExpressionPtr ExpressionTree::EvaluateFunction(const ExpressionPtr& express
             if (arguments->size() != 2)
                 throw ExpressionTreeException("\"RegExMatch\" function expects 2 arguments, received " + ToString(arguments->size()));
 
-            return RegExMatch(Evaluate(arguments->at(0), ExpressionValueType::String), Evaluate(arguments->at(1), ExpressionValueType::String));
+            return RegExMatch(Evaluate(arguments->at(0), ExpressionValueType::String), Evaluate(arguments->at(1), ExpressionValueType::String), FindPreparedOperand(m_regexPatterns, expression));
         case ExpressionFunctionType::RegExVal:
             if (arguments->size() != 2)
                 throw ExpressionTreeException("\"RegExVal\" function expects 2 arguments, received " + ToString(arguments->size()));
 
-            return RegExVal(Evaluate(arguments->at(0), ExpressionValueType::String), Evaluate(arguments->at(1), ExpressionValueType::String));
+            return RegExVal(Evaluate(arguments->at(0), ExpressionValueType::String), Evaluate(arguments->at(1), ExpressionValueType::String), FindPreparedOperand(m_regexPatterns, expression));
         case ExpressionFunctionType::Replace:
             if (arguments->size() < 3 || arguments->size() > 4)
                 throw ExpressionTreeException("\"Replace\" function expects 3 or 4 arguments, received " + ToString(arguments->size()));
@@ -941,13 +1123,13 @@ ValueExpressionPtr ExpressionTree::EvaluateOperator(const ExpressionPtr& express
         case ExpressionOperatorType::IsNotNull:
             return IsNotNull(leftValue);
         case ExpressionOperatorType::Like:
-            return Like(leftValue, rightValue);
+            return Like(leftValue, rightValue, false, FindPreparedOperand(m_likePatterns, expression));
         case ExpressionOperatorType::LikeExactMatch:
-            return Like(leftValue, rightValue, true);
+            return Like(leftValue, rightValue, true, FindPreparedOperand(m_likePatterns, expression));
         case ExpressionOperatorType::NotLike:
-            return NotLike(leftValue, rightValue);
+            return NotLike(leftValue, rightValue, false, FindPreparedOperand(m_likePatterns, expression));
         case ExpressionOperatorType::NotLikeExactMatch:
-            return NotLike(leftValue, rightValue, true);
+            return NotLike(leftValue, rightValue, true, FindPreparedOperand(m_likePatterns, expression));
         case ExpressionOperatorType::And:
             return And(leftValue, rightValue);
         case ExpressionOperatorType::Or:
@@ -1876,14 +2058,14 @@ ValueExpressionPtr ExpressionTree::Power(const ValueExpressionPtr& sourceValue,
     }
 }
 
-ValueExpressionPtr ExpressionTree::RegExMatch(const ValueExpressionPtr& regexValue, const ValueExpressionPtr& testValue) const
+ValueExpressionPtr ExpressionTree::RegExMatch(const ValueExpressionPtr& regexValue, const ValueExpressionPtr& testValue, const regex* expression) const
 {
-    return EvaluateRegEx("RegExMatch", regexValue, testValue, false);
+    return EvaluateRegEx("RegExMatch", regexValue, testValue, false, expression);
 }
 
-ValueExpressionPtr ExpressionTree::RegExVal(const ValueExpressionPtr& regexValue, const ValueExpressionPtr& testValue) const
+ValueExpressionPtr ExpressionTree::RegExVal(const ValueExpressionPtr& regexValue, const ValueExpressionPtr& testValue, const regex* expression) const
 {
-    return EvaluateRegEx("RegExVal", regexValue, testValue, true);
+    return EvaluateRegEx("RegExVal", regexValue, testValue, true, expression);
 }
 
 ValueExpressionPtr ExpressionTree::Replace(const ValueExpressionPtr& sourceValue, const ValueExpressionPtr& testValue, const ValueExpressionPtr& replaceValue, const ValueExpressionPtr& ignoreCase) const
@@ -2212,7 +2394,14 @@ ValueExpressionPtr ExpressionTree::Multiply(const ValueExpressionPtr& leftValue,
         case ExpressionValueType::Int64:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Int64, left->ValueAsInt64() * right->ValueAsInt64());
         case ExpressionValueType::Decimal:
+        {
+            Decimal128 leftDecimal, rightDecimal, result;
+
+            if (TryGetCompactDecimals(left, right, leftDecimal, rightDecimal) && Decimal128::TryMultiply(leftDecimal, rightDecimal, result))
+                return NewSharedPtr<ValueExpression>(ExpressionValueType::Decimal, result);
+
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Decimal, left->ValueAsDecimal() * right->ValueAsDecimal());
+        }
         case ExpressionValueType::Double:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Double, left->ValueAsDouble() * right->ValueAsDouble());
         case ExpressionValueType::String:
@@ -2312,7 +2501,14 @@ ValueExpressionPtr ExpressionTree::Add(const ValueExpressionPtr& leftValue, cons
         case ExpressionValueType::Int64:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Int64, left->ValueAsInt64() + right->ValueAsInt64());
         case ExpressionValueType::Decimal:
+        {
+            Decimal128 leftDecimal, rightDecimal, result;
+
+            if (TryGetCompactDecimals(left, right, leftDecimal, rightDecimal) && Decimal128::TryAdd(leftDecimal, rightDecimal, result))
+                return NewSharedPtr<ValueExpression>(ExpressionValueType::Decimal, result);
+
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Decimal, left->ValueAsDecimal() + right->ValueAsDecimal());
+        }
         case ExpressionValueType::Double:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Double, left->ValueAsDouble() + right->ValueAsDouble());
         case ExpressionValueType::String:
@@ -2344,7 +2540,14 @@ ValueExpressionPtr ExpressionTree::Subtract(const ValueExpressionPtr& leftValue,
         case ExpressionValueType::Int64:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Int64, left->ValueAsInt64() - right->ValueAsInt64());
         case ExpressionValueType::Decimal:
+        {
+            Decimal128 leftDecimal, rightDecimal, result;
+
+            if (TryGetCompactDecimals(left, right, leftDecimal, rightDecimal) && Decimal128::TrySubtract(leftDecimal, rightDecimal, result))
+                return NewSharedPtr<ValueExpression>(ExpressionValueType::Decimal, result);
+
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Decimal, left->ValueAsDecimal() - right->ValueAsDecimal());
+        }
         case ExpressionValueType::Double:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Double, left->ValueAsDouble() - right->ValueAsDouble());
         case ExpressionValueType::String:
@@ -2560,7 +2763,14 @@ ValueExpressionPtr ExpressionTree::LessThan(const ValueExpressionPtr& leftValue,
         case ExpressionValueType::Int64:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsInt64() < right->ValueAsInt64());
         case ExpressionValueType::Decimal:
+        {
+            Decimal128 leftDecimal, rightDecimal;
+
+            if (TryGetCompactDecimals(left, right, leftDecimal, rightDecimal))
+                return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, Decimal128::Compare(leftDecimal, rightDecimal) < 0);
+
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsDecimal() < right->ValueAsDecimal());
+        }
         case ExpressionValueType::Double:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsDouble() < right->ValueAsDouble());
         case ExpressionValueType::String:
@@ -2594,7 +2804,14 @@ ValueExpressionPtr ExpressionTree::LessThanOrEqual(const ValueExpressionPtr& lef
         case ExpressionValueType::Int64:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsInt64() <= right->ValueAsInt64());
         case ExpressionValueType::Decimal:
+        {
+            Decimal128 leftDecimal, rightDecimal;
+
+            if (TryGetCompactDecimals(left, right, leftDecimal, rightDecimal))
+                return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, Decimal128::Compare(leftDecimal, rightDecimal) <= 0);
+
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsDecimal() <= right->ValueAsDecimal());
+        }
         case ExpressionValueType::Double:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsDouble() <= right->ValueAsDouble());
         case ExpressionValueType::String:
@@ -2628,7 +2845,14 @@ ValueExpressionPtr ExpressionTree::GreaterThan(const ValueExpressionPtr& leftVal
         case ExpressionValueType::Int64:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsInt64() > right->ValueAsInt64());
         case ExpressionValueType::Decimal:
+        {
+            Decimal128 leftDecimal, rightDecimal;
+
+            if (TryGetCompactDecimals(left, right, leftDecimal, rightDecimal))
+                return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, Decimal128::Compare(leftDecimal, rightDecimal) > 0);
+
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsDecimal() > right->ValueAsDecimal());
+        }
         case ExpressionValueType::Double:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsDouble() > right->ValueAsDouble());
         case ExpressionValueType::String:
@@ -2662,7 +2886,14 @@ ValueExpressionPtr ExpressionTree::GreaterThanOrEqual(const ValueExpressionPtr&
         case ExpressionValueType::Int64:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsInt64() >= right->ValueAsInt64());
         case ExpressionValueType::Decimal:
+        {
+            Decimal128 leftDecimal, rightDecimal;
+
+            if (TryGetCompactDecimals(left, right, leftDecimal, rightDecimal))
+                return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, Decimal128::Compare(leftDecimal, rightDecimal) >= 0);
+
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsDecimal() >= right->ValueAsDecimal());
+        }
         case ExpressionValueType::Double:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsDouble() >= right->ValueAsDouble());
         case ExpressionValueType::String:
@@ -2696,7 +2927,14 @@ ValueExpressionPtr ExpressionTree::Equal(const ValueExpressionPtr& leftValue, co
         case ExpressionValueType::Int64:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsInt64() == right->ValueAsInt64());
         case ExpressionValueType::Decimal:
+        {
+            Decimal128 leftDecimal, rightDecimal;
+
+            if (TryGetCompactDecimals(left, right, leftDecimal, rightDecimal))
+                return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, Decimal128::Compare(leftDecimal, rightDecimal) == 0);
+
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsDecimal() == right->ValueAsDecimal());
+        }
         case ExpressionValueType::Double:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsDouble() == right->ValueAsDouble());
         case ExpressionValueType::String:
@@ -2730,7 +2968,14 @@ ValueExpressionPtr ExpressionTree::NotEqual(const ValueExpressionPtr& leftValue,
         case ExpressionValueType::Int64:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsInt64() != right->ValueAsInt64());
         case ExpressionValueType::Decimal:
+        {
+            Decimal128 leftDecimal, rightDecimal;
+
+            if (TryGetCompactDecimals(left, right, leftDecimal, rightDecimal))
+                return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, Decimal128::Compare(leftDecimal, rightDecimal) != 0);
+
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsDecimal() != right->ValueAsDecimal());
+        }
         case ExpressionValueType::Double:
             return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, left->ValueAsDouble() != right->ValueAsDouble());
         case ExpressionValueType::String:
@@ -2756,7 +3001,7 @@ ValueExpressionPtr ExpressionTree::IsNotNull(const ValueExpressionPtr& leftValue
     return NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, !leftValue->IsNull());
 }
 
-ValueExpressionPtr ExpressionTree::Like(const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue, const bool exactMatch) const
+ValueExpressionPtr ExpressionTree::Like(const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue, const bool exactMatch, const LikePattern* pattern) const
 {
     // If left value is Null, result is Null
     if (leftValue->IsNull())
@@ -2768,27 +3013,25 @@ ValueExpressionPtr ExpressionTree::Like(const ValueExpressionPtr& leftValue, con
     if (rightValue->IsNull())
         throw ExpressionTreeException("Right operand of \"LIKE\" expression is null");
 
-    const string leftOperand = leftValue->ValueAsString();
-    const string rightOperand = rightValue->ValueAsString();
+    LikePatternPtr parsedPattern;
 
-    string testExpression = GSF::Replace(rightOperand, "%", "*", false);
-    const bool startsWithWildcard = GSF::StartsWith(testExpression, "*", false);
-    const bool endsWithWildcard = GSF::EndsWith(testExpression, "*", false);
-    const bool ignoreCase = !exactMatch;
-
-    if (startsWithWildcard)
-        testExpression = testExpression.substr(1);
+    // Patterns of constant right operands are parsed once during preparation
+    if (pattern == nullptr)
+    {
+        parsedPattern = ParseLikePattern(rightValue->ValueAsString());
+        pattern = parsedPattern.get();
+    }
 
-    if (endsWithWildcard && !testExpression.empty())
-        testExpression = testExpression.substr(0, testExpression.size() - 1);
+    const string& testExpression = pattern->TestExpression;
+    const bool startsWithWildcard = pattern->StartsWithWildcard;
+    const bool endsWithWildcard = pattern->EndsWithWildcard;
+    const bool ignoreCase = !exactMatch;
 
     // "*" or "**" expression means match everything
     if (testExpression.empty())
         return ExpressionTree::True;
 
-    // Wild cards in the middle of the string are not supported
-    if (GSF::Contains(testExpression, "*", false))
-        throw ExpressionTreeException("Right operand of \"LIKE\" expression \"" + rightOperand + "\" has an invalid pattern");
+    const string leftOperand = leftValue->ValueAsString();
 
     if (startsWithWildcard && GSF::EndsWith(leftOperand, testExpression, ignoreCase))
         return ExpressionTree::True;
@@ -2802,13 +3045,13 @@ ValueExpressionPtr ExpressionTree::Like(const ValueExpressionPtr& leftValue, con
     return ExpressionTree::False;
 }
 
-ValueExpressionPtr ExpressionTree::NotLike(const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue, const bool exactMatch) const
+ValueExpressionPtr ExpressionTree::NotLike(const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue, const bool exactMatch, const LikePattern* pattern) const
 {
     // If left value is Null, result is Null
     if (leftValue->IsNull())
         return NullValue(ExpressionValueType::Boolean);
 
-    const ValueExpressionPtr likeResult = Like(leftValue, rightValue, exactMatch);
+    const ValueExpressionPtr likeResult = Like(leftValue, rightValue, exactMatch, pattern);
 
     return likeResult->ValueAsBoolean() ? ExpressionTree::False : ExpressionTree::True;
 }
@@ -2916,7 +3159,7 @@ ValueExpressionPtr ExpressionTree::Convert(const ValueExpressionPtr& sourceValue
                     targetValue = static_cast<int64_t>(value);
                     break;
                 case ExpressionValueType::Decimal:
-                    targetValue = static_cast<decimal_t>(value);
+                    targetValue = Decimal128(value);
                     break;
                 case ExpressionValueType::Double:
                     targetValue = static_cast<float64_t>(value);
@@ -2948,7 +3191,7 @@ ValueExpressionPtr ExpressionTree::Convert(const ValueExpressionPtr& sourceValue
                     targetValue = static_cast<int64_t>(value);
                     break;
                 case ExpressionValueType::Decimal:
-                    targetValue = static_cast<decimal_t>(value);
+                    targetValue = Decimal128(value);
                     break;
                 case ExpressionValueType::Double:
                     targetValue = static_cast<float64_t>(value);
@@ -2980,7 +3223,7 @@ ValueExpressionPtr ExpressionTree::Convert(const ValueExpressionPtr& sourceValue
                     targetValue = value;
                     break;
                 case ExpressionValueType::Decimal:
-                    targetValue = static_cast<decimal_t>(value);
+                    targetValue = Decimal128(value);
                     break;
                 case ExpressionValueType::Double:
                     targetValue = static_cast<float64_t>(value);
@@ -2998,6 +3241,10 @@ ValueExpressionPtr ExpressionTree::Convert(const ValueExpressionPtr& sourceValue
         }
         case ExpressionValueType::Decimal:
         {
+            // Decimal values, compact or not, need no conversion
+            if (targetValueType == ExpressionValueType::Decimal)
+                return sourceValue;
+
             const decimal_t value = sourceValue->ValueAsDecimal();
 
             switch (targetValueType)
@@ -3162,7 +3409,7 @@ ValueExpressionPtr ExpressionTree::Convert(const ValueExpressionPtr& sourceValue
     return NewSharedPtr<ValueExpression>(targetValueType, targetValue);
 }
 
-ValueExpressionPtr ExpressionTree::EvaluateRegEx(const string& functionName, const ValueExpressionPtr& regexValue, const ValueExpressionPtr& testValue, const bool returnMatchedValue) const
+ValueExpressionPtr ExpressionTree::EvaluateRegEx(const string& functionName, const ValueExpressionPtr& regexValue, const ValueExpressionPtr& testValue, const bool returnMatchedValue, const regex* expression) const
 {
     if (regexValue->ValueType != ExpressionValueType::String)
         throw ExpressionTreeException("\"" + functionName + "\" function expression value, first argument, must be a string");
@@ -3173,12 +3420,18 @@ ValueExpressionPtr ExpressionTree::EvaluateRegEx(const string& functionName, con
     if (regexValue->IsNull() || testValue->IsNull())
         return NullValue(returnMatchedValue ? ExpressionValueType::String : ExpressionValueType::Boolean);
 
-    const string expressionText = regexValue->ValueAsString();
     const string testText = testValue->ValueAsString();
-    const regex expression(expressionText);
+    regex parsedExpression;
+
+    // Constant expressions are compiled once during preparation
+    if (expression == nullptr)
+    {
+        parsedExpression = regex(regexValue->ValueAsString());
+        expression = &parsedExpression;
+    }
 
     smatch match;
-    const bool result = regex_search(testText, match, expression);
+    const bool result = regex_search(testText, match, *expression);
 
     if (returnMatchedValue)
     {
@@ -3193,8 +3446,460 @@ ValueExpressionPtr ExpressionTree::EvaluateRegEx(const string& functionName, con
     return result ? ExpressionTree::True : ExpressionTree::False;
 }
 
+const ExpressionPtr& ExpressionTree::GetPreparedRoot()
+{
+    // Prepare again when root expression has been replaced
+    if (!m_prepared || m_preparedSource != Root)
+    {
+        bool isConstant;
+
+        m_likePatterns.clear();
+        m_regexPatterns.clear();
+        m_inListSets.clear();
+
+        m_preparedRoot = Prepare(Root, isConstant);
+        m_preparedSource = Root;
+        m_prepared = true;
+    }
+
+    return m_preparedRoot;
+}
+
+ExpressionPtr ExpressionTree::Prepare(const ExpressionPtr& expression, bool& isConstant)
+{
+    isConstant = true;
+
+    if (expression == nullptr)
+        return expression;
+
+    ExpressionPtr preparedExpression = expression;
+
+    switch (expression->Type)
+    {
+        case ExpressionType::Value:
+            return expression;
+        case ExpressionType::Column:
+            isConstant = false;
+            return expression;
+        case ExpressionType::Unary:
+        {
+            const UnaryExpressionPtr unaryExpression = CastSharedPtr<UnaryExpression>(expression);
+            const ExpressionPtr value = Prepare(unaryExpression->Value, isConstant);
+
+            if (value != unaryExpression->Value)
+                preparedExpression = CastSharedPtr<Expression>(NewSharedPtr<UnaryExpression>(unaryExpression->UnaryType, value));
+
+            break;
+        }
+        case ExpressionType::InList:
+        {
+            const InListExpressionPtr inListExpression = CastSharedPtr<InListExpression>(expression);
+            const ExpressionPtr value = Prepare(inListExpression->Value, isConstant);
+            const ExpressionCollectionPtr arguments = PrepareArguments(inListExpression->Arguments, isConstant);
+
+            if (value != inListExpression->Value || arguments != inListExpression->Arguments)
+                preparedExpression = CastSharedPtr<Expression>(NewSharedPtr<InListExpression>(value, arguments, inListExpression->HasNotKeyword, inListExpression->ExactMatch));
+
+            if (!isConstant)
+                PrepareInListSet(CastSharedPtr<InListExpression>(preparedExpression));
+
+            break;
+        }
+        case ExpressionType::Function:
+        {
+            const FunctionExpressionPtr functionExpression = CastSharedPtr<FunctionExpression>(expression);
+            const ExpressionFunctionType functionType = functionExpression->FunctionType;
+            const ExpressionCollectionPtr arguments = PrepareArguments(functionExpression->Arguments, isConstant);
+
+            if (arguments != functionExpression->Arguments)
+                preparedExpression = CastSharedPtr<Expression>(NewSharedPtr<FunctionExpression>(functionType, arguments));
+
+            // Current time functions are never constant
+            if (functionType == ExpressionFunctionType::Now || functionType == ExpressionFunctionType::UtcNow)
+                isConstant = false;
+
+            if (!isConstant && (functionType == ExpressionFunctionType::RegExMatch || functionType == ExpressionFunctionType::RegExVal))
+                PrepareRegEx(CastSharedPtr<FunctionExpression>(preparedExpression));
+
+            break;
+        }
+        case ExpressionType::Operator:
+        {
+            const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
+            bool rightIsConstant;
+
+            const ExpressionPtr leftValue = Prepare(operatorExpression->LeftValue, isConstant);
+            const ExpressionPtr rightValue = Prepare(operatorExpression->RightValue, rightIsConstant);
+            isConstant = isConstant && rightIsConstant;
+
+            if (leftValue != operatorExpression->LeftValue || rightValue != operatorExpression->RightValue)
+                preparedExpression = CastSharedPtr<Expression>(NewSharedPtr<OperatorExpression>(operatorExpression->OperatorType, leftValue, rightValue));
+
+            if (!isConstant)
+                PrepareLikePattern(CastSharedPtr<OperatorExpression>(preparedExpression));
+
+            break;
+        }
+        default:
+            throw ExpressionTreeException("Unexpected expression type encountered");
+    }
+
+    if (!isConstant)
+        return preparedExpression;
+
+    // Fold constant expression to its value, evaluation errors are left to be reported for each row
+    ValueExpressionPtr value;
+
+    try
+    {
+        value = Evaluate(preparedExpression);
+    }
+    catch (...)
+    {
+        return preparedExpression;
+    }
+
+    // Undefined values take on type of evaluation target
+    if (value->ValueType == ExpressionValueType::Undefined)
+        return preparedExpression;
+
+    return CastSharedPtr<Expression>(value);
+}
+
+ExpressionCollectionPtr ExpressionTree::PrepareArguments(const ExpressionCollectionPtr& arguments, bool& isConstant)
+{
+    ExpressionCollectionPtr preparedArguments = arguments;
+
+    for (size_t i = 0; i < arguments->size(); i++)
+    {
+        bool argumentIsConstant;
+        const ExpressionPtr argument = Prepare(arguments->at(i), argumentIsConstant);
+
+        isConstant = isConstant && argumentIsConstant;
+
+        if (argument == arguments->at(i))
+            continue;
+
+        // Copy collection on first changed argument
+        if (preparedArguments == arguments)
+            preparedArguments = NewSharedPtr<ExpressionCollection>(*arguments);
+
+        preparedArguments->at(i) = argument;
+    }
+
+    return preparedArguments;
+}
+
+void ExpressionTree::PrepareInListSet(const InListExpressionPtr& inListExpression)
+{
+    const ExpressionPtr& value = inListExpression->Value;
+    ExpressionValueType valueType;
+
+    // Test value type must be known before evaluation, i.e., a column reference
+    if (value == nullptr || value->Type != ExpressionType::Column || !TryGetColumnValueType(CastSharedPtr<ColumnExpression>(value)->DataColumn, valueType))
+        return;
+
+    if (!InListSet::IsSupportedType(valueType))
+        return;
+
+    const InListSetPtr inListSet = NewSharedPtr<InListSet>(valueType, inListExpression->ExactMatch);
+
+    for (const ExpressionPtr& argument : *inListExpression->Arguments)
+    {
+        // Only non-null constants compared as the test value type can be hashed
+        if (argument == nullptr || argument->Type != ExpressionType::Value)
+            return;
+
+        const ValueExpressionPtr argumentValue = CastSharedPtr<ValueExpression>(argument);
+
+        if (argumentValue->IsNull())
+            return;
+
+        try
+        {
+            if (DeriveComparisonOperationValueType(ExpressionOperatorType::Equal, valueType, argumentValue->ValueType) != valueType)
+                return;
+
+            inListSet->Add(Convert(argumentValue, valueType));
+        }
+        catch (...)
+        {
+            return;
+        }
+    }
+
+    m_inListSets[inListExpression.get()] = inListSet;
+}
+
+void ExpressionTree::PrepareLikePattern(const OperatorExpressionPtr& operatorExpression)
+{
+    switch (operatorExpression->OperatorType)
+    {
+        case ExpressionOperatorType::Like:
+        case ExpressionOperatorType::LikeExactMatch:
+        case ExpressionOperatorType::NotLike:
+        case ExpressionOperatorType::NotLikeExactMatch:
+            break;
+        default:
+            return;
+    }
+
+    const ExpressionPtr& rightValue = operatorExpression->RightValue;
+
+    if (rightValue == nullptr || rightValue->Type != ExpressionType::Value)
+        return;
+
+    const ValueExpressionPtr pattern = CastSharedPtr<ValueExpression>(rightValue);
+
+    if (pattern->ValueType != ExpressionValueType::String || pattern->IsNull())
+        return;
+
+    // Invalid patterns are left to be reported during evaluation
+    try
+    {
+        m_likePatterns[operatorExpression.get()] = ParseLikePattern(pattern->ValueAsString());
+    }
+    catch (const ExpressionTreeException&)
+    {
+    }
+}
+
+void ExpressionTree::PrepareRegEx(const FunctionExpressionPtr& functionExpression)
+{
+    const ExpressionCollectionPtr& arguments = functionExpression->Arguments;
+
+    if (arguments->empty() || arguments->at(0) == nullptr || arguments->at(0)->Type != ExpressionType::Value)
+        return;
+
+    const ValueExpressionPtr regexValue = CastSharedPtr<ValueExpression>(arguments->at(0));
+
+    if (regexValue->ValueType != ExpressionValueType::String || regexValue->IsNull())
+        return;
+
+    // Invalid expressions are left to be reported during evaluation
+    try
+    {
+        m_regexPatterns[functionExpression.get()] = NewSharedPtr<regex>(regexValue->ValueAsString());
+    }
+    catch (const regex_error&)
+    {
+    }
+}
+
+LikePatternPtr ExpressionTree::ParseLikePattern(const string& pattern)
+{
+    LikePatternPtr likePattern = NewSharedPtr<LikePattern>();
+    string& testExpression = likePattern->TestExpression;
+
+    testExpression = GSF::Replace(pattern, "%", "*", false);
+    likePattern->StartsWithWildcard = GSF::StartsWith(testExpression, "*", false);
+    likePattern->EndsWithWildcard = GSF::EndsWith(testExpression, "*", false);
+
+    if (likePattern->StartsWithWildcard)
+        testExpression = testExpression.substr(1);
+
+    if (likePattern->EndsWithWildcard && !testExpression.empty())
+        testExpression = testExpression.substr(0, testExpression.size() - 1);
+
+    // Wild cards in the middle of the string are not supported, "*" or "**" expression means match everything
+    if (!testExpression.empty() && GSF::Contains(testExpression, "*", false))
+        throw ExpressionTreeException("Right operand of \"LIKE\" expression \"" + pattern + "\" has an invalid pattern");
+
+    return likePattern;
+}
+
+bool ExpressionTree::PlanCandidateRows(const ExpressionPtr& expression, vector<int32_t>& rowIndexes, string* plan)
+{
+    if (expression == nullptr)
+        return false;
+
+    if (expression->Type == ExpressionType::InList)
+    {
+        const InListExpressionPtr inListExpression = CastSharedPtr<InListExpression>(expression);
+        const ExpressionPtr& value = inListExpression->Value;
+
+        if (inListExpression->HasNotKeyword || value == nullptr || value->Type != ExpressionType::Column)
+            return false;
+
+        return SeekIndex(CastSharedPtr<ColumnExpression>(value)->DataColumn, *inListExpression->Arguments, rowIndexes, plan);
+    }
+
+    if (expression->Type != ExpressionType::Operator)
+        return false;
+
+    const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
+    const ExpressionPtr& leftValue = operatorExpression->LeftValue;
+    const ExpressionPtr& rightValue = operatorExpression->RightValue;
+
+    if (leftValue == nullptr || rightValue == nullptr)
+        return false;
+
+    switch (operatorExpression->OperatorType)
+    {
+        case ExpressionOperatorType::Equal:
+        case ExpressionOperatorType::EqualExactMatch:
+        {
+            // Index keys are case-insensitive, exact matching is applied by the residual filter
+            if (leftValue->Type == ExpressionType::Column && rightValue->Type == ExpressionType::Value)
+                return SeekIndex(CastSharedPtr<ColumnExpression>(leftValue)->DataColumn, ExpressionCollection { rightValue }, rowIndexes, plan);
+
+            if (leftValue->Type == ExpressionType::Value && rightValue->Type == ExpressionType::Column)
+                return SeekIndex(CastSharedPtr<ColumnExpression>(rightValue)->DataColumn, ExpressionCollection { leftValue }, rowIndexes, plan);
+
+            return false;
+        }
+        case ExpressionOperatorType::And:
+        {
+            vector<int32_t> leftRows, rightRows;
+            string leftPlan, rightPlan;
+            const bool leftPlanned = PlanCandidateRows(leftValue, leftRows, plan == nullptr ? nullptr : &leftPlan);
+            const bool rightPlanned = PlanCandidateRows(rightValue, rightRows, plan == nullptr ? nullptr : &rightPlan);
+
+            // Either planned operand limits candidates, unplanned operand is left to residual filter
+            if (leftPlanned && rightPlanned)
+            {
+                rowIndexes.clear();
+                set_intersection(leftRows.begin(), leftRows.end(), rightRows.begin(), rightRows.end(), back_inserter(rowIndexes));
+
+                if (plan != nullptr)
+                    *plan = "INTERSECT(" + leftPlan + ", " + rightPlan + ")";
+            }
+            else if (leftPlanned)
+            {
+                rowIndexes.swap(leftRows);
+
+                if (plan != nullptr)
+                    plan->swap(leftPlan);
+            }
+            else if (rightPlanned)
+            {
+                rowIndexes.swap(rightRows);
+
+                if (plan != nullptr)
+                    plan->swap(rightPlan);
+            }
+
+            return leftPlanned || rightPlanned;
+        }
+        case ExpressionOperatorType::Or:
+        {
+            vector<int32_t> leftRows, rightRows;
+            string leftPlan, rightPlan;
+
+            // Both operands must be planned, otherwise any row could match
+            if (!PlanCandidateRows(leftValue, leftRows, plan == nullptr ? nullptr : &leftPlan) || !PlanCandidateRows(rightValue, rightRows, plan == nullptr ? nullptr : &rightPlan))
+                return false;
+
+            rowIndexes.clear();
+            set_union(leftRows.begin(), leftRows.end(), rightRows.begin(), rightRows.end(), back_inserter(rowIndexes));
+
+            if (plan != nullptr)
+                *plan = "UNION(" + leftPlan + ", " + rightPlan + ")";
+
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+bool ExpressionTree::SeekIndex(const DataColumnPtr& column, const ExpressionCollection& values, vector<int32_t>& rowIndexes, string* plan)
+{
+    ExpressionValueType valueType;
+
+    if (column == nullptr || column->Parent() != m_table || !TryGetColumnValueType(column, valueType))
+        return false;
+
+    const DataTableIndexPtr index = m_table->Index(column->Index());
+
+    if (index == nullptr)
+        return false;
+
+    vector<const vector<int32_t>*> matchedRows;
+
+    for (const ExpressionPtr& value : values)
+    {
+        if (value == nullptr || value->Type != ExpressionType::Value)
+            return false;
+
+        const ValueExpressionPtr constantValue = CastSharedPtr<ValueExpression>(value);
+
+        // Null never compares as equal, so it cannot add candidate rows
+        if (constantValue->IsNull())
+            continue;
+
+        ValueExpressionPtr key;
+
+        try
+        {
+            // Constant must compare as the column value type, integer types share the same keys
+            const ExpressionValueType comparisonValueType = DeriveComparisonOperationValueType(ExpressionOperatorType::Equal, valueType, constantValue->ValueType);
+
+            if (comparisonValueType != valueType && !(IsIntegerType(comparisonValueType) && IsIntegerType(valueType)))
+                return false;
+
+            key = Convert(constantValue, comparisonValueType);
+        }
+        catch (...)
+        {
+            return false;
+        }
+
+        if (key->IsNull())
+            continue;
+
+        const vector<int32_t>* rows;
+
+        switch (key->ValueType)
+        {
+            case ExpressionValueType::Boolean:
+                rows = index->FindRowsByInteger(key->ValueAsBoolean() ? 1 : 0);
+                break;
+            case ExpressionValueType::Int32:
+                rows = index->FindRowsByInteger(key->ValueAsInt32());
+                break;
+            case ExpressionValueType::Int64:
+                rows = index->FindRowsByInteger(key->ValueAsInt64());
+                break;
+            case ExpressionValueType::Double:
+                rows = index->FindRowsByDouble(key->ValueAsDouble());
+                break;
+            case ExpressionValueType::String:
+                rows = index->FindRowsByString(key->ValueAsString());
+                break;
+            case ExpressionValueType::Guid:
+                rows = index->FindRowsByGuid(key->ValueAsGuid());
+                break;
+            default:
+                return false;
+        }
+
+        if (rows != nullptr)
+            matchedRows.push_back(rows);
+    }
+
+    rowIndexes.clear();
+
+    for (const vector<int32_t>* rows : matchedRows)
+        rowIndexes.insert(rowIndexes.end(), rows->begin(), rows->end());
+
+    // Keep table order, repeated keys may list the same rows
+    if (matchedRows.size() > 1)
+    {
+        sort(rowIndexes.begin(), rowIndexes.end());
+        rowIndexes.erase(unique(rowIndexes.begin(), rowIndexes.end()), rowIndexes.end());
+    }
+
+    if (plan != nullptr)
+        *plan = "INDEX SEEK [" + column->Name() + "] (" + ToString(values.size()) + (values.size() == 1 ? " key, " : " keys, ") + ToString(rowIndexes.size()) + " rows)";
+
+    return true;
+}
+
 ExpressionTree::ExpressionTree(DataTablePtr table) :
     m_table(std::move(table)),
+    m_prepared(false),
+    m_programCompiled(false),
     TopLimit(-1)
 {
 }
@@ -3204,10 +3909,69 @@ const DataTablePtr& ExpressionTree::Table() const
     return m_table;
 }
 
+const ExpressionProgramPtr& ExpressionTree::GetProgram()
+{
+    const ExpressionPtr& root = GetPreparedRoot();
+
+    // Recompile when root expression has been replaced
+    if (!m_programCompiled || m_programRoot != root)
+    {
+        m_program = ExpressionProgram::Compile(*this, root);
+        m_programRoot = root;
+        m_programCompiled = true;
+    }
+
+    return m_program;
+}
+
+bool ExpressionTree::SelectCandidateRows(vector<int32_t>& rowIndexes)
+{
+    return PlanCandidateRows(GetPreparedRoot(), rowIndexes, nullptr);
+}
+
+string ExpressionTree::Explain()
+{
+    stringstream plan;
+    vector<int32_t> rowIndexes;
+    string accessPlan;
+
+    if (PlanCandidateRows(GetPreparedRoot(), rowIndexes, &accessPlan))
+        plan << accessPlan;
+    else
+        plan << "TABLE SCAN [" << m_table->Name() << "] (" << m_table->RowCount() << " rows)";
+
+    plan << " -> FILTER (" << (UseCompiledProgram && GetProgram() != nullptr ? "compiled" : "interpreted") << ")";
+
+    if (TopLimit > -1)
+        plan << " -> TOP " << TopLimit;
+
+    for (size_t i = 0; i < OrderByTerms.size(); i++)
+    {
+        const auto& orderByTerm = OrderByTerms[i];
+
+        plan << (i == 0 ? " -> ORDER BY " : ", ") << "[" << get<0>(orderByTerm)->Name() << "]";
+
+        if (!get<1>(orderByTerm))
+            plan << " DESC";
+    }
+
+    return plan.str();
+}
+
 ValueExpressionPtr ExpressionTree::Evaluate(const DataRowPtr& row)
 {
+    if (UseCompiledProgram && row != nullptr && row->Parent() == m_table)
+    {
+        const ExpressionProgramPtr& program = GetProgram();
+
+        if (program != nullptr)
+            return ExpressionProgram::ToValueExpression(program->Execute(*row));
+    }
+
+    const ExpressionPtr& root = GetPreparedRoot();
+
     m_currentRow = row;
-    return Evaluate(Root);
+    return Evaluate(root);
 }
 
 const ValueExpressionPtr ExpressionTree::True = NewSharedPtr<ValueExpression>(ExpressionValueType::Boolean, true);
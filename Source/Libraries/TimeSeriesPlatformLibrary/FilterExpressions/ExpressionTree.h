@@ -26,6 +26,8 @@
 
 #include "../../Common/CommonTypes.h"
 #include "../../Data/DataSet.h"
+#include <regex>
+#include <unordered_set>
 
 namespace GSF {
 namespace FilterExpressions
@@ -75,7 +77,7 @@ namespace FilterExpressions
         Boolean,    // bool
         Int32,      // int32_t
         Int64,      // int64_t
-        Decimal,    // decimal_t
+        Decimal,    // decimal_t, or Decimal128 when value fits compact form
         Double,     // float64_t
         String,     // string
         Guid,       // Guid
@@ -118,6 +120,9 @@ namespace FilterExpressions
         GSF::decimal_t ValueAsDecimal() const;
         Nullable<GSF::decimal_t> ValueAsNullableDecimal() const;
 
+        // Gets decimal value held in compact form, returns false when value is null or held as decimal_t
+        bool TryGetCompactDecimal(GSF::Decimal128& value) const;
+
         GSF::float64_t ValueAsDouble() const;
         Nullable<GSF::float64_t> ValueAsNullableDouble() const;
 
@@ -278,11 +283,78 @@ namespace FilterExpressions
 
     typedef GSF::SharedPtr<OperatorExpression> OperatorExpressionPtr;
 
+    // Hashed set of constant IN list arguments, converted to the value type of the
+    // tested expression, used in place of a linear scan of the arguments per row
+    class InListSet // NOLINT
+    {
+    private:
+        std::unordered_set<int64_t> m_integerValues;
+        std::unordered_set<GSF::float64_t> m_doubleValues;
+        std::unordered_set<std::string> m_stringValues;
+        std::unordered_set<std::string, GSF::StringHash, GSF::StringEqual> m_ignoreCaseStringValues;
+        std::unordered_set<GSF::Guid> m_guidValues;
+
+    public:
+        InListSet(ExpressionValueType valueType, bool exactMatch);
+
+        const ExpressionValueType ValueType;
+        const bool ExactMatch;
+
+        void Add(const ValueExpressionPtr& value);
+        bool Contains(const ValueExpressionPtr& value) const;
+
+        bool ContainsInteger(int64_t value) const;
+        bool ContainsDouble(GSF::float64_t value) const;
+        bool ContainsString(const std::string& value) const;
+        bool ContainsGuid(const GSF::Guid& value) const;
+
+        static bool IsSupportedType(ExpressionValueType valueType);
+    };
+
+    typedef GSF::SharedPtr<InListSet> InListSetPtr;
+
+    // LIKE expression pattern with leading and trailing wildcards removed
+    struct LikePattern
+    {
+        std::string TestExpression;
+        bool StartsWithWildcard;
+        bool EndsWithWildcard;
+    };
+
+    typedef GSF::SharedPtr<LikePattern> LikePatternPtr;
+
+    class ExpressionProgram;
+    typedef GSF::SharedPtr<ExpressionProgram> ExpressionProgramPtr;
+
     class ExpressionTree
     {
     private:
         GSF::Data::DataRowPtr m_currentRow;
         GSF::Data::DataTablePtr m_table;
+        ExpressionPtr m_preparedRoot;
+        ExpressionPtr m_preparedSource;
+        bool m_prepared;
+        ExpressionProgramPtr m_program;
+        ExpressionPtr m_programRoot;
+        bool m_programCompiled;
+
+        // Operand state derived once for prepared expressions with constant operands
+        std::unordered_map<const Expression*, LikePatternPtr> m_likePatterns;
+        std::unordered_map<const Expression*, GSF::SharedPtr<std::regex>> m_regexPatterns;
+        std::unordered_map<const Expression*, InListSetPtr> m_inListSets;
+
+        // Expression preparation, i.e., constant folding and operand precompilation
+        const ExpressionPtr& GetPreparedRoot();
+        ExpressionPtr Prepare(const ExpressionPtr& expression, bool& isConstant);
+        ExpressionCollectionPtr PrepareArguments(const ExpressionCollectionPtr& arguments, bool& isConstant);
+        void PrepareInListSet(const InListExpressionPtr& inListExpression);
+        void PrepareLikePattern(const OperatorExpressionPtr& operatorExpression);
+        void PrepareRegEx(const FunctionExpressionPtr& functionExpression);
+        static LikePatternPtr ParseLikePattern(const std::string& pattern);
+
+        // Index-aware row selection planning
+        bool PlanCandidateRows(const ExpressionPtr& expression, std::vector<int32_t>& rowIndexes, std::string* plan);
+        bool SeekIndex(const GSF::Data::DataColumnPtr& column, const ExpressionCollection& values, std::vector<int32_t>& rowIndexes, std::string* plan);
 
         ValueExpressionPtr Evaluate(const ExpressionPtr& expression, ExpressionValueType targetValueType = ExpressionValueType::Boolean) const;
         ValueExpressionPtr EvaluateUnary(const ExpressionPtr& expression) const;
@@ -324,8 +396,8 @@ namespace FilterExpressions
         ValueExpressionPtr Now() const;
         ValueExpressionPtr NthIndexOf(const ValueExpressionPtr& sourceValue, const ValueExpressionPtr& testValue, const ValueExpressionPtr& indexValue, const ValueExpressionPtr& ignoreCase) const;
         ValueExpressionPtr Power(const ValueExpressionPtr& sourceValue, const ValueExpressionPtr& exponentValue) const;
-        ValueExpressionPtr RegExMatch(const ValueExpressionPtr& regexValue, const ValueExpressionPtr& testValue) const;
-        ValueExpressionPtr RegExVal(const ValueExpressionPtr& regexValue, const ValueExpressionPtr& testValue) const;
+        ValueExpressionPtr RegExMatch(const ValueExpressionPtr& regexValue, const ValueExpressionPtr& testValue, const std::regex* expression = nullptr) const;
+        ValueExpressionPtr RegExVal(const ValueExpressionPtr& regexValue, const ValueExpressionPtr& testValue, const std::regex* expression = nullptr) const;
         ValueExpressionPtr Replace(const ValueExpressionPtr& sourceValue, const ValueExpressionPtr& testValue, const ValueExpressionPtr& replaceValue, const ValueExpressionPtr& ignoreCase) const;
         ValueExpressionPtr Reverse(const ValueExpressionPtr& sourceValue) const;
         ValueExpressionPtr Round(const ValueExpressionPtr& sourceValue) const;
@@ -360,8 +432,8 @@ namespace FilterExpressions
         ValueExpressionPtr NotEqual(const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue, ExpressionValueType valueType, bool exactMatch = false) const;
         ValueExpressionPtr IsNull(const ValueExpressionPtr& leftValue) const;
         ValueExpressionPtr IsNotNull(const ValueExpressionPtr& leftValue) const;
-        ValueExpressionPtr Like(const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue, bool exactMatch = false) const;
-        ValueExpressionPtr NotLike(const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue, bool exactMatch = false) const;
+        ValueExpressionPtr Like(const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue, bool exactMatch = false, const LikePattern* pattern = nullptr) const;
+        ValueExpressionPtr NotLike(const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue, bool exactMatch = false, const LikePattern* pattern = nullptr) const;
         ValueExpressionPtr And(const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue) const;
         ValueExpressionPtr Or(const ValueExpressionPtr& leftValue, const ValueExpressionPtr& rightValue) const;
 
@@ -374,7 +446,7 @@ namespace FilterExpressions
         static bool UnaryBool(bool unaryValue, ExpressionUnaryType unaryOperation);
 
         ValueExpressionPtr Convert(const ValueExpressionPtr& sourceValue, ExpressionValueType targetValueType) const;
-        ValueExpressionPtr EvaluateRegEx(const std::string& functionName, const ValueExpressionPtr& regexValue, const ValueExpressionPtr& testValue, bool returnMatchedValue) const;
+        ValueExpressionPtr EvaluateRegEx(const std::string& functionName, const ValueExpressionPtr& regexValue, const ValueExpressionPtr& testValue, bool returnMatchedValue, const std::regex* expression) const;
     public:
         ExpressionTree(GSF::Data::DataTablePtr table);
 
@@ -384,12 +456,37 @@ namespace FilterExpressions
 
         ExpressionPtr Root = nullptr;
 
+        // Determines if rows are evaluated with a compiled program when
+        // root expression is supported by the compiler, defaults to true
+        bool UseCompiledProgram = true;
+
+        // Maximum number of threads used to evaluate rows of a compiled program during a select
+        // operation, 0 uses all processors, defaults to 1, i.e., serial evaluation
+        int32_t MaxDegreeOfParallelism = 1;
+
+        // Minimum number of rows to evaluate before a select operation is partitioned across threads
+        int32_t ParallelRowThreshold = 50000;
+
+        // Gets program compiled from prepared root expression, nullptr when not supported
+        const ExpressionProgramPtr& GetProgram();
+
         ValueExpressionPtr Evaluate(const GSF::Data::DataRowPtr& row);
 
+        // Gets ascending indexes of the table rows that can match the prepared root expression using
+        // the hash indexes of the table, returns false when the expression requires a table scan.
+        // Candidate rows are a superset of the matching rows, full expression must still be evaluated.
+        bool SelectCandidateRows(std::vector<int32_t>& rowIndexes);
+
+        // Describes how rows will be selected for the expression tree, e.g.:
+        // INDEX SEEK [SignalID] (2 keys, 2 rows) -> FILTER (compiled)
+        std::string Explain();
+
         static const ValueExpressionPtr True;
         static const ValueExpressionPtr False;
         static const ValueExpressionPtr EmptyString;
         static ValueExpressionPtr NullValue(ExpressionValueType targetValueType);
+
+        friend class ExpressionProgram;
     };
 
     typedef GSF::SharedPtr<ExpressionTree> ExpressionTreePtr;
@@ -0,0 +1,354 @@
+//******************************************************************************************************
+//  FilterExpressionCache.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "FilterExpressionCache.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+using namespace GSF::FilterExpressions;
+
+namespace
+{
+    // Column reference of a cached expression, holds column name only so that cache does not keep tables alive
+    class UnboundColumnExpression : public ColumnExpression
+    {
+    public:
+        UnboundColumnExpression(string columnName) :
+            ColumnExpression(nullptr),
+            ColumnName(std::move(columnName))
+        {
+        }
+
+        const string ColumnName;
+    };
+
+    template<typename TReplaceColumn>
+    ExpressionPtr ReplaceColumns(const ExpressionPtr& expression, const TReplaceColumn& replaceColumn);
+
+    template<typename TReplaceColumn>
+    ExpressionCollectionPtr ReplaceColumns(const ExpressionCollectionPtr& arguments, const TReplaceColumn& replaceColumn, bool& replaced)
+    {
+        replaced = true;
+
+        if (arguments == nullptr)
+            return arguments;
+
+        ExpressionCollectionPtr result = NewSharedPtr<ExpressionCollection>();
+        bool changed = false;
+
+        result->reserve(arguments->size());
+
+        for (const auto& argument : *arguments)
+        {
+            result->push_back(ReplaceColumns(argument, replaceColumn));
+
+            if (result->back() == nullptr && argument != nullptr)
+            {
+                replaced = false;
+                return nullptr;
+            }
+
+            changed |= result->back() != argument;
+        }
+
+        return changed ? result : arguments;
+    }
+
+    // Copies expression with each column expression replaced, subtrees without columns are shared with
+    // source expression. Returns nullptr when a column expression could not be replaced.
+    template<typename TReplaceColumn>
+    ExpressionPtr ReplaceColumns(const ExpressionPtr& expression, const TReplaceColumn& replaceColumn)
+    {
+        if (expression == nullptr)
+            return expression;
+
+        switch (expression->Type)
+        {
+            case ExpressionType::Column:
+                return replaceColumn(*CastSharedPtr<ColumnExpression>(expression));
+            case ExpressionType::Unary:
+            {
+                const UnaryExpressionPtr unaryExpression = CastSharedPtr<UnaryExpression>(expression);
+                const ExpressionPtr value = ReplaceColumns(unaryExpression->Value, replaceColumn);
+
+                if (value == nullptr)
+                    return nullptr;
+
+                return value == unaryExpression->Value ? expression : NewSharedPtr<UnaryExpression>(unaryExpression->UnaryType, value);
+            }
+            case ExpressionType::InList:
+            {
+                const InListExpressionPtr inListExpression = CastSharedPtr<InListExpression>(expression);
+                const ExpressionPtr value = ReplaceColumns(inListExpression->Value, replaceColumn);
+                bool replaced;
+                const ExpressionCollectionPtr arguments = ReplaceColumns(inListExpression->Arguments, replaceColumn, replaced);
+
+                if (value == nullptr || !replaced)
+                    return nullptr;
+
+                if (value == inListExpression->Value && arguments == inListExpression->Arguments)
+                    return expression;
+
+                return NewSharedPtr<InListExpression>(value, arguments, inListExpression->HasNotKeyword, inListExpression->ExactMatch);
+            }
+            case ExpressionType::Function:
+            {
+                const FunctionExpressionPtr functionExpression = CastSharedPtr<FunctionExpression>(expression);
+                bool replaced;
+                const ExpressionCollectionPtr arguments = ReplaceColumns(functionExpression->Arguments, replaceColumn, replaced);
+
+                if (!replaced)
+                    return nullptr;
+
+                return arguments == functionExpression->Arguments ? expression : NewSharedPtr<FunctionExpression>(functionExpression->FunctionType, arguments);
+            }
+            case ExpressionType::Operator:
+            {
+                const OperatorExpressionPtr operatorExpression = CastSharedPtr<OperatorExpression>(expression);
+                const ExpressionPtr leftValue = ReplaceColumns(operatorExpression->LeftValue, replaceColumn);
+                const ExpressionPtr rightValue = ReplaceColumns(operatorExpression->RightValue, replaceColumn);
+
+                if ((leftValue == nullptr && operatorExpression->LeftValue != nullptr) || (rightValue == nullptr && operatorExpression->RightValue != nullptr))
+                    return nullptr;
+
+                if (leftValue == operatorExpression->LeftValue && rightValue == operatorExpression->RightValue)
+                    return expression;
+
+                return NewSharedPtr<OperatorExpression>(operatorExpression->OperatorType, leftValue, rightValue);
+            }
+            default:
+                return expression;
+        }
+    }
+}
+
+FilterExpressionCache::FilterExpressionCache(const size_t capacity) :
+    m_capacity(capacity),
+    m_hitCount(0UL),
+    m_missCount(0UL)
+{
+}
+
+void FilterExpressionCache::Evict()
+{
+    // Least recently used entries are at the back of the list
+    while (m_entries.size() > m_capacity)
+    {
+        m_entryMap.erase(m_entries.back().Key);
+        m_entries.pop_back();
+    }
+}
+
+string FilterExpressionCache::CreateKey(const string& primaryTableName, const string& filterExpression, const bool identifiersAsExpressions)
+{
+    // Whitespace surrounding the expression is ignored by the lexer, so it is removed from the key
+    string key(1, identifiersAsExpressions ? '1' : '0');
+
+    key.append(primaryTableName);
+    key.push_back('\0');
+    key.append(GSF::Trim(filterExpression));
+
+    return key;
+}
+
+vector<FilterExpressionCache::UnboundStatement> FilterExpressionCache::Unbind(const vector<FilterExpressionStatement>& statements)
+{
+    vector<UnboundStatement> unboundStatements;
+    unboundStatements.reserve(statements.size());
+
+    for (const auto& statement : statements)
+    {
+        UnboundStatement unboundStatement { statement, {}, {} };
+        FilterExpressionStatement& target = unboundStatement.Statement;
+
+        if (statement.Table != nullptr)
+        {
+            unboundStatement.TableName = statement.Table->Name();
+            target.Table = nullptr;
+        }
+
+        target.Root = ReplaceColumns(statement.Root, [](const ColumnExpression& column)
+        {
+            return NewSharedPtr<UnboundColumnExpression>(column.DataColumn->Name());
+        });
+
+        for (auto& orderByTerm : target.OrderByTerms)
+        {
+            unboundStatement.OrderByColumnNames.push_back(get<0>(orderByTerm)->Name());
+            get<0>(orderByTerm) = nullptr;
+        }
+
+        unboundStatements.push_back(std::move(unboundStatement));
+    }
+
+    return unboundStatements;
+}
+
+FilterExpressionStatementsPtr FilterExpressionCache::Bind(const vector<UnboundStatement>& statements, const DataSetPtr& dataSet)
+{
+    SharedPtr<vector<FilterExpressionStatement>> boundStatements = NewSharedPtr<vector<FilterExpressionStatement>>();
+    boundStatements->reserve(statements.size());
+
+    for (const auto& unboundStatement : statements)
+    {
+        FilterExpressionStatement statement = unboundStatement.Statement;
+
+        if (!unboundStatement.TableName.empty())
+        {
+            statement.Table = dataSet->Table(unboundStatement.TableName);
+
+            if (statement.Table == nullptr)
+                return nullptr;
+        }
+
+        const DataTablePtr& table = statement.Table;
+
+        if (statement.Root != nullptr)
+        {
+            if (table == nullptr)
+                return nullptr;
+
+            statement.Root = ReplaceColumns(statement.Root, [&table](const ColumnExpression& column) -> ExpressionPtr
+            {
+                const DataColumnPtr& dataColumn = table->Column(static_cast<const UnboundColumnExpression&>(column).ColumnName);
+                return dataColumn == nullptr ? nullptr : NewSharedPtr<ColumnExpression>(dataColumn);
+            });
+
+            if (statement.Root == nullptr)
+                return nullptr;
+        }
+
+        for (size_t i = 0; i < statement.OrderByTerms.size(); i++)
+        {
+            DataColumnPtr& orderByColumn = get<0>(statement.OrderByTerms[i]);
+            orderByColumn = table == nullptr ? nullptr : table->Column(unboundStatement.OrderByColumnNames[i]);
+
+            if (orderByColumn == nullptr)
+                return nullptr;
+        }
+
+        boundStatements->push_back(std::move(statement));
+    }
+
+    return boundStatements;
+}
+
+size_t FilterExpressionCache::GetCapacity()
+{
+    ScopeLock lock(m_mutex);
+    return m_capacity;
+}
+
+void FilterExpressionCache::SetCapacity(const size_t capacity)
+{
+    ScopeLock lock(m_mutex);
+    m_capacity = capacity;
+    Evict();
+}
+
+size_t FilterExpressionCache::Count()
+{
+    ScopeLock lock(m_mutex);
+    return m_entries.size();
+}
+
+uint64_t FilterExpressionCache::GetHitCount()
+{
+    ScopeLock lock(m_mutex);
+    return m_hitCount;
+}
+
+uint64_t FilterExpressionCache::GetMissCount()
+{
+    ScopeLock lock(m_mutex);
+    return m_missCount;
+}
+
+FilterExpressionStatementsPtr FilterExpressionCache::TryGet(const DataSetPtr& dataSet, const string& primaryTableName, const string& filterExpression, const bool identifiersAsExpressions)
+{
+    if (dataSet == nullptr)
+        return nullptr;
+
+    const string key = CreateKey(primaryTableName, filterExpression, identifiersAsExpressions);
+    ScopeLock lock(m_mutex);
+
+    if (m_capacity == 0)
+        return nullptr;
+
+    const auto iterator = m_entryMap.find(key);
+
+    if (iterator == m_entryMap.end())
+    {
+        m_missCount++;
+        return nullptr;
+    }
+
+    // Entry remains cached when dataset lacks a referenced table or column since other datasets may have them
+    const auto entry = iterator->second;
+    FilterExpressionStatementsPtr statements = Bind(entry->Statements, dataSet);
+
+    if (statements == nullptr)
+    {
+        m_missCount++;
+        return nullptr;
+    }
+
+    // Move entry to front of list as most recently used
+    m_entries.splice(m_entries.begin(), m_entries, entry);
+    m_hitCount++;
+
+    return statements;
+}
+
+void FilterExpressionCache::Add(const string& primaryTableName, const string& filterExpression, const bool identifiersAsExpressions, const vector<FilterExpressionStatement>& statements)
+{
+    string key = CreateKey(primaryTableName, filterExpression, identifiersAsExpressions);
+    vector<UnboundStatement> unboundStatements = Unbind(statements);
+    ScopeLock lock(m_mutex);
+
+    if (m_capacity == 0)
+        return;
+
+    const auto iterator = m_entryMap.find(key);
+
+    if (iterator != m_entryMap.end())
+    {
+        // Another parser may have added the same expression concurrently, refresh existing entry
+        iterator->second->Statements = std::move(unboundStatements);
+        m_entries.splice(m_entries.begin(), m_entries, iterator->second);
+        return;
+    }
+
+    m_entries.push_front({ key, std::move(unboundStatements) });
+    m_entryMap.emplace(std::move(key), m_entries.begin());
+
+    Evict();
+}
+
+void FilterExpressionCache::Invalidate()
+{
+    ScopeLock lock(m_mutex);
+    m_entryMap.clear();
+    m_entries.clear();
+}
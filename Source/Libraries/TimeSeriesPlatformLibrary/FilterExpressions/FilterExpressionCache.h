@@ -0,0 +1,117 @@
+//******************************************************************************************************
+//  FilterExpressionCache.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __FILTER_EXPRESSION_CACHE_H
+#define __FILTER_EXPRESSION_CACHE_H
+
+#include "../../Common/CommonTypes.h"
+#include "../../Data/DataSet.h"
+#include "ExpressionTree.h"
+#include <list>
+
+namespace GSF {
+namespace FilterExpressions
+{
+    // Filter expression statement captured from a parse tree so that it can be replayed without re-parsing
+    struct FilterExpressionStatement
+    {
+        enum class StatementType
+        {
+            Expression,
+            SignalID,
+            MeasurementKey,
+            PointTag
+        };
+
+        StatementType Type = StatementType::Expression;
+
+        // Identifier statement values
+        GSF::Guid SignalID;
+        std::string Identifier;
+
+        // Expression statement values, expression subtrees without column references are shared by all replays
+        GSF::Data::DataTablePtr Table;
+        ExpressionPtr Root;
+        int32_t TopLimit = -1;
+        std::vector<std::tuple<GSF::Data::DataColumnPtr, bool, bool>> OrderByTerms;
+    };
+
+    typedef GSF::SharedPtr<const std::vector<FilterExpressionStatement>> FilterExpressionStatementsPtr;
+
+    // Thread-safe, bounded LRU cache of parsed filter expression statements. Entries are keyed by the
+    // trimmed filter expression text and the primary table name. Parsed statements only depend on the
+    // names of the tables and columns they reference, so entries hold those names instead of dataset
+    // references and are bound to the tables and columns of the requested dataset when returned, any
+    // dataset with the referenced tables and columns can use an entry.
+    class FilterExpressionCache // NOLINT
+    {
+    private:
+        // Statement with table and column references replaced by their names
+        struct UnboundStatement
+        {
+            FilterExpressionStatement Statement;
+            std::string TableName;
+            std::vector<std::string> OrderByColumnNames;
+        };
+
+        struct CacheEntry
+        {
+            std::string Key;
+            std::vector<UnboundStatement> Statements;
+        };
+
+        std::list<CacheEntry> m_entries;
+        std::unordered_map<std::string, std::list<CacheEntry>::iterator> m_entryMap;
+        size_t m_capacity;
+        uint64_t m_hitCount;
+        uint64_t m_missCount;
+        GSF::Mutex m_mutex;
+
+        void Evict();
+        static std::string CreateKey(const std::string& primaryTableName, const std::string& filterExpression, bool identifiersAsExpressions);
+        static std::vector<UnboundStatement> Unbind(const std::vector<FilterExpressionStatement>& statements);
+        static FilterExpressionStatementsPtr Bind(const std::vector<UnboundStatement>& statements, const GSF::Data::DataSetPtr& dataSet);
+    public:
+        FilterExpressionCache(size_t capacity = DefaultCapacity);
+
+        // Gets or sets maximum number of cached filter expressions, zero disables caching
+        size_t GetCapacity();
+        void SetCapacity(size_t capacity);
+
+        size_t Count();
+        uint64_t GetHitCount();
+        uint64_t GetMissCount();
+
+        // Gets cached statements for filter expression bound to dataset, nullptr when not cached or
+        // when dataset does not have a referenced table or column
+        FilterExpressionStatementsPtr TryGet(const GSF::Data::DataSetPtr& dataSet, const std::string& primaryTableName, const std::string& filterExpression, bool identifiersAsExpressions);
+        void Add(const std::string& primaryTableName, const std::string& filterExpression, bool identifiersAsExpressions, const std::vector<FilterExpressionStatement>& statements);
+
+        // Removes all cached expressions
+        void Invalidate();
+
+        static constexpr size_t DefaultCapacity = 256;
+    };
+}}
+
+#endif
@@ -22,8 +22,12 @@
 //******************************************************************************************************
 
 #include "FilterExpressionParser.h"
+#include "FilterExpressionSyntaxReader.h"
+#include "ExpressionProgram.h"
 #include "tree/ParseTreeWalker.h"
 #include "../Common/Nullable.h"
+#include <atomic>
+#include <numeric>
 
 using namespace std;
 using namespace GSF;
@@ -33,56 +37,15 @@ using namespace antlr4;
 using namespace antlr4::tree;
 using namespace boost;
 
-static string ParseStringLiteral(string stringLiteral)
+// Gets hash index used to resolve identifiers for the column of the specified type, if the table owner
+// has created one, e.g., DataPublisher for its metadata. Indexes are never added to the table here since
+// an index makes every later change to the column's values take a lock and invalidate the index.
+static DataTableIndexPtr GetIdentifierIndex(const DataTablePtr& table, const DataColumnPtr& column, const DataType type)
 {
-    // Remove any surrounding quotes from string, ANTLR grammar already
-    // ensures strings starting with quote also ends with one
-    if (stringLiteral.front() == '\'')
-    {
-        stringLiteral.erase(0, 1);
-        stringLiteral.erase(stringLiteral.size() - 1);
-    }
+    if (column->Type() != type || column->Computed())
+        return nullptr;
 
-    return stringLiteral;
-}
-
-static GSF::Guid ParseGuidLiteral(string guidLiteral)
-{
-    // Remove any quotes from GUID (boost currently only handles optional braces),
-    // ANTLR grammar already ensures GUID starting with quote also ends with one
-    if (guidLiteral.front() == '\'')
-    {
-        guidLiteral.erase(0, 1);
-        guidLiteral.erase(guidLiteral.size() - 1);
-    }
-
-    return ParseGuid(guidLiteral.c_str());
-}
-
-static datetime_t ParseDateTimeLiteral(string time)
-{
-    // Remove any surrounding '#' symbols from date/time, ANTLR grammar already
-    // ensures date/time starting with '#' symbol will also end with one
-    if (time.front() == '#')
-    {
-        time.erase(0, 1);
-        time.erase(time.size() - 1);
-    }
-
-    return ParseTimestamp(time.c_str());
-}
-
-static string ParsePointTagLiteral(string pointTagLiteral)
-{
-    // Remove any double-quotes from point tag literal, ANTLR grammar already
-    // ensures tag starting with quote also ends with one
-    if (pointTagLiteral.front() == '"')
-    {
-        pointTagLiteral.erase(0, 1);
-        pointTagLiteral.erase(pointTagLiteral.size() - 1);
-    }
-
-    return pointTagLiteral;
+    return table->Index(column->Index());
 }
 
 FilterExpressionParserException::FilterExpressionParserException(string message) noexcept :
@@ -96,26 +59,30 @@ const char* FilterExpressionParserException::what() const noexcept
 }
 
 FilterExpressionParser::FilterExpressionParser(const string& filterExpression, const bool suppressConsoleErrorOutput) :
-    m_inputStream(filterExpression),
+    m_filterExpression(filterExpression),
+    m_suppressConsoleErrorOutput(suppressConsoleErrorOutput),
+    m_inputStream(nullptr),
+    m_lexer(nullptr),
+    m_tokens(nullptr),
+    m_parser(nullptr),
     m_callbackErrorListener(nullptr),
     m_dataSet(nullptr),
     m_trackFilteredRows(true),
     m_trackFilteredSignalIDs(false),
-    m_filterExpressionStatementCount(0)
+    m_filterExpressionStatementCount(0),
+    m_useExpressionCache(true),
+    m_useSyntaxReader(true),
+    m_maxDegreeOfParallelism(1),
+    m_parallelRowThreshold(50000)
 {
-    m_lexer = new FilterExpressionSyntaxLexer(&m_inputStream);
-    m_tokens = new CommonTokenStream(m_lexer);
-    m_parser = new FilterExpressionSyntaxParser(m_tokens);
-    
-    if (suppressConsoleErrorOutput)
-        m_parser->removeErrorListeners();
 }
 
 FilterExpressionParser::~FilterExpressionParser()
 {
-    delete m_lexer;
-    delete m_tokens;
     delete m_parser;
+    delete m_tokens;
+    delete m_lexer;
+    delete m_inputStream;
     delete m_callbackErrorListener;
 }
 
@@ -130,12 +97,140 @@ void FilterExpressionParser::CallbackErrorListener::syntaxError(Recognizer* reco
     m_parsingExceptionCallback(m_filterExpressionParser, msg);
 }
 
+void FilterExpressionParser::InitializeParser()
+{
+    // ANTLR lexer and parser are only created when statements are not available from the expression cache
+    if (m_parser != nullptr)
+        return;
+
+    m_inputStream = new ANTLRInputStream(m_filterExpression);
+    m_lexer = new FilterExpressionSyntaxLexer(m_inputStream);
+    m_tokens = new CommonTokenStream(m_lexer);
+    m_parser = new FilterExpressionSyntaxParser(m_tokens);
+
+    if (m_suppressConsoleErrorOutput)
+        m_parser->removeErrorListeners();
+
+    if (m_parsingExceptionCallback != nullptr)
+    {
+        m_callbackErrorListener = new CallbackErrorListener(shared_from_this(), m_parsingExceptionCallback);
+        m_parser->addErrorListener(m_callbackErrorListener);
+    }
+}
+
 void FilterExpressionParser::VisitParseTreeNodes()
 {
+    // Standalone Guids are parsed as literal values when neither rows nor signal IDs are tracked
+    const bool identifiersAsExpressions = !m_trackFilteredRows && !m_trackFilteredSignalIDs;
+    const bool useExpressionCache = m_useExpressionCache && m_dataSet != nullptr;
+
+    if (useExpressionCache && LoadCachedStatements(identifiersAsExpressions))
+        return;
+
+    if (m_useSyntaxReader && m_dataSet != nullptr && ReadStatements(identifiersAsExpressions, useExpressionCache))
+        return;
+
+    InitializeParser();
+    m_statements.clear();
+
     // Create parse tree and visit listener methods
     ParseTreeWalker walker;
     const auto parseTree = m_parser->parse();
     walker.walk(this, parseTree);
+
+    // Expressions with syntax errors are not cached so that parsing exceptions are reported for every parse
+    if (useExpressionCache && m_parser->getNumberOfSyntaxErrors() == 0 && m_lexer->getNumberOfSyntaxErrors() == 0)
+        CacheStatements(identifiersAsExpressions);
+}
+
+bool FilterExpressionParser::LoadCachedStatements(const bool identifiersAsExpressions)
+{
+    const FilterExpressionStatementsPtr statements = GetExpressionCache().TryGet(m_dataSet, m_primaryTableName, m_filterExpression, identifiersAsExpressions);
+
+    if (statements == nullptr)
+        return false;
+
+    LoadStatements(*statements);
+    return true;
+}
+
+bool FilterExpressionParser::ReadStatements(const bool identifiersAsExpressions, const bool cacheStatements)
+{
+    SharedPtr<vector<FilterExpressionStatement>> statements;
+
+    // Syntax reader has no error recovery, so any failure falls back on the ANTLR parser
+    // which reports syntax errors and exceptions the same as it always has
+    try
+    {
+        FilterExpressionSyntaxReader reader(m_filterExpression, m_dataSet, m_primaryTableName, identifiersAsExpressions);
+        statements = NewSharedPtr<vector<FilterExpressionStatement>>(reader.Read());
+    }
+    catch (...)
+    {
+        return false;
+    }
+
+    LoadStatements(*statements);
+
+    if (cacheStatements)
+        GetExpressionCache().Add(m_primaryTableName, m_filterExpression, identifiersAsExpressions, *statements);
+
+    return true;
+}
+
+void FilterExpressionParser::LoadStatements(const vector<FilterExpressionStatement>& statements)
+{
+    // Replay statements in parsed order so identifier and set operations match a parse tree walk
+    for (const auto& statement : statements)
+    {
+        m_filterExpressionStatementCount++;
+
+        if (m_filterExpressionStatementCount == 2)
+            InitializeSetOperations();
+
+        if (statement.Type != FilterExpressionStatement::StatementType::Expression)
+        {
+            ApplyIdentifierStatement(statement);
+            continue;
+        }
+
+        // Each parser gets its own expression tree since trees hold evaluation state
+        ExpressionTreePtr expressionTree = NewSharedPtr<ExpressionTree>(statement.Table);
+
+        expressionTree->Root = statement.Root;
+        expressionTree->TopLimit = statement.TopLimit;
+        expressionTree->OrderByTerms = statement.OrderByTerms;
+        expressionTree->MaxDegreeOfParallelism = m_maxDegreeOfParallelism;
+        expressionTree->ParallelRowThreshold = m_parallelRowThreshold;
+
+        m_expressionTrees.push_back(expressionTree);
+    }
+}
+
+void FilterExpressionParser::CacheStatements(const bool identifiersAsExpressions)
+{
+    SharedPtr<vector<FilterExpressionStatement>> statements = NewSharedPtr<vector<FilterExpressionStatement>>(m_statements);
+    size_t expressionTreeIndex = 0;
+
+    for (auto& statement : *statements)
+    {
+        if (statement.Type != FilterExpressionStatement::StatementType::Expression)
+            continue;
+
+        if (expressionTreeIndex >= m_expressionTrees.size())
+            return;
+
+        // Parsed tree state is copied since returned expression trees can be modified by caller
+        const ExpressionTreePtr& expressionTree = m_expressionTrees[expressionTreeIndex++];
+
+        statement.Table = expressionTree->Table();
+        statement.Root = expressionTree->Root;
+        statement.TopLimit = expressionTree->TopLimit;
+        statement.OrderByTerms = expressionTree->OrderByTerms;
+    }
+
+    if (expressionTreeIndex == m_expressionTrees.size())
+        GetExpressionCache().Add(m_primaryTableName, m_filterExpression, identifiersAsExpressions, *statements);
 }
 
 void FilterExpressionParser::InitializeSetOperations()
@@ -211,6 +306,19 @@ void FilterExpressionParser::MapMatchedFieldRow(const DataTablePtr& primaryTable
     if (column == nullptr)
         return;
 
+    const DataTableIndexPtr index = GetIdentifierIndex(primaryTable, column, DataType::String);
+
+    if (index != nullptr)
+    {
+        // Rows are indexed in table order, so first row matches linear scan
+        const vector<int32_t>* rows = index->FindRowsByString(matchValue);
+
+        if (rows != nullptr)
+            AddMatchedRow(primaryTable->Row(rows->front()), signalIDColumnIndex);
+
+        return;
+    }
+
     const int32_t columnIndex = column->Index();
 
     for (int32_t i = 0; i < primaryTable->RowCount(); i++)
@@ -280,10 +388,17 @@ void FilterExpressionParser::SetPrimaryTableName(const string& tableName)
 
 void FilterExpressionParser::RegisterParsingExceptionCallback(const ParsingExceptionCallback& parsingExceptionCallback)
 {
+    m_parsingExceptionCallback = parsingExceptionCallback;
+
+    // Error listener is registered when parser is created
+    if (m_parser == nullptr)
+        return;
+
     if (m_callbackErrorListener)
     {
         m_parser->removeErrorListener(m_callbackErrorListener);
         delete m_callbackErrorListener;
+        m_callbackErrorListener = nullptr;
     }
 
     if (parsingExceptionCallback == nullptr)
@@ -389,6 +504,46 @@ const vector<ExpressionTreePtr>& FilterExpressionParser::GetExpressionTrees()
     return m_expressionTrees;
 }
 
+bool FilterExpressionParser::GetUseExpressionCache() const
+{
+    return m_useExpressionCache;
+}
+
+void FilterExpressionParser::SetUseExpressionCache(const bool useExpressionCache)
+{
+    m_useExpressionCache = useExpressionCache;
+}
+
+bool FilterExpressionParser::GetUseSyntaxReader() const
+{
+    return m_useSyntaxReader;
+}
+
+void FilterExpressionParser::SetUseSyntaxReader(const bool useSyntaxReader)
+{
+    m_useSyntaxReader = useSyntaxReader;
+}
+
+int32_t FilterExpressionParser::GetMaxDegreeOfParallelism() const
+{
+    return m_maxDegreeOfParallelism;
+}
+
+void FilterExpressionParser::SetMaxDegreeOfParallelism(const int32_t maxDegreeOfParallelism)
+{
+    m_maxDegreeOfParallelism = maxDegreeOfParallelism;
+}
+
+int32_t FilterExpressionParser::GetParallelRowThreshold() const
+{
+    return m_parallelRowThreshold;
+}
+
+void FilterExpressionParser::SetParallelRowThreshold(const int32_t parallelRowThreshold)
+{
+    m_parallelRowThreshold = parallelRowThreshold;
+}
+
 /*
     filterExpressionStatement
      : identifierStatement
@@ -403,6 +558,7 @@ void FilterExpressionParser::enterFilterExpressionStatement(FilterExpressionSynt
     m_expressions.clear();
     m_activeExpressionTree = nullptr;
     m_filterExpressionStatementCount++;
+    m_statements.emplace_back();
 
     // Encountering second filter expression statement necessitates the use of set operations
     // to prevent possible result duplications
@@ -432,6 +588,8 @@ void FilterExpressionParser::enterFilterStatement(FilterExpressionSyntaxParser::
         throw FilterExpressionParserException("Failed to find table \"" + tableName + "\"");
 
     m_activeExpressionTree = NewSharedPtr<ExpressionTree>(table);
+    m_activeExpressionTree->MaxDegreeOfParallelism = m_maxDegreeOfParallelism;
+    m_activeExpressionTree->ParallelRowThreshold = m_parallelRowThreshold;
     m_expressionTrees.push_back(m_activeExpressionTree);
 
     if (context->K_TOP() != nullptr)
@@ -466,11 +624,11 @@ void FilterExpressionParser::enterFilterStatement(FilterExpressionSyntaxParser::
  */
 void FilterExpressionParser::exitIdentifierStatement(FilterExpressionSyntaxParser::IdentifierStatementContext* context)
 {
-    GSF::Guid signalID = Empty::Guid;
+    FilterExpressionStatement& statement = m_statements.back();
 
     if (context->GUID_LITERAL())
     {
-        signalID = ParseGuidLiteral(context->GUID_LITERAL()->getText());
+        const GSF::Guid signalID = FilterExpressionSyntaxReader::ParseGuidLiteral(context->GUID_LITERAL()->getText());
 
         if (!m_trackFilteredRows && !m_trackFilteredSignalIDs)
         {
@@ -482,7 +640,36 @@ void FilterExpressionParser::exitIdentifierStatement(FilterExpressionSyntaxParse
             m_activeExpressionTree->Root = CastSharedPtr<Expression>(NewSharedPtr<ValueExpression>(ExpressionValueType::Guid, signalID));
             return;
         }
-        
+
+        statement.Type = FilterExpressionStatement::StatementType::SignalID;
+        statement.SignalID = signalID;
+    }
+    else if (context->MEASUREMENT_KEY_LITERAL())
+    {
+        statement.Type = FilterExpressionStatement::StatementType::MeasurementKey;
+        statement.Identifier = context->MEASUREMENT_KEY_LITERAL()->getText();
+    }
+    else if (context->POINT_TAG_LITERAL())
+    {
+        statement.Type = FilterExpressionStatement::StatementType::PointTag;
+        statement.Identifier = FilterExpressionSyntaxReader::ParsePointTagLiteral(context->POINT_TAG_LITERAL()->getText());
+    }
+    else
+    {
+        return;
+    }
+
+    ApplyIdentifierStatement(statement);
+}
+
+void FilterExpressionParser::ApplyIdentifierStatement(const FilterExpressionStatement& statement)
+{
+    GSF::Guid signalID = Empty::Guid;
+
+    if (statement.Type == FilterExpressionStatement::StatementType::SignalID)
+    {
+        signalID = statement.SignalID;
+
         if (m_trackFilteredSignalIDs && signalID != Empty::Guid)
         {
             if (m_filterExpressionStatementCount > 1)
@@ -520,42 +707,59 @@ void FilterExpressionParser::exitIdentifierStatement(FilterExpressionSyntaxParse
     if (m_trackFilteredRows && signalID != Empty::Guid)
     {
         // Map matching row for manually specified Guid
-        for (int32_t i = 0; i < primaryTable->RowCount(); i++)
+        DataRowPtr matchedRow = nullptr;
+        const DataTableIndexPtr index = GetIdentifierIndex(primaryTable, signalIDColumn, DataType::Guid);
+
+        if (index != nullptr)
         {
-            const DataRowPtr& row = primaryTable->Row(i);
+            const vector<int32_t>* rows = index->FindRowsByGuid(signalID);
 
-            if (row)
+            if (rows != nullptr)
+                matchedRow = primaryTable->Row(rows->front());
+        }
+        else
+        {
+            for (int32_t i = 0; i < primaryTable->RowCount(); i++)
             {
-                const Nullable<GSF::Guid> signalIDField = row->ValueAsGuid(signalIDColumnIndex);
+                const DataRowPtr& row = primaryTable->Row(i);
 
-                if (signalIDField.HasValue() && signalIDField.GetValueOrDefault() == signalID)
+                if (row)
                 {
-                    if (m_filterExpressionStatementCount > 1)
-                    {
-                        if (m_filteredRowSet.insert(row).second)
-                            m_filteredRows.push_back(row);
-                    }
-                    else
+                    const Nullable<GSF::Guid> signalIDField = row->ValueAsGuid(signalIDColumnIndex);
+
+                    if (signalIDField.HasValue() && signalIDField.GetValueOrDefault() == signalID)
                     {
-                        m_filteredRows.push_back(row);
+                        matchedRow = row;
+                        break;
                     }
-
-                    return;
                 }
             }
         }
 
+        if (matchedRow != nullptr)
+        {
+            if (m_filterExpressionStatementCount > 1)
+            {
+                if (m_filteredRowSet.insert(matchedRow).second)
+                    m_filteredRows.push_back(matchedRow);
+            }
+            else
+            {
+                m_filteredRows.push_back(matchedRow);
+            }
+        }
+
         return;
     }
 
-    if (context->MEASUREMENT_KEY_LITERAL())
+    if (statement.Type == FilterExpressionStatement::StatementType::MeasurementKey)
     {
-        MapMatchedFieldRow(primaryTable, primaryTableIDFields->MeasurementKeyFieldName, context->MEASUREMENT_KEY_LITERAL()->getText(), signalIDColumnIndex);
+        MapMatchedFieldRow(primaryTable, primaryTableIDFields->MeasurementKeyFieldName, statement.Identifier, signalIDColumnIndex);
         return;
     }
 
-    if (context->POINT_TAG_LITERAL())
-        MapMatchedFieldRow(primaryTable, primaryTableIDFields->PointTagFieldName, ParsePointTagLiteral(context->POINT_TAG_LITERAL()->getText()), signalIDColumnIndex);
+    if (statement.Type == FilterExpressionStatement::StatementType::PointTag)
+        MapMatchedFieldRow(primaryTable, primaryTableIDFields->PointTagFieldName, statement.Identifier, signalIDColumnIndex);
 }
 
 /*
@@ -576,6 +780,8 @@ void FilterExpressionParser::enterExpression(FilterExpressionSyntaxParser::Expre
             throw FilterExpressionParserException("Failed to find table \"" + m_primaryTableName + "\"");
 
         m_activeExpressionTree = NewSharedPtr<ExpressionTree>(table);
+        m_activeExpressionTree->MaxDegreeOfParallelism = m_maxDegreeOfParallelism;
+        m_activeExpressionTree->ParallelRowThreshold = m_parallelRowThreshold;
         m_expressionTrees.push_back(m_activeExpressionTree);
     }
 }
@@ -980,49 +1186,23 @@ void FilterExpressionParser::exitLiteralValue(FilterExpressionSyntaxParser::Lite
 
     if (context->INTEGER_LITERAL())
     {
-        const double_t value = stod(context->INTEGER_LITERAL()->getText());
-
-        if (value > Int64::MaxValue)
-            result = NewSharedPtr<ValueExpression>(ExpressionValueType::Double, value);
-        else if (value > Int32::MaxValue)
-            result = NewSharedPtr<ValueExpression>(ExpressionValueType::Int64, static_cast<int64_t>(value));
-        else
-            result = NewSharedPtr<ValueExpression>(ExpressionValueType::Int32, static_cast<int32_t>(value));
+        result = FilterExpressionSyntaxReader::ParseIntegerLiteral(context->INTEGER_LITERAL()->getText());
     }
     else if (context->NUMERIC_LITERAL())
     {
-        const string& literal = context->NUMERIC_LITERAL()->getText();
-        
-        if (Contains(literal, "E"))
-        {
-            // Real literals using scientific notation are parsed as double
-            result = NewSharedPtr<ValueExpression>(ExpressionValueType::Double, stod(literal));
-        }
-        else
-        {
-            // Real literals without scientific notation are parsed as decimal, if
-            // the number fails to parse as decimal, then it is parsed as a double
-            try
-            {
-                result = NewSharedPtr<ValueExpression>(ExpressionValueType::Decimal, decimal_t(literal));
-            }
-            catch (const runtime_error&)
-            {
-                result = NewSharedPtr<ValueExpression>(ExpressionValueType::Double, stod(literal));
-            }
-        }
+        result = FilterExpressionSyntaxReader::ParseNumericLiteral(context->NUMERIC_LITERAL()->getText());
     }
     else if (context->STRING_LITERAL())
     {
-        result = NewSharedPtr<ValueExpression>(ExpressionValueType::String, ParseStringLiteral(context->STRING_LITERAL()->getText()));
+        result = NewSharedPtr<ValueExpression>(ExpressionValueType::String, FilterExpressionSyntaxReader::ParseStringLiteral(context->STRING_LITERAL()->getText()));
     }
     else if (context->DATETIME_LITERAL())
     {
-        result = NewSharedPtr<ValueExpression>(ExpressionValueType::DateTime, ParseDateTimeLiteral(context->DATETIME_LITERAL()->getText()));
+        result = NewSharedPtr<ValueExpression>(ExpressionValueType::DateTime, FilterExpressionSyntaxReader::ParseDateTimeLiteral(context->DATETIME_LITERAL()->getText()));
     }
     else if (context->GUID_LITERAL())
     {
-        result = NewSharedPtr<ValueExpression>(ExpressionValueType::Guid, ParseGuidLiteral(context->GUID_LITERAL()->getText()));
+        result = NewSharedPtr<ValueExpression>(ExpressionValueType::Guid, FilterExpressionSyntaxReader::ParseGuidLiteral(context->GUID_LITERAL()->getText()));
     }
     else if (context->BOOLEAN_LITERAL())
     {
@@ -1222,125 +1402,451 @@ vector<DataRowPtr> FilterExpressionParser::Select(const DataTablePtr& dataTable,
     return Select(dataTable->Parent(), filterExpression, dataTable->Name(), tableIDFields, suppressConsoleErrorOutput);
 }
 
-vector<DataRowPtr> FilterExpressionParser::Select(const ExpressionTreePtr& expressionTree)
+// Sort keys of one order-by term for a set of matched rows. Keys are extracted once with a typed
+// store per key type, and case folding is applied up front, so that comparisons made while sorting
+// do not repeat value conversions or case-insensitive string compares.
+class OrderByKeys // NOLINT
 {
-    const DataTablePtr& table = expressionTree->Table();
-    vector<DataRowPtr> matchedRows;
+private:
+    enum class KeyType
+    {
+        Integer,
+        UInt64,
+        Double,
+        Decimal,
+        String,
+        Guid,
+        DateTime
+    };
+
+    const int32_t m_columnIndex;
+    const bool m_ascending;
+    KeyType m_keyType;
+    vector<bool> m_hasValue;
+    vector<int64_t> m_integerKeys;
+    vector<uint64_t> m_uint64Keys;
+    vector<float64_t> m_doubleKeys;
+    vector<decimal_t> m_decimalKeys;
+    vector<string> m_stringKeys;
+    vector<GSF::Guid> m_guidKeys;
+    vector<datetime_t> m_dateTimeKeys;
+
+    template<class T, class TKey>
+    void ExtractKeys(const vector<DataRowPtr>& rows, Nullable<T> (DataRow::*valueAs)(int32_t), vector<TKey>& keys)
+    {
+        keys.reserve(rows.size());
+
+        for (const DataRowPtr& row : rows)
+        {
+            const Nullable<T> value = (row.get()->*valueAs)(m_columnIndex);
+            m_hasValue.push_back(value.HasValue());
+            keys.push_back(value.HasValue() ? static_cast<TKey>(value.GetValueOrDefault()) : TKey());
+        }
+    }
+
+    template<class T>
+    static int32_t CompareKeys(const T& leftKey, const T& rightKey)
+    {
+        return leftKey < rightKey ? -1 : (rightKey < leftKey ? 1 : 0);
+    }
+
+    // Compares characters as signed values, matching lexicographical compare of strings
+    static int32_t CompareKeys(const string& leftKey, const string& rightKey)
+    {
+        const size_t length = min(leftKey.size(), rightKey.size());
+
+        for (size_t i = 0; i < length; i++)
+        {
+            if (leftKey[i] != rightKey[i])
+                return leftKey[i] < rightKey[i] ? -1 : 1;
+        }
+
+        return CompareKeys(leftKey.size(), rightKey.size());
+    }
+
+public:
+    OrderByKeys(const std::tuple<DataColumnPtr, bool, bool>& orderByTerm, const vector<DataRowPtr>& rows) :
+        m_columnIndex(get<0>(orderByTerm)->Index()),
+        m_ascending(get<1>(orderByTerm))
+    {
+        m_hasValue.reserve(rows.size());
+
+        switch (get<0>(orderByTerm)->Type())
+        {
+            case DataType::String:
+            {
+                const bool exactMatch = get<2>(orderByTerm);
+                m_keyType = KeyType::String;
+                m_stringKeys.reserve(rows.size());
+
+                for (const DataRowPtr& row : rows)
+                {
+                    const Nullable<string> value = row->ValueAsString(m_columnIndex);
+                    m_hasValue.push_back(value.HasValue());
+
+                    if (!value.HasValue())
+                        m_stringKeys.emplace_back();
+                    else if (exactMatch)
+                        m_stringKeys.push_back(value.GetValueOrDefault());
+                    else
+                        m_stringKeys.push_back(ToUpper(value.GetValueOrDefault()));
+                }
+
+                break;
+            }
+            case DataType::Boolean:
+                m_keyType = KeyType::Integer;
+                ExtractKeys(rows, &DataRow::ValueAsBoolean, m_integerKeys);
+                break;
+            case DataType::DateTime:
+                m_keyType = KeyType::DateTime;
+                ExtractKeys(rows, &DataRow::ValueAsDateTime, m_dateTimeKeys);
+                break;
+            case DataType::Single:
+                m_keyType = KeyType::Double;
+                ExtractKeys(rows, &DataRow::ValueAsSingle, m_doubleKeys);
+                break;
+            case DataType::Double:
+                m_keyType = KeyType::Double;
+                ExtractKeys(rows, &DataRow::ValueAsDouble, m_doubleKeys);
+                break;
+            case DataType::Decimal:
+                m_keyType = KeyType::Decimal;
+                ExtractKeys(rows, &DataRow::ValueAsDecimal, m_decimalKeys);
+                break;
+            case DataType::Guid:
+                m_keyType = KeyType::Guid;
+                ExtractKeys(rows, &DataRow::ValueAsGuid, m_guidKeys);
+                break;
+            case DataType::Int8:
+                m_keyType = KeyType::Integer;
+                ExtractKeys(rows, &DataRow::ValueAsInt8, m_integerKeys);
+                break;
+            case DataType::Int16:
+                m_keyType = KeyType::Integer;
+                ExtractKeys(rows, &DataRow::ValueAsInt16, m_integerKeys);
+                break;
+            case DataType::Int32:
+                m_keyType = KeyType::Integer;
+                ExtractKeys(rows, &DataRow::ValueAsInt32, m_integerKeys);
+                break;
+            case DataType::Int64:
+                m_keyType = KeyType::Integer;
+                ExtractKeys(rows, &DataRow::ValueAsInt64, m_integerKeys);
+                break;
+            case DataType::UInt8:
+                m_keyType = KeyType::Integer;
+                ExtractKeys(rows, &DataRow::ValueAsUInt8, m_integerKeys);
+                break;
+            case DataType::UInt16:
+                m_keyType = KeyType::Integer;
+                ExtractKeys(rows, &DataRow::ValueAsUInt16, m_integerKeys);
+                break;
+            case DataType::UInt32:
+                m_keyType = KeyType::Integer;
+                ExtractKeys(rows, &DataRow::ValueAsUInt32, m_integerKeys);
+                break;
+            case DataType::UInt64:
+                m_keyType = KeyType::UInt64;
+                ExtractKeys(rows, &DataRow::ValueAsUInt64, m_uint64Keys);
+                break;
+            default:
+                throw FilterExpressionParserException("Unexpected column data type encountered");
+        }
+    }
+
+    // Compares keys of two rows, by index, in term order, null values sort first in ascending order
+    int32_t Compare(const int32_t leftRowIndex, const int32_t rightRowIndex) const
+    {
+        const int32_t leftIndex = m_ascending ? leftRowIndex : rightRowIndex;
+        const int32_t rightIndex = m_ascending ? rightRowIndex : leftRowIndex;
+        const bool leftHasValue = m_hasValue[leftIndex];
+        const bool rightHasValue = m_hasValue[rightIndex];
+
+        if (!leftHasValue || !rightHasValue)
+        {
+            if (leftHasValue == rightHasValue)
+                return 0;
+
+            return leftHasValue ? 1 : -1;
+        }
+
+        switch (m_keyType)
+        {
+            case KeyType::Integer:
+                return CompareKeys(m_integerKeys[leftIndex], m_integerKeys[rightIndex]);
+            case KeyType::UInt64:
+                return CompareKeys(m_uint64Keys[leftIndex], m_uint64Keys[rightIndex]);
+            case KeyType::Double:
+                return CompareKeys(m_doubleKeys[leftIndex], m_doubleKeys[rightIndex]);
+            case KeyType::Decimal:
+                return CompareKeys(m_decimalKeys[leftIndex], m_decimalKeys[rightIndex]);
+            case KeyType::String:
+                return CompareKeys(m_stringKeys[leftIndex], m_stringKeys[rightIndex]);
+            case KeyType::Guid:
+                return CompareKeys(m_guidKeys[leftIndex], m_guidKeys[rightIndex]);
+            case KeyType::DateTime:
+                return CompareKeys(m_dateTimeKeys[leftIndex], m_dateTimeKeys[rightIndex]);
+            default:
+                return 0;
+        }
+    }
+};
+
+// Sorts matched rows by order-by terms. TOP limit, when defined, applies to matched rows in table order,
+// so only the first rows up to the limit are kept and sorted. When sorted runs are provided, rows are
+// already sorted within each run and runs are only merged.
+static void SortMatchedRows(const vector<std::tuple<DataColumnPtr, bool, bool>>& orderByTerms, const int32_t topLimit, vector<DataRowPtr>& matchedRows, const vector<size_t>* sortedRuns = nullptr)
+{
+    if (topLimit > -1 && matchedRows.size() > static_cast<size_t>(topLimit))
+        matchedRows.resize(topLimit);
+
+    const size_t rowCount = matchedRows.size();
+
+    if (rowCount == 0 || orderByTerms.empty())
+        return;
+
+    vector<OrderByKeys> orderByKeys;
+    orderByKeys.reserve(orderByTerms.size());
+
+    for (const auto& orderByTerm : orderByTerms)
+        orderByKeys.emplace_back(orderByTerm, matchedRows);
+
+    const auto compareRows = [&orderByKeys](const int32_t leftRowIndex, const int32_t rightRowIndex)
+    {
+        for (const OrderByKeys& keys : orderByKeys)
+        {
+            const int32_t result = keys.Compare(leftRowIndex, rightRowIndex);
+
+            if (result != 0)
+                return result < 0;
+
+            // Last compare result was equal, continue sort based on next order-by term
+        }
+
+        return false;
+    };
+
+    // Rows are sorted by index so keys stay in place
+    vector<int32_t> rowIndexes(rowCount);
+    iota(rowIndexes.begin(), rowIndexes.end(), 0);
+
+    if (sortedRuns != nullptr)
+    {
+        size_t runStart = 0;
+
+        for (const size_t runEnd : *sortedRuns)
+        {
+            if (runStart > 0)
+                inplace_merge(rowIndexes.begin(), rowIndexes.begin() + runStart, rowIndexes.begin() + runEnd, compareRows);
+
+            runStart = runEnd;
+        }
+    }
+    else
+    {
+        sort(rowIndexes.begin(), rowIndexes.end(), compareRows);
+    }
+
+    vector<DataRowPtr> sortedRows;
+    sortedRows.reserve(rowCount);
+
+    for (size_t i = 0; i < rowCount; i++)
+        sortedRows.push_back(std::move(matchedRows[rowIndexes[i]]));
+
+    matchedRows.swap(sortedRows);
+}
+
+// Evaluates compiled program for a range of table rows, or candidate rows when provided, using its own
+// registers so that ranges of the same table can be evaluated concurrently
+static void SelectRows(const DataTablePtr& table, const ExpressionProgram& program, const vector<int32_t>* candidateRows, const int32_t startIndex, const int32_t endIndex, const int32_t topLimit, vector<DataRowPtr>& matchedRows)
+{
+    vector<ExpressionProgram::Register> registers = program.CreateRegisters();
 
-    for (int32_t i = 0; i < table->RowCount(); i++)
+    for (int32_t i = startIndex; i < endIndex; i++)
     {
-        if (expressionTree->TopLimit > -1 && static_cast<int32_t>(matchedRows.size()) >= expressionTree->TopLimit)
+        if (topLimit > -1 && static_cast<int32_t>(matchedRows.size()) >= topLimit)
             break;
 
-        const DataRowPtr& row = table->Row(i);
+        const DataRowPtr& row = table->Row(candidateRows == nullptr ? i : candidateRows->at(i));
 
         if (row == nullptr)
             continue;
 
-        const ValueExpressionPtr& resultExpression = expressionTree->Evaluate(row);
+        // Evaluate compiled program in place, avoiding value expression allocations
+        const ExpressionProgram::Register& result = program.Execute(*row, registers);
 
-        // Final expression should have a boolean data type (it's part of a WHERE clause)
-        if (resultExpression->ValueType != ExpressionValueType::Boolean)
-            throw FilterExpressionParserException("Final expression tree evaluation did not result in a boolean value, result data type is \"" + string(EnumName(resultExpression->ValueType)) + "\"");
+        if (result.ValueType != ExpressionValueType::Boolean)
+            throw FilterExpressionParserException("Final expression tree evaluation did not result in a boolean value, result data type is \"" + string(EnumName(result.ValueType)) + "\"");
 
-        // If final result is Null, i.e., has no value due to Null propagation, treat result as False
-        if (resultExpression->ValueAsBoolean())
+        if (!result.IsNull && result.BooleanValue)
             matchedRows.push_back(row);
     }
+}
+
+// Gets number of row ranges to evaluate concurrently for a compiled expression tree
+static int32_t GetPartitionCount(const ExpressionTree& expressionTree, const int32_t rowCount)
+{
+    int32_t maxDegreeOfParallelism = expressionTree.MaxDegreeOfParallelism;
 
-    if (!matchedRows.empty() && !expressionTree->OrderByTerms.empty())
+    if (maxDegreeOfParallelism < 1)
+        maxDegreeOfParallelism = static_cast<int32_t>(Thread::hardware_concurrency());
+
+    if (maxDegreeOfParallelism < 2 || rowCount < expressionTree.ParallelRowThreshold)
+        return 1;
+
+    return min(maxDegreeOfParallelism, rowCount);
+}
+
+// Gets pool of threads, shared by all select operations, used to evaluate row partitions
+static boost::asio::thread_pool& GetSelectThreadPool()
+{
+    static boost::asio::thread_pool threadPool(max(Thread::hardware_concurrency(), 1U));
+    return threadPool;
+}
+
+vector<DataRowPtr> FilterExpressionParser::Select(const ExpressionTreePtr& expressionTree)
+{
+    const DataTablePtr& table = expressionTree->Table();
+    const ExpressionProgramPtr program = expressionTree->UseCompiledProgram ? expressionTree->GetProgram() : nullptr;
+    const vector<std::tuple<DataColumnPtr, bool, bool>>& orderByTerms = expressionTree->OrderByTerms;
+    const int32_t topLimit = expressionTree->TopLimit;
+    vector<DataRowPtr> matchedRows;
+
+    // When indexes can limit the rows to evaluate, only candidate rows are visited in table order
+    vector<int32_t> candidateRows;
+    const bool useCandidateRows = expressionTree->SelectCandidateRows(candidateRows);
+    const int32_t rowCount = useCandidateRows ? ConvertInt32(candidateRows.size()) : table->RowCount();
+
+    // Only compiled programs are re-entrant, interpreted expression trees are always evaluated serially
+    const int32_t partitionCount = program == nullptr ? 1 : GetPartitionCount(*expressionTree, rowCount);
+
+    if (partitionCount > 1)
     {
-        sort(matchedRows.begin(), matchedRows.end(), [expressionTree](const DataRowPtr& leftMatchedRow, const DataRowPtr& rightMatchedRow)
+        // Without a TOP limit, partitions are sorted concurrently and then merged. With a limit, only the first
+        // matches in table order are sorted, which are not known until partitions are combined. Computed columns
+        // are evaluated on demand by their own expression trees, so these are sorted serially.
+        const bool sortPartitions = topLimit < 0 && !orderByTerms.empty() && none_of(orderByTerms.begin(), orderByTerms.end(), [](const std::tuple<DataColumnPtr, bool, bool>& orderByTerm)
         {
-            for (size_t i = 0; i < expressionTree->OrderByTerms.size(); i++)
+            return get<0>(orderByTerm)->Computed();
+        });
+
+        const int32_t partitionSize = (rowCount + partitionCount - 1) / partitionCount;
+        vector<vector<DataRowPtr>> partitionRows(partitionCount);
+        vector<std::exception_ptr> partitionErrors(partitionCount);
+
+        const auto selectPartition = [&](const int32_t partition)
+        {
+            try
             {
-                const auto orderByTerm = expressionTree->OrderByTerms[i];
-                const DataColumnPtr& orderByColumn = get<0>(orderByTerm);
-                const int32_t columnIndex = orderByColumn->Index();
-                const bool ascending = get<1>(orderByTerm);
-                const bool exactMatch = get<2>(orderByTerm);
-                const DataRowPtr& leftRow = ascending ? leftMatchedRow : rightMatchedRow;
-                const DataRowPtr& rightRow = ascending ? rightMatchedRow : leftMatchedRow;
-                int32_t result;
+                const int32_t startIndex = partition * partitionSize;
+                const int32_t endIndex = min(startIndex + partitionSize, rowCount);
+                vector<DataRowPtr>& rows = partitionRows[partition];
 
-                switch (orderByColumn->Type())
-                {
-                    case DataType::String:
-                    {
-                        auto leftNullable = leftRow->ValueAsString(columnIndex);
-                        auto rightNullable = rightRow->ValueAsString(columnIndex);
+                SelectRows(table, *program, useCandidateRows ? &candidateRows : nullptr, startIndex, endIndex, topLimit, rows);
 
-                        if (leftNullable.HasValue() && rightNullable.HasValue())
-                            result = Compare(leftNullable.GetValueOrDefault(), rightNullable.GetValueOrDefault(), !exactMatch);
-                        else if (!leftNullable.HasValue() && !rightNullable.HasValue())
-                            result = 0;
-                        else
-                            result = leftNullable.HasValue() ? 1 : -1;
+                if (sortPartitions)
+                    SortMatchedRows(orderByTerms, -1, rows);
+            }
+            catch (...)
+            {
+                partitionErrors[partition] = std::current_exception();
+            }
+        };
 
-                        break;
-                    }
-                    case DataType::Boolean:
-                        result = CompareValues(leftRow->ValueAsBoolean(columnIndex), rightRow->ValueAsBoolean(columnIndex));
-                        break;
-                    case DataType::DateTime:
-                        result = CompareValues(leftRow->ValueAsDateTime(columnIndex), rightRow->ValueAsDateTime(columnIndex));
-                        break;
-                    case DataType::Single:
-                        result = CompareValues(leftRow->ValueAsSingle(columnIndex), rightRow->ValueAsSingle(columnIndex));
-                        break;
-                    case DataType::Double:
-                        result = CompareValues(leftRow->ValueAsDouble(columnIndex), rightRow->ValueAsDouble(columnIndex));
-                        break;
-                    case DataType::Decimal:
-                        result = CompareValues(leftRow->ValueAsDecimal(columnIndex), rightRow->ValueAsDecimal(columnIndex));
-                        break;
-                    case DataType::Guid:
-                        result = CompareValues(leftRow->ValueAsGuid(columnIndex), rightRow->ValueAsGuid(columnIndex));
-                        break;
-                    case DataType::Int8:
-                        result = CompareValues(leftRow->ValueAsInt8(columnIndex), rightRow->ValueAsInt8(columnIndex));
-                        break;
-                    case DataType::Int16:
-                        result = CompareValues(leftRow->ValueAsInt16(columnIndex), rightRow->ValueAsInt16(columnIndex));
-                        break;
-                    case DataType::Int32:
-                        result = CompareValues(leftRow->ValueAsInt32(columnIndex), rightRow->ValueAsInt32(columnIndex));
-                        break;
-                    case DataType::Int64:
-                        result = CompareValues(leftRow->ValueAsInt64(columnIndex), rightRow->ValueAsInt64(columnIndex));
-                        break;
-                    case DataType::UInt8:
-                        result = CompareValues(leftRow->ValueAsUInt8(columnIndex), rightRow->ValueAsUInt8(columnIndex));
-                        break;
-                    case DataType::UInt16:
-                        result = CompareValues(leftRow->ValueAsUInt16(columnIndex), rightRow->ValueAsUInt16(columnIndex));
-                        break;
-                    case DataType::UInt32:
-                        result = CompareValues(leftRow->ValueAsUInt32(columnIndex), rightRow->ValueAsUInt32(columnIndex));
-                        break;
-                    case DataType::UInt64:
-                        result = CompareValues(leftRow->ValueAsUInt64(columnIndex), rightRow->ValueAsUInt64(columnIndex));
-                        break;
-                    default:
-                        throw FilterExpressionParserException("Unexpected column data type encountered");
-                }
+        // Pooled tasks and calling thread take partitions in turn, so select completes even when pool is busy
+        std::atomic<int32_t> nextPartition(0);
+        int32_t pendingTasks = partitionCount - 1;
+        Mutex pendingTasksLock;
+        WaitHandle tasksComplete;
 
-                if (result < 0)
-                    return true;
+        const auto selectPartitions = [&]
+        {
+            for (int32_t partition = nextPartition++; partition < partitionCount; partition = nextPartition++)
+                selectPartition(partition);
+        };
 
-                if (result > 0)
-                    return false;
+        for (int32_t i = 1; i < partitionCount; i++)
+        {
+            boost::asio::post(GetSelectThreadPool(), [&]
+            {
+                selectPartitions();
 
-                // Last compare result was equal, continue sort based on next order-by term
-            }
+                ScopeLock lock(pendingTasksLock);
 
-            return false;
-        });
+                if (--pendingTasks == 0)
+                    tasksComplete.notify_one();
+            });
+        }
+
+        selectPartitions();
+
+        // Tasks reference local state, so wait for all of them, including any that found no partitions left
+        UniqueLock lock(pendingTasksLock);
+
+        while (pendingTasks > 0)
+            tasksComplete.wait(lock);
+
+        // Report error from first failed partition, i.e., same error as serial evaluation
+        for (const std::exception_ptr& partitionError : partitionErrors)
+        {
+            if (partitionError != nullptr)
+                std::rethrow_exception(partitionError);
+        }
+
+        // Partition results are combined in row order, or merged by order-by terms when sorted
+        vector<size_t> sortedRuns;
+        sortedRuns.reserve(partitionCount);
+
+        for (vector<DataRowPtr>& rows : partitionRows)
+        {
+            matchedRows.insert(matchedRows.end(), make_move_iterator(rows.begin()), make_move_iterator(rows.end()));
+            sortedRuns.push_back(matchedRows.size());
+        }
+
+        SortMatchedRows(orderByTerms, topLimit, matchedRows, sortPartitions ? &sortedRuns : nullptr);
+        return matchedRows;
+    }
+
+    if (program != nullptr)
+    {
+        SelectRows(table, *program, useCandidateRows ? &candidateRows : nullptr, 0, rowCount, topLimit, matchedRows);
+    }
+    else
+    {
+        for (int32_t i = 0; i < rowCount; i++)
+        {
+            if (topLimit > -1 && static_cast<int32_t>(matchedRows.size()) >= topLimit)
+                break;
+
+            const DataRowPtr& row = table->Row(useCandidateRows ? candidateRows[i] : i);
+
+            if (row == nullptr)
+                continue;
+
+            const ValueExpressionPtr& resultExpression = expressionTree->Evaluate(row);
+
+            // Final expression should have a boolean data type (it's part of a WHERE clause)
+            if (resultExpression->ValueType != ExpressionValueType::Boolean)
+                throw FilterExpressionParserException("Final expression tree evaluation did not result in a boolean value, result data type is \"" + string(EnumName(resultExpression->ValueType)) + "\"");
+
+            // If final result is Null, i.e., has no value due to Null propagation, treat result as False
+            if (resultExpression->ValueAsBoolean())
+                matchedRows.push_back(row);
+        }
     }
 
+    SortMatchedRows(orderByTerms, topLimit, matchedRows);
+
     return matchedRows;
 }
 
+FilterExpressionCache& FilterExpressionParser::GetExpressionCache()
+{
+    static FilterExpressionCache expressionCache;
+    return expressionCache;
+}
+
 const TableIDFieldsPtr FilterExpressionParser::DefaultTableIDFields = []
 { 
     TableIDFieldsPtr defaultTableIDFIelds = NewSharedPtr<TableIDFields>();
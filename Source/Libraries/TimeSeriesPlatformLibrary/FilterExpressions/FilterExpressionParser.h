@@ -29,6 +29,7 @@
 #include "../../Common/CommonTypes.h"
 #include "../../Data/DataSet.h"
 #include "ExpressionTree.h"
+#include "FilterExpressionCache.h"
 
 #ifdef _DEBUG
 #define SUPPRESS_CONSOLE_ERROR_OUTPUT false
@@ -80,11 +81,14 @@ namespace FilterExpressions
             void syntaxError(antlr4::Recognizer* recognizer, antlr4::Token* offendingSymbol, size_t line, size_t charPositionInLine, const std::string& msg, std::exception_ptr e) override;
         };
 
-        antlr4::ANTLRInputStream m_inputStream;
+        std::string m_filterExpression;
+        bool m_suppressConsoleErrorOutput;
+        antlr4::ANTLRInputStream* m_inputStream;
         FilterExpressionSyntaxLexer* m_lexer;
         antlr4::CommonTokenStream* m_tokens;
         FilterExpressionSyntaxParser* m_parser;
         CallbackErrorListener* m_callbackErrorListener;
+        ParsingExceptionCallback m_parsingExceptionCallback;
         GSF::Data::DataSetPtr m_dataSet;
         std::string m_primaryTableName;
         GSF::StringMap<TableIDFieldsPtr> m_tableIDFields;
@@ -103,7 +107,19 @@ namespace FilterExpressions
         std::vector<ExpressionTreePtr> m_expressionTrees;
         std::map<const antlr4::ParserRuleContext*, ExpressionPtr> m_expressions;
 
+        bool m_useExpressionCache;
+        bool m_useSyntaxReader;
+        int32_t m_maxDegreeOfParallelism;
+        int32_t m_parallelRowThreshold;
+        std::vector<FilterExpressionStatement> m_statements;
+
+        void InitializeParser();
         void VisitParseTreeNodes();
+        bool LoadCachedStatements(bool identifiersAsExpressions);
+        bool ReadStatements(bool identifiersAsExpressions, bool cacheStatements);
+        void LoadStatements(const std::vector<FilterExpressionStatement>& statements);
+        void CacheStatements(bool identifiersAsExpressions);
+        void ApplyIdentifierStatement(const FilterExpressionStatement& statement);
         void InitializeSetOperations();
         inline void AddMatchedRow(const GSF::Data::DataRowPtr& row, int32_t signalIDColumnIndex);
         inline void MapMatchedFieldRow(const GSF::Data::DataTablePtr& primaryTable, const std::string& columnName, const std::string& matchValue, int32_t signalIDColumnIndex);
@@ -140,6 +156,25 @@ namespace FilterExpressions
 
         const std::vector<ExpressionTreePtr>& GetExpressionTrees();
 
+        // Gets or sets flag that determines if parsed statements are shared through the expression cache, defaults to true
+        bool GetUseExpressionCache() const;
+        void SetUseExpressionCache(bool useExpressionCache);
+
+        // Gets or sets flag that determines if statements are read with the hand-written syntax reader before
+        // falling back on the ANTLR parser, which is only used for expressions the reader rejects, defaults to true
+        bool GetUseSyntaxReader() const;
+        void SetUseSyntaxReader(bool useSyntaxReader);
+
+        // Gets or sets maximum number of threads used to evaluate rows of each generated expression tree,
+        // 0 uses all processors, defaults to 1, i.e., serial evaluation
+        int32_t GetMaxDegreeOfParallelism() const;
+        void SetMaxDegreeOfParallelism(int32_t maxDegreeOfParallelism);
+
+        // Gets or sets minimum number of rows to evaluate before a select operation of each generated
+        // expression tree is partitioned across threads, defaults to 50000
+        int32_t GetParallelRowThreshold() const;
+        void SetParallelRowThreshold(int32_t parallelRowThreshold);
+
         void enterFilterExpressionStatement(FilterExpressionSyntaxParser::FilterExpressionStatementContext*) override;
         void enterFilterStatement(FilterExpressionSyntaxParser::FilterStatementContext*) override;
         void exitIdentifierStatement(FilterExpressionSyntaxParser::IdentifierStatementContext*) override;
@@ -161,6 +196,10 @@ namespace FilterExpressions
         static std::vector<GSF::Data::DataRowPtr> Select(const GSF::Data::DataTablePtr& dataTable, const std::string& filterExpression, const TableIDFieldsPtr& tableIDFields = nullptr, bool suppressConsoleErrorOutput = SUPPRESS_CONSOLE_ERROR_OUTPUT);
         static std::vector<GSF::Data::DataRowPtr> Select(const ExpressionTreePtr& expressionTree);
 
+        // Gets the cache of parsed filter expressions shared by all parsers, cached expressions are
+        // bound by table and column name to the dataset of each parser that uses them
+        static FilterExpressionCache& GetExpressionCache();
+
         static const TableIDFieldsPtr DefaultTableIDFields;
     };
 
@@ -0,0 +1,1237 @@
+//******************************************************************************************************
+//  FilterExpressionSyntaxReader.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "FilterExpressionSyntaxReader.h"
+#include "FilterExpressionParser.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+using namespace GSF::FilterExpressions;
+
+// Character classes of the FilterExpressionSyntax.g4 lexer rules
+static bool IsDigit(const char value)
+{
+    return value >= '0' && value <= '9';
+}
+
+static bool IsHexDigit(const char value)
+{
+    return IsDigit(value) || (value >= 'a' && value <= 'f') || (value >= 'A' && value <= 'F');
+}
+
+static bool IsLetter(const char value)
+{
+    return (value >= 'a' && value <= 'z') || (value >= 'A' && value <= 'Z');
+}
+
+static bool IsIdentifierStart(const char value)
+{
+    return IsLetter(value) || value == '_';
+}
+
+static bool IsIdentifierPart(const char value)
+{
+    return IsIdentifierStart(value) || IsDigit(value);
+}
+
+static bool IsAcronymDigit(const char value)
+{
+    return IsLetter(value) || IsDigit(value) || value == '-' || value == '!' || value == '_' || value == '.' || value == '@' || value == '#' || value == '$';
+}
+
+static size_t CountWhile(const string& text, size_t index, bool (*predicate)(char))
+{
+    const size_t start = index;
+
+    while (index < text.size() && predicate(text[index]))
+        index++;
+
+    return index - start;
+}
+
+static char CharAt(const string& text, const size_t index)
+{
+    return index < text.size() ? text[index] : '\0';
+}
+
+// GUID_VALUE: 8, 4, 4, 4 and 12 hex digits with optional dashes between groups
+static size_t MatchGuidValue(const string& text, const size_t start)
+{
+    static const size_t groups[] = { 8, 4, 4, 4, 12 };
+    size_t index = start;
+
+    for (size_t i = 0; i < 5; i++)
+    {
+        for (size_t j = 0; j < groups[i]; j++)
+        {
+            if (!IsHexDigit(CharAt(text, index)))
+                return 0;
+
+            index++;
+        }
+
+        if (i < 4 && CharAt(text, index) == '-')
+            index++;
+    }
+
+    return index - start;
+}
+
+static size_t MatchGuidLiteral(const string& text, const size_t start)
+{
+    const char first = text[start];
+
+    if (first == '\'' || first == '{')
+    {
+        const size_t length = MatchGuidValue(text, start + 1);
+
+        if (length > 0 && CharAt(text, start + 1 + length) == (first == '{' ? '}' : '\''))
+            return length + 2;
+
+        return 0;
+    }
+
+    return MatchGuidValue(text, start);
+}
+
+static size_t MatchIntegerLiteral(const string& text, const size_t start)
+{
+    const size_t length = CountWhile(text, start, IsDigit);
+
+    if (text[start] == '0' && (CharAt(text, start + 1) == 'x' || CharAt(text, start + 1) == 'X'))
+    {
+        const size_t hexLength = CountWhile(text, start + 2, IsHexDigit);
+
+        if (hexLength > 0)
+            return max(length, hexLength + 2);
+    }
+
+    return length;
+}
+
+static size_t MatchNumericLiteral(const string& text, const size_t start)
+{
+    size_t index = start;
+    const size_t digits = CountWhile(text, index, IsDigit);
+
+    index += digits;
+
+    if (digits > 0)
+    {
+        if (CharAt(text, index) == '.')
+            index += 1 + CountWhile(text, index + 1, IsDigit);
+    }
+    else
+    {
+        if (CharAt(text, index) != '.')
+            return 0;
+
+        const size_t fraction = CountWhile(text, index + 1, IsDigit);
+
+        if (fraction == 0)
+            return 0;
+
+        index += 1 + fraction;
+    }
+
+    // Optional exponent is only part of the literal when followed by digits
+    size_t exponent = index;
+
+    if (CharAt(text, exponent) == 'e' || CharAt(text, exponent) == 'E')
+    {
+        exponent++;
+
+        if (CharAt(text, exponent) == '-' || CharAt(text, exponent) == '+')
+            exponent++;
+
+        const size_t exponentDigits = CountWhile(text, exponent, IsDigit);
+
+        if (exponentDigits > 0)
+            index = exponent + exponentDigits;
+    }
+
+    return index - start;
+}
+
+static size_t MatchMeasurementKeyLiteral(const string& text, const size_t start)
+{
+    const size_t length = CountWhile(text, start, IsAcronymDigit);
+
+    if (length == 0 || CharAt(text, start + length) != ':')
+        return 0;
+
+    const size_t digits = CountWhile(text, start + length + 1, IsDigit);
+    return digits > 0 ? length + 1 + digits : 0;
+}
+
+static size_t MatchPointTagLiteral(const string& text, const size_t start)
+{
+    if (text[start] != '"')
+        return 0;
+
+    const size_t length = CountWhile(text, start + 1, IsAcronymDigit);
+    return length > 0 && CharAt(text, start + 1 + length) == '"' ? length + 2 : 0;
+}
+
+static size_t MatchStringLiteral(const string& text, const size_t start)
+{
+    if (text[start] != '\'')
+        return 0;
+
+    // Doubled quotes continue the literal, longest closed literal is matched
+    size_t accepted = 0;
+    size_t index = start + 1;
+
+    while (index < text.size())
+    {
+        if (text[index] == '\'')
+        {
+            accepted = index + 1 - start;
+
+            if (CharAt(text, index + 1) != '\'')
+                break;
+
+            index += 2;
+        }
+        else
+        {
+            index++;
+        }
+    }
+
+    return accepted;
+}
+
+static size_t MatchDelimited(const string& text, const size_t start, const char open, const char close)
+{
+    if (text[start] != open)
+        return 0;
+
+    const size_t end = text.find(close, start + 1);
+    return end == string::npos || end == start + 1 ? 0 : end + 1 - start;
+}
+
+static size_t MatchComment(const string& text, const size_t start)
+{
+    if (text[start] == '-' && CharAt(text, start + 1) == '-')
+    {
+        const size_t end = text.find_first_of("\r\n", start + 2);
+        return (end == string::npos ? text.size() : end) - start;
+    }
+
+    if (text[start] == '/' && CharAt(text, start + 1) == '*')
+    {
+        const size_t end = text.find("*/", start + 2);
+        return (end == string::npos ? text.size() : end + 2) - start;
+    }
+
+    return 0;
+}
+
+static const StringMap<ExpressionFunctionType>& FunctionNames()
+{
+    static const StringMap<ExpressionFunctionType> functionNames = {
+        { "ABS", ExpressionFunctionType::Abs },
+        { "CEILING", ExpressionFunctionType::Ceiling },
+        { "COALESCE", ExpressionFunctionType::Coalesce },
+        { "CONVERT", ExpressionFunctionType::Convert },
+        { "CONTAINS", ExpressionFunctionType::Contains },
+        { "DATEADD", ExpressionFunctionType::DateAdd },
+        { "DATEDIFF", ExpressionFunctionType::DateDiff },
+        { "DATEPART", ExpressionFunctionType::DatePart },
+        { "ENDSWITH", ExpressionFunctionType::EndsWith },
+        { "FLOOR", ExpressionFunctionType::Floor },
+        { "IIF", ExpressionFunctionType::IIf },
+        { "INDEXOF", ExpressionFunctionType::IndexOf },
+        { "ISDATE", ExpressionFunctionType::IsDate },
+        { "ISINTEGER", ExpressionFunctionType::IsInteger },
+        { "ISGUID", ExpressionFunctionType::IsGuid },
+        { "ISNULL", ExpressionFunctionType::IsNull },
+        { "ISNUMERIC", ExpressionFunctionType::IsNumeric },
+        { "LASTINDEXOF", ExpressionFunctionType::LastIndexOf },
+        { "LEN", ExpressionFunctionType::Len },
+        { "LOWER", ExpressionFunctionType::Lower },
+        { "MAXOF", ExpressionFunctionType::MaxOf },
+        { "MINOF", ExpressionFunctionType::MinOf },
+        { "NOW", ExpressionFunctionType::Now },
+        { "NTHINDEXOF", ExpressionFunctionType::NthIndexOf },
+        { "POWER", ExpressionFunctionType::Power },
+        { "REGEXMATCH", ExpressionFunctionType::RegExMatch },
+        { "REGEXVAL", ExpressionFunctionType::RegExVal },
+        { "REPLACE", ExpressionFunctionType::Replace },
+        { "REVERSE", ExpressionFunctionType::Reverse },
+        { "ROUND", ExpressionFunctionType::Round },
+        { "SPLIT", ExpressionFunctionType::Split },
+        { "SQRT", ExpressionFunctionType::Sqrt },
+        { "STARTSWITH", ExpressionFunctionType::StartsWith },
+        { "STRCOUNT", ExpressionFunctionType::StrCount },
+        { "STRCMP", ExpressionFunctionType::StrCmp },
+        { "SUBSTR", ExpressionFunctionType::SubStr },
+        { "TRIM", ExpressionFunctionType::Trim },
+        { "TRIMLEFT", ExpressionFunctionType::TrimLeft },
+        { "TRIMRIGHT", ExpressionFunctionType::TrimRight },
+        { "UPPER", ExpressionFunctionType::Upper },
+        { "UTCNOW", ExpressionFunctionType::UtcNow }
+    };
+
+    return functionNames;
+}
+
+FilterExpressionSyntaxReader::FilterExpressionSyntaxReader(const string& filterExpression, const DataSetPtr& dataSet, const string& primaryTableName, const bool identifiersAsExpressions) :
+    m_filterExpression(filterExpression),
+    m_dataSet(dataSet),
+    m_primaryTableName(primaryTableName),
+    m_identifiersAsExpressions(identifiersAsExpressions),
+    m_index(0)
+{
+}
+
+void FilterExpressionSyntaxReader::Tokenize()
+{
+    int32_t line = 1;
+    size_t lineStart = 0;
+    size_t index = 0;
+
+    m_tokens.clear();
+
+    while (index < m_filterExpression.size())
+    {
+        Token token {};
+        const size_t length = MatchToken(index, token);
+
+        token.Start = index;
+        token.Length = length;
+        token.Line = line;
+        token.Column = static_cast<int32_t>(index - lineStart);
+
+        if (token.Type == TokenType::Unexpected)
+            throw FilterExpressionParserException(SyntaxError(token, {}));
+
+        // Hidden tokens, i.e., spaces and comments, are returned as end of input
+        if (token.Type != TokenType::EndOfInput)
+            m_tokens.push_back(token);
+
+        for (size_t i = index; i < index + length; i++)
+        {
+            if (m_filterExpression[i] == '\n')
+            {
+                line++;
+                lineStart = i + 1;
+            }
+        }
+
+        index += length;
+    }
+
+    Token endOfInput {};
+
+    endOfInput.Type = TokenType::EndOfInput;
+    endOfInput.Start = m_filterExpression.size();
+    endOfInput.Line = line;
+    endOfInput.Column = static_cast<int32_t>(m_filterExpression.size() - lineStart);
+
+    m_tokens.push_back(endOfInput);
+}
+
+size_t FilterExpressionSyntaxReader::MatchToken(const size_t start, Token& token) const
+{
+    const string& text = m_filterExpression;
+    const char first = text[start];
+
+    // Like the ANTLR lexer, longest match wins and ties go to the rule defined first in the grammar,
+    // where operators and punctuation used by parser rules precede all named lexer rules
+    enum class Rule { Operator, Word, QuotedIdentifier, Integer, Numeric, Guid, MeasurementKey, PointTag, String, DateTime, Comment, Space };
+
+    size_t bestLength = 0;
+    Rule bestRule = Rule::Space;
+    TokenType operatorType = TokenType::Unexpected;
+
+    const auto consider = [&](const size_t length, const Rule rule)
+    {
+        if (length > bestLength)
+        {
+            bestLength = length;
+            bestRule = rule;
+        }
+    };
+
+    // Operators and punctuation
+    const char second = CharAt(text, start + 1);
+    const char third = CharAt(text, start + 2);
+    size_t operatorLength = 0;
+
+    switch (first)
+    {
+        case ';': operatorType = TokenType::Semicolon; operatorLength = 1; break;
+        case ',': operatorType = TokenType::Comma; operatorLength = 1; break;
+        case '(': operatorType = TokenType::LeftParenthesis; operatorLength = 1; break;
+        case ')': operatorType = TokenType::RightParenthesis; operatorLength = 1; break;
+        case '+': operatorType = TokenType::Plus; operatorLength = 1; break;
+        case '-': operatorType = TokenType::Minus; operatorLength = 1; break;
+        case '~': operatorType = TokenType::Tilde; operatorLength = 1; break;
+        case '*': operatorType = TokenType::Asterisk; operatorLength = 1; break;
+        case '/': operatorType = TokenType::Slash; operatorLength = 1; break;
+        case '%': operatorType = TokenType::Percent; operatorLength = 1; break;
+        case '^': operatorType = TokenType::Caret; operatorLength = 1; break;
+        case '!':
+            if (second == '=' && third == '=')
+                operatorType = TokenType::NotDoubleEqual, operatorLength = 3;
+            else if (second == '=')
+                operatorType = TokenType::NotEqual, operatorLength = 2;
+            else
+                operatorType = TokenType::Exclamation, operatorLength = 1;
+            break;
+        case '=':
+            if (second == '=' && third == '=')
+                operatorType = TokenType::TripleEqual, operatorLength = 3;
+            else if (second == '=')
+                operatorType = TokenType::DoubleEqual, operatorLength = 2;
+            else
+                operatorType = TokenType::Equal, operatorLength = 1;
+            break;
+        case '<':
+            if (second == '=')
+                operatorType = TokenType::LessThanOrEqual, operatorLength = 2;
+            else if (second == '>')
+                operatorType = TokenType::LessGreater, operatorLength = 2;
+            else if (second == '<')
+                operatorType = TokenType::ShiftLeft, operatorLength = 2;
+            else
+                operatorType = TokenType::LessThan, operatorLength = 1;
+            break;
+        case '>':
+            if (second == '=')
+                operatorType = TokenType::GreaterThanOrEqual, operatorLength = 2;
+            else if (second == '>')
+                operatorType = TokenType::ShiftRight, operatorLength = 2;
+            else
+                operatorType = TokenType::GreaterThan, operatorLength = 1;
+            break;
+        case '&':
+            if (second == '&')
+                operatorType = TokenType::DoubleAmpersand, operatorLength = 2;
+            else
+                operatorType = TokenType::Ampersand, operatorLength = 1;
+            break;
+        case '|':
+            if (second == '|')
+                operatorType = TokenType::DoublePipe, operatorLength = 2;
+            else
+                operatorType = TokenType::Pipe, operatorLength = 1;
+            break;
+        default:
+            break;
+    }
+
+    consider(operatorLength, Rule::Operator);
+
+    // Keywords, boolean literals and identifiers
+    if (IsIdentifierStart(first))
+        consider(CountWhile(text, start, IsIdentifierPart), Rule::Word);
+
+    if (first == '`' || first == '[')
+        consider(MatchDelimited(text, start, first, first == '`' ? '`' : ']'), Rule::QuotedIdentifier);
+
+    // Literals
+    if (IsDigit(first))
+        consider(MatchIntegerLiteral(text, start), Rule::Integer);
+
+    if (IsDigit(first) || first == '.')
+        consider(MatchNumericLiteral(text, start), Rule::Numeric);
+
+    if (IsHexDigit(first) || first == '\'' || first == '{')
+        consider(MatchGuidLiteral(text, start), Rule::Guid);
+
+    if (IsAcronymDigit(first))
+        consider(MatchMeasurementKeyLiteral(text, start), Rule::MeasurementKey);
+
+    consider(MatchPointTagLiteral(text, start), Rule::PointTag);
+    consider(MatchStringLiteral(text, start), Rule::String);
+    consider(MatchDelimited(text, start, '#', '#'), Rule::DateTime);
+
+    // Hidden channel tokens
+    consider(MatchComment(text, start), Rule::Comment);
+
+    if (first == ' ' || first == '\v' || first == '\t' || first == '\r' || first == '\n')
+        consider(1, Rule::Space);
+
+    // Non-ASCII text is not read, ANTLR input stream decodes UTF-8 to code points
+    for (size_t i = start; i < start + max(bestLength, static_cast<size_t>(1)); i++)
+    {
+        if (static_cast<unsigned char>(text[i]) > 127)
+            bestLength = 0;
+    }
+
+    if (bestLength == 0)
+    {
+        token.Type = TokenType::Unexpected;
+        return 1;
+    }
+
+    switch (bestRule)
+    {
+        case Rule::Operator:
+            token.Type = operatorType;
+            break;
+        case Rule::Word:
+        {
+            static const StringMap<TokenType> keywords = {
+                { "AND", TokenType::And },
+                { "ASC", TokenType::Asc },
+                { "BINARY", TokenType::Binary },
+                { "BY", TokenType::By },
+                { "DESC", TokenType::Desc },
+                { "FILTER", TokenType::Filter },
+                { "IN", TokenType::In },
+                { "IS", TokenType::Is },
+                { "LIKE", TokenType::Like },
+                { "NOT", TokenType::Not },
+                { "NULL", TokenType::Null },
+                { "OR", TokenType::Or },
+                { "ORDER", TokenType::Order },
+                { "TOP", TokenType::Top },
+                { "WHERE", TokenType::Where },
+                { "XOR", TokenType::Xor },
+                { "TRUE", TokenType::BooleanLiteral },
+                { "FALSE", TokenType::BooleanLiteral }
+            };
+
+            const string word = text.substr(start, bestLength);
+            const auto keyword = keywords.find(word);
+
+            if (keyword != keywords.end())
+            {
+                token.Type = keyword->second;
+            }
+            else
+            {
+                const auto function = FunctionNames().find(word);
+
+                if (function != FunctionNames().end())
+                {
+                    token.Type = TokenType::Function;
+                    token.FunctionType = function->second;
+                }
+                else
+                {
+                    token.Type = TokenType::Identifier;
+                }
+            }
+
+            break;
+        }
+        case Rule::QuotedIdentifier:
+            token.Type = TokenType::Identifier;
+            break;
+        case Rule::Integer:
+            token.Type = TokenType::IntegerLiteral;
+            break;
+        case Rule::Numeric:
+            token.Type = TokenType::NumericLiteral;
+            break;
+        case Rule::Guid:
+            token.Type = TokenType::GuidLiteral;
+            break;
+        case Rule::MeasurementKey:
+            token.Type = TokenType::MeasurementKeyLiteral;
+            break;
+        case Rule::PointTag:
+            token.Type = TokenType::PointTagLiteral;
+            break;
+        case Rule::String:
+            token.Type = TokenType::StringLiteral;
+            break;
+        case Rule::DateTime:
+            token.Type = TokenType::DateTimeLiteral;
+            break;
+        default:
+            token.Type = TokenType::EndOfInput;
+            break;
+    }
+
+    return bestLength;
+}
+
+const FilterExpressionSyntaxReader::Token& FilterExpressionSyntaxReader::Current() const
+{
+    return m_tokens[m_index];
+}
+
+const FilterExpressionSyntaxReader::Token& FilterExpressionSyntaxReader::Peek(const size_t offset) const
+{
+    return m_tokens[min(m_index + offset, m_tokens.size() - 1)];
+}
+
+string FilterExpressionSyntaxReader::Text(const Token& token) const
+{
+    return m_filterExpression.substr(token.Start, token.Length);
+}
+
+const FilterExpressionSyntaxReader::Token& FilterExpressionSyntaxReader::Expect(const TokenType type, const char* expected)
+{
+    const Token& token = Current();
+
+    if (token.Type != type)
+        throw FilterExpressionParserException(SyntaxError(token, expected));
+
+    m_index++;
+    return token;
+}
+
+string FilterExpressionSyntaxReader::SyntaxError(const Token& token, const string& expected) const
+{
+    string message = "Syntax error at line " + ToString(token.Line) + ":" + ToString(token.Column) + ", ";
+
+    if (token.Type == TokenType::EndOfInput)
+        message += "unexpected end of input";
+    else if (token.Type == TokenType::Unexpected)
+        message += "unexpected character \"" + m_filterExpression.substr(token.Start, 1) + "\"";
+    else
+        message += "unexpected \"" + Text(token) + "\"";
+
+    if (!expected.empty())
+        message += ", expected " + expected;
+
+    return message;
+}
+
+vector<FilterExpressionStatement> FilterExpressionSyntaxReader::Read()
+{
+    vector<FilterExpressionStatement> statements;
+
+    Tokenize();
+    m_index = 0;
+
+    // filterExpressionStatementList: ';'* filterExpressionStatement ( ';'+ filterExpressionStatement )* ';'*
+    while (Current().Type == TokenType::Semicolon)
+        m_index++;
+
+    ReadStatement(statements);
+
+    while (Current().Type == TokenType::Semicolon)
+    {
+        while (Current().Type == TokenType::Semicolon)
+            m_index++;
+
+        if (Current().Type != TokenType::EndOfInput)
+            ReadStatement(statements);
+    }
+
+    Expect(TokenType::EndOfInput, "\";\" or end of input");
+
+    return statements;
+}
+
+void FilterExpressionSyntaxReader::ReadStatement(vector<FilterExpressionStatement>& statements)
+{
+    const Token& token = Current();
+    const TokenType nextType = Peek(1).Type;
+    const bool isStatementEnd = nextType == TokenType::Semicolon || nextType == TokenType::EndOfInput;
+
+    statements.emplace_back();
+    FilterExpressionStatement& statement = statements.back();
+
+    // Identifier statements take precedence over a standalone Guid literal expression
+    if (isStatementEnd && token.Type == TokenType::GuidLiteral && !m_identifiersAsExpressions)
+    {
+        statement.Type = FilterExpressionStatement::StatementType::SignalID;
+        statement.SignalID = ParseGuidLiteral(Text(token));
+        m_index++;
+        return;
+    }
+
+    if (isStatementEnd && token.Type == TokenType::MeasurementKeyLiteral)
+    {
+        statement.Type = FilterExpressionStatement::StatementType::MeasurementKey;
+        statement.Identifier = Text(token);
+        m_index++;
+        return;
+    }
+
+    if (isStatementEnd && token.Type == TokenType::PointTagLiteral)
+    {
+        statement.Type = FilterExpressionStatement::StatementType::PointTag;
+        statement.Identifier = ParsePointTagLiteral(Text(token));
+        m_index++;
+        return;
+    }
+
+    if (token.Type == TokenType::Filter)
+    {
+        ReadFilterStatement(statement);
+        return;
+    }
+
+    // Standalone expressions are evaluated against the primary table
+    m_table = GetPrimaryTable();
+    statement.Table = m_table;
+    statement.Root = ReadExpression(0);
+}
+
+/*
+    filterStatement
+     : K_FILTER ( K_TOP topLimit )? tableName K_WHERE expression ( K_ORDER K_BY orderingTerm ( ',' orderingTerm )* )?
+     ;
+ */
+void FilterExpressionSyntaxReader::ReadFilterStatement(FilterExpressionStatement& statement)
+{
+    Expect(TokenType::Filter, "\"FILTER\"");
+
+    if (Current().Type == TokenType::Top)
+    {
+        m_index++;
+
+        // topLimit: ( '-' | '+' )? INTEGER_LITERAL
+        string topLimit;
+
+        if (Current().Type == TokenType::Minus || Current().Type == TokenType::Plus)
+            topLimit = Text(m_tokens[m_index++]);
+
+        topLimit += Text(Expect(TokenType::IntegerLiteral, "integer TOP limit"));
+        statement.TopLimit = stoi(topLimit);
+    }
+
+    const string tableName = Text(Expect(TokenType::Identifier, "table name"));
+    m_table = m_dataSet->Table(tableName);
+
+    if (m_table == nullptr)
+        throw FilterExpressionParserException("Failed to find table \"" + tableName + "\"");
+
+    statement.Table = m_table;
+    Expect(TokenType::Where, "\"WHERE\"");
+    statement.Root = ReadExpression(0);
+
+    if (Current().Type != TokenType::Order)
+        return;
+
+    m_index++;
+    Expect(TokenType::By, "\"BY\"");
+
+    // orderingTerm: exactMatchModifier? orderByColumnName ( K_ASC | K_DESC )?
+    while (true)
+    {
+        const bool exactMatch = ReadExactMatchModifier();
+        const string orderByColumnName = Text(Expect(TokenType::Identifier, "order by column name"));
+        const DataColumnPtr& orderByColumn = m_table->Column(orderByColumnName);
+        bool ascending = true;
+
+        if (orderByColumn == nullptr)
+            throw FilterExpressionParserException("Failed to find order by field \"" + orderByColumnName + "\" for table \"" + m_table->Name() + "\"");
+
+        if (Current().Type == TokenType::Asc)
+        {
+            m_index++;
+        }
+        else if (Current().Type == TokenType::Desc)
+        {
+            ascending = false;
+            m_index++;
+        }
+
+        statement.OrderByTerms.emplace_back(orderByColumn, ascending, !exactMatch);
+
+        if (Current().Type != TokenType::Comma)
+            break;
+
+        m_index++;
+    }
+}
+
+/*
+    expression
+     : notOperator expression
+     | expression logicalOperator expression
+     | predicateExpression
+     ;
+
+    Precedence follows the left-recursive rule rewrite of ANTLR, where earlier alternatives bind tighter
+ */
+ExpressionPtr FilterExpressionSyntaxReader::ReadExpression(const int32_t precedence)
+{
+    ExpressionPtr value;
+
+    // Leading not operator applies to the expression instead of a unary value operator
+    if (IsNotOperator(0))
+    {
+        m_index++;
+        value = NewSharedPtr<UnaryExpression>(ExpressionUnaryType::Not, ReadExpression(3));
+    }
+    else
+    {
+        value = ReadPredicateExpression(0);
+    }
+
+    while (precedence <= 2)
+    {
+        ExpressionOperatorType operatorType;
+
+        switch (Current().Type)
+        {
+            case TokenType::And:
+            case TokenType::DoubleAmpersand:
+                operatorType = ExpressionOperatorType::And;
+                break;
+            case TokenType::Or:
+            case TokenType::DoublePipe:
+                operatorType = ExpressionOperatorType::Or;
+                break;
+            default:
+                return value;
+        }
+
+        m_index++;
+        value = NewSharedPtr<OperatorExpression>(operatorType, value, ReadExpression(3));
+    }
+
+    return value;
+}
+
+/*
+    predicateExpression
+     : predicateExpression notOperator? K_IN exactMatchModifier? '(' expressionList ')'
+     | predicateExpression K_IS notOperator? K_NULL
+     | predicateExpression comparisonOperator predicateExpression
+     | predicateExpression notOperator? K_LIKE exactMatchModifier? predicateExpression
+     | valueExpression
+     ;
+ */
+ExpressionPtr FilterExpressionSyntaxReader::ReadPredicateExpression(const int32_t precedence)
+{
+    ExpressionPtr value = ReadValueExpression(0);
+
+    while (true)
+    {
+        const bool hasNotOperator = IsNotOperator(0);
+        const TokenType type = Peek(hasNotOperator ? 1 : 0).Type;
+
+        if (type == TokenType::In && precedence <= 5)
+        {
+            m_index += hasNotOperator ? 2 : 1;
+
+            const bool exactMatch = ReadExactMatchModifier();
+
+            Expect(TokenType::LeftParenthesis, "\"(\"");
+            const ExpressionCollectionPtr arguments = ReadExpressionList();
+            Expect(TokenType::RightParenthesis, "\")\"");
+
+            value = NewSharedPtr<InListExpression>(value, arguments, hasNotOperator, exactMatch);
+            continue;
+        }
+
+        if (hasNotOperator)
+        {
+            if (type != TokenType::Like || precedence > 2)
+                return value;
+
+            m_index += 2;
+
+            const bool exactMatch = ReadExactMatchModifier();
+            value = NewSharedPtr<OperatorExpression>(exactMatch ? ExpressionOperatorType::NotLikeExactMatch : ExpressionOperatorType::NotLike, value, ReadPredicateExpression(3));
+            continue;
+        }
+
+        ExpressionOperatorType operatorType;
+
+        switch (type)
+        {
+            case TokenType::Is:
+            {
+                if (precedence > 4)
+                    return value;
+
+                m_index++;
+
+                const bool isNotNull = IsNotOperator(0);
+
+                if (isNotNull)
+                    m_index++;
+
+                Expect(TokenType::Null, "\"NULL\"");
+                value = NewSharedPtr<OperatorExpression>(isNotNull ? ExpressionOperatorType::IsNotNull : ExpressionOperatorType::IsNull, value, nullptr);
+                continue;
+            }
+            case TokenType::Like:
+            {
+                if (precedence > 2)
+                    return value;
+
+                m_index++;
+
+                const bool exactMatch = ReadExactMatchModifier();
+                value = NewSharedPtr<OperatorExpression>(exactMatch ? ExpressionOperatorType::LikeExactMatch : ExpressionOperatorType::Like, value, ReadPredicateExpression(3));
+                continue;
+            }
+            case TokenType::LessThan:
+                operatorType = ExpressionOperatorType::LessThan;
+                break;
+            case TokenType::LessThanOrEqual:
+                operatorType = ExpressionOperatorType::LessThanOrEqual;
+                break;
+            case TokenType::GreaterThan:
+                operatorType = ExpressionOperatorType::GreaterThan;
+                break;
+            case TokenType::GreaterThanOrEqual:
+                operatorType = ExpressionOperatorType::GreaterThanOrEqual;
+                break;
+            case TokenType::Equal:
+            case TokenType::DoubleEqual:
+                operatorType = ExpressionOperatorType::Equal;
+                break;
+            case TokenType::TripleEqual:
+                operatorType = ExpressionOperatorType::EqualExactMatch;
+                break;
+            case TokenType::NotEqual:
+            case TokenType::LessGreater:
+                operatorType = ExpressionOperatorType::NotEqual;
+                break;
+            case TokenType::NotDoubleEqual:
+                operatorType = ExpressionOperatorType::NotEqualExactMatch;
+                break;
+            default:
+                return value;
+        }
+
+        if (precedence > 3)
+            return value;
+
+        m_index++;
+        value = NewSharedPtr<OperatorExpression>(operatorType, value, ReadPredicateExpression(4));
+    }
+}
+
+/*
+    valueExpression
+     : literalValue
+     | columnName
+     | functionExpression
+     | unaryOperator valueExpression
+     | '(' expression ')'
+     | valueExpression mathOperator valueExpression
+     | valueExpression bitwiseOperator valueExpression
+     ;
+ */
+ExpressionPtr FilterExpressionSyntaxReader::ReadValueExpression(const int32_t precedence)
+{
+    ExpressionPtr value;
+    const Token& token = Current();
+
+    switch (token.Type)
+    {
+        case TokenType::IntegerLiteral:
+        case TokenType::NumericLiteral:
+        case TokenType::StringLiteral:
+        case TokenType::DateTimeLiteral:
+        case TokenType::GuidLiteral:
+        case TokenType::BooleanLiteral:
+        case TokenType::Null:
+            value = ReadLiteralValue();
+            break;
+        case TokenType::Identifier:
+        {
+            const string columnName = Text(token);
+            const DataColumnPtr& dataColumn = m_table->Column(columnName);
+
+            if (dataColumn == nullptr)
+                throw FilterExpressionParserException("Failed to find column \"" + columnName + "\" in table \"" + m_table->Name() + "\"");
+
+            m_index++;
+            value = NewSharedPtr<ColumnExpression>(dataColumn);
+            break;
+        }
+        case TokenType::Function:
+        {
+            const ExpressionFunctionType functionType = token.FunctionType;
+            ExpressionCollectionPtr arguments;
+
+            m_index++;
+            Expect(TokenType::LeftParenthesis, "\"(\"");
+
+            if (Current().Type == TokenType::RightParenthesis)
+                arguments = NewSharedPtr<ExpressionCollection>();
+            else
+                arguments = ReadExpressionList();
+
+            Expect(TokenType::RightParenthesis, "\")\"");
+            value = NewSharedPtr<FunctionExpression>(functionType, arguments);
+            break;
+        }
+        case TokenType::Plus:
+        case TokenType::Minus:
+        case TokenType::Tilde:
+        case TokenType::Exclamation:
+        case TokenType::Not:
+        {
+            ExpressionUnaryType unaryType;
+
+            if (token.Type == TokenType::Plus)
+                unaryType = ExpressionUnaryType::Plus;
+            else if (token.Type == TokenType::Minus)
+                unaryType = ExpressionUnaryType::Minus;
+            else
+                unaryType = ExpressionUnaryType::Not;
+
+            m_index++;
+            value = NewSharedPtr<UnaryExpression>(unaryType, ReadValueExpression(4));
+            break;
+        }
+        case TokenType::LeftParenthesis:
+            m_index++;
+            value = ReadExpression(0);
+            Expect(TokenType::RightParenthesis, "\")\"");
+            break;
+        default:
+            throw FilterExpressionParserException(SyntaxError(token, "expression"));
+    }
+
+    while (true)
+    {
+        ExpressionOperatorType operatorType;
+        int32_t operatorPrecedence = 2;
+
+        switch (Current().Type)
+        {
+            case TokenType::Asterisk:
+                operatorType = ExpressionOperatorType::Multiply;
+                break;
+            case TokenType::Slash:
+                operatorType = ExpressionOperatorType::Divide;
+                break;
+            case TokenType::Percent:
+                operatorType = ExpressionOperatorType::Modulus;
+                break;
+            case TokenType::Plus:
+                operatorType = ExpressionOperatorType::Add;
+                break;
+            case TokenType::Minus:
+                operatorType = ExpressionOperatorType::Subtract;
+                break;
+            case TokenType::ShiftLeft:
+                operatorType = ExpressionOperatorType::BitShiftLeft;
+                operatorPrecedence = 1;
+                break;
+            case TokenType::ShiftRight:
+                operatorType = ExpressionOperatorType::BitShiftRight;
+                operatorPrecedence = 1;
+                break;
+            case TokenType::Ampersand:
+                operatorType = ExpressionOperatorType::BitwiseAnd;
+                operatorPrecedence = 1;
+                break;
+            case TokenType::Pipe:
+                operatorType = ExpressionOperatorType::BitwiseOr;
+                operatorPrecedence = 1;
+                break;
+            case TokenType::Caret:
+            case TokenType::Xor:
+                operatorType = ExpressionOperatorType::BitwiseXor;
+                operatorPrecedence = 1;
+                break;
+            default:
+                return value;
+        }
+
+        if (precedence > operatorPrecedence)
+            return value;
+
+        m_index++;
+        value = NewSharedPtr<OperatorExpression>(operatorType, value, ReadValueExpression(operatorPrecedence + 1));
+    }
+}
+
+/*
+    literalValue
+     : INTEGER_LITERAL
+     | NUMERIC_LITERAL
+     | STRING_LITERAL
+     | DATETIME_LITERAL
+     | GUID_LITERAL
+     | BOOLEAN_LITERAL
+     | K_NULL
+     ;
+ */
+ExpressionPtr FilterExpressionSyntaxReader::ReadLiteralValue()
+{
+    const Token& token = Current();
+    const string literal = Text(token);
+    ValueExpressionPtr result;
+
+    m_index++;
+
+    switch (token.Type)
+    {
+        case TokenType::IntegerLiteral:
+            result = ParseIntegerLiteral(literal);
+            break;
+        case TokenType::NumericLiteral:
+            result = ParseNumericLiteral(literal);
+            break;
+        case TokenType::StringLiteral:
+            result = NewSharedPtr<ValueExpression>(ExpressionValueType::String, ParseStringLiteral(literal));
+            break;
+        case TokenType::DateTimeLiteral:
+            result = NewSharedPtr<ValueExpression>(ExpressionValueType::DateTime, ParseDateTimeLiteral(literal));
+            break;
+        case TokenType::GuidLiteral:
+            result = NewSharedPtr<ValueExpression>(ExpressionValueType::Guid, ParseGuidLiteral(literal));
+            break;
+        case TokenType::BooleanLiteral:
+            result = IsEqual(literal, "true") ? ExpressionTree::True : ExpressionTree::False;
+            break;
+        default:
+            result = ExpressionTree::NullValue(ExpressionValueType::Undefined);
+            break;
+    }
+
+    return CastSharedPtr<Expression>(result);
+}
+
+ExpressionCollectionPtr FilterExpressionSyntaxReader::ReadExpressionList()
+{
+    ExpressionCollectionPtr expressions = NewSharedPtr<ExpressionCollection>();
+
+    expressions->push_back(ReadExpression(0));
+
+    while (Current().Type == TokenType::Comma)
+    {
+        m_index++;
+        expressions->push_back(ReadExpression(0));
+    }
+
+    return expressions;
+}
+
+bool FilterExpressionSyntaxReader::IsNotOperator(const size_t offset) const
+{
+    const TokenType type = Peek(offset).Type;
+    return type == TokenType::Not || type == TokenType::Exclamation;
+}
+
+bool FilterExpressionSyntaxReader::ReadExactMatchModifier()
+{
+    const TokenType type = Current().Type;
+
+    if (type != TokenType::Binary && type != TokenType::TripleEqual)
+        return false;
+
+    m_index++;
+    return true;
+}
+
+const DataTablePtr& FilterExpressionSyntaxReader::GetPrimaryTable() const
+{
+    const DataTablePtr& table = m_dataSet->Table(m_primaryTableName);
+
+    if (table == nullptr)
+        throw FilterExpressionParserException("Failed to find table \"" + m_primaryTableName + "\"");
+
+    return table;
+}
+
+ValueExpressionPtr FilterExpressionSyntaxReader::ParseIntegerLiteral(const string& literal)
+{
+    const double_t value = stod(literal);
+
+    if (value > Int64::MaxValue)
+        return NewSharedPtr<ValueExpression>(ExpressionValueType::Double, value);
+
+    if (value > Int32::MaxValue)
+        return NewSharedPtr<ValueExpression>(ExpressionValueType::Int64, static_cast<int64_t>(value));
+
+    return NewSharedPtr<ValueExpression>(ExpressionValueType::Int32, static_cast<int32_t>(value));
+}
+
+ValueExpressionPtr FilterExpressionSyntaxReader::ParseNumericLiteral(const string& literal)
+{
+    // Real literals using scientific notation are parsed as double
+    if (Contains(literal, "E"))
+        return NewSharedPtr<ValueExpression>(ExpressionValueType::Double, stod(literal));
+
+    // Real literals without scientific notation are parsed as decimal, compact when the value
+    // fits, if the number fails to parse as decimal, then it is parsed as a double
+    Decimal128 compact;
+
+    if (Decimal128::TryParse(literal, compact))
+        return NewSharedPtr<ValueExpression>(ExpressionValueType::Decimal, compact);
+
+    try
+    {
+        return NewSharedPtr<ValueExpression>(ExpressionValueType::Decimal, decimal_t(literal));
+    }
+    catch (const runtime_error&)
+    {
+        return NewSharedPtr<ValueExpression>(ExpressionValueType::Double, stod(literal));
+    }
+}
+
+string FilterExpressionSyntaxReader::ParseStringLiteral(string stringLiteral)
+{
+    // Remove any surrounding quotes from string, ANTLR grammar already
+    // ensures strings starting with quote also ends with one
+    if (stringLiteral.front() == '\'')
+    {
+        stringLiteral.erase(0, 1);
+        stringLiteral.erase(stringLiteral.size() - 1);
+    }
+
+    return stringLiteral;
+}
+
+GSF::Guid FilterExpressionSyntaxReader::ParseGuidLiteral(string guidLiteral)
+{
+    // Remove any quotes from GUID (boost currently only handles optional braces),
+    // ANTLR grammar already ensures GUID starting with quote also ends with one
+    if (guidLiteral.front() == '\'')
+    {
+        guidLiteral.erase(0, 1);
+        guidLiteral.erase(guidLiteral.size() - 1);
+    }
+
+    return ParseGuid(guidLiteral.c_str());
+}
+
+datetime_t FilterExpressionSyntaxReader::ParseDateTimeLiteral(string time)
+{
+    // Remove any surrounding '#' symbols from date/time, ANTLR grammar already
+    // ensures date/time starting with '#' symbol will also end with one
+    if (time.front() == '#')
+    {
+        time.erase(0, 1);
+        time.erase(time.size() - 1);
+    }
+
+    return ParseTimestamp(time.c_str());
+}
+
+string FilterExpressionSyntaxReader::ParsePointTagLiteral(string pointTagLiteral)
+{
+    // Remove any double-quotes from point tag literal, ANTLR grammar already
+    // ensures tag starting with quote also ends with one
+    if (pointTagLiteral.front() == '"')
+    {
+        pointTagLiteral.erase(0, 1);
+        pointTagLiteral.erase(pointTagLiteral.size() - 1);
+    }
+
+    return pointTagLiteral;
+}
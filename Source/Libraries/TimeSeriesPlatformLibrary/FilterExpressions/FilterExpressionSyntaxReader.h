@@ -0,0 +1,155 @@
+//******************************************************************************************************
+//  FilterExpressionSyntaxReader.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __FILTER_EXPRESSION_SYNTAX_READER_H
+#define __FILTER_EXPRESSION_SYNTAX_READER_H
+
+#include "FilterExpressionCache.h"
+
+namespace GSF {
+namespace FilterExpressions
+{
+    // Hand-written lexer and recursive-descent parser for the grammar defined in FilterExpressionSyntax.g4.
+    // Statements are read with the same tokens, operator precedence and literal conversions as the ANTLR
+    // generated parser and the FilterExpressionParser listener, but without creating a parse tree. There
+    // is no error recovery, expressions that are not syntactically valid or that contain non-ASCII text
+    // are rejected with an exception that includes the line and column of the offending token.
+    class FilterExpressionSyntaxReader // NOLINT
+    {
+    private:
+        enum class TokenType : uint8_t
+        {
+            EndOfInput,
+            Semicolon,
+            Comma,
+            LeftParenthesis,
+            RightParenthesis,
+            Plus,
+            Minus,
+            Tilde,
+            Exclamation,
+            Asterisk,
+            Slash,
+            Percent,
+            LessThan,
+            LessThanOrEqual,
+            GreaterThan,
+            GreaterThanOrEqual,
+            Equal,
+            DoubleEqual,
+            TripleEqual,
+            NotEqual,
+            NotDoubleEqual,
+            LessGreater,
+            DoubleAmpersand,
+            DoublePipe,
+            ShiftLeft,
+            ShiftRight,
+            Ampersand,
+            Pipe,
+            Caret,
+            And,
+            Asc,
+            Binary,
+            By,
+            Desc,
+            Filter,
+            Function,
+            In,
+            Is,
+            Like,
+            Not,
+            Null,
+            Or,
+            Order,
+            Top,
+            Where,
+            Xor,
+            BooleanLiteral,
+            Identifier,
+            IntegerLiteral,
+            NumericLiteral,
+            GuidLiteral,
+            MeasurementKeyLiteral,
+            PointTagLiteral,
+            StringLiteral,
+            DateTimeLiteral,
+            Unexpected
+        };
+
+        struct Token
+        {
+            TokenType Type;
+            ExpressionFunctionType FunctionType;
+            size_t Start;
+            size_t Length;
+            int32_t Line;
+            int32_t Column;
+        };
+
+        const std::string& m_filterExpression;
+        const GSF::Data::DataSetPtr& m_dataSet;
+        const std::string& m_primaryTableName;
+        const bool m_identifiersAsExpressions;
+        std::vector<Token> m_tokens;
+        size_t m_index;
+        GSF::Data::DataTablePtr m_table;
+
+        // Lexer
+        void Tokenize();
+        size_t MatchToken(size_t start, Token& token) const;
+
+        // Parser
+        const Token& Current() const;
+        const Token& Peek(size_t offset) const;
+        std::string Text(const Token& token) const;
+        const Token& Expect(TokenType type, const char* expected);
+        void ReadStatement(std::vector<FilterExpressionStatement>& statements);
+        void ReadFilterStatement(FilterExpressionStatement& statement);
+        ExpressionPtr ReadExpression(int32_t precedence);
+        ExpressionPtr ReadPredicateExpression(int32_t precedence);
+        ExpressionPtr ReadValueExpression(int32_t precedence);
+        ExpressionPtr ReadLiteralValue();
+        ExpressionCollectionPtr ReadExpressionList();
+        bool IsNotOperator(size_t offset) const;
+        bool ReadExactMatchModifier();
+        const GSF::Data::DataTablePtr& GetPrimaryTable() const;
+        std::string SyntaxError(const Token& token, const std::string& expected) const;
+
+    public:
+        FilterExpressionSyntaxReader(const std::string& filterExpression, const GSF::Data::DataSetPtr& dataSet, const std::string& primaryTableName, bool identifiersAsExpressions);
+
+        // Reads all statements of the filter expression, throws FilterExpressionParserException on failure
+        std::vector<FilterExpressionStatement> Read();
+
+        // Literal conversions shared with the ANTLR parse tree listener
+        static ValueExpressionPtr ParseIntegerLiteral(const std::string& literal);
+        static ValueExpressionPtr ParseNumericLiteral(const std::string& literal);
+        static std::string ParseStringLiteral(std::string stringLiteral);
+        static GSF::Guid ParseGuidLiteral(std::string guidLiteral);
+        static GSF::datetime_t ParseDateTimeLiteral(std::string time);
+        static std::string ParsePointTagLiteral(std::string pointTagLiteral);
+    };
+}}
+
+#endif
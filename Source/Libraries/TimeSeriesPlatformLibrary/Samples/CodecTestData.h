@@ -0,0 +1,145 @@
+//******************************************************************************************************
+//  CodecTestData.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#pragma once
+
+#include <cstring>
+#include "../Common/CommonTypes.h"
+#include "../Common/Convert.h"
+#include "../Data/DataSet.h"
+
+// Test data shared by codec sample tests and benchmarks
+
+// Same working buffer size used by publisher
+static constexpr uint32_t BlockSize = 32768U;
+
+// Measurement fields as passed to a codec, TValue is the codec value type or its raw bits
+template<typename TValue>
+struct BasicTestMeasurement
+{
+    uint16_t ID;
+    int64_t Timestamp;
+    uint32_t Quality;
+    TValue Value;
+};
+
+typedef BasicTestMeasurement<GSF::float64_t> TestMeasurement;
+typedef std::vector<TestMeasurement> TestStream;
+
+// Deterministic generator so results can be reproduced on any platform
+class Random
+{
+    uint64_t m_state;
+
+public:
+    explicit Random(uint64_t seed) : m_state(seed) { }
+
+    uint64_t Next()
+    {
+        m_state = m_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return m_state;
+    }
+
+    // Returns high 31 bits of next state, low bits of this generator have short periods
+    uint32_t NextUInt32()
+    {
+        return static_cast<uint32_t>(Next() >> 33);
+    }
+
+    uint32_t Next(uint32_t range)
+    {
+        return NextUInt32() % range;
+    }
+
+    GSF::float64_t NextDouble()
+    {
+        return static_cast<GSF::float64_t>(Next() >> 11) / 9007199254740992.0;
+    }
+
+    GSF::Guid NextGuid()
+    {
+        uint8_t data[16];
+
+        for (size_t i = 0; i < 16; i += 8)
+        {
+            const uint64_t bits = Next();
+            memcpy(data + i, &bits, 8);
+        }
+
+        return GSF::ParseGuid(data);
+    }
+};
+
+inline uint32_t ToBits(GSF::float32_t value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(uint32_t));
+    return bits;
+}
+
+inline uint64_t ToBits(GSF::float64_t value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(uint64_t));
+    return bits;
+}
+
+// Recorded PMU data from History.xml, replayed with timestamps shifted past the end of the previous
+// replay. Point IDs are assigned in order of first appearance of each signal ID.
+inline TestStream LoadHistoryStream(uint32_t replayCount = 1)
+{
+    const GSF::Data::DataSetPtr dataSet = GSF::Data::DataSet::FromXml("History.xml");
+    const GSF::Data::DataTablePtr history = dataSet->Table("History");
+    const int32_t signalIDColumn = history->Column("SignalID")->Index();
+    const int32_t timestampColumn = history->Column("Timestamp")->Index();
+    const int32_t valueColumn = history->Column("Value")->Index();
+    std::unordered_map<GSF::Guid, uint16_t> pointIDs;
+    TestStream recording;
+
+    for (int32_t i = 0; i < history->RowCount(); i++)
+    {
+        const GSF::Data::DataRowPtr row = history->Row(i);
+        const GSF::Guid signalID = row->ValueAsGuid(signalIDColumn).GetValueOrDefault();
+        const auto result = pointIDs.emplace(signalID, static_cast<uint16_t>(pointIDs.size()));
+
+        recording.push_back({ result.first->second, row->ValueAsInt64(timestampColumn).GetValueOrDefault(), 0U, row->ValueAsDouble(valueColumn).GetValueOrDefault() });
+    }
+
+    TestStream stream;
+
+    if (recording.empty())
+        return stream;
+
+    const int64_t span = recording.back().Timestamp - recording.front().Timestamp + 333333LL;
+
+    for (uint32_t replay = 0; replay < replayCount; replay++)
+    {
+        for (TestMeasurement measurement : recording)
+        {
+            measurement.Timestamp += span * replay;
+            stream.push_back(measurement);
+        }
+    }
+
+    return stream;
+}
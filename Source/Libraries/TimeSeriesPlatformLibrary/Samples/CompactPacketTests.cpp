@@ -0,0 +1,280 @@
+//******************************************************************************************************
+//  CompactPacketTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <cassert>
+#include <algorithm>
+#include "../Transport/CompactMeasurement.h"
+#include "../Transport/CompactPacketCodec.h"
+#include "CodecTestData.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// Each frame is published as its own compact packet, as a UDP publisher does for each publication
+typedef vector<vector<uint8_t>> PacketStream;
+
+struct TestData
+{
+    SignalIndexCachePtr SignalIndexCache;
+    PacketStream Packets;
+    size_t MeasurementCount;
+};
+
+SignalIndexCachePtr CreateSignalIndexCache(uint32_t signalCount, uint32_t firstIndex = 0)
+{
+    SignalIndexCachePtr signalIndexCache = NewSharedPtr<SignalIndexCache>();
+
+    for (uint32_t i = 0; i < signalCount; i++)
+        signalIndexCache->AddMeasurementKey(static_cast<uint16_t>(firstIndex + i), NewGuid(), "PPA", i + 1);
+
+    return signalIndexCache;
+}
+
+void AddPacket(TestData& data, const vector<Measurement>& frame)
+{
+    const CompactMeasurement serializer(data.SignalIndexCache);
+    vector<uint8_t> packet;
+
+    for (size_t i = 0; i < frame.size(); i++)
+        serializer.SerializeMeasurement(frame[i], packet, static_cast<uint16_t>(i));
+
+    data.Packets.push_back(packet);
+    data.MeasurementCount += frame.size();
+}
+
+// Recorded PMU data from History.xml, one packet per timestamp
+TestData LoadHistoryData()
+{
+    vector<Measurement> frame;
+    TestData data { nullptr, {}, 0 };
+
+    for (const TestMeasurement& record : LoadHistoryStream())
+    {
+        Measurement measurement;
+
+        measurement.Timestamp = record.Timestamp;
+        measurement.Value = record.Value;
+
+        if (!frame.empty() && frame.back().Timestamp != measurement.Timestamp)
+        {
+            if (data.SignalIndexCache == nullptr)
+                data.SignalIndexCache = CreateSignalIndexCache(ConvertUInt32(frame.size()));
+
+            AddPacket(data, frame);
+            frame.clear();
+        }
+
+        frame.push_back(measurement);
+    }
+
+    return data;
+}
+
+// Synchrophasor style frames: frequency, angle, magnitude and status values for each device
+TestData GenerateFrameData(uint32_t pointCount, uint32_t frameCount, uint64_t seed)
+{
+    TestData data { CreateSignalIndexCache(pointCount), {}, 0 };
+    Random random(seed);
+    vector<Measurement> frame(pointCount);
+    int64_t timestamp = 637000000000000000LL;
+
+    for (uint32_t i = 0; i < frameCount; i++)
+    {
+        timestamp += 333333;
+
+        for (uint32_t point = 0; point < pointCount; point++)
+        {
+            Measurement& measurement = frame[point];
+
+            measurement.Timestamp = timestamp;
+
+            switch (point % 4)
+            {
+                case 0:
+                    measurement.Value = 59.95 + random.Next(1000) / 10000.0;
+                    break;
+                case 1:
+                    measurement.Value = i * 0.02 + point - 180.0;
+                    break;
+                case 2:
+                    measurement.Value = 131000.0 + random.Next(500);
+                    break;
+                default:
+                    measurement.Value = i % 300 < 150 ? 0.0 : 1.0;
+                    break;
+            }
+        }
+
+        AddPacket(data, frame);
+    }
+
+    return data;
+}
+
+PacketStream Compress(CompactPacketCodec& codec, const PacketStream& packets)
+{
+    PacketStream compressedPackets;
+
+    for (const auto& packet : packets)
+    {
+        compressedPackets.emplace_back();
+        codec.Compress(packet.data(), ConvertUInt32(packet.size()), compressedPackets.back());
+    }
+
+    return compressedPackets;
+}
+
+// Measures compression ratio and CPU cost, best of five runs
+void Benchmark(const string& name, const TestData& data)
+{
+    const float64_t count = static_cast<float64_t>(data.MeasurementCount);
+    size_t packetSize = 0;
+
+    for (const auto& packet : data.Packets)
+        packetSize += packet.size();
+
+    cout << "Benchmark: " << name << ", " << data.Packets.size() << " packets, " << packetSize / count << " bytes/value uncompressed" << endl;
+
+    for (int32_t useDictionary = 0; useDictionary < 2; useDictionary++)
+    {
+        CompactPacketCodec codec;
+        PacketStream compressedPackets;
+        vector<uint8_t> buffer;
+        float64_t compressTime = numeric_limits<float64_t>::max();
+        float64_t decompressTime = numeric_limits<float64_t>::max();
+        size_t compressedSize = 0;
+
+        codec.SetDictionarySource(useDictionary ? data.SignalIndexCache : nullptr);
+
+        for (int32_t i = 0; i < 5; i++)
+        {
+            auto startTime = chrono::steady_clock::now();
+            compressedPackets = Compress(codec, data.Packets);
+            compressTime = min(compressTime, chrono::duration<float64_t>(chrono::steady_clock::now() - startTime).count());
+
+            startTime = chrono::steady_clock::now();
+
+            for (auto& packet : compressedPackets)
+                codec.Decompress(packet.data(), ConvertUInt32(packet.size()), buffer);
+
+            decompressTime = min(decompressTime, chrono::duration<float64_t>(chrono::steady_clock::now() - startTime).count());
+        }
+
+        for (const auto& packet : compressedPackets)
+            compressedSize += packet.size();
+
+        cout << (useDictionary ? "    with dictionary: " : "    no dictionary:   ");
+        cout << compressedSize / count << " bytes/value, ratio " << static_cast<float64_t>(packetSize) / compressedSize << ", ";
+        cout << compressTime / count * 1e9 << " ns/value compress, ";
+        cout << decompressTime / count * 1e9 << " ns/value decompress" << endl;
+    }
+}
+
+// Sample application to test independently compressed compact packets and to measure
+// their compression ratio and CPU cost on recorded and generated PMU data.
+int main(int argc, char* argv[])
+{
+    const TestData historyData = LoadHistoryData();
+    const TestData frameData = GenerateFrameData(400, 300, 1);
+    CompactPacketCodec codec;
+    PacketStream compressedPackets;
+    vector<uint8_t> buffer;
+    int32_t test = 0;
+
+    assert(!historyData.Packets.empty());
+
+    // Test packets round-trip without a dictionary
+    compressedPackets = Compress(codec, frameData.Packets);
+
+    for (size_t i = 0; i < compressedPackets.size(); i++)
+    {
+        const uint32_t length = codec.Decompress(compressedPackets[i].data(), ConvertUInt32(compressedPackets[i].size()), buffer);
+        assert(equal(buffer.begin(), buffer.begin() + length, frameData.Packets[i].begin(), frameData.Packets[i].end()));
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test packets round-trip with a dictionary and decode independently, in any order
+    codec.SetDictionarySource(frameData.SignalIndexCache);
+    compressedPackets = Compress(codec, frameData.Packets);
+
+    for (size_t i = compressedPackets.size(); i > 0; i -= 2)
+    {
+        const uint32_t length = codec.Decompress(compressedPackets[i - 1].data(), ConvertUInt32(compressedPackets[i - 1].size()), buffer);
+        assert(equal(buffer.begin(), buffer.begin() + length, frameData.Packets[i - 1].begin(), frameData.Packets[i - 1].end()));
+
+        if (i < 2)
+            break;
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test receiver with a different signal index cache detects mismatched dictionary
+    CompactPacketCodec receiver;
+    bool failed = false;
+
+    receiver.SetDictionarySource(CreateSignalIndexCache(400, 1000));
+
+    try
+    {
+        receiver.Decompress(compressedPackets[0].data(), ConvertUInt32(compressedPackets[0].size()), buffer);
+    }
+    catch (const SubscriberException&)
+    {
+        failed = true;
+    }
+
+    assert(failed);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test truncated packet is reported as an error
+    failed = false;
+
+    try
+    {
+        codec.Decompress(compressedPackets[0].data(), ConvertUInt32(compressedPackets[0].size() / 2), buffer);
+    }
+    catch (const SubscriberException&)
+    {
+        failed = true;
+    }
+
+    assert(failed);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    Benchmark("History.xml, 4 values per packet", historyData);
+    Benchmark("generated, 40 values per packet", GenerateFrameData(40, 1000, 2));
+    Benchmark("generated, 400 values per packet", frameData);
+    Benchmark("generated, 2000 values per packet", GenerateFrameData(2000, 60, 3));
+
+    cout << endl << "Tests complete. Press enter to exit." << endl;
+    getc(stdin);
+
+    return 0;
+}
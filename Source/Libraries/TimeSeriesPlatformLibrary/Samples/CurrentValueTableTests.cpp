@@ -0,0 +1,219 @@
+//******************************************************************************************************
+//  CurrentValueTableTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <cassert>
+#include "../Transport/CurrentValueTable.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// Few slots so readers constantly race the writer on the same slot
+static constexpr uint16_t SignalCount = 8;
+static constexpr int32_t ReaderCount = 4;
+static constexpr int64_t UpdateCount = 2000000LL;
+
+// Value and flags are derived from timestamp so a torn read is detected as a mismatch
+float64_t GetExpectedValue(int64_t timestamp)
+{
+    return static_cast<float64_t>(timestamp) * 0.5;
+}
+
+uint32_t GetExpectedFlags(int64_t timestamp)
+{
+    return static_cast<uint32_t>(timestamp * 7LL);
+}
+
+bool IsConsistent(const CurrentValue& value)
+{
+    return value.Value == GetExpectedValue(value.Timestamp) && value.Flags == GetExpectedFlags(value.Timestamp);
+}
+
+int main(int argc, char* argv[])
+{
+    SignalIndexCachePtr signalIndexCache = NewSharedPtr<SignalIndexCache>();
+    vector<Guid> signalIDs;
+    int32_t test = 0;
+
+    for (uint16_t i = 0; i < SignalCount; i++)
+    {
+        signalIDs.push_back(NewGuid());
+        signalIndexCache->AddMeasurementKey(i, signalIDs.back(), "TEST", i + 1U);
+    }
+
+    CurrentValueTable table(signalIndexCache);
+    CurrentValue value {};
+    vector<CurrentValue> values;
+
+    // Test no values are reported before first update
+    assert(!table.TryGetValue(uint16_t(0), value));
+    assert(table.GetSnapshot(values) == 0);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test single update is readable by runtime ID and signal ID
+    table.Update(3, 10, GetExpectedValue(10), GetExpectedFlags(10));
+    assert(table.TryGetValue(uint16_t(3), value));
+    assert(value.SignalID == signalIDs[3] && value.Timestamp == 10 && IsConsistent(value));
+    assert(table.TryGetValue(signalIDs[3], value));
+    assert(value.Timestamp == 10);
+    assert(!table.TryGetValue(signalIDs[2], value));
+    assert(!table.TryGetValue(uint16_t(SignalCount), value));
+    assert(!table.TryGetValue(NewGuid(), value));
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test consecutive updates alternate buffers and the latest value is always reported
+    for (int64_t timestamp = 11; timestamp < 16; timestamp++)
+    {
+        table.Update(3, timestamp, GetExpectedValue(timestamp), GetExpectedFlags(timestamp));
+        assert(table.TryGetValue(uint16_t(3), value));
+        assert(value.Timestamp == timestamp && IsConsistent(value));
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test snapshot includes only slots that have received values
+    table.Update(5, 20, GetExpectedValue(20), GetExpectedFlags(20));
+    assert(table.GetSnapshot(values) == 2);
+    assert(values[0].SignalID == signalIDs[3] && values[0].Timestamp == 15);
+    assert(values[1].SignalID == signalIDs[5] && values[1].Timestamp == 20);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test polling readers never observe torn or regressing values while the writer updates
+    atomic<bool> writing(true);
+    atomic<int64_t> tornReads(0);
+    atomic<int64_t> regressions(0);
+    atomic<int64_t> reads(0);
+    vector<thread> readers;
+
+    for (int32_t i = 0; i < ReaderCount; i++)
+    {
+        readers.emplace_back([&, i]
+        {
+            vector<int64_t> lastTimestamps(SignalCount, 0LL);
+            vector<CurrentValue> snapshot;
+            CurrentValue current {};
+
+            while (writing)
+            {
+                // Half the readers poll single values, the others poll snapshots
+                if (i % 2 == 0)
+                {
+                    for (uint16_t signalIndex = 0; signalIndex < SignalCount; signalIndex++)
+                    {
+                        if (!table.TryGetValue(signalIndex, current))
+                            continue;
+
+                        if (!IsConsistent(current) || current.SignalID != signalIDs[signalIndex])
+                            tornReads++;
+
+                        if (current.Timestamp < lastTimestamps[signalIndex])
+                            regressions++;
+
+                        lastTimestamps[signalIndex] = current.Timestamp;
+                        reads++;
+                    }
+                }
+                else
+                {
+                    table.GetSnapshot(snapshot);
+
+                    for (const CurrentValue& snapshotValue : snapshot)
+                    {
+                        if (!IsConsistent(snapshotValue))
+                            tornReads++;
+
+                        reads++;
+                    }
+                }
+            }
+        });
+    }
+
+    for (int64_t timestamp = 100; timestamp < UpdateCount + 100; timestamp++)
+    {
+        const uint16_t signalIndex = static_cast<uint16_t>(timestamp % SignalCount);
+        table.Update(signalIndex, timestamp, GetExpectedValue(timestamp), GetExpectedFlags(timestamp));
+    }
+
+    writing = false;
+
+    for (thread& reader : readers)
+        reader.join();
+
+    assert(reads > 0);
+    assert(tornReads == 0);
+    assert(regressions == 0);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test every slot reports its final update once the writer has stopped
+    assert(table.GetSnapshot(values) == SignalCount);
+
+    for (const CurrentValue& snapshotValue : values)
+    {
+        assert(IsConsistent(snapshotValue));
+        assert(snapshotValue.Timestamp >= UpdateCount + 100 - SignalCount);
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test updated table carries over values of runtime IDs that keep their signal
+    SignalIndexCachePtr updatedCache = NewSharedPtr<SignalIndexCache>();
+    const Guid addedSignalID = NewGuid();
+
+    for (uint16_t i = 0; i < SignalCount; i++)
+    {
+        // Runtime ID 0 is released, 1 is reassigned to a new signal and one past the end is added
+        if (i == 0)
+            continue;
+
+        updatedCache->AddMeasurementKey(i, i == 1 ? addedSignalID : signalIDs[i], "TEST", i + 1U);
+    }
+
+    updatedCache->AddMeasurementKey(SignalCount, NewGuid(), "TEST", SignalCount + 1U);
+
+    CurrentValueTable updatedTable(updatedCache, table);
+    CurrentValue previousValue {};
+
+    assert(updatedTable.GetSnapshot(values) == SignalCount - 2);
+    assert(!updatedTable.TryGetValue(uint16_t(1), value));
+    assert(!updatedTable.TryGetValue(uint16_t(SignalCount), value));
+
+    for (uint16_t i = 2; i < SignalCount; i++)
+    {
+        assert(table.TryGetValue(i, previousValue));
+        assert(updatedTable.TryGetValue(signalIDs[i], value));
+        assert(value.Timestamp == previousValue.Timestamp && IsConsistent(value));
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    cout << endl << "Tests complete. Press enter to exit." << endl;
+    getc(stdin);
+
+    return 0;
+}
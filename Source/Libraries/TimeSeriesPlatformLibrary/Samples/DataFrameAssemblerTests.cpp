@@ -0,0 +1,298 @@
+//******************************************************************************************************
+//  DataFrameAssemblerTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <cassert>
+#include "../Transport/DataFrameAssembler.h"
+#include "../Transport/DataPublisher.h"
+#include "../Transport/DataSubscriber.h"
+#include "MetadataTestData.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// Number of analog values defined for each test device
+static constexpr uint32_t AnalogCount = 4U;
+
+// Lag time, in ticks, used by direct assembler tests
+static constexpr int64_t LagTime = 500LL * Ticks::PerMillisecond;
+
+// Creates a configuration frame with an analog value for each of the given measurements
+ConfigurationFramePtr CreateConfigurationFrame(const string& deviceAcronym, const vector<MeasurementMetadataPtr>& measurements)
+{
+    ConfigurationFramePtr configurationFrame = NewSharedPtr<ConfigurationFrame>();
+
+    configurationFrame->DeviceAcronym = deviceAcronym;
+
+    for (const MeasurementMetadataPtr& measurement : measurements)
+    {
+        configurationFrame->Analogs.push_back(measurement);
+        configurationFrame->Measurements.insert(measurement->SignalID);
+    }
+
+    return configurationFrame;
+}
+
+int32_t RunAssemblerTests(int32_t test)
+{
+    vector<MeasurementMetadataPtr> measurements[2];
+    SignalIndexCachePtr signalIndexCache = NewSharedPtr<SignalIndexCache>();
+
+    // Runtime IDs 0-3 map to DEV1, 4-7 map to DEV2 and 8 is subscribed without a frame position
+    for (uint32_t i = 0; i < AnalogCount * 2; i++)
+    {
+        const uint32_t device = i / AnalogCount;
+        measurements[device].push_back(CreateMeasurement(i + 1, "DEV" + ToString(device + 1)));
+        signalIndexCache->AddMeasurementKey(static_cast<uint16_t>(i), measurements[device].back()->SignalID, "TEST", i + 1);
+    }
+
+    const uint16_t unmappedIndex = static_cast<uint16_t>(AnalogCount * 2);
+    signalIndexCache->AddMeasurementKey(unmappedIndex, NewGuid(), "TEST", unmappedIndex + 1);
+
+    const vector<ConfigurationFramePtr> configurationFrames =
+    {
+        CreateConfigurationFrame("DEV1", measurements[0]),
+        CreateConfigurationFrame("DEV2", measurements[1])
+    };
+
+    DataFrameAssembler assembler(signalIndexCache, configurationFrames, LagTime);
+    const int64_t baseTime = ToTicks(UtcNow());
+    vector<DataFramePtr> frames;
+
+    // Test frames are created only for configuration frames with subscribed values
+    assert(assembler.GetFrameCount() == 2);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test frame is published as soon as all expected values are received
+    for (uint16_t i = 0; i < AnalogCount; i++)
+    {
+        assert(frames.empty());
+        assembler.Assign(i, baseTime, i * 1.0, 0U, frames);
+    }
+
+    assert(frames.size() == 1);
+    assert(frames[0]->DeviceAcronym == "DEV1");
+    assert(frames[0]->Timestamp == baseTime);
+    assert(frames[0]->IsComplete());
+    assert(frames[0]->ReceivedCount == AnalogCount);
+    assert(frames[0]->Analogs[2].SignalID == measurements[0][2]->SignalID);
+    assert(frames[0]->Analogs[2].Value == 2.0);
+    assert(assembler.GetStatistics().CompleteFrames == 1);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test a value for a newer timestamp publishes the pending partial frame
+    frames.clear();
+    assembler.Assign(0, baseTime + 1, 1.0, 0U, frames);
+    assembler.Assign(1, baseTime + 1, 1.0, 0U, frames);
+    assert(frames.empty());
+
+    assembler.Assign(2, baseTime + 2, 1.0, 0U, frames);
+    assert(frames.size() == 1);
+    assert(frames[0]->Timestamp == baseTime + 1);
+    assert(!frames[0]->IsComplete());
+    assert(frames[0]->ReceivedCount == 2);
+    assert(assembler.GetStatistics().PartialFrames == 1);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test values for published or older timestamps are counted as late
+    frames.clear();
+    assembler.Assign(3, baseTime + 1, 1.0, 0U, frames);
+    assembler.Assign(3, baseTime, 1.0, 0U, frames);
+    assert(frames.empty());
+    assert(assembler.GetStatistics().LateMeasurements == 2);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test values without a frame position are counted as unmapped
+    assembler.Assign(unmappedIndex, baseTime + 2, 1.0, 0U, frames);
+    assembler.Assign(UInt16::MaxValue, baseTime + 2, 1.0, 0U, frames);
+    assert(frames.empty());
+    assert(assembler.GetStatistics().UnmappedMeasurements == 2);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test pending frame lagging the latest received timestamp by more than lag time is published
+    assembler.PublishLaggingFrames(frames);
+    assert(frames.empty());
+
+    assembler.Assign(AnalogCount, baseTime + LagTime * 2, 1.0, 0U, frames);
+    assert(frames.empty());
+
+    assembler.PublishLaggingFrames(frames);
+    assert(frames.size() == 1);
+    assert(frames[0]->DeviceAcronym == "DEV1");
+    assert(frames[0]->Timestamp == baseTime + 2);
+    assert(frames[0]->ReceivedCount == 1);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test pending frame is published by local clock once lag time has passed without new values
+    frames.clear();
+    this_thread::sleep_for(chrono::milliseconds(LagTime / Ticks::PerMillisecond + 100LL));
+    assembler.PublishLaggingFrames(frames);
+    assert(frames.size() == 1);
+    assert(frames[0]->DeviceAcronym == "DEV2");
+    assert(frames[0]->ReceivedCount == 1);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test completeness counters account for every published frame and assigned value
+    const DataFrameStatistics& statistics = assembler.GetStatistics();
+    assert(statistics.CompleteFrames == 1);
+    assert(statistics.PartialFrames == 3);
+    assert(statistics.AssignedMeasurements == AnalogCount + 4);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test frame positions are unchanged by a cache that only adds or removes unmapped signals
+    SignalIndexCachePtr updatedCache = NewSharedPtr<SignalIndexCache>();
+
+    for (uint32_t i = 0; i < AnalogCount * 2; i++)
+        updatedCache->AddMeasurementKey(static_cast<uint16_t>(i), measurements[i / AnalogCount][i % AnalogCount]->SignalID, "TEST", i + 1);
+
+    assert(assembler.HasSameFramePositions(*updatedCache));
+
+    updatedCache->AddMeasurementKey(unmappedIndex + 1, NewGuid(), "TEST", unmappedIndex + 2);
+    assert(assembler.HasSameFramePositions(*updatedCache));
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test frame positions change when a mapped runtime ID is released or a frame signal gains a runtime ID
+    SignalIndexCachePtr releasedCache = NewSharedPtr<SignalIndexCache>();
+
+    for (uint32_t i = 1; i < AnalogCount * 2; i++)
+        releasedCache->AddMeasurementKey(static_cast<uint16_t>(i), measurements[i / AnalogCount][i % AnalogCount]->SignalID, "TEST", i + 1);
+
+    assert(!assembler.HasSameFramePositions(*releasedCache));
+
+    releasedCache->AddMeasurementKey(unmappedIndex + 1, measurements[0][0]->SignalID, "TEST", 1);
+    assert(!assembler.HasSameFramePositions(*releasedCache));
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    return test;
+}
+
+// Verifies the subscriber lag timer publishes frames after values stop arriving, over a local loopback
+int32_t RunSubscriberTests(uint16_t port, int32_t test)
+{
+    DataPublisherPtr publisher = NewSharedPtr<DataPublisher>(port);
+    const DeviceMetadataPtr device = CreateDevice("DEV1", 1);
+    vector<MeasurementMetadataPtr> measurements;
+
+    for (uint32_t i = 1; i <= AnalogCount; i++)
+        measurements.push_back(CreateMeasurement(i, "DEV1"));
+
+    publisher->DefineMetadata({ device }, measurements, vector<PhasorMetadataPtr>());
+
+    DataSubscriberPtr subscriber = NewSharedPtr<DataSubscriber>();
+    Mutex framesLock;
+    vector<DataFramePtr> receivedFrames;
+    atomic<int32_t> activeCallbacks(0);
+    atomic<int32_t> errors(0);
+
+    subscriber->RegisterNewDataFramesCallback([&](DataSubscriber*, const vector<DataFramePtr>& frames)
+    {
+        // Frames are delivered by the data thread and the lag timer, never concurrently
+        if (++activeCallbacks > 1)
+            errors++;
+
+        // Constrain lock to frame copy
+        {
+            ScopeLock lock(framesLock);
+            receivedFrames.insert(receivedFrames.end(), frames.begin(), frames.end());
+        }
+
+        --activeCallbacks;
+    });
+
+    subscriber->RegisterErrorMessageCallback([&errors](DataSubscriber*, const string& message)
+    {
+        cerr << "    Subscriber error: " << message << endl;
+        errors++;
+    });
+
+    subscriber->SetConfigurationFrames({ CreateConfigurationFrame("DEV1", measurements) });
+    subscriber->SetFrameAssemblyLagTime(0.1);
+
+    SubscriptionInfo info;
+    info.FilterExpression = "FILTER ActiveMeasurements WHERE Device = 'DEV1'";
+
+    subscriber->Connect("localhost", port);
+    subscriber->Subscribe(info);
+
+    this_thread::sleep_for(chrono::milliseconds(500));
+
+    // Publish all but one of the device values once, frame can only be completed by the lag timer
+    const int64_t timestamp = ToTicks(UtcNow());
+    vector<Measurement> values;
+
+    for (uint32_t i = 0; i < AnalogCount - 1; i++)
+    {
+        Measurement measurement;
+        measurement.SignalID = measurements[i]->SignalID;
+        measurement.Value = i * 1.0;
+        measurement.Timestamp = timestamp;
+        values.push_back(measurement);
+    }
+
+    publisher->PublishMeasurements(values);
+    this_thread::sleep_for(chrono::milliseconds(500));
+
+    // Test lag timer published the partial frame without further values
+    {
+        ScopeLock lock(framesLock);
+        assert(receivedFrames.size() == 1);
+        assert(receivedFrames[0]->ReceivedCount == AnalogCount - 1);
+        assert(receivedFrames[0]->ExpectedCount == AnalogCount);
+        assert(!receivedFrames[0]->IsComplete());
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test subscriber statistics reflect the timer published frame
+    const DataFrameStatistics statistics = subscriber->GetFrameAssemblyStatistics();
+    assert(statistics.CompleteFrames == 0);
+    assert(statistics.PartialFrames == 1);
+    assert(statistics.AssignedMeasurements == AnalogCount - 1);
+    assert(errors == 0);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    subscriber->Disconnect();
+
+    return test;
+}
+
+int main(int argc, char* argv[])
+{
+    int32_t test = 0;
+
+    cout << "Testing data frame assembler:" << endl;
+    test = RunAssemblerTests(test);
+
+    cout << "Testing subscriber frame assembly lag timer:" << endl;
+    test = RunSubscriberTests(7185, test);
+
+    cout << endl << "Tests complete. Press enter to exit." << endl;
+    getc(stdin);
+
+    return 0;
+}
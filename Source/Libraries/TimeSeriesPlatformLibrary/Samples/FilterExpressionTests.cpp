@@ -25,8 +25,10 @@
 #include <string>
 #include <fstream>
 #include <iterator>
+#include <random>
 #include <boost/filesystem.hpp>
 #include "../FilterExpressions/FilterExpressionParser.h"
+#include "../FilterExpressions/FilterExpressionSyntaxReader.h"
 #include "../Data/DataSet.h"
 
 using namespace std;
@@ -57,6 +59,291 @@ void Evaluate(const FilterExpressionParserPtr& parser)
     }
 }
 
+// Describes structure of an expression so trees created by different parsers can be compared
+string DescribeExpression(const ExpressionPtr& expression)
+{
+    if (expression == nullptr)
+        return "null";
+
+    switch (expression->Type)
+    {
+        case ExpressionType::Value:
+        {
+            const ValueExpressionPtr value = CastSharedPtr<ValueExpression>(expression);
+            return string(EnumName(value->ValueType)) + ":" + (value->ValueType == ExpressionValueType::Undefined || value->IsNull() ? "NULL" : value->ToString());
+        }
+        case ExpressionType::Unary:
+        {
+            const UnaryExpressionPtr unary = CastSharedPtr<UnaryExpression>(expression);
+            return "(" + string(EnumName(unary->UnaryType)) + " " + DescribeExpression(unary->Value) + ")";
+        }
+        case ExpressionType::Column:
+            return "[" + CastSharedPtr<ColumnExpression>(expression)->DataColumn->Name() + "]";
+        case ExpressionType::InList:
+        {
+            const InListExpressionPtr inList = CastSharedPtr<InListExpression>(expression);
+            string description = "(" + DescribeExpression(inList->Value) + (inList->HasNotKeyword ? " NOT" : "") + " IN" + (inList->ExactMatch ? " BINARY" : "");
+
+            for (const auto& argument : *inList->Arguments)
+                description += " " + DescribeExpression(argument);
+
+            return description + ")";
+        }
+        case ExpressionType::Function:
+        {
+            const FunctionExpressionPtr function = CastSharedPtr<FunctionExpression>(expression);
+            string description = "(F" + ToString(static_cast<int32_t>(function->FunctionType));
+
+            for (const auto& argument : *function->Arguments)
+                description += " " + DescribeExpression(argument);
+
+            return description + ")";
+        }
+        case ExpressionType::Operator:
+        {
+            const OperatorExpressionPtr operation = CastSharedPtr<OperatorExpression>(expression);
+            return "(" + DescribeExpression(operation->LeftValue) + " " + EnumName(operation->OperatorType) + " " + DescribeExpression(operation->RightValue) + ")";
+        }
+        default:
+            return "?";
+    }
+}
+
+// Generates random filter expression tokens following FilterExpressionSyntax.g4
+class FilterExpressionGenerator
+{
+private:
+    mt19937 m_random;
+    vector<string> m_tokens;
+
+    int32_t Next(const int32_t count)
+    {
+        return uniform_int_distribution<int32_t>(0, count - 1)(m_random);
+    }
+
+    const char* Pick(const vector<const char*>& values)
+    {
+        return values[Next(static_cast<int32_t>(values.size()))];
+    }
+
+    void Literal()
+    {
+        m_tokens.emplace_back(Pick({ "1", "0", "42", "0x1F", "3000000000", "99999999999999999999", "1.5", "2.", ".5", "1.5E3", ".5e-2", "7e+1", "'FREQ'", "'it''s'", "''", "'%PHA'", "#2019-02-04 03:00:52#", "{ea4b1b4f-3d0a-4f2b-bc36-b8a3c0a0c9a1}", "'ea4b1b4f-3d0a-4f2b-bc36-b8a3c0a0c9a1'", "8a4b1b4f3d0a4f2bbc36b8a3c0a0c9a1", "True", "FALSE", "NULL" }));
+    }
+
+    void ExpressionList(const int32_t depth)
+    {
+        const int32_t count = 1 + Next(3);
+
+        for (int32_t i = 0; i < count; i++)
+        {
+            if (i > 0)
+                m_tokens.emplace_back(",");
+
+            Expression(depth + 1);
+        }
+    }
+
+    void ValueExpression(const int32_t depth)
+    {
+        switch (depth > 4 ? Next(2) : Next(7))
+        {
+            case 0:
+                Literal();
+                break;
+            case 1:
+                m_tokens.emplace_back(Pick({ "SignalAcronym", "ID", "PointTag", "SignalID", "pointtag" }));
+                break;
+            case 2:
+                m_tokens.emplace_back(Pick({ "Len", "UPPER", "Coalesce", "IsNull", "SubStr", "Now" }));
+                m_tokens.emplace_back("(");
+
+                if (Next(4) > 0)
+                    ExpressionList(depth);
+
+                m_tokens.emplace_back(")");
+                break;
+            case 3:
+                m_tokens.emplace_back(Pick({ "-", "+", "~", "!", "NOT" }));
+                ValueExpression(depth + 1);
+                break;
+            case 4:
+                m_tokens.emplace_back("(");
+                Expression(depth + 1);
+                m_tokens.emplace_back(")");
+                break;
+            default:
+                ValueExpression(depth + 1);
+                m_tokens.emplace_back(Pick({ "*", "/", "%", "+", "-", "<<", ">>", "&", "|", "^", "XOR" }));
+                ValueExpression(depth + 1);
+                break;
+        }
+    }
+
+    void PredicateExpression(const int32_t depth)
+    {
+        switch (depth > 4 ? 0 : Next(6))
+        {
+            case 1:
+                PredicateExpression(depth + 1);
+                m_tokens.emplace_back(Pick({ "<", "<=", ">", ">=", "=", "==", "===", "!=", "!==", "<>" }));
+                PredicateExpression(depth + 1);
+                break;
+            case 2:
+                PredicateExpression(depth + 1);
+
+                if (Next(2) == 0)
+                    m_tokens.emplace_back(Pick({ "NOT", "!" }));
+
+                m_tokens.emplace_back("IN");
+
+                if (Next(3) == 0)
+                    m_tokens.emplace_back(Pick({ "BINARY", "===" }));
+
+                m_tokens.emplace_back("(");
+                ExpressionList(depth);
+                m_tokens.emplace_back(")");
+                break;
+            case 3:
+                PredicateExpression(depth + 1);
+                m_tokens.emplace_back("IS");
+
+                if (Next(2) == 0)
+                    m_tokens.emplace_back(Pick({ "NOT", "!" }));
+
+                m_tokens.emplace_back("NULL");
+                break;
+            case 4:
+                PredicateExpression(depth + 1);
+
+                if (Next(2) == 0)
+                    m_tokens.emplace_back(Pick({ "NOT", "!" }));
+
+                m_tokens.emplace_back("LIKE");
+
+                if (Next(3) == 0)
+                    m_tokens.emplace_back(Pick({ "BINARY", "===" }));
+
+                PredicateExpression(depth + 1);
+                break;
+            default:
+                ValueExpression(depth);
+                break;
+        }
+    }
+
+    void Expression(const int32_t depth)
+    {
+        switch (depth > 4 ? 0 : Next(4))
+        {
+            case 1:
+                m_tokens.emplace_back(Pick({ "NOT", "!" }));
+                Expression(depth + 1);
+                break;
+            case 2:
+                Expression(depth + 1);
+                m_tokens.emplace_back(Pick({ "AND", "&&", "OR", "||" }));
+                Expression(depth + 1);
+                break;
+            default:
+                PredicateExpression(depth);
+                break;
+        }
+    }
+
+    void Statement()
+    {
+        switch (Next(5))
+        {
+            case 0:
+                m_tokens.emplace_back(Pick({ "{ea4b1b4f-3d0a-4f2b-bc36-b8a3c0a0c9a1}", "PPA:1", "\"GPA_SHELBY-PA1.IAZ\"" }));
+                break;
+            case 1:
+                m_tokens.emplace_back("FILTER");
+
+                if (Next(2) == 0)
+                {
+                    m_tokens.emplace_back("TOP");
+
+                    if (Next(2) == 0)
+                        m_tokens.emplace_back(Pick({ "-", "+" }));
+
+                    m_tokens.emplace_back(Pick({ "1", "5", "0x2" }));
+                }
+
+                m_tokens.emplace_back(Pick({ "MeasurementDetail", "measurementdetail", "MissingTable" }));
+                m_tokens.emplace_back("WHERE");
+                Expression(0);
+
+                if (Next(2) == 0)
+                {
+                    m_tokens.emplace_back("ORDER");
+                    m_tokens.emplace_back("BY");
+
+                    for (int32_t i = Next(2); i >= 0; i--)
+                    {
+                        if (Next(3) == 0)
+                            m_tokens.emplace_back("BINARY");
+
+                        m_tokens.emplace_back(Pick({ "PointTag", "SignalAcronym", "ID" }));
+
+                        if (Next(2) == 0)
+                            m_tokens.emplace_back(Pick({ "ASC", "DESC" }));
+
+                        if (i > 0)
+                            m_tokens.emplace_back(",");
+                    }
+                }
+
+                break;
+            default:
+                Expression(0);
+                break;
+        }
+    }
+
+public:
+    FilterExpressionGenerator(const uint32_t seed) : m_random(seed)
+    {
+    }
+
+    // Generates a statement list, mutated with random tokens or characters one time in three
+    string Next()
+    {
+        m_tokens.clear();
+
+        for (int32_t i = Next(2); i >= 0; i--)
+        {
+            Statement();
+
+            if (i > 0 || Next(4) == 0)
+                m_tokens.emplace_back(";");
+        }
+
+        if (Next(3) == 0)
+        {
+            const size_t index = Next(static_cast<int32_t>(m_tokens.size()));
+
+            if (Next(2) == 0)
+                m_tokens.erase(m_tokens.begin() + index);
+            else
+                m_tokens.insert(m_tokens.begin() + index, Pick({ "(", ")", ",", ";", "-", "NOT", "IN", "LIKE", "WHERE", "1", "'", "#", "[", "@", "?", "--", "/*", "ID", "'x'", "." }));
+        }
+
+        string expression;
+
+        for (const string& token : m_tokens)
+        {
+            if (!expression.empty())
+                expression += Pick({ " ", " ", " ", " ", "", "\n", "  /* c */ ", " -- c\n" });
+
+            expression += token;
+        }
+
+        return expression;
+    }
+};
+
 // Sample application to test the filter expression parser.
 int main(int argc, char* argv[])
 {
@@ -1510,6 +1797,638 @@ int main(int argc, char* argv[])
     assert(timetag > DateAdd(UtcNow(), -5, TimeInterval::Second));
     cout << "Test " << ++test << " succeeded..." << endl;
 
+    // Test 160 - compiled expression programs evaluate the same as interpreted expression trees
+    const DataTablePtr measurementDetail = dataSet->Table("MeasurementDetail");
+
+    const vector<string> compiledExpressions = {
+        "SignalAcronym = 'FREQ'",
+        "SignalAcronym === 'freq'",
+        "SignalAcronym LIKE 'IPH%' AND Enabled",
+        "SignalAcronym NOT LIKE '*PHM' OR PhasorSourceIndex > 2",
+        "SignalAcronym LIKE BINARY 'iph*'",
+        "SignalAcronym LIKE 'FREQ'",
+        "SignalAcronym > 'IPHM' AND SignalAcronym <= 'VPHM'",
+        "PhasorSourceIndex * 2 + 1 >= 5",
+        "PhasorSourceIndex % 2 = 1",
+        "-PhasorSourceIndex < -1 OR ~PhasorSourceIndex = -5",
+        "(PhasorSourceIndex & 1) = 1 AND (PhasorSourceIndex ^ 7) > 4",
+        "PhasorSourceIndex / 2E0 > 1.5E0",
+        "PhasorSourceIndex = NULL",
+        "PhasorSourceIndex IS NULL",
+        "PhasorSourceIndex IN (1, '2', 3E0)",
+        "SignalAcronym IN ('IPHM', 'vphm', 'FREQ')",
+        "SignalAcronym NOT IN BINARY ('IPHM', 'vphm')",
+        "SignalAcronym IN ('IPHM', 'VPHM') OR PhasorSourceIndex > 2",
+        "Len('FREQ') = 4 AND SignalAcronym = Upper('freq')",
+        "Description IS NOT NULL AND NOT Internal",
+        "UpdatedOn > '2019-01-04 08:01:00'",
+        "SignalID <> '00000000-0000-0000-0000-000000000000'",
+        "Enabled = 'true' AND Enabled = 1"
+    };
+
+    for (const string& expression : compiledExpressions)
+    {
+        const ExpressionTreePtr expressionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, expression);
+        assert(expressionTree->GetProgram() != nullptr);
+
+        for (int32_t i = 0; i < measurementDetail->RowCount(); i++)
+        {
+            dataRow = measurementDetail->Row(i);
+
+            expressionTree->UseCompiledProgram = true;
+            const ValueExpressionPtr compiledResult = expressionTree->Evaluate(dataRow);
+
+            expressionTree->UseCompiledProgram = false;
+            const ValueExpressionPtr interpretedResult = expressionTree->Evaluate(dataRow);
+
+            assert(compiledResult->ValueType == interpretedResult->ValueType);
+            assert(compiledResult->IsNull() == interpretedResult->IsNull());
+            assert(compiledResult->ToString() == interpretedResult->ToString());
+        }
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 161 - compiled and interpreted selections match, unsupported expressions fall back to interpreter
+    const vector<string> selectExpressions = {
+        "SignalAcronym LIKE '%PH%' AND PhasorSourceIndex > 1",
+        "SignalAcronym IN ('STAT', 'FREQ')",
+        "Len(SignalAcronym) = 4 AND PhasorSourceIndex IS NOT NULL",
+        "PhasorSourceIndex << 1 = 4"
+    };
+
+    for (const string& expression : selectExpressions)
+    {
+        const ExpressionTreePtr expressionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, expression);
+
+        expressionTree->UseCompiledProgram = true;
+        const vector<DataRowPtr> compiledRows = FilterExpressionParser::Select(expressionTree);
+
+        expressionTree->UseCompiledProgram = false;
+        const vector<DataRowPtr> interpretedRows = FilterExpressionParser::Select(expressionTree);
+
+        assert(!compiledRows.empty());
+        assert(compiledRows == interpretedRows);
+    }
+
+    assert(FilterExpressionParser::GenerateExpressionTree(measurementDetail, selectExpressions[0])->GetProgram() != nullptr);
+    assert(FilterExpressionParser::GenerateExpressionTree(measurementDetail, selectExpressions[2])->GetProgram() == nullptr);
+    assert(FilterExpressionParser::GenerateExpressionTree(measurementDetail, selectExpressions[3])->GetProgram() == nullptr);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 162 - compiled LIKE expression reports invalid patterns like interpreter
+    ExpressionTreePtr expressionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, "SignalAcronym LIKE 'I*M'");
+    assert(expressionTree->GetProgram() != nullptr);
+    string compiledError, interpretedError;
+
+    try
+    {
+        FilterExpressionParser::Select(expressionTree);
+    }
+    catch (const ExpressionTreeException& ex)
+    {
+        compiledError = ex.what();
+    }
+
+    expressionTree->UseCompiledProgram = false;
+
+    try
+    {
+        FilterExpressionParser::Select(expressionTree);
+    }
+    catch (const ExpressionTreeException& ex)
+    {
+        interpretedError = ex.what();
+    }
+
+    assert(!compiledError.empty());
+    assert(compiledError == interpretedError);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 163 - prepared expressions fold constants and precompile regex, LIKE and IN operands
+    expressionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, "Len('FREQ') + 1 = 5");
+    assert(expressionTree->Root->Type == ExpressionType::Operator);
+    assert(expressionTree->Evaluate(measurementDetail->Row(0))->ValueAsBoolean());
+    assert(expressionTree->GetProgram() == nullptr);
+
+    assert(FilterExpressionParser::GenerateExpressionTree(measurementDetail, "UpdatedOn < UtcNow()")->GetProgram() == nullptr);
+
+    const vector<pair<string, string>> equivalentExpressions = {
+        { "RegExMatch('^[IV]PH[AM]$', SignalAcronym)", "SignalAcronym LIKE 'IPH*' OR SignalAcronym LIKE 'VPH*'" },
+        { "RegExVal('PH[AM]', SignalAcronym) = 'PHM'", "SignalAcronym LIKE '%PHM'" },
+        { "SignalAcronym IN ('iphm', 'VPHM')", "SignalAcronym = 'IPHM' OR SignalAcronym = 'vphm'" },
+        { "SignalAcronym NOT IN BINARY ('iphm', 'VPHM')", "SignalAcronym !== 'iphm' AND SignalAcronym !== 'VPHM'" },
+        { "SignalID IN ('24a1c8d9-9ca5-488b-921f-00c1e230450c', {c571fab4-3eb3-459c-8e41-00f660c6d631})", "SignalID = {24A1C8D9-9CA5-488B-921F-00C1E230450C} OR SignalID = 'c571fab4-3eb3-459c-8e41-00f660c6d631'" }
+    };
+
+    for (const auto& expressions : equivalentExpressions)
+    {
+        const ExpressionTreePtr preparedTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, expressions.first);
+        const ExpressionTreePtr equivalentTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, expressions.second);
+        const vector<DataRowPtr> preparedRows = FilterExpressionParser::Select(preparedTree);
+
+        assert(!preparedRows.empty());
+        assert(preparedRows == FilterExpressionParser::Select(equivalentTree));
+
+        preparedTree->UseCompiledProgram = false;
+        assert(preparedRows == FilterExpressionParser::Select(preparedTree));
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 164 - indexed selections match table scans, indexes are invalidated when values change
+    const vector<string> indexedExpressions = {
+        "SignalAcronym = 'freq'",
+        "SignalAcronym === 'freq'",
+        "'IPHM' = SignalAcronym AND Enabled",
+        "SignalAcronym IN ('IPHM', 'vphm') AND PhasorSourceIndex = 2",
+        "SignalID IN ('24a1c8d9-9ca5-488b-921f-00c1e230450c', {c571fab4-3eb3-459c-8e41-00f660c6d631}) OR SignalAcronym = 'FREQ'",
+        "SignalAcronym = 'FREQ' AND Len(Description) > 0",
+        "SignalAcronym = 'VPHM' OR Description LIKE '%Status%'"
+    };
+
+    vector<vector<DataRowPtr>> scannedRows;
+
+    for (const string& expression : indexedExpressions)
+        scannedRows.push_back(FilterExpressionParser::Select(FilterExpressionParser::GenerateExpressionTree(measurementDetail, expression)));
+
+    measurementDetail->CreateIndex("SignalID");
+    measurementDetail->CreateIndex("SignalAcronym");
+    measurementDetail->CreateIndex("PhasorSourceIndex");
+    assert(measurementDetail->HasIndex(measurementDetail->Column("SignalAcronym")->Index()));
+
+    for (size_t i = 0; i < indexedExpressions.size(); i++)
+    {
+        expressionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, indexedExpressions[i]);
+        assert(FilterExpressionParser::Select(expressionTree) == scannedRows[i]);
+
+        expressionTree->UseCompiledProgram = false;
+        assert(FilterExpressionParser::Select(expressionTree) == scannedRows[i]);
+    }
+
+    assert(StartsWith(FilterExpressionParser::GenerateExpressionTree(measurementDetail, indexedExpressions[0])->Explain(), "INDEX SEEK [SignalAcronym]"));
+    assert(StartsWith(FilterExpressionParser::GenerateExpressionTree(measurementDetail, indexedExpressions[3])->Explain(), "INTERSECT(INDEX SEEK [SignalAcronym]"));
+    assert(StartsWith(FilterExpressionParser::GenerateExpressionTree(measurementDetail, indexedExpressions[4])->Explain(), "UNION(INDEX SEEK [SignalID] (2 keys"));
+    assert(StartsWith(FilterExpressionParser::GenerateExpressionTree(measurementDetail, indexedExpressions[6])->Explain(), "TABLE SCAN [MeasurementDetail]"));
+    assert(EndsWith(FilterExpressionParser::GenerateExpressionTree(measurementDetail, indexedExpressions[5])->Explain(), "-> FILTER (interpreted)"));
+
+    dataRow = scannedRows[0][0];
+    const int32_t signalAcronymIndex = measurementDetail->Column("SignalAcronym")->Index();
+    const Nullable<string> signalAcronym = dataRow->ValueAsString(signalAcronymIndex);
+
+    dataRow->SetStringValue(signalAcronymIndex, string("TEST"));
+    expressionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, "SignalAcronym = 'TEST'");
+    assert(FilterExpressionParser::Select(expressionTree) == vector<DataRowPtr> { dataRow });
+
+    dataRow->SetStringValue(signalAcronymIndex, signalAcronym);
+    assert(FilterExpressionParser::Select(expressionTree).empty());
+    assert(measurementDetail->RemoveIndex("SignalAcronym"));
+    assert(measurementDetail->Index(signalAcronymIndex) == nullptr);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 165 - identifier statements resolve rows with table indexes that track value changes
+    const int32_t idIndex = measurementDetail->Column("ID")->Index();
+    const int32_t pointTagIndex = measurementDetail->Column("PointTag")->Index();
+    const int32_t signalIDIndex = measurementDetail->Column("SignalID")->Index();
+    const DataRowPtr idRow = measurementDetail->Row(1);
+    const DataRowPtr pointTagRow = measurementDetail->Row(2);
+    const DataRowPtr signalIDRow = measurementDetail->Row(3);
+    const Nullable<string> pointTag = pointTagRow->ValueAsString(pointTagIndex);
+
+    // Identifiers are resolved by scan until the table owner creates indexes, parsing never adds them
+    for (int32_t i = 0; i < 2; i++)
+    {
+        assert(measurementDetail->HasIndex(idIndex) == (i > 0) && measurementDetail->HasIndex(pointTagIndex) == (i > 0));
+
+        pointTagRow->SetStringValue(pointTagIndex, string("TESTTAG"));
+
+        parser = NewSharedPtr<FilterExpressionParser>(idRow->ValueAsString(idIndex).GetValueOrDefault() + "; \"TESTTAG\"; " + ToString(signalIDRow->ValueAsGuid(signalIDIndex).GetValueOrDefault()) + "; \"TESTTAG\"");
+        parser->SetDataSet(dataSet);
+        parser->SetTableIDFields("MeasurementDetail", measurementDetailIDFields);
+        parser->SetPrimaryTableName("MeasurementDetail");
+        parser->SetTrackFilteredSignalIDs(true);
+        Evaluate(parser);
+
+        assert(parser->FilteredRows() == (vector<DataRowPtr> { idRow, pointTagRow, signalIDRow }));
+        assert(parser->FilteredSignalIDs().size() == 3);
+        assert(parser->FilteredSignalIDs()[1] == pointTagRow->ValueAsGuid(signalIDIndex).GetValueOrDefault());
+
+        pointTagRow->SetStringValue(pointTagIndex, pointTag);
+
+        parser = NewSharedPtr<FilterExpressionParser>("\"TESTTAG\"");
+        parser->SetDataSet(dataSet);
+        parser->SetTableIDFields("MeasurementDetail", measurementDetailIDFields);
+        parser->SetPrimaryTableName("MeasurementDetail");
+        Evaluate(parser);
+
+        assert(parser->FilteredRows().empty());
+        assert(measurementDetail->HasIndex(idIndex) == (i > 0) && measurementDetail->HasIndex(pointTagIndex) == (i > 0));
+
+        measurementDetail->CreateIndex("ID");
+        measurementDetail->CreateIndex("PointTag");
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 166 - partitioned selections match serial selections, including ordering and errors
+    const vector<string> partitionedExpressions = {
+        "SignalAcronym LIKE '%PH%' OR PhasorSourceIndex > 1",
+        "SignalAcronym IN ('IPHM', 'VPHM', 'FREQ')",
+        "SignalID <> '00000000-0000-0000-0000-000000000000'"
+    };
+
+    for (const string& expression : partitionedExpressions)
+    {
+        for (int32_t topLimit = -1; topLimit < 4; topLimit += 4)
+        {
+            for (int32_t orderByTermCount = 0; orderByTermCount < 3; orderByTermCount++)
+            {
+                expressionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, expression);
+                expressionTree->TopLimit = topLimit;
+
+                if (orderByTermCount > 0)
+                    expressionTree->OrderByTerms.emplace_back(measurementDetail->Column("SignalAcronym"), false, false);
+
+                if (orderByTermCount > 1)
+                    expressionTree->OrderByTerms.emplace_back(measurementDetail->Column("SignalID"), true, false);
+                else if (orderByTermCount > 0)
+                    expressionTree->OrderByTerms.emplace_back(measurementDetail->Column("ID"), true, false);
+
+                const vector<DataRowPtr> serialRows = FilterExpressionParser::Select(expressionTree);
+
+                expressionTree->MaxDegreeOfParallelism = 4;
+                expressionTree->ParallelRowThreshold = 1;
+
+                assert(!serialRows.empty());
+                assert(FilterExpressionParser::Select(expressionTree) == serialRows);
+            }
+        }
+    }
+
+    expressionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, "PhasorSourceIndex + 1");
+    expressionTree->MaxDegreeOfParallelism = 0;
+    expressionTree->ParallelRowThreshold = 1;
+    compiledError.clear();
+
+    try
+    {
+        FilterExpressionParser::Select(expressionTree);
+    }
+    catch (const FilterExpressionParserException& ex)
+    {
+        compiledError = ex.what();
+    }
+
+    assert(compiledError == "Final expression tree evaluation did not result in a boolean value, result data type is \"Int32\"");
+
+    // Parser parallelism settings apply to each generated expression tree
+    const vector<DataRowPtr> serialRows = FilterExpressionParser::Select(dataSet, "FILTER MeasurementDetail WHERE SignalAcronym <> 'STAT' ORDER BY PointTag", "MeasurementDetail");
+
+    parser = NewSharedPtr<FilterExpressionParser>("FILTER MeasurementDetail WHERE SignalAcronym <> 'STAT' ORDER BY PointTag");
+    parser->SetDataSet(dataSet);
+    parser->SetMaxDegreeOfParallelism(4);
+    parser->SetParallelRowThreshold(1);
+    Evaluate(parser);
+
+    assert(parser->GetExpressionTrees().size() == 1);
+    assert(parser->GetExpressionTrees()[0]->MaxDegreeOfParallelism == 4);
+    assert(parser->GetExpressionTrees()[0]->ParallelRowThreshold == 1);
+    assert(!serialRows.empty());
+    assert(parser->FilteredRows() == serialRows);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 167 - TOP limit with ORDER BY sorts first matched rows in table order, keys sort like value comparisons
+    const vector<DataRowPtr> unorderedRows = FilterExpressionParser::Select(dataSet, "FILTER MeasurementDetail WHERE SignalAcronym <> 'STAT'", "MeasurementDetail");
+    const vector<DataRowPtr> orderedRows = FilterExpressionParser::Select(dataSet, "FILTER MeasurementDetail WHERE SignalAcronym <> 'STAT' ORDER BY PointTag DESC", "MeasurementDetail");
+    const vector<DataRowPtr> topOrderedRows = FilterExpressionParser::Select(dataSet, "FILTER TOP 5 MeasurementDetail WHERE SignalAcronym <> 'STAT' ORDER BY PointTag DESC", "MeasurementDetail");
+
+    assert(orderedRows.size() > 5);
+    assert(orderedRows.size() == unorderedRows.size());
+    assert(topOrderedRows.size() == 5);
+    assert(unordered_set<DataRowPtr>(topOrderedRows.begin(), topOrderedRows.end()) == unordered_set<DataRowPtr>(unorderedRows.begin(), unorderedRows.begin() + 5));
+
+    for (size_t i = 1; i < topOrderedRows.size(); i++)
+        assert(Compare(topOrderedRows[i - 1]->ValueAsString(pointTagIndex).GetValueOrDefault(), topOrderedRows[i]->ValueAsString(pointTagIndex).GetValueOrDefault()) >= 0);
+
+    for (size_t i = 1; i < orderedRows.size(); i++)
+        assert(Compare(orderedRows[i - 1]->ValueAsString(pointTagIndex).GetValueOrDefault(), orderedRows[i]->ValueAsString(pointTagIndex).GetValueOrDefault()) >= 0);
+
+    const vector<DataRowPtr> binaryOrderedRows = FilterExpressionParser::Select(dataSet, "FILTER MeasurementDetail WHERE True ORDER BY BINARY SignalReference", "MeasurementDetail");
+    const int32_t signalReferenceIndex = measurementDetail->Column("SignalReference")->Index();
+
+    assert(binaryOrderedRows.size() == static_cast<size_t>(measurementDetail->RowCount()));
+
+    for (size_t i = 1; i < binaryOrderedRows.size(); i++)
+        assert(Compare(binaryOrderedRows[i - 1]->ValueAsString(signalReferenceIndex).GetValueOrDefault(), binaryOrderedRows[i]->ValueAsString(signalReferenceIndex).GetValueOrDefault(), false) <= 0);
+
+    const vector<DataRowPtr> nullOrderedRows = FilterExpressionParser::Select(dataSet, "FILTER MeasurementDetail WHERE True ORDER BY PhasorSourceIndex, SignalID DESC", "MeasurementDetail");
+    const int32_t phasorSourceIndex = measurementDetail->Column("PhasorSourceIndex")->Index();
+
+    assert(nullOrderedRows.size() > 3);
+    assert(!nullOrderedRows[0]->ValueAsInt32(phasorSourceIndex).HasValue());
+    assert(!nullOrderedRows[1]->ValueAsInt32(phasorSourceIndex).HasValue());
+    assert(nullOrderedRows[0]->ValueAsGuid(signalIDIndex).GetValueOrDefault() > nullOrderedRows[1]->ValueAsGuid(signalIDIndex).GetValueOrDefault());
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 168 - cached filter expressions replay identifiers and statements without sharing expression trees
+    FilterExpressionCache& expressionCache = FilterExpressionParser::GetExpressionCache();
+    const string cachedExpression = idRow->ValueAsString(idIndex).GetValueOrDefault() + "; FILTER TOP 3 MeasurementDetail WHERE SignalAcronym = 'STAT' ORDER BY PointTag; " + ToString(signalIDRow->ValueAsGuid(signalIDIndex).GetValueOrDefault());
+    vector<vector<DataRowPtr>> cachedRows;
+    vector<vector<GSF::Guid>> cachedSignalIDs;
+
+    // Filtered rows are distinct, TOP rows may include identified rows
+    const vector<DataRowPtr> cachedTopRows = FilterExpressionParser::Select(dataSet, "FILTER TOP 3 MeasurementDetail WHERE SignalAcronym = 'STAT' ORDER BY PointTag", "MeasurementDetail");
+    unordered_set<DataRowPtr> expectedCachedRows(cachedTopRows.begin(), cachedTopRows.end());
+    expectedCachedRows.insert(idRow);
+    expectedCachedRows.insert(signalIDRow);
+
+    expressionCache.Invalidate();
+    const uint64_t hitCount = expressionCache.GetHitCount();
+
+    for (int32_t i = 0; i < 3; i++)
+    {
+        parser = NewSharedPtr<FilterExpressionParser>(i == 1 ? "  " + cachedExpression + " " : cachedExpression);
+        parser->SetDataSet(dataSet);
+        parser->SetTableIDFields("MeasurementDetail", measurementDetailIDFields);
+        parser->SetPrimaryTableName("MeasurementDetail");
+        parser->SetTrackFilteredSignalIDs(true);
+        parser->SetUseExpressionCache(i < 2);
+        Evaluate(parser);
+
+        cachedRows.push_back(parser->FilteredRows());
+        cachedSignalIDs.push_back(parser->FilteredSignalIDs());
+    }
+
+    assert(expressionCache.GetHitCount() == hitCount + 1);
+    assert(expressionCache.Count() == 1);
+    assert(cachedRows[0].size() == expectedCachedRows.size() && cachedRows[0][0] == idRow && cachedRows[0][1] == signalIDRow);
+    assert(cachedRows[1] == cachedRows[0] && cachedRows[2] == cachedRows[0]);
+    assert(cachedSignalIDs[1] == cachedSignalIDs[0] && cachedSignalIDs[2] == cachedSignalIDs[0]);
+
+    expressionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, "SignalAcronym = 'FREQ'");
+    expressionTree->TopLimit = 1;
+    const ExpressionTreePtr cachedExpressionTree = FilterExpressionParser::GenerateExpressionTree(measurementDetail, "SignalAcronym = 'FREQ'");
+
+    assert(cachedExpressionTree != expressionTree && cachedExpressionTree->Root != expressionTree->Root);
+    assert(CastSharedPtr<OperatorExpression>(cachedExpressionTree->Root)->RightValue == CastSharedPtr<OperatorExpression>(expressionTree->Root)->RightValue);
+    assert(cachedExpressionTree->TopLimit == -1);
+    assert(expressionCache.GetHitCount() == hitCount + 2);
+
+    int32_t parsingExceptionCount = 0;
+
+    for (int32_t i = 0; i < 2; i++)
+    {
+        parser = NewSharedPtr<FilterExpressionParser>("FILTER MeasurementDetail WHERE SignalAcronym = 'FREQ' SignalID");
+        parser->SetDataSet(dataSet);
+        parser->RegisterParsingExceptionCallback([&parsingExceptionCount](FilterExpressionParserPtr, const string&) { parsingExceptionCount++; });
+        Evaluate(parser);
+    }
+
+    assert(parsingExceptionCount == 2);
+    assert(expressionCache.Count() == 2);
+
+    expressionCache.SetCapacity(1);
+    assert(expressionCache.Count() == 1);
+    expressionCache.SetCapacity(FilterExpressionCache::DefaultCapacity);
+
+    expressionCache.Invalidate();
+    assert(expressionCache.Count() == 0);
+
+    // Cached entries reference tables and columns by name, so a parsed dataset is not kept alive
+    // by the cache and another dataset with the same tables and columns is served from cache
+    const string releasedExpression = "FILTER MeasurementDetail WHERE SignalAcronym = 'FREQ' ORDER BY PointTag";
+    const DataSetPtr releasedDataSet = DataSet::FromXml(MetadataSampleFileName[0]);
+    const DataTablePtr releasedTable = releasedDataSet->Table("MeasurementDetail");
+    const long dataSetReferences = releasedDataSet.use_count();
+    const long tableReferences = releasedTable.use_count();
+    const long signalAcronymReferences = releasedTable->Column("SignalAcronym").use_count();
+    const long pointTagReferences = releasedTable->Column("PointTag").use_count();
+    const size_t releasedRowCount = FilterExpressionParser::Select(releasedDataSet, releasedExpression, "MeasurementDetail").size();
+
+    assert(releasedRowCount > 0);
+    assert(expressionCache.Count() == 1);
+    assert(releasedDataSet.use_count() == dataSetReferences && releasedTable.use_count() == tableReferences);
+    assert(releasedTable->Column("SignalAcronym").use_count() == signalAcronymReferences && releasedTable->Column("PointTag").use_count() == pointTagReferences);
+
+    const uint64_t releasedHitCount = expressionCache.GetHitCount();
+    const DataSetPtr sameSchemaDataSet = DataSet::FromXml(MetadataSampleFileName[0]);
+    const vector<DataRowPtr> sameSchemaRows = FilterExpressionParser::Select(sameSchemaDataSet, releasedExpression, "MeasurementDetail");
+
+    assert(expressionCache.GetHitCount() == releasedHitCount + 1);
+    assert(sameSchemaRows.size() == releasedRowCount && sameSchemaRows[0]->Parent() == sameSchemaDataSet->Table("MeasurementDetail"));
+    assert(releasedTable.use_count() == tableReferences);
+
+    // Datasets missing a referenced column are parsed and report the error instead of using cache
+    const DataSetPtr missingColumnDataSet = NewSharedPtr<DataSet>();
+    const DataTablePtr missingColumnTable = missingColumnDataSet->CreateTable("MeasurementDetail");
+    missingColumnTable->AddColumn(missingColumnTable->CreateColumn("PointTag", DataType::String));
+    missingColumnDataSet->AddOrUpdateTable(missingColumnTable);
+    parsingExceptionCount = 0;
+
+    parser = NewSharedPtr<FilterExpressionParser>(releasedExpression);
+    parser->SetDataSet(missingColumnDataSet);
+    parser->SetPrimaryTableName("MeasurementDetail");
+
+    try
+    {
+        parser->Evaluate();
+    }
+    catch (const FilterExpressionParserException&)
+    {
+        parsingExceptionCount++;
+    }
+
+    assert(parsingExceptionCount > 0);
+    assert(expressionCache.GetHitCount() == releasedHitCount + 1);
+
+    expressionCache.Invalidate();
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 169 - syntax reader creates the same statements as the ANTLR parser for generated expressions
+    FilterExpressionGenerator generator(20181025);
+    int32_t readCount = 0;
+
+    for (int32_t i = 0; i < 5000; i++)
+    {
+        const string filterExpression = generator.Next();
+        const bool identifiersAsExpressions = i % 2 == 1;
+        vector<FilterExpressionStatement> statements;
+
+        // Expressions rejected by the reader are left to the ANTLR parser, these are not compared
+        // since ANTLR error recovery for some invalid expressions is not reliable
+        try
+        {
+            statements = FilterExpressionSyntaxReader(filterExpression, dataSet, "MeasurementDetail", identifiersAsExpressions).Read();
+        }
+        catch (const FilterExpressionParserException&)
+        {
+            continue;
+        }
+
+        parser = NewSharedPtr<FilterExpressionParser>(filterExpression);
+        parser->SetDataSet(dataSet);
+        parser->SetPrimaryTableName("MeasurementDetail");
+        parser->SetTrackFilteredRows(!identifiersAsExpressions);
+        parser->SetUseExpressionCache(false);
+        parser->SetUseSyntaxReader(false);
+
+        int32_t syntaxErrorCount = 0;
+        parser->RegisterParsingExceptionCallback([&syntaxErrorCount](FilterExpressionParserPtr, const string&) { syntaxErrorCount++; });
+
+        const vector<ExpressionTreePtr>& expressionTrees = parser->GetExpressionTrees();
+        size_t treeIndex = 0;
+
+        if (syntaxErrorCount > 0)
+            cerr << "Syntax reader accepted invalid expression: " << filterExpression << endl;
+
+        assert(syntaxErrorCount == 0);
+
+        for (const auto& statement : statements)
+        {
+            if (statement.Type != FilterExpressionStatement::StatementType::Expression)
+                continue;
+
+            assert(treeIndex < expressionTrees.size());
+            const ExpressionTreePtr& expressionTree = expressionTrees[treeIndex++];
+
+            if (DescribeExpression(statement.Root) != DescribeExpression(expressionTree->Root))
+                cerr << "Syntax reader expression mismatch: " << filterExpression << endl;
+
+            assert(DescribeExpression(statement.Root) == DescribeExpression(expressionTree->Root));
+            assert(statement.Table == expressionTree->Table());
+            assert(statement.TopLimit == expressionTree->TopLimit);
+            assert(statement.OrderByTerms == expressionTree->OrderByTerms);
+        }
+
+        assert(treeIndex == expressionTrees.size());
+        readCount++;
+    }
+
+    assert(readCount > 1000);
+
+    for (const char* invalidExpression : { "", ";", "ID = ", "ID IS NOT", "FILTER MeasurementDetail ID = 1", "PPA:1 = 1", "'FREQ", "ID = 1 /", "Len(", "ID === ?", "SignalAcronym = '\xC3\xA9'", "FILTER MissingTable WHERE True", "Missing = 1" })
+    {
+        bool rejected = false;
+
+        try
+        {
+            FilterExpressionSyntaxReader(invalidExpression, dataSet, "MeasurementDetail", false).Read();
+        }
+        catch (const FilterExpressionParserException&)
+        {
+            rejected = true;
+        }
+
+        assert(rejected);
+    }
+
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test 170 - compact decimal values evaluate the same as full precision decimals, falling back when they do not fit
+    const DataSetPtr decimalDataSet = NewSharedPtr<DataSet>();
+    const DataTablePtr decimalTable = decimalDataSet->CreateTable("Decimals");
+    decimalTable->AddColumn(decimalTable->CreateColumn("A", DataType::Decimal));
+    decimalTable->AddColumn(decimalTable->CreateColumn("B", DataType::Decimal));
+    decimalDataSet->AddOrUpdateTable(decimalTable);
+
+    const vector<pair<string, bool>> decimalValues =
+    {
+        { "0", true },
+        { "1.5", true },
+        { "-2.25", true },
+        { "12.340", true },
+        { "0.0000123", true },
+        { "0.0000000000000000000000000001", true },
+        { "79228162514264337593543950335", true },
+        { "-79228162514264337593543950335", true },
+        { "123456789012345678901234567890.5", false },
+        { "3.14159265358979323846264338327950288", false }
+    };
+
+    for (const auto& left : decimalValues)
+    {
+        for (const auto& right : decimalValues)
+        {
+            DataRowPtr row = NewSharedPtr<DataRow>(decimalTable);
+            Decimal128 compact;
+
+            row->SetDecimalValue(0, decimal_t(left.first));
+            row->SetDecimalValue(1, decimal_t(right.first));
+            decimalTable->AddRow(row);
+
+            assert(row->TryGetCompactDecimal(0, compact) == left.second);
+            assert(row->ValueAsDecimal(0).GetValueOrDefault() == decimal_t(left.first));
+        }
+    }
+
+    DataRowPtr nullDecimalRow = NewSharedPtr<DataRow>(decimalTable);
+    nullDecimalRow->SetDecimalValue(1, decimal_t(1));
+    decimalTable->AddRow(nullDecimalRow);
+
+    const vector<pair<string, function<decimal_t(const decimal_t&, const decimal_t&)>>> decimalOperations =
+    {
+        { "A + B", [](const decimal_t& a, const decimal_t& b) { return a + b; } },
+        { "A - B", [](const decimal_t& a, const decimal_t& b) { return a - b; } },
+        { "A * B", [](const decimal_t& a, const decimal_t& b) { return a * b; } },
+        { "A * 3 - 1.25", [](const decimal_t& a, const decimal_t&) { return a * 3 - decimal_t("1.25"); } }
+    };
+
+    const vector<pair<string, function<bool(const decimal_t&, const decimal_t&)>>> decimalComparisons =
+    {
+        { "A < B", [](const decimal_t& a, const decimal_t& b) { return a < b; } },
+        { "A <= B", [](const decimal_t& a, const decimal_t& b) { return a <= b; } },
+        { "A = B", [](const decimal_t& a, const decimal_t& b) { return a == b; } },
+        { "A <> B", [](const decimal_t& a, const decimal_t& b) { return a != b; } },
+        { "A > 1", [](const decimal_t& a, const decimal_t&) { return a > 1; } },
+        { "A >= -2.250", [](const decimal_t& a, const decimal_t&) { return a >= decimal_t("-2.25"); } }
+    };
+
+    for (const auto& operation : decimalOperations)
+    {
+        const ExpressionTreePtr expressionTree = FilterExpressionParser::GenerateExpressionTree(decimalTable, operation.first);
+
+        for (int32_t i = 0; i < decimalTable->RowCount(); i++)
+        {
+            const DataRowPtr& row = decimalTable->Row(i);
+            const ValueExpressionPtr result = expressionTree->Evaluate(row);
+
+            assert(result->ValueType == ExpressionValueType::Decimal);
+
+            if (row == nullDecimalRow)
+                assert(result->IsNull());
+            else
+                assert(result->ValueAsDecimal() == operation.second(row->ValueAsDecimal(0).GetValueOrDefault(), row->ValueAsDecimal(1).GetValueOrDefault()));
+        }
+    }
+
+    for (const auto& comparison : decimalComparisons)
+    {
+        const ExpressionTreePtr expressionTree = FilterExpressionParser::GenerateExpressionTree(decimalTable, comparison.first);
+
+        for (int32_t i = 0; i < decimalTable->RowCount(); i++)
+        {
+            const DataRowPtr& row = decimalTable->Row(i);
+            const ValueExpressionPtr result = expressionTree->Evaluate(row);
+
+            assert(result->ValueType == ExpressionValueType::Boolean);
+
+            if (row == nullDecimalRow)
+                assert(result->IsNull());
+            else
+                assert(result->ValueAsBoolean() == comparison.second(row->ValueAsDecimal(0).GetValueOrDefault(), row->ValueAsDecimal(1).GetValueOrDefault()));
+        }
+    }
+
+    // Exact results that fit stay compact, overflowing results fall back on full precision
+    Decimal128 compactResult;
+    const ExpressionTreePtr productTree = FilterExpressionParser::GenerateExpressionTree(decimalTable, "A * B");
+    assert(productTree->Evaluate(decimalTable->Row(12))->TryGetCompactDecimal(compactResult));
+    assert(compactResult.ToString() == "-3.375");
+    assert(!productTree->Evaluate(decimalTable->Row(66))->TryGetCompactDecimal(compactResult));
+    assert(productTree->Evaluate(decimalTable->Row(66))->ToString() == decimal_t(Decimal::DotNetMaxValue * Decimal::DotNetMaxValue).str());
+    assert(FilterExpressionParser::Select(decimalTable, "A * 2 > 3 AND B < 0").size() == 8);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
     // Wait until the user presses enter before quitting.
     cout << endl << "Tests complete. Press enter to exit." << endl;
     string line;
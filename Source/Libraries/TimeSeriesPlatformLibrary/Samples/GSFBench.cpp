@@ -0,0 +1,662 @@
+//******************************************************************************************************
+//  GSFBench.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+// Micro-benchmarks for codec, transport and filtering hot paths. Results are written as CSV, one row
+// per benchmark and parameter, so runs from different commits can be compared directly:
+//
+//     gsf-bench [--quick] [--filter <name substring>] [--output <file name>]
+//
+// All input data is synthetic and generated from a fixed seed so results are reproducible.
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <algorithm>
+#include <cmath>
+#include "../Common/Convert.h"
+#include "../Data/DataSet.h"
+#include "../FilterExpressions/FilterExpressionParser.h"
+#include "../Transport/ActiveMeasurementsSchema.h"
+#include "../Transport/CompactMeasurement.h"
+#include "../Transport/DataPublisher.h"
+#include "../Transport/RoutingTables.h"
+#include "../Transport/SignalIndexCache.h"
+#include "../Transport/TSSCEncoder.h"
+#include "../Transport/TSSCDecoder.h"
+#include "../Transport/XOR64Encoder.h"
+#include "../Transport/XOR64Decoder.h"
+#include "CodecTestData.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+using namespace GSF::FilterExpressions;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// 30 frames per second in ticks
+static constexpr int64_t FrameInterval = 333333LL;
+static constexpr int64_t StartTime = 636500000000000000LL;
+
+struct BenchmarkOptions
+{
+    bool Quick = false;
+    string Filter;
+    string OutputFileName;
+};
+
+// Times repeated calls of an operation, each call processes a known number of items. Very short
+// operations are batched so clock overhead stays negligible, results report median and minimum
+// time per item across all samples.
+class BenchmarkRunner
+{
+private:
+    const BenchmarkOptions& m_options;
+    ostream& m_output;
+
+    static float64_t Elapsed(const chrono::steady_clock::time_point& startTime)
+    {
+        return chrono::duration<float64_t, nano>(chrono::steady_clock::now() - startTime).count();
+    }
+
+public:
+    BenchmarkRunner(const BenchmarkOptions& options, ostream& output) :
+        m_options(options),
+        m_output(output)
+    {
+        m_output << "benchmark,parameter,items,samples,median_ns_per_item,min_ns_per_item,items_per_second" << endl;
+    }
+
+    bool IsEnabled(const string& name) const
+    {
+        return m_options.Filter.empty() || name.find(m_options.Filter) != string::npos;
+    }
+
+    bool IsQuick() const
+    {
+        return m_options.Quick;
+    }
+
+    void Run(const string& name, const string& parameter, uint64_t itemCount, const function<void()>& operation)
+    {
+        const float64_t minimumSampleTime = 10.0E6;
+        const float64_t targetTime = m_options.Quick ? 100.0E6 : 500.0E6;
+        const uint32_t minimumSamples = m_options.Quick ? 3U : 5U;
+        const uint32_t maximumSamples = 1000U;
+
+        // First call warms up caches and sizes the batch
+        auto startTime = chrono::steady_clock::now();
+        operation();
+        const float64_t callTime = max(Elapsed(startTime), 1.0);
+        const uint32_t batchSize = static_cast<uint32_t>(max(1.0, ceil(minimumSampleTime / callTime)));
+
+        vector<float64_t> samples;
+        float64_t totalTime = 0.0;
+
+        while (samples.size() < maximumSamples && (samples.size() < minimumSamples || totalTime < targetTime))
+        {
+            startTime = chrono::steady_clock::now();
+
+            for (uint32_t i = 0; i < batchSize; i++)
+                operation();
+
+            const float64_t sampleTime = Elapsed(startTime);
+            totalTime += sampleTime;
+            samples.push_back(sampleTime / batchSize / static_cast<float64_t>(itemCount));
+        }
+
+        sort(samples.begin(), samples.end());
+        const float64_t median = samples[samples.size() / 2];
+
+        m_output << name << "," << parameter << "," << itemCount << "," << samples.size() << "," << median << "," << samples.front() << "," << 1.0E9 / median << endl;
+        cerr << "    " << name << " [" << parameter << "]: " << median << " ns/item" << endl;
+    }
+};
+
+// Phasor-like synthetic values: frequencies, magnitudes, rotating angles and digitals
+float64_t NextValue(Random& random, uint32_t signal, float64_t previous, uint32_t frame)
+{
+    switch (signal % 4U)
+    {
+        case 0:
+            return frame == 0 ? 60.0 : previous + (random.NextDouble() - 0.5) * 0.002;
+        case 1:
+            return frame == 0 ? 100000.0 + signal * 10.0 : previous + (random.NextDouble() - 0.5) * 20.0;
+        case 2:
+            return fmod(signal * 7.0 + frame * 1.2 + random.NextDouble() * 0.01, 360.0) - 180.0;
+        default:
+            return static_cast<float64_t>(signal / 4U % 2U);
+    }
+}
+
+TestStream CreateStream(uint32_t signalCount, uint32_t frameCount)
+{
+    Random random(0x5EED0001ULL);
+    vector<float64_t> values(signalCount, 0.0);
+    TestStream stream;
+
+    stream.reserve(static_cast<size_t>(signalCount) * frameCount);
+
+    for (uint32_t frame = 0; frame < frameCount; frame++)
+    {
+        for (uint32_t signal = 0; signal < signalCount; signal++)
+        {
+            values[signal] = NextValue(random, signal, values[signal], frame);
+            stream.push_back({ static_cast<uint16_t>(signal), StartTime + frame * FrameInterval, 0U, values[signal] });
+        }
+    }
+
+    return stream;
+}
+
+vector<GSF::Guid> CreateSignalIDs(uint32_t signalCount)
+{
+    Random random(0x5EED0002ULL);
+    vector<GSF::Guid> signalIDs;
+
+    signalIDs.reserve(signalCount);
+
+    for (uint32_t i = 0; i < signalCount; i++)
+        signalIDs.push_back(random.NextGuid());
+
+    return signalIDs;
+}
+
+SignalIndexCachePtr CreateSignalIndexCache(const vector<GSF::Guid>& signalIDs)
+{
+    SignalIndexCachePtr signalIndexCache = NewSharedPtr<SignalIndexCache>();
+    signalIndexCache->Reserve(ConvertUInt32(signalIDs.size()));
+
+    for (size_t i = 0; i < signalIDs.size(); i++)
+        signalIndexCache->AddMeasurementKey(static_cast<uint16_t>(i), signalIDs[i], "PPA", ConvertUInt32(i + 1));
+
+    return signalIndexCache;
+}
+
+vector<MeasurementPtr> CreateMeasurements(const TestStream& stream, const vector<GSF::Guid>& signalIDs)
+{
+    vector<MeasurementPtr> measurements;
+    measurements.reserve(stream.size());
+
+    for (const TestMeasurement& source : stream)
+    {
+        MeasurementPtr measurement = NewSharedPtr<Measurement>();
+        measurement->ID = source.ID + 1U;
+        measurement->Source = "PPA";
+        measurement->SignalID = signalIDs[source.ID];
+        measurement->Timestamp = source.Timestamp;
+        measurement->Value = source.Value;
+        measurements.push_back(measurement);
+    }
+
+    return measurements;
+}
+
+// Synthetic ActiveMeasurements table, ten signals per device
+DataSetPtr CreateActiveMeasurements(uint32_t rowCount)
+{
+    static const string signalTypes[] = { "FREQ", "DFDT", "VPHM", "VPHA", "IPHM", "IPHA", "ALOG", "DIGI", "STAT", "FLAG" };
+    static const string engineeringUnits[] = { "Hz", "Hz/s", "Volts", "Degrees", "Amps", "Degrees", "", "", "", "" };
+
+    Random random(0x5EED0003ULL);
+    const DataSetPtr dataSet = DataSet::FromXml(ActiveMeasurementsSchema, ActiveMeasurementsSchemaLength);
+    const DataTablePtr table = dataSet->Table("ActiveMeasurements");
+    const GSF::Guid nodeID = random.NextGuid();
+    const datetime_t updatedOn = FromTicks(StartTime);
+
+    const int32_t sourceNodeID = table->Column("SourceNodeID")->Index();
+    const int32_t id = table->Column("ID")->Index();
+    const int32_t signalID = table->Column("SignalID")->Index();
+    const int32_t pointTag = table->Column("PointTag")->Index();
+    const int32_t signalReference = table->Column("SignalReference")->Index();
+    const int32_t internal = table->Column("Internal")->Index();
+    const int32_t subscribed = table->Column("Subscribed")->Index();
+    const int32_t device = table->Column("Device")->Index();
+    const int32_t deviceID = table->Column("DeviceID")->Index();
+    const int32_t framesPerSecond = table->Column("FramesPerSecond")->Index();
+    const int32_t protocol = table->Column("Protocol")->Index();
+    const int32_t signalType = table->Column("SignalType")->Index();
+    const int32_t units = table->Column("EngineeringUnits")->Index();
+    const int32_t adder = table->Column("Adder")->Index();
+    const int32_t multiplier = table->Column("Multiplier")->Index();
+    const int32_t description = table->Column("Description")->Index();
+    const int32_t updatedOnColumn = table->Column("UpdatedOn")->Index();
+
+    for (uint32_t i = 0; i < rowCount; i++)
+    {
+        const uint32_t deviceIndex = i / 10U;
+        const uint32_t typeIndex = i % 10U;
+        const string deviceName = "DEV" + ToString(deviceIndex);
+        const DataRowPtr row = table->CreateRow();
+
+        row->SetGuidValue(sourceNodeID, nodeID);
+        row->SetStringValue(id, "PPA:" + ToString(i + 1U));
+        row->SetGuidValue(signalID, random.NextGuid());
+        row->SetStringValue(pointTag, deviceName + ":" + signalTypes[typeIndex]);
+        row->SetStringValue(signalReference, deviceName + "-" + signalTypes[typeIndex]);
+        row->SetInt32Value(internal, 1);
+        row->SetInt32Value(subscribed, 0);
+        row->SetStringValue(device, deviceName);
+        row->SetInt32Value(deviceID, static_cast<int32_t>(deviceIndex + 1U));
+        row->SetInt32Value(framesPerSecond, 30);
+        row->SetStringValue(protocol, string(random.Next(4U) == 0 ? "IEEE C37.118-2005" : "GatewayTransport"));
+        row->SetStringValue(signalType, signalTypes[typeIndex]);
+        row->SetStringValue(units, engineeringUnits[typeIndex]);
+        row->SetDoubleValue(adder, 0.0);
+        row->SetDoubleValue(multiplier, 1.0);
+        row->SetStringValue(description, deviceName + " " + signalTypes[typeIndex] + " measurement");
+        row->SetDateTimeValue(updatedOnColumn, updatedOn);
+
+        table->AddRow(row);
+    }
+
+    return dataSet;
+}
+
+void BenchmarkCodecs(BenchmarkRunner& runner)
+{
+    const uint32_t frameCount = runner.IsQuick() ? 30U : 300U;
+
+    for (uint32_t signalCount : { 100U, 1000U })
+    {
+        const TestStream stream = CreateStream(signalCount, frameCount);
+        const string parameter = ToString(signalCount) + " signals";
+        vector<uint8_t> block(BlockSize);
+        vector<vector<uint8_t>> blocks;
+
+        if (runner.IsEnabled("tssc"))
+        {
+            TSSCEncoder encoder;
+            TSSCDecoder decoder;
+
+            const auto encode = [&]
+            {
+                blocks.clear();
+                encoder.Reset();
+                encoder.SetBuffer(block.data(), 0, BlockSize);
+
+                for (const TestMeasurement& measurement : stream)
+                {
+                    if (!encoder.TryAddMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, static_cast<float32_t>(measurement.Value)))
+                    {
+                        blocks.emplace_back(block.begin(), block.begin() + encoder.FinishBlock());
+                        encoder.SetBuffer(block.data(), 0, BlockSize);
+                        encoder.TryAddMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, static_cast<float32_t>(measurement.Value));
+                    }
+                }
+
+                blocks.emplace_back(block.begin(), block.begin() + encoder.FinishBlock());
+            };
+
+            runner.Run("tssc_encode", parameter, stream.size(), encode);
+
+            runner.Run("tssc_decode", parameter, stream.size(), [&]
+            {
+                uint16_t id;
+                int64_t timestamp;
+                uint32_t quality;
+                float32_t value;
+
+                decoder.Reset();
+
+                for (vector<uint8_t>& encoded : blocks)
+                {
+                    decoder.SetBuffer(encoded.data(), 0, ConvertUInt32(encoded.size()));
+
+                    while (decoder.TryGetMeasurement(id, timestamp, quality, value))
+                    {
+                    }
+                }
+            });
+        }
+
+        if (runner.IsEnabled("xor64"))
+        {
+            XOR64Encoder encoder;
+            XOR64Decoder decoder;
+
+            runner.Run("xor64_encode", parameter, stream.size(), [&]
+            {
+                blocks.clear();
+                encoder.Reset();
+                encoder.SetBuffer(block.data(), 0, BlockSize);
+
+                for (const TestMeasurement& measurement : stream)
+                {
+                    if (!encoder.TryAddMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, measurement.Value))
+                    {
+                        blocks.emplace_back(block.begin(), block.begin() + encoder.FinishBlock());
+                        encoder.SetBuffer(block.data(), 0, BlockSize);
+                        encoder.TryAddMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, measurement.Value);
+                    }
+                }
+
+                blocks.emplace_back(block.begin(), block.begin() + encoder.FinishBlock());
+            });
+
+            runner.Run("xor64_decode", parameter, stream.size(), [&]
+            {
+                uint16_t id;
+                int64_t timestamp;
+                uint32_t quality;
+                float64_t value;
+
+                decoder.Reset();
+
+                for (vector<uint8_t>& encoded : blocks)
+                {
+                    decoder.SetBuffer(encoded.data(), 0, ConvertUInt32(encoded.size()));
+
+                    while (decoder.TryGetMeasurement(id, timestamp, quality, value))
+                    {
+                    }
+                }
+            });
+        }
+    }
+}
+
+void BenchmarkCompactMeasurement(BenchmarkRunner& runner)
+{
+    if (!runner.IsEnabled("compact"))
+        return;
+
+    const uint32_t frameCount = runner.IsQuick() ? 30U : 300U;
+
+    for (uint32_t signalCount : { 100U, 1000U })
+    {
+        const vector<GSF::Guid> signalIDs = CreateSignalIDs(signalCount);
+        const SignalIndexCachePtr signalIndexCache = CreateSignalIndexCache(signalIDs);
+        const vector<MeasurementPtr> measurements = CreateMeasurements(CreateStream(signalCount, frameCount), signalIDs);
+        const string parameter = ToString(signalCount) + " signals";
+
+        // Publisher default, timestamps as offsets from a base time
+        int64_t baseTimeOffsets[] = { StartTime, 0LL };
+        const CompactMeasurement serializer(signalIndexCache, baseTimeOffsets);
+        vector<uint8_t> packet;
+        vector<uint8_t> buffer;
+
+        runner.Run("compact_serialize", parameter, measurements.size(), [&]
+        {
+            packet.clear();
+
+            for (const MeasurementPtr& measurement : measurements)
+            {
+                serializer.SerializeMeasurement(*measurement, buffer, signalIndexCache->GetSignalIndex(measurement->SignalID));
+                WriteBytes(packet, buffer);
+                buffer.clear();
+            }
+        });
+
+        runner.Run("compact_parse", parameter, measurements.size(), [&]
+        {
+            uint32_t offset = 0;
+            const uint32_t length = ConvertUInt32(packet.size());
+            MeasurementPtr measurement;
+
+            while (serializer.TryParseMeasurement(packet.data(), offset, length, measurement))
+            {
+            }
+        });
+    }
+}
+
+void BenchmarkSignalIndexCache(BenchmarkRunner& runner, const SubscriberConnection& connection)
+{
+    if (!runner.IsEnabled("signal_index_cache"))
+        return;
+
+    for (uint32_t signalCount : { 1000U, 10000U, 50000U })
+    {
+        const vector<GSF::Guid> signalIDs = CreateSignalIDs(signalCount);
+        const SignalIndexCachePtr signalIndexCache = CreateSignalIndexCache(signalIDs);
+        const string parameter = ToString(signalCount) + " signals";
+        vector<uint8_t> buffer;
+        GSF::Guid subscriberID;
+
+        runner.Run("signal_index_cache_serialize", parameter, signalCount, [&]
+        {
+            buffer.clear();
+            signalIndexCache->Serialize(connection, buffer);
+        });
+
+        runner.Run("signal_index_cache_parse", parameter, signalCount, [&]
+        {
+            SignalIndexCache parsedCache;
+            parsedCache.Parse(buffer, subscriberID);
+        });
+
+        // Lookups in a shuffled order so results are not dominated by sequential access
+        vector<uint16_t> runtimeIDs(signalCount);
+        Random random(0x5EED0004ULL);
+
+        for (uint32_t i = 0; i < signalCount; i++)
+            runtimeIDs[i] = static_cast<uint16_t>(i);
+
+        for (uint32_t i = signalCount - 1U; i > 0; i--)
+            swap(runtimeIDs[i], runtimeIDs[random.Next(i + 1U)]);
+
+        vector<GSF::Guid> lookupSignalIDs;
+        lookupSignalIDs.reserve(signalCount);
+
+        for (uint16_t runtimeID : runtimeIDs)
+            lookupSignalIDs.push_back(signalIDs[runtimeID]);
+
+        uint64_t checksum = 0;
+
+        runner.Run("signal_index_cache_lookup_runtime_id", parameter, signalCount, [&]
+        {
+            for (const GSF::Guid& signalID : lookupSignalIDs)
+                checksum += signalIndexCache->GetSignalIndex(signalID);
+        });
+
+        runner.Run("signal_index_cache_lookup_signal_id", parameter, signalCount, [&]
+        {
+            for (uint16_t runtimeID : runtimeIDs)
+                checksum += signalIndexCache->GetSignalID(runtimeID).data[0];
+        });
+
+        if (checksum == 0)
+            cerr << "    unexpected empty lookup results" << endl;
+    }
+}
+
+// Connections are left unsubscribed, so this measures route lookup and per-destination
+// fan-out without including serialization or socket writes
+void BenchmarkRoutingTables(BenchmarkRunner& runner, const DataPublisherPtr& publisher, IOContext& service)
+{
+    if (!runner.IsEnabled("routing"))
+        return;
+
+    const uint32_t signalCount = 1000U;
+    const vector<GSF::Guid> signalIDs = CreateSignalIDs(signalCount);
+    const vector<MeasurementPtr> measurements = CreateMeasurements(CreateStream(signalCount, 1U), signalIDs);
+
+    for (uint32_t subscriberCount : { 1U, 10U, 100U })
+    {
+        RoutingTables routingTables;
+        vector<SubscriberConnectionPtr> connections;
+
+        // Each subscriber receives half of the signals, with overlap between subscribers
+        for (uint32_t i = 0; i < subscriberCount; i++)
+        {
+            unordered_set<GSF::Guid> routes;
+
+            for (uint32_t j = 0; j < signalCount / 2U; j++)
+                routes.insert(signalIDs[(i * 7U + j) % signalCount]);
+
+            connections.push_back(NewSharedPtr<SubscriberConnection, DataPublisherPtr, IOContext&>(publisher, service));
+            routingTables.UpdateRoutes(connections.back(), routes);
+        }
+
+        // Route updates are applied asynchronously
+        this_thread::sleep_for(chrono::milliseconds(100 + subscriberCount * 5));
+
+        runner.Run("routing_publish", ToString(subscriberCount) + " subscribers", measurements.size(), [&]
+        {
+            routingTables.PublishMeasurements(measurements);
+        });
+    }
+}
+
+void BenchmarkDataSets(BenchmarkRunner& runner)
+{
+    const bool selectEnabled = runner.IsEnabled("filter_select") || runner.IsEnabled("filter_select_parallel");
+    const bool xmlEnabled = runner.IsEnabled("dataset_");
+
+    if (!selectEnabled && !xmlEnabled)
+        return;
+
+    static const pair<const char*, const char*> filterExpressions[] =
+    {
+        { "filter_select_equals", "FILTER ActiveMeasurements WHERE SignalType = 'FREQ'" },
+        { "filter_select_in_like", "FILTER ActiveMeasurements WHERE SignalType IN ('IPHM', 'IPHA') AND Device LIKE 'DEV1%'" },
+        { "filter_select_top_order", "FILTER TOP 100 ActiveMeasurements WHERE SignalType = 'VPHM' ORDER BY PointTag DESC" },
+        { "filter_select_keys", "PPA:1; PPA:500; PPA:999" }
+    };
+
+    vector<uint32_t> rowCounts = { 1000U, 10000U, 100000U, 1000000U };
+
+    if (runner.IsQuick())
+        rowCounts.resize(2);
+
+    for (uint32_t rowCount : rowCounts)
+    {
+        const DataSetPtr dataSet = CreateActiveMeasurements(rowCount);
+        const string parameter = ToString(rowCount) + " rows";
+
+        if (selectEnabled)
+        {
+            for (const auto& filterExpression : filterExpressions)
+            {
+                if (!runner.IsEnabled(filterExpression.first))
+                    continue;
+
+                runner.Run(filterExpression.first, parameter, rowCount, [&]
+                {
+                    FilterExpressionParser::Select(dataSet, filterExpression.second, "ActiveMeasurements");
+                });
+            }
+
+            // Scaling of partitioned evaluation for the largest table
+            if (rowCount == rowCounts.back() && runner.IsEnabled("filter_select_parallel"))
+            {
+                const ExpressionTreePtr expressionTree = FilterExpressionParser::GenerateExpressionTree(dataSet->Table("ActiveMeasurements"), "SignalType IN ('IPHM', 'IPHA') AND Device LIKE 'DEV1%'");
+
+                for (int32_t threadCount : { 1, 2, 4, 8, 16 })
+                {
+                    expressionTree->MaxDegreeOfParallelism = threadCount;
+
+                    runner.Run("filter_select_parallel", parameter + ", " + ToString(threadCount) + " threads", rowCount, [&]
+                    {
+                        FilterExpressionParser::Select(expressionTree);
+                    });
+                }
+            }
+        }
+
+        // XML serialization of a million rows is not representative of metadata exchange
+        if (!xmlEnabled || rowCount > 100000U)
+            continue;
+
+        vector<uint8_t> buffer;
+
+        runner.Run("dataset_write_xml", parameter, rowCount, [&]
+        {
+            buffer.clear();
+            dataSet->WriteXml(buffer);
+        });
+
+        runner.Run("dataset_read_xml", parameter, rowCount, [&]
+        {
+            DataSet::FromXml(buffer);
+        });
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    BenchmarkOptions options;
+
+    for (int32_t i = 1; i < argc; i++)
+    {
+        const string argument = argv[i];
+
+        if (argument == "--quick")
+        {
+            options.Quick = true;
+        }
+        else if (argument == "--filter" && i + 1 < argc)
+        {
+            options.Filter = argv[++i];
+        }
+        else if (argument == "--output" && i + 1 < argc)
+        {
+            options.OutputFileName = argv[++i];
+        }
+        else
+        {
+            cerr << "Usage: " << argv[0] << " [--quick] [--filter <name substring>] [--output <file name>]" << endl;
+            return 1;
+        }
+    }
+
+    ofstream outputFile;
+
+    if (!options.OutputFileName.empty())
+    {
+        outputFile.open(options.OutputFileName);
+
+        if (!outputFile)
+        {
+            cerr << "Failed to open output file \"" << options.OutputFileName << "\"" << endl;
+            return 1;
+        }
+    }
+
+    BenchmarkRunner runner(options, options.OutputFileName.empty() ? cout : outputFile);
+
+    // Publisher is only needed as the parent of subscriber connections, binds to any available port
+    const DataPublisherPtr publisher = NewSharedPtr<DataPublisher, uint16_t>(0);
+    IOContext service;
+    const SubscriberConnectionPtr connection = NewSharedPtr<SubscriberConnection, DataPublisherPtr, IOContext&>(publisher, service);
+
+    cerr << "Running codec benchmarks..." << endl;
+    BenchmarkCodecs(runner);
+    BenchmarkCompactMeasurement(runner);
+
+    cerr << "Running transport benchmarks..." << endl;
+    BenchmarkSignalIndexCache(runner, *connection);
+    BenchmarkRoutingTables(runner, publisher, service);
+
+    cerr << "Running data set benchmarks..." << endl;
+    BenchmarkDataSets(runner);
+
+    cerr << "Benchmarks complete." << endl;
+
+    return 0;
+}
@@ -0,0 +1,579 @@
+//******************************************************************************************************
+//  GSFLoopback.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+// End-to-end loopback harness for capacity planning. Starts a publisher and a number of in-process
+// subscribers over localhost, publishes a synthetic point set and measures what each transport mode
+// sustains. Each measurement timestamp carries its publish time, so subscribers compute latency from
+// publication to callback. One CSV row is written per mode:
+//
+//     gsf-loopback [--subscribers <count>] [--signals <count>] [--rate <frames per second, 0 = maximum>]
+//                  [--duration <seconds>] [--modes <name substring>] [--port <port>] [--output <file name>]
+//
+// Modes combine TCP or UDP data channels, compact, TSSC or XOR64 payloads, and real-time or throttled
+// publication. Stateful payload compression is not available over UDP, there the subscriber request
+// for compression results in per-packet compressed compact data.
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <map>
+#include "../Transport/DataPublisher.h"
+#include "../Transport/DataSubscriber.h"
+#include "MetadataTestData.h"
+
+#ifdef __linux__
+#include <dirent.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::Data;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+struct HarnessOptions
+{
+    uint32_t SubscriberCount = 1U;
+    uint32_t SignalCount = 1000U;
+    float64_t FrameRate = 30.0;
+    float64_t Duration = 5.0;
+    float64_t ThrottledInterval = 0.1;
+    uint16_t Port = 7175;
+    string Modes;
+    string OutputFileName;
+};
+
+struct HarnessMode
+{
+    string Name;
+    bool UdpDataChannel;
+    bool CompressPayload;
+    uint32_t CompressionMode;
+    bool Throttled;
+};
+
+// Log-linear latency histogram in microseconds, exact below 128 and within
+// 1/64 of the value above, so percentiles are reported with ~1.5% precision
+class LatencyHistogram
+{
+private:
+    static constexpr int32_t SubBucketBits = 6;
+    static constexpr int32_t SubBucketCount = 1 << SubBucketBits;
+    static constexpr int32_t LinearLimit = SubBucketCount * 2;
+
+    vector<uint64_t> m_counts;
+    uint64_t m_total;
+    uint64_t m_maximum;
+
+    static int32_t GetBucket(uint64_t value)
+    {
+        if (value < static_cast<uint64_t>(LinearLimit))
+            return static_cast<int32_t>(value);
+
+        int32_t exponent = 0;
+
+        while (value >> (exponent + 1))
+            exponent++;
+
+        return LinearLimit + (exponent - SubBucketBits - 1) * SubBucketCount + static_cast<int32_t>(value >> (exponent - SubBucketBits) & (SubBucketCount - 1));
+    }
+
+    static uint64_t GetBucketValue(int32_t bucket)
+    {
+        if (bucket < LinearLimit)
+            return static_cast<uint64_t>(bucket);
+
+        const int32_t exponent = (bucket - LinearLimit) / SubBucketCount + SubBucketBits + 1;
+        const uint64_t subBucket = static_cast<uint64_t>((bucket - LinearLimit) % SubBucketCount);
+
+        return (static_cast<uint64_t>(SubBucketCount) + subBucket) << (exponent - SubBucketBits);
+    }
+
+public:
+    LatencyHistogram() :
+        m_counts(LinearLimit + 64 * SubBucketCount, 0ULL),
+        m_total(0ULL),
+        m_maximum(0ULL)
+    {
+    }
+
+    void Add(uint64_t value, uint64_t count = 1ULL)
+    {
+        m_counts[GetBucket(value)] += count;
+        m_total += count;
+        m_maximum = max(m_maximum, value);
+    }
+
+    void Add(const LatencyHistogram& other)
+    {
+        for (size_t i = 0; i < m_counts.size(); i++)
+            m_counts[i] += other.m_counts[i];
+
+        m_total += other.m_total;
+        m_maximum = max(m_maximum, other.m_maximum);
+    }
+
+    uint64_t Percentile(float64_t percentile) const
+    {
+        if (m_total == 0)
+            return 0ULL;
+
+        const uint64_t target = max(static_cast<uint64_t>(1), static_cast<uint64_t>(ceil(m_total * percentile / 100.0)));
+        uint64_t count = 0ULL;
+
+        for (size_t i = 0; i < m_counts.size(); i++)
+        {
+            count += m_counts[i];
+
+            if (count >= target)
+                return min(GetBucketValue(static_cast<int32_t>(i)), m_maximum);
+        }
+
+        return m_maximum;
+    }
+
+    uint64_t Maximum() const
+    {
+        return m_maximum;
+    }
+};
+
+// Received value tracking for one subscriber, updated from its callback thread
+struct SubscriberStatistics
+{
+    Mutex Lock;
+    LatencyHistogram Latency;
+    atomic<uint64_t> ValuesReceived { 0ULL };
+    atomic<bool> Collecting { true };
+    int64_t FirstReceived = 0LL;
+    int64_t LastReceived = 0LL;
+};
+
+typedef SharedPtr<SubscriberStatistics> SubscriberStatisticsPtr;
+
+// Cumulative CPU time, in seconds, per thread of this process
+map<int32_t, float64_t> GetThreadCPUTimes()
+{
+    map<int32_t, float64_t> cpuTimes;
+
+#ifdef __linux__
+    const float64_t ticksPerSecond = static_cast<float64_t>(sysconf(_SC_CLK_TCK));
+    DIR* directory = opendir("/proc/self/task");
+
+    if (directory == nullptr)
+        return cpuTimes;
+
+    while (const dirent* entry = readdir(directory))
+    {
+        if (entry->d_name[0] == '.')
+            continue;
+
+        ifstream statFile(string("/proc/self/task/") + entry->d_name + "/stat");
+        string stat;
+
+        if (!getline(statFile, stat))
+            continue;
+
+        // Thread name is in parentheses and may contain spaces, fields that follow start with state
+        const size_t nameEnd = stat.rfind(')');
+
+        if (nameEnd == string::npos)
+            continue;
+
+        stringstream fields(stat.substr(nameEnd + 2));
+        string field;
+        uint64_t userTime = 0ULL, systemTime = 0ULL;
+
+        for (int32_t i = 0; i < 11 && fields >> field; i++)
+        {
+        }
+
+        fields >> userTime >> systemTime;
+        cpuTimes[atoi(entry->d_name)] = (userTime + systemTime) / ticksPerSecond;
+    }
+
+    closedir(directory);
+#endif
+
+    return cpuTimes;
+}
+
+vector<MeasurementMetadataPtr> DefineSyntheticMetadata(const DataPublisherPtr& publisher, uint32_t signalCount)
+{
+    vector<DeviceMetadataPtr> devices;
+    vector<MeasurementMetadataPtr> measurements;
+
+    // Ten analog values per device
+    for (uint32_t i = 0; i < signalCount; i++)
+    {
+        const uint32_t deviceNumber = i / 10U + 1U;
+
+        if (i % 10U == 0U)
+            devices.push_back(CreateDevice("LOOPBACK" + ToString(deviceNumber), static_cast<uint16_t>(deviceNumber), "Loopback Device " + ToString(deviceNumber)));
+
+        measurements.push_back(CreateMeasurement(i % 10U + 1U, devices.back()->Acronym, "LB:" + ToString(i + 1U)));
+    }
+
+    publisher->DefineMetadata(devices, measurements, vector<PhasorMetadataPtr>());
+
+    return measurements;
+}
+
+vector<HarnessMode> GetHarnessModes()
+{
+    vector<HarnessMode> modes;
+
+    for (const bool udpDataChannel : { false, true })
+    {
+        for (const bool throttled : { false, true })
+        {
+            const string transport = udpDataChannel ? "udp" : "tcp";
+            const string publication = throttled ? "-throttled" : "";
+
+            modes.push_back({ transport + "-compact" + publication, udpDataChannel, false, CompressionModes::TSSC, throttled });
+            modes.push_back({ transport + "-tssc" + publication, udpDataChannel, true, CompressionModes::TSSC, throttled });
+            modes.push_back({ transport + "-xor64" + publication, udpDataChannel, true, CompressionModes::XOR64, throttled });
+        }
+    }
+
+    return modes;
+}
+
+void RunMode(const HarnessOptions& options, const HarnessMode& mode, const DataPublisherPtr& publisher, const vector<MeasurementMetadataPtr>& metadata, ostream& output)
+{
+    vector<DataSubscriberPtr> subscribers;
+    vector<SubscriberStatisticsPtr> statistics;
+
+    cerr << "Running " << mode.Name << "..." << endl;
+
+    for (uint32_t i = 0; i < options.SubscriberCount; i++)
+    {
+        DataSubscriberPtr subscriber = NewSharedPtr<DataSubscriber>();
+        SubscriberStatisticsPtr subscriberStatistics = NewSharedPtr<SubscriberStatistics>();
+
+        subscriber->RegisterNewMeasurementsCallback([subscriberStatistics](DataSubscriber*, const vector<MeasurementPtr>& measurements)
+        {
+            const int64_t now = ToTicks(UtcNow());
+            SubscriberStatistics& stats = *subscriberStatistics;
+
+            if (!stats.Collecting)
+                return;
+
+            ScopeLock lock(stats.Lock);
+
+            for (const MeasurementPtr& measurement : measurements)
+                stats.Latency.Add(static_cast<uint64_t>(max(static_cast<int64_t>(0), now - measurement->Timestamp)) / 10U);
+
+            if (stats.FirstReceived == 0LL)
+                stats.FirstReceived = now;
+
+            stats.LastReceived = now;
+            stats.ValuesReceived += measurements.size();
+        });
+
+        subscriber->RegisterErrorMessageCallback([](DataSubscriber*, const string& message)
+        {
+            cerr << "    Subscriber error: " << message << endl;
+        });
+
+        subscriber->SetPayloadDataCompressed(mode.CompressPayload);
+        subscriber->SetPayloadCompressionMode(mode.CompressionMode);
+
+        SubscriptionInfo info;
+        info.FilterExpression = "FILTER ActiveMeasurements WHERE ID LIKE 'LB:%'";
+        info.Throttled = mode.Throttled;
+        info.PublishInterval = options.ThrottledInterval;
+        info.UdpDataChannel = mode.UdpDataChannel;
+        info.DataChannelLocalPort = static_cast<uint16_t>(options.Port + 1U + i);
+
+        subscriber->Connect("localhost", options.Port);
+        subscriber->Subscribe(info);
+
+        subscribers.push_back(subscriber);
+        statistics.push_back(subscriberStatistics);
+    }
+
+    // Wait for every subscriber to receive its signal index cache
+    const auto subscribeTimeout = chrono::steady_clock::now() + chrono::seconds(10);
+
+    for (const DataSubscriberPtr& subscriber : subscribers)
+    {
+        while (chrono::steady_clock::now() < subscribeTimeout)
+        {
+            const SignalIndexCachePtr signalIndexCache = subscriber->GetSignalIndexCache();
+
+            if (signalIndexCache != nullptr && signalIndexCache->Count() == metadata.size())
+                break;
+
+            this_thread::sleep_for(chrono::milliseconds(10));
+        }
+    }
+
+    const auto getMinimumReceived = [&]
+    {
+        uint64_t minimum = UInt64::MaxValue;
+
+        for (const SubscriberStatisticsPtr& subscriberStatistics : statistics)
+            minimum = min(minimum, subscriberStatistics->ValuesReceived.load());
+
+        return minimum;
+    };
+
+    // When publishing as fast as possible, at most this many frames are allowed in flight so
+    // results reflect sustained throughput instead of send queue growth
+    const uint64_t maximumInFlight = 100ULL * metadata.size();
+    const bool unpaced = options.FrameRate <= 0.0;
+    const auto frameInterval = chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<float64_t>(unpaced ? 0.0 : 1.0 / options.FrameRate));
+
+    const map<int32_t, float64_t> startCPUTimes = GetThreadCPUTimes();
+    const PublicationStatistics startPublicationStatistics = publisher->GetStatistics();
+    const auto startTime = chrono::steady_clock::now();
+    const auto stopTime = startTime + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<float64_t>(options.Duration));
+    auto nextFrameTime = startTime;
+    uint64_t valuesPublished = 0ULL;
+    uint64_t frame = 0ULL;
+    vector<MeasurementPtr> measurements;
+
+    while (chrono::steady_clock::now() < stopTime)
+    {
+        if (unpaced)
+        {
+            // Throttled or UDP subscribers may never catch up, so waiting is bounded
+            const auto waitTimeout = chrono::steady_clock::now() + chrono::milliseconds(100);
+
+            while (!mode.Throttled && valuesPublished - min(valuesPublished, getMinimumReceived()) > maximumInFlight && chrono::steady_clock::now() < waitTimeout)
+                this_thread::yield();
+        }
+        else
+        {
+            this_thread::sleep_until(nextFrameTime);
+            nextFrameTime += frameInterval;
+        }
+
+        const int64_t timestamp = ToTicks(UtcNow());
+        measurements.clear();
+        measurements.reserve(metadata.size());
+
+        for (size_t i = 0; i < metadata.size(); i++)
+        {
+            MeasurementPtr measurement = NewSharedPtr<Measurement>();
+            measurement->SignalID = metadata[i]->SignalID;
+            measurement->Timestamp = timestamp;
+            measurement->Value = static_cast<float64_t>(frame % 1000ULL) + i * 0.001;
+            measurements.push_back(measurement);
+        }
+
+        publisher->PublishMeasurements(measurements);
+        valuesPublished += measurements.size();
+        frame++;
+    }
+
+    const float64_t publishTime = chrono::duration<float64_t>(chrono::steady_clock::now() - startTime).count();
+
+    // Throttled publication repeats latest values indefinitely, so only the final interval is collected,
+    // otherwise drain until no subscriber has received anything for a while
+    uint64_t lastTotal = UInt64::MaxValue;
+
+    if (mode.Throttled)
+        this_thread::sleep_for(chrono::duration<float64_t>(options.ThrottledInterval + 0.1));
+
+    for (int32_t i = 0; i < 50 && !mode.Throttled; i++)
+    {
+        uint64_t total = 0ULL;
+
+        for (const SubscriberStatisticsPtr& subscriberStatistics : statistics)
+            total += subscriberStatistics->ValuesReceived.load();
+
+        if (total == lastTotal)
+            break;
+
+        lastTotal = total;
+        this_thread::sleep_for(chrono::milliseconds(250));
+    }
+
+    for (const SubscriberStatisticsPtr& subscriberStatistics : statistics)
+        subscriberStatistics->Collecting = false;
+
+    const float64_t elapsedTime = chrono::duration<float64_t>(chrono::steady_clock::now() - startTime).count();
+    const map<int32_t, float64_t> stopCPUTimes = GetThreadCPUTimes();
+    const PublicationRates publicationRates = CalculateRates(startPublicationStatistics, publisher->GetStatistics());
+    SubscriptionRates subscriptionRates;
+
+    uint64_t valuesReceived = 0ULL;
+    uint64_t bytesReceived = 0ULL;
+    float64_t receiveTime = 0.0;
+    LatencyHistogram latency;
+
+    for (size_t i = 0; i < subscribers.size(); i++)
+    {
+        SubscriberStatistics& subscriberStatistics = *statistics[i];
+        ScopeLock lock(subscriberStatistics.Lock);
+
+        valuesReceived += subscriberStatistics.ValuesReceived;
+        bytesReceived += subscribers[i]->GetTotalCommandChannelBytesReceived();
+
+        // Data channel total reports command channel bytes when not using UDP
+        if (mode.UdpDataChannel)
+            bytesReceived += subscribers[i]->GetTotalDataChannelBytesReceived();
+        receiveTime = max(receiveTime, (subscriberStatistics.LastReceived - subscriberStatistics.FirstReceived) / 1.0E7);
+        latency.Add(subscriberStatistics.Latency);
+
+        // Subscriber counters start at connection, per packet averages only need an empty baseline
+        const SubscriptionRates rates = CalculateRates(SubscriptionStatistics(), subscribers[i]->GetStatistics());
+        subscriptionRates.DecodeTimePerPacket = max(subscriptionRates.DecodeTimePerPacket, rates.DecodeTimePerPacket);
+    }
+
+    for (const DataSubscriberPtr& subscriber : subscribers)
+        subscriber->Disconnect();
+
+    // Rates are based on the publication window, or the receive window when draining took longer
+    const float64_t rateTime = max(publishTime, receiveTime);
+    vector<pair<float64_t, int32_t>> threadCPUTimes;
+    float64_t processCPUTime = 0.0;
+
+    for (const auto& stopCPUTime : stopCPUTimes)
+    {
+        const auto startCPUTime = startCPUTimes.find(stopCPUTime.first);
+        const float64_t cpuTime = stopCPUTime.second - (startCPUTime == startCPUTimes.end() ? 0.0 : startCPUTime->second);
+
+        processCPUTime += cpuTime;
+        threadCPUTimes.emplace_back(cpuTime, stopCPUTime.first);
+    }
+
+    sort(threadCPUTimes.rbegin(), threadCPUTimes.rend());
+
+    const bool hasCPUTimes = !threadCPUTimes.empty();
+    const string processCPU = hasCPUTimes ? ToString(processCPUTime / elapsedTime * 100.0) : "";
+    const string maximumThreadCPU = hasCPUTimes ? ToString(threadCPUTimes.front().first / elapsedTime * 100.0) : "";
+
+    output << mode.Name << "," << options.SubscriberCount << "," << metadata.size() << "," << options.FrameRate << "," << publishTime << ","
+           << valuesPublished << "," << valuesReceived << "," << valuesReceived / rateTime << "," << bytesReceived / rateTime << ","
+           << latency.Percentile(50.0) << "," << latency.Percentile(99.0) << "," << latency.Percentile(99.9) << "," << latency.Maximum() << ","
+           << processCPU << "," << maximumThreadCPU << "," << threadCPUTimes.size() << endl;
+
+    cerr << "    " << valuesReceived / rateTime << " values/s, " << bytesReceived / rateTime / 1.0E6 << " MB/s, latency p50/p99/p99.9: "
+         << latency.Percentile(50.0) << "/" << latency.Percentile(99.0) << "/" << latency.Percentile(99.9) << " us" << endl;
+
+    cerr << "    Encode: " << publicationRates.EncodeTimePerPacket << " us/packet (" << publicationRates.MeasurementsPerPacket << " values/packet), socket wait: "
+         << publicationRates.SocketWaitTimePerWrite << " us/write, decode: " << subscriptionRates.DecodeTimePerPacket << " us/packet" << endl;
+
+    if (hasCPUTimes)
+    {
+        cerr << "    CPU: " << processCPU << "% process, busiest threads:";
+
+        for (size_t i = 0; i < threadCPUTimes.size() && i < 5; i++)
+            cerr << " " << threadCPUTimes[i].second << "=" << threadCPUTimes[i].first / elapsedTime * 100.0 << "%";
+
+        cerr << endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    HarnessOptions options;
+
+    for (int32_t i = 1; i < argc; i++)
+    {
+        const string argument = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (argument == "--subscribers" && hasValue)
+            options.SubscriberCount = max(1U, static_cast<uint32_t>(stoul(argv[++i])));
+        else if (argument == "--signals" && hasValue)
+            options.SignalCount = min(65535U, max(1U, static_cast<uint32_t>(stoul(argv[++i]))));
+        else if (argument == "--rate" && hasValue)
+            options.FrameRate = stod(argv[++i]);
+        else if (argument == "--duration" && hasValue)
+            options.Duration = stod(argv[++i]);
+        else if (argument == "--throttled-interval" && hasValue)
+            options.ThrottledInterval = stod(argv[++i]);
+        else if (argument == "--modes" && hasValue)
+            options.Modes = argv[++i];
+        else if (argument == "--port" && hasValue)
+            options.Port = static_cast<uint16_t>(stoul(argv[++i]));
+        else if (argument == "--output" && hasValue)
+            options.OutputFileName = argv[++i];
+        else
+        {
+            cerr << "Usage: " << argv[0] << " [--subscribers <count>] [--signals <count>] [--rate <frames per second, 0 = maximum>]" << endl;
+            cerr << "       [--duration <seconds>] [--throttled-interval <seconds>] [--modes <name substring>] [--port <port>] [--output <file name>]" << endl;
+            return 1;
+        }
+    }
+
+    ofstream outputFile;
+
+    if (!options.OutputFileName.empty())
+    {
+        outputFile.open(options.OutputFileName);
+
+        if (!outputFile)
+        {
+            cerr << "Failed to open output file \"" << options.OutputFileName << "\"" << endl;
+            return 1;
+        }
+    }
+
+    ostream& output = options.OutputFileName.empty() ? cout : outputFile;
+
+    // Publisher is shared by all modes, subscribers are created for each mode
+    const DataPublisherPtr publisher = NewSharedPtr<DataPublisher, uint16_t>(options.Port);
+
+    publisher->RegisterErrorMessageCallback([](DataPublisher*, const string& message)
+    {
+        cerr << "    Publisher error: " << message << endl;
+    });
+
+    const vector<MeasurementMetadataPtr> metadata = DefineSyntheticMetadata(publisher, options.SignalCount);
+
+    output << "mode,subscribers,signals,frame_rate,duration_s,values_published,values_received,values_per_second,bytes_per_second,"
+           << "latency_p50_us,latency_p99_us,latency_p999_us,latency_max_us,process_cpu_percent,max_thread_cpu_percent,threads" << endl;
+
+    for (const HarnessMode& mode : GetHarnessModes())
+    {
+        if (!options.Modes.empty() && mode.Name.find(options.Modes) == string::npos)
+            continue;
+
+        try
+        {
+            RunMode(options, mode, publisher, metadata, output);
+        }
+        catch (const std::exception& ex)
+        {
+            cerr << "    Failed to run " << mode.Name << ": " << ex.what() << endl;
+        }
+
+        // Let publisher finish tearing down connections before the next mode
+        this_thread::sleep_for(chrono::milliseconds(500));
+    }
+
+    cerr << "Loopback runs complete." << endl;
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+//******************************************************************************************************
+//  MetadataTestData.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#pragma once
+
+#include "../Common/CommonTypes.h"
+#include "../Common/Convert.h"
+#include "../Transport/TransportTypes.h"
+
+// Publisher metadata shared by sample tests and harnesses that run a local publisher
+
+// Creates a gateway transport device, name defaults to acronym
+inline GSF::TimeSeries::DeviceMetadataPtr CreateDevice(const std::string& acronym, uint16_t accessID, const std::string& name = {})
+{
+    GSF::TimeSeries::DeviceMetadataPtr device = GSF::NewSharedPtr<GSF::TimeSeries::DeviceMetadata>();
+
+    device->Acronym = acronym;
+    device->Name = name.empty() ? acronym : name;
+    device->UniqueID = GSF::NewGuid();
+    device->AccessID = accessID;
+    device->ProtocolName = "GatewayTransport";
+    device->FramesPerSecond = 30;
+    device->CompanyAcronym = "GPA";
+    device->Longitude = 0.0;
+    device->Latitude = 0.0;
+    device->UpdatedOn = GSF::UtcNow();
+
+    return device;
+}
+
+// Creates analog value number of device, measurement ID defaults to "TEST:<number>"
+inline GSF::TimeSeries::MeasurementMetadataPtr CreateMeasurement(uint32_t number, const std::string& deviceAcronym, const std::string& id = {})
+{
+    GSF::TimeSeries::MeasurementMetadataPtr measurement = GSF::NewSharedPtr<GSF::TimeSeries::MeasurementMetadata>();
+    const std::string signalName = "AV" + GSF::ToString(number);
+
+    measurement->DeviceAcronym = deviceAcronym;
+    measurement->ID = id.empty() ? "TEST:" + GSF::ToString(number) : id;
+    measurement->SignalID = GSF::NewGuid();
+    measurement->PointTag = deviceAcronym + ":" + signalName;
+    measurement->Reference = GSF::TimeSeries::SignalReference(deviceAcronym + "-" + signalName);
+    measurement->PhasorSourceIndex = 0;
+    measurement->Description = deviceAcronym + " analog value " + GSF::ToString(number);
+    measurement->UpdatedOn = GSF::UtcNow();
+
+    return measurement;
+}
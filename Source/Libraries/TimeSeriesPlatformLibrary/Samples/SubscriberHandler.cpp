@@ -127,6 +127,9 @@ void SubscriberHandler::ParsedMetadata()
 void SubscriberHandler::ReceivedNewMeasurements(const vector<MeasurementPtr>& measurements)
 {
     // TODO: The following code could be used to generate frame based output, e.g., for IEEE C37.118
+    // Get index of resolved metadata for received runtime IDs, hold reference for entire batch
+    //const SignalMetadataIndexPtr signalMetadataIndex = GetSignalMetadataIndex();
+
     // Start processing measurements
     //for (auto &measurement : measurements)
     //{
@@ -139,28 +142,25 @@ void SubscriberHandler::ReceivedNewMeasurements(const vector<MeasurementPtr>& me
     //    // Handle per measurement quality flags
     //    int32_t qualityFlags = measurement->Flags;
 
-    //    ConfigurationFramePtr configurationFrame;
-    //    MeasurementMetadataPtr measurementMetadata;
+    //    const SignalMetadataReference* signalReference;
 
-    //    // Find associated configuration for measurement
-    //    if (TryFindTargetConfigurationFrame(measurement->SignalID, configurationFrame))
+    //    // Lookup measurement metadata and associated configuration frame by runtime ID
+    //    if (signalMetadataIndex && signalMetadataIndex->TryGetReference(*measurement, signalReference))
     //    {
-    //        // Lookup measurement metadata - it's faster to find metadata from within configuration frame
-    //        if (TryGetMeasurementMetdataFromConfigurationFrame(measurement->SignalID, configurationFrame, measurementMetadata))
-    //        {
-    //            const SignalReference& reference = measurementMetadata->Reference;
+    //        const SignalReference& reference = signalReference->Metadata->Reference;
 
-    //            // reference.Acronym	<< target device acronym 
-    //            // reference.Kind		<< kind of signal (see SignalKind in "Types.h"), like Frequency, Angle, etc
-    //            // reference.Index    << for Phasors, Analogs and Digitals - this is the ordered "index"
+    //        // reference.Acronym	<< target device acronym 
+    //        // reference.Kind		<< kind of signal (see SignalKind in "Types.h"), like Frequency, Angle, etc
+    //        // reference.Index    << for Phasors, Analogs and Digitals - this is the ordered "index"
 
+    //        if (signalReference->Frame != nullptr)
+    //        {
     //            // TODO: Handle measurement processing here...
     //        }
-    //    }
-    //    else if (TryGetMeasurementMetdata(measurement->SignalID, measurementMetadata))
-    //    {
-    //        // Received measurement is not part of a defined configuration frame, e.g., a statistic
-    //        const SignalReference& reference = measurementMetadata->Reference;
+    //        else
+    //        {
+    //            // Received measurement is not part of a defined configuration frame, e.g., a statistic
+    //        }
     //    }
     //}
 
@@ -0,0 +1,433 @@
+//******************************************************************************************************
+//  SubscriptionUpdateTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <cassert>
+#include "../Transport/DataPublisher.h"
+#include "../Transport/DataSubscriber.h"
+#include "../Transport/SubscriberInstance.h"
+#include "MetadataTestData.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// Verifies that publisher metadata changes re-evaluate subscriptions against changed rows only,
+// keeping runtime IDs of unaffected signals stable, over a local publisher to subscriber loopback
+
+struct TestMode
+{
+    string Name;
+    bool CompressPayload;
+    uint32_t CompressionMode;
+};
+
+struct TestState
+{
+    Mutex Lock;
+    vector<MeasurementMetadataPtr> Measurements;
+    unordered_set<Guid> Received[2];
+    atomic<int32_t> Resets { 0 };
+    atomic<int32_t> Subscribes { 0 };
+    atomic<int32_t> Updates { 0 };
+    atomic<int32_t> Errors { 0 };
+};
+
+// Gets runtime IDs assigned by the publisher to the connection with the given subscribed signal count
+unordered_map<Guid, uint16_t> GetRuntimeIDs(const DataPublisherPtr& publisher, uint32_t signalCount)
+{
+    unordered_map<Guid, uint16_t> runtimeIDs;
+
+    publisher->IterateSubscriberConnections([&](const SubscriberConnectionPtr& connection, void*)
+    {
+        const SignalIndexCachePtr signalIndexCache = connection->GetSignalIndexCache();
+
+        if (signalIndexCache == nullptr || signalIndexCache->Count() != signalCount)
+            return;
+
+        for (uint32_t i = 0; i < signalIndexCache->GetSignalIndexCapacity(); i++)
+        {
+            const uint16_t signalIndex = static_cast<uint16_t>(i);
+
+            if (signalIndexCache->Contains(signalIndex))
+                runtimeIDs.emplace(signalIndexCache->GetSignalID(signalIndex), signalIndex);
+        }
+    },
+    nullptr);
+
+    return runtimeIDs;
+}
+
+void ClearReceived(TestState& state)
+{
+    ScopeLock lock(state.Lock);
+    state.Received[0].clear();
+    state.Received[1].clear();
+}
+
+// Waits until condition is true, returns false if timeout elapses first
+bool WaitFor(const function<bool()>& condition, int32_t timeout = 5000)
+{
+    for (int32_t elapsed = 0; !condition(); elapsed += 10)
+    {
+        if (elapsed >= timeout)
+            return false;
+
+        this_thread::sleep_for(chrono::milliseconds(10));
+    }
+
+    return true;
+}
+
+// Creates a publisher counting compression resets, subscribes and subscription updates, with 10
+// measurements defined for each of DEV1 and DEV2
+DataPublisherPtr CreatePublisher(TestState& state, const vector<DeviceMetadataPtr>& devices, uint16_t port)
+{
+    DataPublisherPtr publisher = NewSharedPtr<DataPublisher>(port);
+
+    publisher->RegisterStatusMessageCallback([&state](DataPublisher*, const string& message)
+    {
+        if (message.find("reset") != string::npos)
+            state.Resets++;
+
+        if (message.find("Client subscribed") != string::npos)
+            state.Subscribes++;
+
+        if (message.find("Updated subscription") != string::npos)
+            state.Updates++;
+    });
+
+    publisher->RegisterErrorMessageCallback([&state](DataPublisher*, const string& message)
+    {
+        cerr << "    Publisher error: " << message << endl;
+        state.Errors++;
+    });
+
+    for (uint32_t i = 1; i <= 20; i++)
+        state.Measurements.push_back(CreateMeasurement(i, i <= 10 ? "DEV1" : "DEV2"));
+
+    publisher->DefineMetadata(devices, state.Measurements, vector<PhasorMetadataPtr>());
+
+    return publisher;
+}
+
+// Publishes a value for every defined measurement until stopped
+void PublishMeasurements(const DataPublisherPtr& publisher, TestState& state, const atomic<bool>& publishing)
+{
+    float64_t value = 0.0;
+
+    while (publishing)
+    {
+        vector<Measurement> measurements;
+
+        // Constrain lock to measurement list copy
+        {
+            ScopeLock lock(state.Lock);
+
+            for (const MeasurementMetadataPtr& metadata : state.Measurements)
+            {
+                Measurement measurement;
+                measurement.SignalID = metadata->SignalID;
+                measurement.Value = value;
+                measurement.Timestamp = ToTicks(UtcNow());
+                measurements.push_back(measurement);
+            }
+        }
+
+        publisher->PublishMeasurements(measurements);
+        value += 1.0;
+
+        this_thread::sleep_for(chrono::milliseconds(5));
+    }
+}
+
+int32_t RunTests(const TestMode& mode, uint16_t port, int32_t test)
+{
+    TestState state;
+    const vector<DeviceMetadataPtr> devices = { CreateDevice("DEV1", 1), CreateDevice("DEV2", 2) };
+    const DataPublisherPtr publisher = CreatePublisher(state, devices, port);
+    atomic<bool> publishing(true);
+
+    Thread publisherThread([&] { PublishMeasurements(publisher, state, publishing); });
+
+    // First subscriber filter matches rows independently, second depends on the full row set
+    const string filterExpressions[2] =
+    {
+        "FILTER ActiveMeasurements WHERE Device = 'DEV1'",
+        "FILTER TOP 3 ActiveMeasurements WHERE Device = 'DEV1' ORDER BY PointTag DESC"
+    };
+
+    DataSubscriberPtr subscribers[2];
+
+    for (int32_t i = 0; i < 2; i++)
+    {
+        subscribers[i] = NewSharedPtr<DataSubscriber>();
+
+        subscribers[i]->RegisterNewMeasurementsCallback([&state, i](DataSubscriber*, const vector<MeasurementPtr>& measurements)
+        {
+            ScopeLock lock(state.Lock);
+
+            for (const MeasurementPtr& measurement : measurements)
+                state.Received[i].insert(measurement->SignalID);
+        });
+
+        subscribers[i]->RegisterErrorMessageCallback([&state](DataSubscriber*, const string& message)
+        {
+            cerr << "    Subscriber error: " << message << endl;
+            state.Errors++;
+        });
+
+        subscribers[i]->SetPayloadDataCompressed(mode.CompressPayload);
+
+        if (mode.CompressPayload)
+            subscribers[i]->SetPayloadCompressionMode(mode.CompressionMode);
+
+        SubscriptionInfo info;
+        info.FilterExpression = filterExpressions[i];
+
+        subscribers[i]->Connect("localhost", port);
+        subscribers[i]->Subscribe(info);
+    }
+
+    this_thread::sleep_for(chrono::milliseconds(500));
+
+    // Test initial subscriptions
+    const unordered_map<Guid, uint16_t> initialRuntimeIDs = GetRuntimeIDs(publisher, 10);
+    assert(initialRuntimeIDs.size() == 10);
+    assert(GetRuntimeIDs(publisher, 3).size() == 3);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Remove TEST:1, move TEST:11 into DEV1, change TEST:5 point tag and add TEST:21 to DEV1
+    const int32_t resets = state.Resets;
+    const int32_t updates = state.Updates;
+    const MeasurementMetadataPtr removed = state.Measurements[0];
+    const MeasurementMetadataPtr moved = state.Measurements[10];
+    const MeasurementMetadataPtr changed = state.Measurements[4];
+    const MeasurementMetadataPtr added = CreateMeasurement(21, "DEV1");
+
+    // Constrain lock to metadata changes
+    {
+        ScopeLock lock(state.Lock);
+        state.Measurements.erase(state.Measurements.begin());
+        moved->DeviceAcronym = "DEV1";
+        changed->PointTag = "DEV1:ZZ";
+        state.Measurements.push_back(added);
+    }
+
+    publisher->DefineMetadata(devices, state.Measurements, vector<PhasorMetadataPtr>());
+    this_thread::sleep_for(chrono::milliseconds(300));
+    ClearReceived(state);
+    this_thread::sleep_for(chrono::milliseconds(300));
+
+    // Test runtime IDs of unaffected signals are stable and a released runtime ID is not reused by a moved signal
+    const unordered_map<Guid, uint16_t> updatedRuntimeIDs = GetRuntimeIDs(publisher, 11);
+    assert(updatedRuntimeIDs.size() == 11);
+    assert(updatedRuntimeIDs.count(removed->SignalID) == 0);
+    assert(updatedRuntimeIDs.count(moved->SignalID) == 1);
+    assert(updatedRuntimeIDs.count(added->SignalID) == 1);
+
+    for (const auto& pair : initialRuntimeIDs)
+    {
+        if (pair.first != removed->SignalID)
+            assert(updatedRuntimeIDs.at(pair.first) == pair.second);
+    }
+
+    assert(updatedRuntimeIDs.at(moved->SignalID) != initialRuntimeIDs.at(removed->SignalID));
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test compression state survived the update
+    assert(state.Resets == resets);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test subscribers receive the updated sets, TOP and ORDER BY filter falls back on full evaluation
+    {
+        ScopeLock lock(state.Lock);
+        assert(state.Received[0].size() == 11);
+        assert(state.Received[0].count(removed->SignalID) == 0);
+        assert(state.Received[0].count(moved->SignalID) == 1);
+        assert(state.Received[0].count(added->SignalID) == 1);
+
+        // TOP applies to first matches in table order, which shift past the removed signal
+        assert(state.Received[1].size() == 3);
+        assert(state.Received[1].count(removed->SignalID) == 0);
+        assert(state.Received[1].count(state.Measurements[2]->SignalID) == 1);
+    }
+
+    assert(state.Updates > updates);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test unchanged metadata does not update subscriptions
+    const int32_t updated = state.Updates;
+    publisher->DefineMetadata(devices, state.Measurements, vector<PhasorMetadataPtr>());
+    this_thread::sleep_for(chrono::milliseconds(200));
+    assert(state.Updates == updated);
+    assert(state.Errors == 0);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    publishing = false;
+    publisherThread.join();
+
+    for (const DataSubscriberPtr& subscriber : subscribers)
+        subscriber->Disconnect();
+
+    return test;
+}
+
+// Subscriber instance that records received signals, metadata and configuration change notifications
+class TestSubscriberInstance : public SubscriberInstance
+{
+private:
+    TestState& m_state;
+
+public:
+    atomic<int32_t> ParsedMetadataCount { 0 };
+    atomic<int32_t> ConfigurationChangeCount { 0 };
+
+    TestSubscriberInstance(TestState& state) :
+        m_state(state)
+    {
+    }
+
+protected:
+    void StatusMessage(const string&) override
+    {
+    }
+
+    void ErrorMessage(const string& message) override
+    {
+        cerr << "    Subscriber error: " << message << endl;
+        m_state.Errors++;
+    }
+
+    void ParsedMetadata() override
+    {
+        ParsedMetadataCount++;
+    }
+
+    void ConfigurationChanged() override
+    {
+        ConfigurationChangeCount++;
+    }
+
+    void ReceivedNewMeasurements(const vector<MeasurementPtr>& measurements) override
+    {
+        ScopeLock lock(m_state.Lock);
+
+        for (const MeasurementPtr& measurement : measurements)
+            m_state.Received[0].insert(measurement->SignalID);
+    }
+};
+
+// Verifies that a subscriber instance refreshes its metadata after a publisher configuration
+// change without resubscribing, so the incremental subscription update keeps compression state
+int32_t RunInstanceTests(uint16_t port, int32_t test)
+{
+    TestState state;
+    const vector<DeviceMetadataPtr> devices = { CreateDevice("DEV1", 1), CreateDevice("DEV2", 2) };
+    const DataPublisherPtr publisher = CreatePublisher(state, devices, port);
+    atomic<bool> publishing(true);
+
+    Thread publisherThread([&] { PublishMeasurements(publisher, state, publishing); });
+
+    TestSubscriberInstance subscriber(state);
+
+    subscriber.Initialize("localhost", port);
+    subscriber.SetAutoReconnect(false);
+    subscriber.SetFilterExpression("FILTER ActiveMeasurements WHERE Device = 'DEV1'");
+    subscriber.SetPayloadCompressionMode(CompressionModes::TSSC);
+    subscriber.Connect();
+
+    // Test subscription starts after initial metadata
+    assert(WaitFor([&] { ScopeLock lock(state.Lock); return state.Received[0].size() == 10; }));
+    assert(subscriber.ParsedMetadataCount == 1 && subscriber.IsSubscribed());
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Add TEST:21 to DEV1, publisher updates subscription then notifies configuration change
+    const int32_t subscribes = state.Subscribes;
+    const int32_t resets = state.Resets;
+    const MeasurementMetadataPtr added = CreateMeasurement(21, "DEV1");
+
+    // Constrain lock to metadata changes
+    {
+        ScopeLock lock(state.Lock);
+        state.Measurements.push_back(added);
+    }
+
+    publisher->DefineMetadata(devices, state.Measurements, vector<PhasorMetadataPtr>());
+    assert(WaitFor([&] { return subscriber.ParsedMetadataCount == 2; }));
+    this_thread::sleep_for(chrono::milliseconds(300));
+    ClearReceived(state);
+    this_thread::sleep_for(chrono::milliseconds(300));
+
+    // Test refreshed metadata did not resubscribe or reset compression, and added signal is received
+    assert(subscriber.ConfigurationChangeCount == 1);
+    assert(state.Subscribes == subscribes);
+    assert(state.Resets == resets);
+
+    {
+        ScopeLock lock(state.Lock);
+        assert(state.Received[0].size() == 11);
+        assert(state.Received[0].count(added->SignalID) == 1);
+    }
+
+    assert(state.Errors == 0);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    publishing = false;
+    publisherThread.join();
+    subscriber.Disconnect();
+
+    return test;
+}
+
+int main(int argc, char* argv[])
+{
+    const TestMode modes[] =
+    {
+        { "TSSC", true, CompressionModes::TSSC },
+        { "XOR64", true, CompressionModes::XOR64 },
+        { "compact", false, CompressionModes::None }
+    };
+
+    int32_t test = 0;
+    uint16_t port = 7175;
+
+    for (const TestMode& mode : modes)
+    {
+        cout << "Testing subscription updates with " << mode.Name << " payloads:" << endl;
+        test = RunTests(mode, port++, test);
+    }
+
+    cout << "Testing subscriber instance metadata refresh:" << endl;
+    test = RunInstanceTests(port, test);
+
+    cout << endl << "Tests complete. Press enter to exit." << endl;
+    getc(stdin);
+
+    return 0;
+}
@@ -0,0 +1,425 @@
+//******************************************************************************************************
+//  TSSCTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <chrono>
+#include <cassert>
+#include <cstring>
+#include "../Transport/TSSCEncoder.h"
+#include "../Transport/TSSCDecoder.h"
+#include "CodecTestData.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// TSSC encodes 32-bit values, raw value bits are kept so NaN payloads are compared exactly
+typedef BasicTestMeasurement<uint32_t> TSSCMeasurement;
+
+struct TSSCStream
+{
+    vector<TSSCMeasurement> Measurements;
+    uint32_t BlockSize;
+};
+
+// Synchrophasor style stream: fixed point set reported every frame in the same order
+TSSCStream GenerateFrameStream(uint32_t pointCount, uint32_t frameCount, uint64_t seed)
+{
+    TSSCStream stream { {}, BlockSize };
+    Random random(seed);
+    int64_t timestamp = 637000000000000000LL;
+
+    for (uint32_t frame = 0; frame < frameCount; frame++)
+    {
+        // 30 frames per second with occasional jitter
+        timestamp += 333333 + (random.Next(50) == 0 ? random.Next(3) : 0);
+
+        for (uint32_t point = 0; point < pointCount; point++)
+        {
+            float32_t value;
+            uint32_t quality = 0U;
+
+            switch (point % 4)
+            {
+                case 0:
+                    value = 59.95F + random.Next(1000) / 10000.0F;
+                    break;
+                case 1:
+                    value = static_cast<float32_t>(frame * 0.02 + point) - 180.0F;
+                    break;
+                case 2:
+                    value = 131000.0F + random.Next(500);
+                    break;
+                default:
+                    value = frame % 300 < 150 ? 0.0F : 1.0F;
+                    quality = frame % 600 < 580 ? 0U : 0x8000U;
+                    break;
+            }
+
+            stream.Measurements.push_back({ static_cast<uint16_t>(point), timestamp, quality, ToBits(value) });
+        }
+    }
+
+    return stream;
+}
+
+// Sparse runtime IDs in varying order with frequent value reuse
+TSSCStream GenerateSparseStream(uint32_t count, uint64_t seed)
+{
+    TSSCStream stream { {}, BlockSize };
+    Random random(seed);
+    int64_t timestamp = 637100000000000000LL;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (random.Next(20) == 0)
+            timestamp += 10000 * random.Next(100);
+
+        const uint16_t id = static_cast<uint16_t>(random.Next(64) * 1021U % 65536U);
+        const uint32_t selector = random.Next(8);
+        uint32_t valueBits;
+
+        if (selector < 3)
+            valueBits = ToBits(static_cast<float32_t>(id % 7));
+        else if (selector < 5)
+            valueBits = ToBits(static_cast<float32_t>(id) + random.Next(4) * 0.5F);
+        else
+            valueBits = random.NextUInt32();
+
+        stream.Measurements.push_back({ id, timestamp, random.Next(10) == 0 ? random.NextUInt32() : 0U, valueBits });
+    }
+
+    return stream;
+}
+
+// Edge cases: reverse and repeated timestamps, large time jumps, zero, NaN and infinity
+// values, full range IDs and quality flags. Uses small blocks to exercise block boundaries.
+TSSCStream GenerateEdgeStream(uint32_t count, uint64_t seed)
+{
+    TSSCStream stream { {}, 1024U };
+    Random random(seed);
+    int64_t timestamp = 0LL;
+    int64_t previousTimestamp = 0LL;
+
+    const uint32_t specialValues[] = { 0x00000000U, 0x80000000U, 0x7FC00000U, 0x7F800000U, 0xFF800000U, 0x00000001U, 0xFFFFFFFFU };
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const int64_t currentTimestamp = timestamp;
+
+        switch (random.Next(8))
+        {
+            case 0:
+                timestamp -= random.Next(1000);
+                break;
+            case 1:
+                timestamp = previousTimestamp;
+                break;
+            case 2:
+                timestamp += static_cast<int64_t>(random.NextUInt32()) << random.Next(31);
+                break;
+            case 3:
+                timestamp += 10000;
+                break;
+            default:
+                break;
+        }
+
+        previousTimestamp = currentTimestamp;
+
+        const uint16_t id = static_cast<uint16_t>(random.Next(4) == 0 ? random.Next(65536) : random.Next(16));
+        const uint32_t valueBits = random.Next(3) == 0 ? specialValues[random.Next(7)] : random.NextUInt32() >> random.Next(32);
+        const uint32_t quality = random.Next(4) == 0 ? random.NextUInt32() >> random.Next(32) : 0U;
+
+        stream.Measurements.push_back({ id, timestamp, quality, valueBits });
+    }
+
+    return stream;
+}
+
+vector<TSSCStream> GenerateTestStreams()
+{
+    vector<TSSCStream> streams;
+
+    streams.push_back(GenerateFrameStream(120, 100, 1));
+    streams.push_back(GenerateSparseStream(5000, 2));
+    streams.push_back(GenerateEdgeStream(5000, 3));
+
+    return streams;
+}
+
+// Encodes a stream into blocks the same way the publisher does, encoder is reset per stream
+vector<vector<uint8_t>> Encode(TSSCEncoder& encoder, const TSSCStream& stream)
+{
+    vector<vector<uint8_t>> blocks;
+    vector<uint8_t> buffer(stream.BlockSize);
+
+    const auto finishBlock = [&]()
+    {
+        const uint32_t length = encoder.FinishBlock();
+        blocks.emplace_back(buffer.begin(), buffer.begin() + length);
+    };
+
+    encoder.Reset();
+    encoder.SetBuffer(buffer.data(), 0, stream.BlockSize);
+
+    for (const auto& measurement : stream.Measurements)
+    {
+        float32_t value;
+        memcpy(&value, &measurement.Value, sizeof(float32_t));
+
+        if (!encoder.TryAddMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, value))
+        {
+            finishBlock();
+            encoder.SetBuffer(buffer.data(), 0, stream.BlockSize);
+            encoder.TryAddMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, value);
+        }
+    }
+
+    finishBlock();
+
+    return blocks;
+}
+
+vector<TSSCMeasurement> Decode(TSSCDecoder& decoder, vector<vector<uint8_t>>& blocks)
+{
+    vector<TSSCMeasurement> measurements;
+    TSSCMeasurement measurement {};
+    float32_t value;
+
+    decoder.Reset();
+
+    for (auto& block : blocks)
+    {
+        decoder.SetBuffer(block.data(), 0, static_cast<uint32_t>(block.size()));
+
+        while (decoder.TryGetMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, value))
+        {
+            measurement.Value = ToBits(value);
+            measurements.push_back(measurement);
+        }
+    }
+
+    return measurements;
+}
+
+bool Equals(const vector<TSSCMeasurement>& left, const vector<TSSCMeasurement>& right)
+{
+    if (left.size() != right.size())
+        return false;
+
+    for (size_t i = 0; i < left.size(); i++)
+    {
+        if (left[i].ID != right[i].ID || left[i].Timestamp != right[i].Timestamp || left[i].Quality != right[i].Quality || left[i].Value != right[i].Value)
+            return false;
+    }
+
+    return true;
+}
+
+// Corpus format: stream count, then for each stream a block count followed by length prefixed blocks, all little-endian
+typedef vector<vector<vector<uint8_t>>> Corpus;
+
+void WriteCorpus(const string& fileName, const Corpus& corpus)
+{
+    ofstream stream(fileName, ios::binary);
+
+    const auto write = [&](uint32_t value) { stream.write(reinterpret_cast<const char*>(&value), sizeof(uint32_t)); };
+
+    write(static_cast<uint32_t>(corpus.size()));
+
+    for (const auto& blocks : corpus)
+    {
+        write(static_cast<uint32_t>(blocks.size()));
+
+        for (const auto& block : blocks)
+        {
+            write(static_cast<uint32_t>(block.size()));
+            stream.write(reinterpret_cast<const char*>(block.data()), block.size());
+        }
+    }
+}
+
+bool TryReadCorpus(const string& fileName, Corpus& corpus)
+{
+    ifstream stream(fileName, ios::binary);
+
+    if (!stream)
+        return false;
+
+    const auto read = [&]() { uint32_t value = 0; stream.read(reinterpret_cast<char*>(&value), sizeof(uint32_t)); return value; };
+
+    corpus.resize(read());
+
+    for (auto& blocks : corpus)
+    {
+        blocks.resize(read());
+
+        for (auto& block : blocks)
+        {
+            block.resize(read());
+            stream.read(reinterpret_cast<char*>(block.data()), block.size());
+        }
+    }
+
+    return static_cast<bool>(stream);
+}
+
+// Decodes all blocks without storing measurements, returns number of measurements decoded
+size_t DecodeCount(TSSCDecoder& decoder, vector<vector<uint8_t>>& blocks)
+{
+    TSSCMeasurement measurement {};
+    float32_t value;
+    size_t count = 0;
+
+    decoder.Reset();
+
+    for (auto& block : blocks)
+    {
+        decoder.SetBuffer(block.data(), 0, static_cast<uint32_t>(block.size()));
+
+        while (decoder.TryGetMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, value))
+            count++;
+    }
+
+    return count;
+}
+
+void Benchmark()
+{
+    const TSSCStream stream = GenerateFrameStream(1000, 1000, 4);
+    const float64_t count = static_cast<float64_t>(stream.Measurements.size());
+    TSSCEncoder encoder;
+    TSSCDecoder decoder;
+    vector<vector<uint8_t>> blocks;
+    float64_t encodeTime = numeric_limits<float64_t>::max();
+    float64_t decodeTime = numeric_limits<float64_t>::max();
+    size_t encodedSize = 0;
+
+    for (int32_t i = 0; i < 5; i++)
+    {
+        auto startTime = chrono::steady_clock::now();
+        blocks = Encode(encoder, stream);
+        encodeTime = min(encodeTime, chrono::duration<float64_t>(chrono::steady_clock::now() - startTime).count());
+
+        startTime = chrono::steady_clock::now();
+        const size_t decodedCount = DecodeCount(decoder, blocks);
+        decodeTime = min(decodeTime, chrono::duration<float64_t>(chrono::steady_clock::now() - startTime).count());
+
+        assert(decodedCount == stream.Measurements.size());
+    }
+
+    for (const auto& block : blocks)
+        encodedSize += block.size();
+
+    assert(Equals(Decode(decoder, blocks), stream.Measurements));
+
+    cout << "Benchmark: " << stream.Measurements.size() << " measurements, " << encodedSize / count << " bytes per measurement" << endl;
+    cout << "    Encode: " << count / encodeTime / 1e6 << " million measurements per second" << endl;
+    cout << "    Decode: " << count / decodeTime / 1e6 << " million measurements per second" << endl;
+}
+
+// Sample application to test TSSC compression compatibility and performance. Encoded test
+// streams are compared to a corpus produced by the reference encoder, any change to the
+// TSSC wire format will fail these tests. Run with "--generate" to write a new corpus.
+int main(int argc, char* argv[])
+{
+    const string corpusFileName = "TSSCCorpus.bin";
+    const vector<TSSCStream> streams = GenerateTestStreams();
+    TSSCEncoder encoder;
+    TSSCDecoder decoder;
+    Corpus corpus;
+    int32_t test = 0;
+
+    if (argc > 1 && string(argv[1]) == "--generate")
+    {
+        for (const auto& stream : streams)
+            corpus.push_back(Encode(encoder, stream));
+
+        WriteCorpus(corpusFileName, corpus);
+        cout << "Generated " << corpusFileName << endl;
+        return 0;
+    }
+
+    if (!TryReadCorpus(corpusFileName, corpus) || corpus.size() != streams.size())
+    {
+        cerr << "Failed to read " << corpusFileName << endl;
+        return 1;
+    }
+
+    for (size_t i = 0; i < streams.size(); i++)
+    {
+        // Test encoded output matches reference encoder bit-for-bit
+        assert(Encode(encoder, streams[i]) == corpus[i]);
+        cout << "Test " << ++test << " succeeded..." << endl;
+
+        // Test reference encoded output decodes to original measurements
+        assert(Equals(Decode(decoder, corpus[i]), streams[i].Measurements));
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test encoder and decoder state carries across streams without reset
+    vector<vector<uint8_t>> blocks = Encode(encoder, streams[0]);
+    vector<uint8_t> buffer(BlockSize);
+    vector<TSSCMeasurement> decoded = Decode(decoder, blocks);
+
+    encoder.SetBuffer(buffer.data(), 0, BlockSize);
+
+    for (const auto& measurement : streams[1].Measurements)
+    {
+        float32_t value;
+        memcpy(&value, &measurement.Value, sizeof(float32_t));
+
+        if (!encoder.TryAddMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, value))
+            break;
+    }
+
+    buffer.resize(encoder.FinishBlock());
+    decoder.SetBuffer(buffer.data(), 0, static_cast<uint32_t>(buffer.size()));
+
+    TSSCMeasurement measurement {};
+    float32_t value;
+    size_t index = 0;
+
+    while (decoder.TryGetMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, value))
+    {
+        const TSSCMeasurement& expected = streams[1].Measurements[index++];
+        assert(measurement.ID == expected.ID && measurement.Timestamp == expected.Timestamp && measurement.Quality == expected.Quality && ToBits(value) == expected.Value);
+    }
+
+    assert(index > 0);
+    cout << "Test " << ++test << " succeeded..." << endl;
+    cout << endl;
+
+    Benchmark();
+
+    // Wait until the user presses enter before quitting.
+    cout << endl << "Tests complete. Press enter to exit." << endl;
+    string line;
+    getline(cin, line);
+
+    return 0;
+}
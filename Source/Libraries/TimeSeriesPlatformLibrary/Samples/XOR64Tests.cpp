@@ -0,0 +1,302 @@
+//******************************************************************************************************
+//  XOR64Tests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#include <iostream>
+#include <string>
+#include <chrono>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include "../Transport/TSSCEncoder.h"
+#include "../Transport/TSSCDecoder.h"
+#include "../Transport/XOR64Encoder.h"
+#include "../Transport/XOR64Decoder.h"
+#include "CodecTestData.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// Full-precision stream: revenue meter accumulators and high-resolution frequency
+TestStream GeneratePrecisionStream(uint32_t pointCount, uint32_t frameCount, uint64_t seed)
+{
+    TestStream stream;
+    Random random(seed);
+    vector<float64_t> energy(pointCount, 1.0e6);
+    int64_t timestamp = 637000000000000000LL;
+
+    for (uint32_t frame = 0; frame < frameCount; frame++)
+    {
+        timestamp += 333333 + (random.Next(50) == 0 ? random.Next(3) : 0);
+
+        for (uint32_t point = 0; point < pointCount; point++)
+        {
+            float64_t value;
+
+            if (point % 2 == 0)
+            {
+                energy[point] += 0.0027777777777777779 * (1.0 + random.Next(100) / 1000.0);
+                value = energy[point];
+            }
+            else
+            {
+                value = 59.999 + random.Next(20000) / 10000000.0;
+            }
+
+            stream.push_back({ static_cast<uint16_t>(point), timestamp, 0U, value });
+        }
+    }
+
+    return stream;
+}
+
+// Boundary values, timestamps, qualities and IDs in random order
+TestStream GenerateEdgeStream(uint32_t count, uint64_t seed)
+{
+    static const float64_t values[] =
+    {
+        0.0, -0.0, 1.0, -1.0, NAN, INFINITY, -INFINITY, 5e-324, 1.7976931348623157e308, 3.14159265358979312
+    };
+
+    static const int64_t timestamps[] =
+    {
+        0LL, 1LL, -1LL, Int64::MaxValue, Int64::MinValue, 637000000000000000LL, 637000000000000000LL + 0xFFFFFFFFLL
+    };
+
+    TestStream stream;
+    Random random(seed);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const uint16_t id = random.Next(4) == 0 ? static_cast<uint16_t>(random.Next(65536)) : static_cast<uint16_t>(random.Next(16));
+        const int64_t timestamp = random.Next(3) == 0 ? timestamps[random.Next(7)] : static_cast<int64_t>(random.Next());
+        const uint32_t quality = random.Next(5) == 0 ? static_cast<uint32_t>(random.Next()) : 0U;
+        float64_t value;
+
+        if (random.Next(3) == 0)
+        {
+            value = values[random.Next(10)];
+        }
+        else
+        {
+            const uint64_t bits = random.Next();
+            memcpy(&value, &bits, sizeof(float64_t));
+        }
+
+        stream.push_back({ id, timestamp, quality, value });
+    }
+
+    return stream;
+}
+
+// Encodes a stream into blocks the same way the publisher does, encoder is reset per stream
+template<typename TEncoder, typename TValue>
+vector<vector<uint8_t>> Encode(TEncoder& encoder, const TestStream& stream, uint32_t blockSize = BlockSize)
+{
+    vector<vector<uint8_t>> blocks;
+    vector<uint8_t> buffer(blockSize);
+
+    const auto finishBlock = [&]()
+    {
+        const uint32_t length = encoder.FinishBlock();
+        blocks.emplace_back(buffer.begin(), buffer.begin() + length);
+    };
+
+    encoder.Reset();
+    encoder.SetBuffer(buffer.data(), 0, blockSize);
+
+    for (const auto& measurement : stream)
+    {
+        const TValue value = static_cast<TValue>(measurement.Value);
+
+        if (!encoder.TryAddMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, value))
+        {
+            finishBlock();
+            encoder.SetBuffer(buffer.data(), 0, blockSize);
+            encoder.TryAddMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, value);
+        }
+    }
+
+    finishBlock();
+
+    return blocks;
+}
+
+template<typename TDecoder, typename TValue>
+TestStream Decode(TDecoder& decoder, vector<vector<uint8_t>>& blocks)
+{
+    TestStream measurements;
+    TestMeasurement measurement {};
+    TValue value;
+
+    decoder.Reset();
+
+    for (auto& block : blocks)
+    {
+        decoder.SetBuffer(block.data(), 0, static_cast<uint32_t>(block.size()));
+
+        while (decoder.TryGetMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, value))
+        {
+            measurement.Value = value;
+            measurements.push_back(measurement);
+        }
+    }
+
+    return measurements;
+}
+
+// Compares value bits so NaN and negative zero must round-trip exactly
+bool Equals(const TestStream& left, const TestStream& right)
+{
+    if (left.size() != right.size())
+        return false;
+
+    for (size_t i = 0; i < left.size(); i++)
+    {
+        const TestMeasurement& x = left[i];
+        const TestMeasurement& y = right[i];
+
+        if (x.ID != y.ID || x.Timestamp != y.Timestamp || x.Quality != y.Quality || ToBits(x.Value) != ToBits(y.Value))
+            return false;
+    }
+
+    return true;
+}
+
+size_t EncodedSize(const vector<vector<uint8_t>>& blocks)
+{
+    size_t size = 0;
+
+    for (const auto& block : blocks)
+        size += block.size();
+
+    return size;
+}
+
+// Measures bytes per value and nanoseconds per value for encode and decode, best of five runs
+template<typename TEncoder, typename TDecoder, typename TValue>
+void Benchmark(const string& codec, const TestStream& stream)
+{
+    const float64_t count = static_cast<float64_t>(stream.size());
+    TEncoder encoder;
+    TDecoder decoder;
+    vector<vector<uint8_t>> blocks;
+    TestStream decoded;
+    float64_t encodeTime = numeric_limits<float64_t>::max();
+    float64_t decodeTime = numeric_limits<float64_t>::max();
+    size_t exactCount = 0;
+
+    for (int32_t i = 0; i < 5; i++)
+    {
+        auto startTime = chrono::steady_clock::now();
+        blocks = Encode<TEncoder, TValue>(encoder, stream);
+        encodeTime = min(encodeTime, chrono::duration<float64_t>(chrono::steady_clock::now() - startTime).count());
+
+        startTime = chrono::steady_clock::now();
+        decoded = Decode<TDecoder, TValue>(decoder, blocks);
+        decodeTime = min(decodeTime, chrono::duration<float64_t>(chrono::steady_clock::now() - startTime).count());
+
+        assert(decoded.size() == stream.size());
+    }
+
+    for (size_t i = 0; i < stream.size(); i++)
+    {
+        if (ToBits(decoded[i].Value) == ToBits(stream[i].Value))
+            exactCount++;
+    }
+
+    cout << "    " << codec << ": " << EncodedSize(blocks) / count << " bytes/value, ";
+    cout << encodeTime / count * 1e9 << " ns/value encode, ";
+    cout << decodeTime / count * 1e9 << " ns/value decode, ";
+    cout << exactCount * 100.0 / count << "% values exact" << endl;
+}
+
+void Benchmark(const string& name, const TestStream& stream)
+{
+    cout << "Benchmark: " << name << ", " << stream.size() << " measurements" << endl;
+    Benchmark<TSSCEncoder, TSSCDecoder, float32_t>(" TSSC", stream);
+    Benchmark<XOR64Encoder, XOR64Decoder, float64_t>("XOR64", stream);
+}
+
+// Sample application to test XOR64 compression round-trips full-precision values and
+// to compare its size and speed with TSSC on recorded and full-precision PMU data.
+int main(int argc, char* argv[])
+{
+    const TestStream historyStream = LoadHistoryStream(250);
+    const TestStream precisionStream = GeneratePrecisionStream(100, 1000, 1);
+    const TestStream edgeStream = GenerateEdgeStream(20000, 2);
+    XOR64Encoder encoder;
+    XOR64Decoder decoder;
+    vector<vector<uint8_t>> blocks;
+    int32_t test = 0;
+
+    assert(!historyStream.empty());
+
+    // Test recorded data round-trips exactly
+    blocks = Encode<XOR64Encoder, float64_t>(encoder, historyStream);
+    assert(Equals(Decode<XOR64Decoder, float64_t>(decoder, blocks), historyStream));
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test full-precision values round-trip exactly
+    blocks = Encode<XOR64Encoder, float64_t>(encoder, precisionStream);
+    assert(Equals(Decode<XOR64Decoder, float64_t>(decoder, blocks), precisionStream));
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test boundary values, timestamps, qualities and IDs round-trip exactly
+    blocks = Encode<XOR64Encoder, float64_t>(encoder, edgeStream);
+    assert(Equals(Decode<XOR64Decoder, float64_t>(decoder, blocks), edgeStream));
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test state carries across many small blocks
+    blocks = Encode<XOR64Encoder, float64_t>(encoder, edgeStream, 64U);
+    assert(blocks.size() > 1000);
+    assert(Equals(Decode<XOR64Decoder, float64_t>(decoder, blocks), edgeStream));
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    // Test truncated block is reported as an error instead of being read past its end
+    blocks = Encode<XOR64Encoder, float64_t>(encoder, precisionStream);
+    blocks[0].resize(blocks[0].size() / 2);
+    bool failed = false;
+
+    try
+    {
+        Decode<XOR64Decoder, float64_t>(decoder, blocks);
+    }
+    catch (const SubscriberException&)
+    {
+        failed = true;
+    }
+
+    assert(failed);
+    cout << "Test " << ++test << " succeeded..." << endl;
+
+    Benchmark("History.xml replayed 250 times", historyStream);
+    Benchmark("full-precision meter and frequency", precisionStream);
+
+    cout << endl << "Tests complete. Press enter to exit." << endl;
+    getc(stdin);
+
+    return 0;
+}
@@ -134,7 +134,8 @@ uint32_t CompactMeasurement::GetBinaryLength(const bool usingBaseTimeOffset) con
 
 // Attempts to parse a measurement from the buffer. Return value of false indicates
 // that there is not enough data to parse the measurement. Offset and length will be
-// updated by this method to indicate how many bytes were used when parsing.
+// updated by this method to indicate how many bytes were used when parsing. Measurement
+// will be null when its signal index is not defined in the signal index cache.
 bool CompactMeasurement::TryParseMeasurement(uint8_t* data, uint32_t& offset, uint32_t length, MeasurementPtr& measurement) const
 {
     // Ensure that we at least have enough
@@ -159,9 +160,14 @@ bool CompactMeasurement::TryParseMeasurement(uint8_t* data, uint32_t& offset, ui
     // Read the signal index from the buffer
     const uint16_t signalIndex = EndianConverter::ToBigEndian<uint16_t>(data, offset + 1);
 
-    // If the signal index is not found in the cache, we cannot parse the measurement
+    // If the signal index is not found in the cache, measurement was serialized against a
+    // signal index cache that has since been replaced, skip it without a parsed measurement
     if (!m_signalIndexCache->Contains(signalIndex))
-        return false;
+    {
+        offset += GetBinaryLength(usingBaseTimeOffset);
+        measurement = nullptr;
+        return true;
+    }
 
     Guid signalID;
     string measurementSource;
@@ -208,6 +214,7 @@ bool CompactMeasurement::TryParseMeasurement(uint8_t* data, uint32_t& offset, ui
     measurement->ID = measurementID;
     measurement->Value = measurementValue;
     measurement->Timestamp = timestamp;
+    measurement->RuntimeID = signalIndex;
 
     return true;
 }
@@ -52,7 +52,8 @@ namespace Transport
 
         // Attempts to parse a measurement from the buffer. Return value of false indicates
         // that there is not enough data to parse the measurement. Offset and length will be
-        // updated by this method to indicate how many bytes were used when parsing.
+        // updated by this method to indicate how many bytes were used when parsing. Measurement
+        // will be null when its signal index is not defined in the signal index cache.
         bool TryParseMeasurement(uint8_t* data, uint32_t& offset, uint32_t length, MeasurementPtr& measurement) const;
 
         // Serializes a measurement into a buffer
@@ -0,0 +1,161 @@
+//******************************************************************************************************
+//  CompactPacketCodec.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#include "CompactPacketCodec.h"
+#include "Constants.h"
+#include "TransportTypes.h"
+#include "../Common/EndianConverter.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// Deflate window size less the minimum lookahead, larger dictionaries are not fully usable
+static constexpr size_t MaxDictionarySize = 32768U - 262U;
+
+// Smaller hash table than the zlib default, it is cleared for every packet and packets are small
+static constexpr int32_t DeflateMemoryLevel = 4;
+
+CompactPacketCodec::CompactPacketCodec() :
+    m_deflateStream(),
+    m_inflateStream(),
+    m_deflateInitialized(false),
+    m_inflateInitialized(false)
+{
+}
+
+CompactPacketCodec::~CompactPacketCodec()
+{
+    if (m_deflateInitialized)
+        deflateEnd(&m_deflateStream);
+
+    if (m_inflateInitialized)
+        inflateEnd(&m_inflateStream);
+}
+
+void CompactPacketCodec::SetDictionarySource(const SignalIndexCachePtr& signalIndexCache)
+{
+    if (signalIndexCache == m_dictionaryCache)
+        return;
+
+    m_dictionaryCache = signalIndexCache;
+
+    if (signalIndexCache == nullptr)
+        m_dictionary.clear();
+    else
+        m_dictionary = CreateDictionary(*signalIndexCache);
+}
+
+void CompactPacketCodec::Compress(const uint8_t* data, uint32_t length, vector<uint8_t>& output)
+{
+    // Streams are reset rather than recreated for each packet to avoid reallocating zlib state
+    if (!m_deflateInitialized)
+    {
+        if (deflateInit2(&m_deflateStream, Z_BEST_SPEED, Z_DEFLATED, MAX_WBITS, DeflateMemoryLevel, Z_DEFAULT_STRATEGY) != Z_OK)
+            throw PublisherException("Failed to initialize compact packet compression");
+
+        m_deflateInitialized = true;
+    }
+    else
+    {
+        deflateReset(&m_deflateStream);
+    }
+
+    if (!m_dictionary.empty())
+        deflateSetDictionary(&m_deflateStream, m_dictionary.data(), static_cast<uInt>(m_dictionary.size()));
+
+    const size_t offset = output.size();
+    output.resize(offset + deflateBound(&m_deflateStream, length));
+
+    m_deflateStream.next_in = const_cast<Bytef*>(data);
+    m_deflateStream.avail_in = length;
+    m_deflateStream.next_out = output.data() + offset;
+    m_deflateStream.avail_out = static_cast<uInt>(output.size() - offset);
+
+    if (deflate(&m_deflateStream, Z_FINISH) != Z_STREAM_END)
+        throw PublisherException("Failed to compress compact data packet");
+
+    output.resize(offset + m_deflateStream.total_out);
+}
+
+uint32_t CompactPacketCodec::Decompress(const uint8_t* data, uint32_t length, vector<uint8_t>& output)
+{
+    if (!m_inflateInitialized)
+    {
+        if (inflateInit(&m_inflateStream) != Z_OK)
+            throw SubscriberException("Failed to initialize compact packet decompression");
+
+        m_inflateInitialized = true;
+    }
+    else
+    {
+        inflateReset(&m_inflateStream);
+    }
+
+    // Publisher never compresses more than a maximum size packet
+    if (output.size() < Common::MaxPacketSize)
+        output.resize(Common::MaxPacketSize);
+
+    m_inflateStream.next_in = const_cast<Bytef*>(data);
+    m_inflateStream.avail_in = length;
+    m_inflateStream.next_out = output.data();
+    m_inflateStream.avail_out = static_cast<uInt>(Common::MaxPacketSize);
+
+    int32_t result = inflate(&m_inflateStream, Z_FINISH);
+
+    if (result == Z_NEED_DICT)
+    {
+        if (m_dictionary.empty() || inflateSetDictionary(&m_inflateStream, m_dictionary.data(), static_cast<uInt>(m_dictionary.size())) != Z_OK)
+            throw SubscriberException("Compact data packet dictionary does not match signal index cache");
+
+        result = inflate(&m_inflateStream, Z_FINISH);
+    }
+
+    if (result != Z_STREAM_END)
+        throw SubscriberException("Failed to decompress compact data packet: " + string(m_inflateStream.msg == nullptr ? "packet is truncated or too large" : m_inflateStream.msg));
+
+    return static_cast<uint32_t>(m_inflateStream.total_out);
+}
+
+vector<uint8_t> CompactPacketCodec::CreateDictionary(const SignalIndexCache& signalIndexCache)
+{
+    const uint32_t capacity = signalIndexCache.GetSignalIndexCapacity();
+    vector<uint8_t> dictionary;
+
+    dictionary.reserve(min(static_cast<size_t>(signalIndexCache.Count()) * 3U, MaxDictionarySize));
+
+    for (uint32_t i = 0; i < capacity && dictionary.size() + 3U <= MaxDictionarySize; i++)
+    {
+        const uint16_t signalIndex = static_cast<uint16_t>(i);
+
+        if (!signalIndexCache.Contains(signalIndex))
+            continue;
+
+        dictionary.push_back(0);
+        EndianConverter::WriteBigEndianBytes(dictionary, signalIndex);
+    }
+
+    return dictionary;
+}
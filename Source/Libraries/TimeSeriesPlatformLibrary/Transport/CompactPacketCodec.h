@@ -0,0 +1,77 @@
+//******************************************************************************************************
+//  CompactPacketCodec.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#ifndef __COMPACT_PACKET_CODEC_H
+#define __COMPACT_PACKET_CODEC_H
+
+#include "SignalIndexCache.h"
+#include <zlib.h>
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Stateless compression of compact format data packets. Each packet is compressed
+    // independently with zlib so it can be decoded without any prior packet, e.g., when
+    // packets are lost over UDP. Packets can be primed with a dictionary derived from the
+    // signal index cache, the zlib dictionary ID lets the receiver detect a mismatched cache.
+    class CompactPacketCodec
+    {
+    private:
+        z_stream m_deflateStream;
+        z_stream m_inflateStream;
+        bool m_deflateInitialized;
+        bool m_inflateInitialized;
+
+        // Dictionary is rebuilt only when the signal index cache changes
+        SignalIndexCachePtr m_dictionaryCache;
+        std::vector<uint8_t> m_dictionary;
+
+    public:
+        CompactPacketCodec();
+        ~CompactPacketCodec();
+
+        // Codec owns zlib stream state, so it cannot be copied.
+        CompactPacketCodec(const CompactPacketCodec&) = delete;
+        CompactPacketCodec& operator=(const CompactPacketCodec&) = delete;
+
+        // Sets the signal index cache used to derive the compression dictionary, use
+        // nullptr to compress without a dictionary. Decompression always uses the
+        // dictionary of the assigned cache when a packet requires one.
+        void SetDictionarySource(const SignalIndexCachePtr& signalIndexCache);
+
+        // Compresses the compact measurement bytes of a packet, appending the result to output.
+        void Compress(const uint8_t* data, uint32_t length, std::vector<uint8_t>& output);
+
+        // Decompresses a packet produced by Compress into output and returns the decompressed length.
+        // Output is kept at maximum packet size so it can be reused without being cleared again.
+        uint32_t Decompress(const uint8_t* data, uint32_t length, std::vector<uint8_t>& output);
+
+        // Creates the dictionary for a signal index cache: the compact state flags and runtime
+        // ID of each signal, which are the most frequent byte sequences in a compact packet.
+        static std::vector<uint8_t> CreateDictionary(const SignalIndexCache& signalIndexCache);
+    };
+}}}
+
+#endif
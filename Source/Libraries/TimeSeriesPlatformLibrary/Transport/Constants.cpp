@@ -90,6 +90,7 @@ const uint8_t DataPacketFlags::Compact;
 const uint8_t DataPacketFlags::CipherIndex;
 const uint8_t DataPacketFlags::Compressed;
 const uint8_t DataPacketFlags::LittleEndianCompression;
+const uint8_t DataPacketFlags::PacketCompressed;
 const uint8_t DataPacketFlags::NoFlags;
 
 const uint8_t ServerCommand::Authenticate;
@@ -153,6 +154,7 @@ const uint32_t OperationalModes::EncodingMask;
 const uint32_t OperationalModes::UseCommonSerializationFormat;
 const uint32_t OperationalModes::ReceiveExternalMetadata;
 const uint32_t OperationalModes::ReceiveInternalMetadata;
+const uint32_t OperationalModes::CompressCompactPackets;
 const uint32_t OperationalModes::CompressPayloadData;
 const uint32_t OperationalModes::CompressSignalIndexCache;
 const uint32_t OperationalModes::CompressMetadata;
@@ -165,8 +167,12 @@ const uint32_t OperationalEncoding::ANSI;
 
 const uint32_t CompressionModes::GZip;
 const uint32_t CompressionModes::TSSC;
+const uint32_t CompressionModes::XOR64;
 const uint32_t CompressionModes::None;
 
+const uint8_t CompressedPayloadVersion::TSSC;
+const uint8_t CompressedPayloadVersion::XOR64;
+
 const uint8_t TSSCCodeWords::EndOfStream;
 const uint8_t TSSCCodeWords::PointIDXOR4;
 const uint8_t TSSCCodeWords::PointIDXOR8;
@@ -133,6 +133,8 @@ namespace Transport
         static const uint8_t Compressed = 0x08;
         // Determines if the compressed data payload is in little-endian order. Bit set = little-endian order compression, bit clear = big-endian order compression.
         static const uint8_t LittleEndianCompression = 0x10;
+        // Determines if the compact payload of a data packet is independently compressed with zlib. Bit set = packet compressed, bit clear = packet normal.
+        static const uint8_t PacketCompressed = 0x20;
         // No flags set. This would represent unsynchronized, full fidelity measurement data packets.
         static const uint8_t NoFlags = 0x00;
     };
@@ -242,7 +244,7 @@ namespace Transport
     {
         // Mask to get version number of protocol. Version number is currently set to 0.
         static const uint32_t VersionMask = 0x0000001F;
-        // Mask to get mode of compression. GZip and TSSC compression are the only modes currently supported. Remaining bits are reserved for future compression modes.
+        // Mask to get mode of compression. GZip, TSSC and XOR64 compression are the modes currently supported.
         static const uint32_t CompressionModeMask = 0x000000E0;
         // Mask to get character encoding used when exchanging messages between publisher and subscriber.
         static const uint32_t EncodingMask = 0x00000300;
@@ -252,6 +254,8 @@ namespace Transport
         static const uint32_t ReceiveExternalMetadata = 0x02000000;
         // Determines whether internal measurements are exchanged during metadata synchronization. Bit set = internal measurements are exchanged, bit clear = no internal measurements are exchanged.
         static const uint32_t ReceiveInternalMetadata = 0x04000000;
+        // Determines whether compact format data packets are compressed independently of each other, e.g., for UDP where packets can be lost. Bit set = compress, bit clear = no compression.
+        static const uint32_t CompressCompactPackets = 0x10000000;
         // Determines whether payload data is compressed when exchanging between publisher and subscriber. Bit set = compress, bit clear = no compression.
         static const uint32_t CompressPayloadData = 0x20000000;
         // Determines whether the signal index cache is compressed when exchanging between publisher and subscriber. Bit set = compress, bit clear = no compression.
@@ -287,10 +291,21 @@ namespace Transport
         static const uint32_t GZip = 0x00000020;
         // TSSC compression
         static const uint32_t TSSC = 0x00000040;
+        // XOR64 compression, full-precision 64-bit values
+        static const uint32_t XOR64 = 0x00000080;
         // No compression
         static const uint32_t None = 0x00000000;
     };
 
+    // Version numbers that start the payload of compressed data packets, identifies the compression algorithm.
+    struct CompressedPayloadVersion
+    {
+        // TSSC compressed payload
+        static const uint8_t TSSC = 85;
+        // XOR64 compressed payload
+        static const uint8_t XOR64 = 86;
+    };
+
     // Security modes used by the DataPublisher to secure data sent over the command channel.
     enum class SecurityMode
     {
@@ -0,0 +1,171 @@
+//******************************************************************************************************
+//  CurrentValueTable.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "CurrentValueTable.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+CurrentValueTable::Entry::Entry() :
+    Timestamp(0),
+    Value(0),
+    Flags(0)
+{
+}
+
+CurrentValueTable::Slot::Slot() :
+    Sequence(0)
+{
+}
+
+CurrentValueTable::CurrentValueTable(SignalIndexCachePtr signalIndexCache) :
+    m_signalIndexCache(std::move(signalIndexCache)),
+    m_slots(m_signalIndexCache->GetSignalIndexCapacity())
+{
+}
+
+CurrentValueTable::CurrentValueTable(SignalIndexCachePtr signalIndexCache, const CurrentValueTable& previousTable) :
+    CurrentValueTable(std::move(signalIndexCache))
+{
+    const SignalIndexCache& previousCache = *previousTable.m_signalIndexCache;
+    const size_t count = min(m_slots.size(), previousTable.m_slots.size());
+    CurrentValue value {};
+
+    // Table is not yet shared, so this thread is its only writer
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint16_t signalIndex = static_cast<uint16_t>(i);
+
+        if (!m_signalIndexCache->Contains(signalIndex) || !previousCache.Contains(signalIndex))
+            continue;
+
+        if (m_signalIndexCache->GetSignalID(signalIndex) != previousCache.GetSignalID(signalIndex))
+            continue;
+
+        if (previousTable.TryReadSlot(signalIndex, value))
+            Update(signalIndex, value.Timestamp, value.Value, value.Flags);
+    }
+}
+
+const SignalIndexCachePtr& CurrentValueTable::GetSignalIndexCache() const
+{
+    return m_signalIndexCache;
+}
+
+void CurrentValueTable::Update(const uint16_t signalIndex, const int64_t timestamp, const float64_t value, const uint32_t flags)
+{
+    if (signalIndex >= m_slots.size())
+        return;
+
+    Slot& slot = m_slots[signalIndex];
+    const uint64_t sequence = slot.Sequence.load(memory_order_relaxed);
+    uint64_t valueBits;
+
+    memcpy(&valueBits, &value, sizeof(uint64_t));
+
+    // Write into the entry that is not holding the last published value
+    Entry& entry = slot.Entries[((sequence >> 1) + 1) & 1];
+
+    // Odd sequence marks the other entry as being written
+    slot.Sequence.store(sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    entry.Timestamp.store(timestamp, memory_order_relaxed);
+    entry.Value.store(valueBits, memory_order_relaxed);
+    entry.Flags.store(flags, memory_order_relaxed);
+
+    slot.Sequence.store(sequence + 2, memory_order_release);
+}
+
+bool CurrentValueTable::TryReadSlot(const uint16_t signalIndex, CurrentValue& value) const
+{
+    const Slot& slot = m_slots[signalIndex];
+    uint64_t sequence = slot.Sequence.load(memory_order_acquire);
+    uint64_t valueBits;
+
+    // No value has been published until the first update completes
+    if (sequence < 2)
+        return false;
+
+    while (true)
+    {
+        // Published entry is stable even while the next update is being written
+        const uint64_t published = sequence >> 1;
+        const Entry& entry = slot.Entries[published & 1];
+
+        value.Timestamp = entry.Timestamp.load(memory_order_relaxed);
+        valueBits = entry.Value.load(memory_order_relaxed);
+        value.Flags = entry.Flags.load(memory_order_relaxed);
+
+        atomic_thread_fence(memory_order_acquire);
+
+        const uint64_t current = slot.Sequence.load(memory_order_relaxed);
+
+        // Entry is only overwritten once the update after next has started
+        if (current - (published << 1) <= 2)
+            break;
+
+        sequence = current;
+    }
+
+    memcpy(&value.Value, &valueBits, sizeof(float64_t));
+    value.SignalID = m_signalIndexCache->GetSignalID(signalIndex);
+
+    return true;
+}
+
+bool CurrentValueTable::TryGetValue(const uint16_t signalIndex, CurrentValue& value) const
+{
+    if (signalIndex >= m_slots.size())
+        return false;
+
+    return TryReadSlot(signalIndex, value);
+}
+
+bool CurrentValueTable::TryGetValue(const Guid& signalID, CurrentValue& value) const
+{
+    const uint16_t signalIndex = m_signalIndexCache->GetSignalIndex(signalID);
+
+    if (signalIndex == UInt16::MaxValue)
+        return false;
+
+    return TryGetValue(signalIndex, value);
+}
+
+uint32_t CurrentValueTable::GetSnapshot(vector<CurrentValue>& values) const
+{
+    CurrentValue value {};
+
+    values.clear();
+    values.reserve(m_signalIndexCache->Count());
+
+    for (size_t i = 0; i < m_slots.size(); i++)
+    {
+        if (TryReadSlot(static_cast<uint16_t>(i), value))
+            values.push_back(value);
+    }
+
+    return ConvertUInt32(values.size());
+}
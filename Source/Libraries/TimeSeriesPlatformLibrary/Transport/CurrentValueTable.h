@@ -0,0 +1,106 @@
+//******************************************************************************************************
+//  CurrentValueTable.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __CURRENT_VALUE_TABLE_H
+#define __CURRENT_VALUE_TABLE_H
+
+#include "../Common/CommonTypes.h"
+#include "SignalIndexCache.h"
+#include <atomic>
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Latest received value for a subscribed signal.
+    struct CurrentValue
+    {
+        GSF::Guid SignalID;
+        int64_t Timestamp;
+        float64_t Value;
+        uint32_t Flags;
+    };
+
+    // Holds the latest received value of every signal in a signal index cache, indexed by
+    // runtime ID. Values are updated by a single writer, the subscriber's data thread, and
+    // can be read from any thread without taking a lock. Each slot is double buffered: the
+    // writer fills the entry readers are not using then publishes it through a sequence
+    // counter, so a read never waits on a write in progress. A read is only repeated when
+    // the writer starts two further updates of the same slot while the read is copying its
+    // three fields, i.e., two new values for one signal within a few loads; at any realistic
+    // signal rate a read completes on its first or second attempt.
+    class CurrentValueTable // NOLINT
+    {
+    private:
+        struct Entry
+        {
+            std::atomic<int64_t> Timestamp;
+            std::atomic<uint64_t> Value;
+            std::atomic<uint32_t> Flags;
+
+            Entry();
+        };
+
+        struct Slot
+        {
+            // Twice the number of completed updates, odd while an update is being written, 64-bit
+            // so it never wraps back to the "no value" range for a continuously updated signal
+            std::atomic<uint64_t> Sequence;
+            Entry Entries[2];
+
+            Slot();
+        };
+
+        const SignalIndexCachePtr m_signalIndexCache;
+        std::vector<Slot> m_slots;
+
+        bool TryReadSlot(uint16_t signalIndex, CurrentValue& value) const;
+
+    public:
+        CurrentValueTable(SignalIndexCachePtr signalIndexCache);
+
+        // Creates a table for an updated signal index cache, carrying over the latest value
+        // of each runtime ID that still refers to the same signal in the previous table.
+        CurrentValueTable(SignalIndexCachePtr signalIndexCache, const CurrentValueTable& previousTable);
+
+        // Gets the signal index cache that defines the runtime IDs of this table.
+        const SignalIndexCachePtr& GetSignalIndexCache() const;
+
+        // Stores the latest value for the given runtime ID. Must only be called from one thread.
+        void Update(uint16_t signalIndex, int64_t timestamp, float64_t value, uint32_t flags);
+
+        // Gets the latest value for the given runtime ID, returns false if no value has been received.
+        bool TryGetValue(uint16_t signalIndex, CurrentValue& value) const;
+
+        // Gets the latest value for the given signal ID, returns false if no value has been received.
+        bool TryGetValue(const GSF::Guid& signalID, CurrentValue& value) const;
+
+        // Gets the latest value of every signal that has received a value, vector will
+        // be cleared then appended to, returns the number of values added.
+        uint32_t GetSnapshot(std::vector<CurrentValue>& values) const;
+    };
+
+    typedef SharedPtr<CurrentValueTable> CurrentValueTablePtr;
+}}}
+
+#endif
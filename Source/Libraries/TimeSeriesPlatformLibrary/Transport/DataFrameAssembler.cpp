@@ -0,0 +1,333 @@
+//******************************************************************************************************
+//  DataFrameAssembler.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "DataFrameAssembler.h"
+#include "../Common/Convert.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// Marks positions with no assigned frame, local copy so it can be bound to const references
+static constexpr uint32_t UnassignedIndex = UInt32::MaxValue;
+
+DataFrameStatistics::DataFrameStatistics() :
+    CompleteFrames(0UL),
+    PartialFrames(0UL),
+    AssignedMeasurements(0UL),
+    UnmappedMeasurements(0UL),
+    LateMeasurements(0UL)
+{
+}
+
+DataFrameAssembler::DataFrameAssembler(const SignalIndexCachePtr& signalIndexCache, const vector<ConfigurationFramePtr>& configurationFrames, int64_t lagTime) :
+    m_positions(signalIndexCache->GetSignalIndexCapacity(), { UnassignedIndex, UnassignedIndex }),
+    m_positionSignalIDs(m_positions.size(), Empty::Guid),
+    m_lagTime(lagTime),
+    m_latestTimestamp(0)
+{
+    unordered_map<Guid, FramePosition> signalPositions;
+    vector<Guid> signalIDs;
+
+    // Map each configuration frame signal to its frame position
+    for (size_t i = 0; i < configurationFrames.size(); i++)
+    {
+        GetSlotSignalIDs(*configurationFrames[i], signalIDs);
+
+        for (size_t j = 0; j < signalIDs.size(); j++)
+        {
+            if (signalIDs[j] == Empty::Guid)
+                continue;
+
+            signalPositions.emplace(signalIDs[j], FramePosition { ConvertUInt32(i), ConvertUInt32(j) });
+            m_frameSignalIDs.insert(signalIDs[j]);
+        }
+    }
+
+    // Resolve frame positions for each subscribed runtime ID
+    vector<DataFramePtr> frames(configurationFrames.size());
+    vector<vector<Measurement*>> frameSlots(configurationFrames.size());
+
+    for (uint32_t i = 0; i < ConvertUInt32(m_positions.size()); i++)
+    {
+        const uint16_t signalIndex = static_cast<uint16_t>(i);
+
+        if (!signalIndexCache->Contains(signalIndex))
+            continue;
+
+        const auto result = signalPositions.find(signalIndexCache->GetSignalID(signalIndex));
+
+        if (result == signalPositions.end())
+            continue;
+
+        const FramePosition& position = result->second;
+        DataFramePtr& frame = frames[position.FrameIndex];
+
+        if (frame == nullptr)
+        {
+            frame = CreateFrame(configurationFrames[position.FrameIndex]);
+            GetSlots(*frame, frameSlots[position.FrameIndex]);
+        }
+
+        // Identity of each value is assigned once, only timestamp, value and flags change per frame
+        Measurement& measurement = *frameSlots[position.FrameIndex][position.SlotIndex];
+        measurement.SignalID = result->first;
+        measurement.Source = signalIndexCache->GetSource(signalIndex);
+        measurement.ID = signalIndexCache->GetID(signalIndex);
+        measurement.RuntimeID = signalIndex;
+
+        frame->ExpectedCount++;
+        m_positions[i] = position;
+        m_positionSignalIDs[i] = result->first;
+    }
+
+    // Only frames with subscribed values are assembled, re-index positions accordingly
+    vector<uint32_t> frameIndexes(frames.size(), UnassignedIndex);
+
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        if (frames[i] == nullptr)
+            continue;
+
+        frameIndexes[i] = ConvertUInt32(m_frames.size());
+
+        FrameState state;
+        state.Frame = frames[i];
+        state.LastPublishedTimestamp = Int64::MinValue;
+        state.StartTime = 0;
+        state.Pending = false;
+        GetSlots(*state.Frame, state.Slots);
+        state.Received.assign(state.Slots.size(), false);
+
+        m_frames.push_back(state);
+    }
+
+    for (FramePosition& position : m_positions)
+    {
+        if (position.FrameIndex != UnassignedIndex)
+            position.FrameIndex = frameIndexes[position.FrameIndex];
+    }
+}
+
+void DataFrameAssembler::Assign(const uint16_t signalIndex, const int64_t timestamp, const float64_t value, const uint32_t flags, vector<DataFramePtr>& frames)
+{
+    if (signalIndex >= m_positions.size() || m_positions[signalIndex].FrameIndex == UnassignedIndex)
+    {
+        m_statistics.UnmappedMeasurements++;
+        return;
+    }
+
+    const FramePosition& position = m_positions[signalIndex];
+    FrameState& state = m_frames[position.FrameIndex];
+
+    if (timestamp <= state.LastPublishedTimestamp)
+    {
+        m_statistics.LateMeasurements++;
+        return;
+    }
+
+    if (state.Pending && timestamp != state.Frame->Timestamp)
+    {
+        if (timestamp < state.Frame->Timestamp)
+        {
+            m_statistics.LateMeasurements++;
+            return;
+        }
+
+        // Value for a newer timestamp, publish what was received so far
+        PublishFrame(state, frames);
+    }
+
+    if (!state.Pending)
+        StartFrame(state, timestamp);
+
+    Measurement& measurement = *state.Slots[position.SlotIndex];
+
+    if (!state.Received[position.SlotIndex])
+    {
+        state.Received[position.SlotIndex] = true;
+        state.Frame->ReceivedCount++;
+    }
+
+    measurement.Timestamp = timestamp;
+    measurement.Value = value;
+    measurement.Flags = static_cast<MeasurementStateFlags>(flags);
+    m_statistics.AssignedMeasurements++;
+
+    if (timestamp > m_latestTimestamp)
+        m_latestTimestamp = timestamp;
+
+    if (state.Frame->ReceivedCount >= state.Frame->ExpectedCount)
+        PublishFrame(state, frames);
+}
+
+void DataFrameAssembler::PublishLaggingFrames(vector<DataFramePtr>& frames)
+{
+    const int64_t threshold = m_latestTimestamp - m_lagTime;
+    const int64_t expiration = ToTicks(UtcNow()) - m_lagTime;
+
+    for (FrameState& state : m_frames)
+    {
+        if (state.Pending && (state.Frame->Timestamp < threshold || state.StartTime < expiration))
+            PublishFrame(state, frames);
+    }
+}
+
+uint32_t DataFrameAssembler::GetFrameCount() const
+{
+    return ConvertUInt32(m_frames.size());
+}
+
+bool DataFrameAssembler::HasSameFramePositions(const SignalIndexCache& signalIndexCache) const
+{
+    const uint32_t capacity = max(signalIndexCache.GetSignalIndexCapacity(), ConvertUInt32(m_positions.size()));
+
+    for (uint32_t i = 0; i < capacity; i++)
+    {
+        const uint16_t signalIndex = static_cast<uint16_t>(i);
+        const bool mapped = i < m_positions.size() && m_positions[i].FrameIndex != UnassignedIndex;
+
+        if (!signalIndexCache.Contains(signalIndex))
+        {
+            // Runtime ID of a mapped signal was released
+            if (mapped)
+                return false;
+
+            continue;
+        }
+
+        const Guid signalID = signalIndexCache.GetSignalID(signalIndex);
+
+        // Mapped runtime ID now refers to a different signal, or an unmapped one now has a frame position
+        if (mapped ? signalID != m_positionSignalIDs[i] : m_frameSignalIDs.find(signalID) != m_frameSignalIDs.end())
+            return false;
+    }
+
+    return true;
+}
+
+const DataFrameStatistics& DataFrameAssembler::GetStatistics() const
+{
+    return m_statistics;
+}
+
+void DataFrameAssembler::StartFrame(FrameState& state, const int64_t timestamp)
+{
+    // Frames are reused in place unless a consumer is still holding a reference
+    if (state.Frame.use_count() > 1)
+    {
+        state.Frame = NewSharedPtr<DataFrame>(*state.Frame);
+        GetSlots(*state.Frame, state.Slots);
+    }
+
+    for (Measurement* measurement : state.Slots)
+    {
+        measurement->Timestamp = 0;
+        measurement->Value = NAN;
+        measurement->Flags = MeasurementStateFlags::Normal;
+    }
+
+    state.Received.assign(state.Slots.size(), false);
+    state.Frame->Timestamp = timestamp;
+    state.Frame->ReceivedCount = 0;
+    state.StartTime = ToTicks(UtcNow());
+    state.Pending = true;
+}
+
+void DataFrameAssembler::PublishFrame(FrameState& state, vector<DataFramePtr>& frames)
+{
+    if (state.Frame->IsComplete())
+        m_statistics.CompleteFrames++;
+    else
+        m_statistics.PartialFrames++;
+
+    state.LastPublishedTimestamp = state.Frame->Timestamp;
+    state.Pending = false;
+
+    frames.push_back(state.Frame);
+}
+
+DataFramePtr DataFrameAssembler::CreateFrame(const ConfigurationFramePtr& configurationFrame)
+{
+    DataFramePtr frame = NewSharedPtr<DataFrame>();
+
+    frame->Configuration = configurationFrame;
+    frame->DeviceAcronym = configurationFrame->DeviceAcronym;
+    frame->Phasors.resize(configurationFrame->Phasors.size());
+    frame->Analogs.resize(configurationFrame->Analogs.size());
+    frame->Digitals.resize(configurationFrame->Digitals.size());
+
+    return frame;
+}
+
+// Slot order must match GetSlotSignalIDs
+void DataFrameAssembler::GetSlots(DataFrame& frame, vector<Measurement*>& slots)
+{
+    slots.clear();
+    slots.reserve(4 + frame.Phasors.size() * 2 + frame.Analogs.size() + frame.Digitals.size());
+
+    slots.push_back(&frame.QualityFlags);
+    slots.push_back(&frame.StatusFlags);
+    slots.push_back(&frame.Frequency);
+    slots.push_back(&frame.DfDt);
+
+    for (Phasor& phasor : frame.Phasors)
+    {
+        slots.push_back(&phasor.Angle);
+        slots.push_back(&phasor.Magnitude);
+    }
+
+    for (Measurement& analog : frame.Analogs)
+        slots.push_back(&analog);
+
+    for (Measurement& digital : frame.Digitals)
+        slots.push_back(&digital);
+}
+
+void DataFrameAssembler::GetSlotSignalIDs(const ConfigurationFrame& configurationFrame, vector<Guid>& signalIDs)
+{
+    const auto getSignalID = [](const MeasurementMetadataPtr& measurement)
+    {
+        return measurement == nullptr ? Empty::Guid : measurement->SignalID;
+    };
+
+    signalIDs.clear();
+
+    signalIDs.push_back(getSignalID(configurationFrame.QualityFlags));
+    signalIDs.push_back(getSignalID(configurationFrame.StatusFlags));
+    signalIDs.push_back(getSignalID(configurationFrame.Frequency));
+    signalIDs.push_back(getSignalID(configurationFrame.DfDt));
+
+    for (const PhasorReferencePtr& phasor : configurationFrame.Phasors)
+    {
+        signalIDs.push_back(phasor == nullptr ? Empty::Guid : getSignalID(phasor->Angle));
+        signalIDs.push_back(phasor == nullptr ? Empty::Guid : getSignalID(phasor->Magnitude));
+    }
+
+    for (const MeasurementMetadataPtr& analog : configurationFrame.Analogs)
+        signalIDs.push_back(getSignalID(analog));
+
+    for (const MeasurementMetadataPtr& digital : configurationFrame.Digitals)
+        signalIDs.push_back(getSignalID(digital));
+}
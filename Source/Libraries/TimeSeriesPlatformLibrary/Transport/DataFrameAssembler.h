@@ -0,0 +1,113 @@
+//******************************************************************************************************
+//  DataFrameAssembler.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __DATA_FRAME_ASSEMBLER_H
+#define __DATA_FRAME_ASSEMBLER_H
+
+#include "../Common/CommonTypes.h"
+#include "TransportTypes.h"
+#include "SignalIndexCache.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Frame assembly statistics.
+    struct DataFrameStatistics
+    {
+        uint64_t CompleteFrames;        // Frames published with all expected values
+        uint64_t PartialFrames;         // Frames published by timestamp change or lag timeout
+        uint64_t AssignedMeasurements;  // Values assigned to a frame position
+        uint64_t UnmappedMeasurements;  // Values with no position in any configuration frame
+        uint64_t LateMeasurements;      // Values received after their frame was published
+
+        DataFrameStatistics();
+    };
+
+    // Groups received values into per-device data frames. Frame positions are resolved once
+    // per signal index cache, so each received value is assigned by runtime ID without any
+    // lookups. A frame is published when all expected values have been received, when a value
+    // for a newer timestamp arrives for the device, or when the frame has been pending, either by
+    // its timestamp relative to the latest received timestamp or by the local clock, for more
+    // than the lag time. Not thread safe, callers must serialize access.
+    class DataFrameAssembler // NOLINT
+    {
+    private:
+        struct FramePosition
+        {
+            uint32_t FrameIndex;
+            uint32_t SlotIndex;
+        };
+
+        struct FrameState
+        {
+            DataFramePtr Frame;
+            std::vector<Measurement*> Slots;
+            std::vector<bool> Received;
+            int64_t LastPublishedTimestamp;
+            int64_t StartTime;
+            bool Pending;
+        };
+
+        std::vector<FramePosition> m_positions;
+        std::vector<Guid> m_positionSignalIDs;
+        std::unordered_set<Guid> m_frameSignalIDs;
+        std::vector<FrameState> m_frames;
+        int64_t m_lagTime;
+        int64_t m_latestTimestamp;
+        DataFrameStatistics m_statistics;
+
+        void StartFrame(FrameState& state, int64_t timestamp);
+        void PublishFrame(FrameState& state, std::vector<DataFramePtr>& frames);
+
+        static DataFramePtr CreateFrame(const ConfigurationFramePtr& configurationFrame);
+        static void GetSlots(DataFrame& frame, std::vector<Measurement*>& slots);
+        static void GetSlotSignalIDs(const ConfigurationFrame& configurationFrame, std::vector<Guid>& signalIDs);
+
+    public:
+        // Creates a new assembler for the given signal index cache and configuration frames,
+        // lag time is in ticks.
+        DataFrameAssembler(const SignalIndexCachePtr& signalIndexCache, const std::vector<ConfigurationFramePtr>& configurationFrames, int64_t lagTime);
+
+        // Assigns a received value to its frame position, any frames ready
+        // for publication are appended to the provided frames vector.
+        void Assign(uint16_t signalIndex, int64_t timestamp, float64_t value, uint32_t flags, std::vector<DataFramePtr>& frames);
+
+        // Appends any pending frames that have exceeded the lag time to the provided frames vector,
+        // call periodically so frames are still published when values stop arriving.
+        void PublishLaggingFrames(std::vector<DataFramePtr>& frames);
+
+        // Gets the number of device frames being assembled.
+        uint32_t GetFrameCount() const;
+
+        // Determines if the given signal index cache resolves to the same frame positions as the
+        // cache this assembler was created with, in which case the assembler remains valid.
+        bool HasSameFramePositions(const SignalIndexCache& signalIndexCache) const;
+
+        const DataFrameStatistics& GetStatistics() const;
+    };
+
+    typedef SharedPtr<DataFrameAssembler> DataFrameAssemblerPtr;
+}}}
+
+#endif
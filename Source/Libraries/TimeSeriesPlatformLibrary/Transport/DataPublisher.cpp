@@ -36,13 +36,6 @@ using namespace GSF::FilterExpressions;
 using namespace GSF::TimeSeries;
 using namespace GSF::TimeSeries::Transport;
 
-struct UserCommandData
-{
-    SubscriberConnection* connection;
-    uint32_t command;
-    vector<uint8_t> data;
-};
-
 DataPublisher::DataPublisher(const TcpEndPoint& endpoint) :
     m_nodeID(NewGuid()),
     m_securityMode(SecurityMode::None),
@@ -52,28 +45,31 @@ DataPublisher::DataPublisher(const TcpEndPoint& endpoint) :
     m_isNaNValueFilterForced(false),
     m_supportsTemporalSubscriptions(false),
     m_useBaseTimeOffsets(true),
+    m_useCompactPacketDictionary(false),
     m_cipherKeyRotationPeriod(60000),
     m_userData(nullptr),
-    m_disposing(false),
-    m_clientAcceptor(m_commandChannelService, endpoint)
+    m_disposing(NewSharedPtr<atomic<bool>>(false)),
+    m_clientAcceptor(m_commandChannelService, endpoint),
+    m_clientSocket(m_commandChannelService)
 {
-    // Run call-back thread
-    Thread([&,this]
+    // Run call-back thread, dispatchers hold connections which hold the publisher, so releasing
+    // a dispatcher can destroy the publisher -- disposing state is shared so it can be checked after
+    m_callbackThread = Thread([this, disposing = m_disposing]
     {
-        while (true)
+        while (!*disposing)
         {
             m_callbackQueue.WaitForData();
 
-            if (m_disposing)
+            if (*disposing)
                 break;
 
-            const CallbackDispatcher dispatcher = m_callbackQueue.Dequeue();
-            dispatcher.Function(dispatcher.Source, *dispatcher.Data);
+            CallbackDispatcher dispatcher = m_callbackQueue.Dequeue();
+            InvokeDispatcher(dispatcher);
         }
     });
 
     // Run command channel accept thread
-    Thread([&,this]
+    m_commandChannelAcceptThread = Thread([&,this]
     {
         StartAccept();
         m_commandChannelService.run();
@@ -92,26 +88,51 @@ DataPublisher::DataPublisher(const string& networkInterface, uint16_t port) :
 
 DataPublisher::~DataPublisher()
 {
-    m_disposing = true;
+    *m_disposing = true;
+
+    // Release queue and stop command channel service so that threads can shut down gracefully
+    m_callbackQueue.Release();
+    m_commandChannelService.stop();
+
+    // Last reference can be released from a publisher thread, which cannot join with itself
+    for (Thread* thread : { &m_callbackThread, &m_commandChannelAcceptThread })
+    {
+        if (thread->get_id() == boost::this_thread::get_id())
+            thread->detach();
+        else
+            thread->join();
+    }
 }
 
-DataPublisher::CallbackDispatcher::CallbackDispatcher() :
-    Source(nullptr),
-    Data(nullptr),
-    Function(nullptr)
+DataPublisher::CallbackDispatcher::CallbackDispatcher(DispatchType type) :
+    Type(type),
+    Command(0)
 {
 }
 
 void DataPublisher::StartAccept()
 {
-    const SubscriberConnectionPtr connection = NewSharedPtr<SubscriberConnection, DataPublisherPtr, IOContext&>(shared_from_this(), m_commandChannelService);
-    m_clientAcceptor.async_accept(connection->CommandChannelSocket(), boost::bind(&DataPublisher::AcceptConnection, this, connection, boost::asio::placeholders::error));
+    m_clientAcceptor.async_accept(m_clientSocket, boost::bind(&DataPublisher::AcceptConnection, this, boost::asio::placeholders::error));
 }
 
-void DataPublisher::AcceptConnection(const SubscriberConnectionPtr& connection, const ErrorCode& error)
+void DataPublisher::AcceptConnection(const ErrorCode& error)
 {
-    if (!error)
+    // Accepted connections share ownership of the publisher, so connection is only created
+    // once a client has been accepted, i.e., after the publisher is owned by a shared pointer
+    const DataPublisherPtr publisher = error ? nullptr : weak_from_this().lock();
+
+    if (!error && publisher == nullptr)
     {
+        DispatchErrorMessage("Subscriber connection refused: publisher is not owned by a shared pointer.");
+        m_clientSocket.close();
+    }
+    else if (!error)
+    {
+        const SubscriberConnectionPtr connection = NewSharedPtr<SubscriberConnection, DataPublisherPtr, IOContext&>(publisher, m_commandChannelService);
+        // Hand accepted socket to connection, moved-from socket has no executor so replace it for next accept
+        connection->CommandChannelSocket() = std::move(m_clientSocket);
+        m_clientSocket = TcpSocket(m_commandChannelService);
+
         WriterLock writeLock(m_subscriberConnectionsLock);
         const bool connectionAccepted = m_maximumAllowedConnections == -1 || static_cast<int32_t>(m_subscriberConnections.size()) < m_maximumAllowedConnections;
         m_subscriberConnections.insert(connection);
@@ -153,195 +174,267 @@ void DataPublisher::RemoveConnection(const SubscriberConnectionPtr& connection)
     m_subscriberConnections.erase(connection);
 }
 
-void DataPublisher::Dispatch(const DispatcherFunction& function)
+void DataPublisher::Dispatch(CallbackDispatcher&& dispatcher)
 {
-    Dispatch(function, nullptr, 0, 0);
+    m_callbackQueue.Enqueue(std::move(dispatcher));
 }
 
-void DataPublisher::Dispatch(const DispatcherFunction& function, const uint8_t* data, uint32_t offset, uint32_t length)
+void DataPublisher::Dispatch(DispatchType type, SubscriberConnection* connection)
 {
-    CallbackDispatcher dispatcher;
-    SharedPtr<vector<uint8_t>> dataVector = NewSharedPtr<vector<uint8_t>>();
-
-    dataVector->resize(length);
-
-    if (data != nullptr)
-    {
-        for (uint32_t i = 0; i < length; ++i)
-            dataVector->at(i) = data[offset + i];
-    }
-
-    dispatcher.Source = this;
-    dispatcher.Data = dataVector;
-    dispatcher.Function = function;
-
-    m_callbackQueue.Enqueue(dispatcher);
+    CallbackDispatcher dispatcher(type);
+    dispatcher.Connection = connection->GetReference();
+    Dispatch(std::move(dispatcher));
 }
 
-void DataPublisher::DispatchStatusMessage(const string& message)
+void DataPublisher::DispatchStatusMessage(string message)
 {
-    const uint32_t messageSize = ConvertUInt32((message.size() + 1) * sizeof(char));
-    Dispatch(&StatusMessageDispatcher, reinterpret_cast<const uint8_t*>(message.c_str()), 0, messageSize);
+    CallbackDispatcher dispatcher(DispatchType::StatusMessage);
+    dispatcher.Message = std::move(message);
+    Dispatch(std::move(dispatcher));
 }
 
-void DataPublisher::DispatchErrorMessage(const string& message)
+void DataPublisher::DispatchErrorMessage(string message)
 {
-    const uint32_t messageSize = ConvertUInt32((message.size() + 1) * sizeof(char));
-    Dispatch(&ErrorMessageDispatcher, reinterpret_cast<const uint8_t*>(message.c_str()), 0, messageSize);
+    CallbackDispatcher dispatcher(DispatchType::ErrorMessage);
+    dispatcher.Message = std::move(message);
+    Dispatch(std::move(dispatcher));
 }
 
 void DataPublisher::DispatchClientConnected(SubscriberConnection* connection)
 {
-    Dispatch(&ClientConnectedDispatcher, reinterpret_cast<uint8_t*>(&connection), 0, sizeof(SubscriberConnection**));
+    Dispatch(DispatchType::ClientConnected, connection);
 }
 
 void DataPublisher::DispatchClientDisconnected(SubscriberConnection* connection)
 {
-    Dispatch(&ClientDisconnectedDispatcher, reinterpret_cast<uint8_t*>(&connection), 0, sizeof(SubscriberConnection**));
+    Dispatch(DispatchType::ClientDisconnected, connection);
 }
 
 void DataPublisher::DispatchProcessingIntervalChangeRequested(SubscriberConnection* connection)
 {
-    Dispatch(&ProcessingIntervalChangeRequestedDispatcher, reinterpret_cast<uint8_t*>(&connection), 0, sizeof(SubscriberConnection**));
+    Dispatch(DispatchType::ProcessingIntervalChangeRequested, connection);
 }
 
 void DataPublisher::DispatchTemporalSubscriptionRequested(SubscriberConnection* connection)
 {
-    Dispatch(&TemporalSubscriptionRequestedDispatcher, reinterpret_cast<uint8_t*>(&connection), 0, sizeof(SubscriberConnection**));
+    Dispatch(DispatchType::TemporalSubscriptionRequested, connection);
 }
 
 void DataPublisher::DispatchTemporalSubscriptionCanceled(SubscriberConnection* connection)
 {
-    Dispatch(&TemporalSubscriptionCanceledDispatcher, reinterpret_cast<uint8_t*>(&connection), 0, sizeof(SubscriberConnection**));
+    Dispatch(DispatchType::TemporalSubscriptionCanceled, connection);
 }
 
 void DataPublisher::DispatchUserCommand(SubscriberConnection* connection, uint32_t command, const uint8_t* data, uint32_t length)
 {
-    // ReSharper disable once CppNonReclaimedResourceAcquisition
-    UserCommandData* userCommandData = new UserCommandData();
-    userCommandData->connection = connection;
-    userCommandData->command = command;
-
-    for (size_t i = 0; i < length; i++)
-        userCommandData->data.push_back(data[i]);
-
-    Dispatch(&UserCommandDispatcher, reinterpret_cast<uint8_t*>(&userCommandData), 0, sizeof(UserCommandData**));
+    CallbackDispatcher dispatcher(DispatchType::UserCommand);
+    dispatcher.Connection = connection->GetReference();
+    dispatcher.Command = command;
+    dispatcher.Data = m_dispatchBufferPool.Acquire(data, length);
+    Dispatch(std::move(dispatcher));
 }
 
-// Dispatcher function for status messages. Decodes the message and provides it to the user via the status message callback.
-void DataPublisher::StatusMessageDispatcher(DataPublisher* source, const vector<uint8_t>& buffer)
+// Provides a dispatched record to the user via its associated callback. This is only called from the callback thread.
+void DataPublisher::InvokeDispatcher(CallbackDispatcher& dispatcher)
 {
-    if (source == nullptr)
-        return;
+    SubscriberConnectionCallback connectionCallback;
 
-    const MessageCallback statusMessageCallback = source->m_statusMessageCallback;
+    switch (dispatcher.Type)
+    {
+        case DispatchType::StatusMessage:
+        {
+            const MessageCallback statusMessageCallback = m_statusMessageCallback;
 
-    if (statusMessageCallback != nullptr)
-        statusMessageCallback(source, reinterpret_cast<const char*>(&buffer[0]));
-}
+            if (statusMessageCallback != nullptr)
+                statusMessageCallback(this, dispatcher.Message);
 
-// Dispatcher function for error messages. Decodes the message and provides it to the user via the error message callback.
-void DataPublisher::ErrorMessageDispatcher(DataPublisher* source, const vector<uint8_t>& buffer)
-{
-    if (source == nullptr)
-        return;
+            return;
+        }
+        case DispatchType::ErrorMessage:
+        {
+            const MessageCallback errorMessageCallback = m_errorMessageCallback;
 
-    const MessageCallback errorMessageCallback = source->m_errorMessageCallback;
+            if (errorMessageCallback != nullptr)
+                errorMessageCallback(this, dispatcher.Message);
 
-    if (errorMessageCallback != nullptr)
-        errorMessageCallback(source, reinterpret_cast<const char*>(&buffer[0]));
-}
+            return;
+        }
+        case DispatchType::UserCommand:
+        {
+            const UserCommandCallback userCommandCallback = m_userCommandCallback;
 
-void DataPublisher::ClientConnectedDispatcher(DataPublisher* source, const vector<uint8_t>& buffer)
-{
-    SubscriberConnection* connection = *reinterpret_cast<SubscriberConnection**>(const_cast<uint8_t*>(&buffer[0]));
+            if (userCommandCallback != nullptr)
+                userCommandCallback(this, dispatcher.Connection, dispatcher.Command, dispatcher.Data);
 
-    if (source != nullptr)
-    {
-        const SubscriberConnectionCallback clientConnectedCallback = source->m_clientConnectedCallback;
-
-        if (clientConnectedCallback != nullptr)
-            clientConnectedCallback(source, connection->GetReference());
+            m_dispatchBufferPool.Release(std::move(dispatcher.Data));
+            return;
+        }
+        case DispatchType::ClientConnected:
+            connectionCallback = m_clientConnectedCallback;
+            break;
+        case DispatchType::ClientDisconnected:
+            connectionCallback = m_clientDisconnectedCallback;
+            break;
+        case DispatchType::ProcessingIntervalChangeRequested:
+            connectionCallback = m_processingIntervalChangeRequestedCallback;
+            break;
+        case DispatchType::TemporalSubscriptionRequested:
+            connectionCallback = m_temporalSubscriptionRequestedCallback;
+            break;
+        case DispatchType::TemporalSubscriptionCanceled:
+            connectionCallback = m_temporalSubscriptionCanceledCallback;
+            break;
     }
+
+    if (connectionCallback != nullptr)
+        connectionCallback(this, dispatcher.Connection);
+
+    if (dispatcher.Type == DispatchType::ClientDisconnected)
+        RemoveConnection(dispatcher.Connection);
 }
 
-void DataPublisher::ClientDisconnectedDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer)
+int32_t DataPublisher::GetColumnIndex(const GSF::Data::DataTablePtr& table, const std::string& columnName)
 {
-    SubscriberConnection* connection = *reinterpret_cast<SubscriberConnection**>(const_cast<uint8_t*>(&buffer[0]));
-
-    if (source != nullptr)
-    {
-        const SubscriberConnectionCallback clientDisconnectedCallback = source->m_clientDisconnectedCallback;
+        const DataColumnPtr& column = table->Column(columnName);
+    
+        if (column == nullptr)
+            throw PublisherException("Column name \"" + columnName + "\" was not found in table \"" + table->Name() + "\"");
+    
+        return column->Index();
+}
 
-        if (clientDisconnectedCallback != nullptr)
-            clientDisconnectedCallback(source, connection->GetReference());
+template<class T>
+static bool NullableEqual(const Nullable<T>& left, const Nullable<T>& right)
+{
+    if (left.HasValue() != right.HasValue())
+        return false;
 
-        source->RemoveConnection(connection->GetReference());
-    }
+    return !left.HasValue() || left.GetValueOrDefault() == right.GetValueOrDefault();
 }
 
-void DataPublisher::ProcessingIntervalChangeRequestedDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer)
+// Determines if non-computed values of two rows from tables with the same schema are equal
+static bool RowValuesEqual(const DataTablePtr& table, const DataRowPtr& left, const DataRowPtr& right)
 {
-    SubscriberConnection* connection = *reinterpret_cast<SubscriberConnection**>(const_cast<uint8_t*>(&buffer[0]));
-
-    if (source != nullptr)
+    for (int32_t i = 0; i < table->ColumnCount(); i++)
     {
-        const SubscriberConnectionCallback temporalProcessingIntervalChangeRequestedCallback = source->m_processingIntervalChangeRequestedCallback;
+        const DataColumnPtr& column = table->Column(i);
+        bool equal;
+
+        if (column->Computed())
+            continue;
 
-        if (temporalProcessingIntervalChangeRequestedCallback != nullptr)
-            temporalProcessingIntervalChangeRequestedCallback(source, connection->GetReference());
+        switch (column->Type())
+        {
+            case DataType::String:
+                equal = NullableEqual(left->ValueAsString(i), right->ValueAsString(i));
+                break;
+            case DataType::Boolean:
+                equal = NullableEqual(left->ValueAsBoolean(i), right->ValueAsBoolean(i));
+                break;
+            case DataType::DateTime:
+                equal = NullableEqual(left->ValueAsDateTime(i), right->ValueAsDateTime(i));
+                break;
+            case DataType::Single:
+                equal = NullableEqual(left->ValueAsSingle(i), right->ValueAsSingle(i));
+                break;
+            case DataType::Double:
+                equal = NullableEqual(left->ValueAsDouble(i), right->ValueAsDouble(i));
+                break;
+            case DataType::Decimal:
+                equal = NullableEqual(left->ValueAsDecimal(i), right->ValueAsDecimal(i));
+                break;
+            case DataType::Guid:
+                equal = NullableEqual(left->ValueAsGuid(i), right->ValueAsGuid(i));
+                break;
+            case DataType::Int8:
+                equal = NullableEqual(left->ValueAsInt8(i), right->ValueAsInt8(i));
+                break;
+            case DataType::Int16:
+                equal = NullableEqual(left->ValueAsInt16(i), right->ValueAsInt16(i));
+                break;
+            case DataType::Int32:
+                equal = NullableEqual(left->ValueAsInt32(i), right->ValueAsInt32(i));
+                break;
+            case DataType::Int64:
+                equal = NullableEqual(left->ValueAsInt64(i), right->ValueAsInt64(i));
+                break;
+            case DataType::UInt8:
+                equal = NullableEqual(left->ValueAsUInt8(i), right->ValueAsUInt8(i));
+                break;
+            case DataType::UInt16:
+                equal = NullableEqual(left->ValueAsUInt16(i), right->ValueAsUInt16(i));
+                break;
+            case DataType::UInt32:
+                equal = NullableEqual(left->ValueAsUInt32(i), right->ValueAsUInt32(i));
+                break;
+            case DataType::UInt64:
+                equal = NullableEqual(left->ValueAsUInt64(i), right->ValueAsUInt64(i));
+                break;
+            default:
+                throw DataSetException("Unexpected column data type encountered");
+        }
+
+        if (!equal)
+            return false;
     }
+
+    return true;
 }
 
-void DataPublisher::TemporalSubscriptionRequestedDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer)
+DataSetPtr DataPublisher::GetChangedMetadata(const DataSetPtr& previousFilteringMetadata, const DataSetPtr& filteringMetadata, unordered_set<Guid>& changedSignalIDs)
 {
-    SubscriberConnection* connection = *reinterpret_cast<SubscriberConnection**>(const_cast<uint8_t*>(&buffer[0]));
+    DataSetPtr changedMetadata = DataSet::FromXml(ActiveMeasurementsSchema, ActiveMeasurementsSchemaLength);
+    const DataTablePtr& changedMeasurements = changedMetadata->Table("ActiveMeasurements");
+    const DataTablePtr& activeMeasurements = filteringMetadata->Table("ActiveMeasurements");
+    const int32_t signalIDColumn = GetColumnIndex(activeMeasurements, "SignalID");
+    unordered_map<Guid, DataRowPtr> previousRows;
 
-    if (source != nullptr)
+    if (previousFilteringMetadata != nullptr)
     {
-        const SubscriberConnectionCallback temporalSubscriptionRequestedCallback = source->m_temporalSubscriptionRequestedCallback;
+        const DataTablePtr& previousMeasurements = previousFilteringMetadata->Table("ActiveMeasurements");
 
-        if (temporalSubscriptionRequestedCallback != nullptr)
-            temporalSubscriptionRequestedCallback(source, connection->GetReference());
-    }
-}
+        for (int32_t i = 0; i < previousMeasurements->RowCount(); i++)
+        {
+            const DataRowPtr& row = previousMeasurements->Row(i);
 
-void DataPublisher::TemporalSubscriptionCanceledDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer)
-{
-    SubscriberConnection* connection = *reinterpret_cast<SubscriberConnection**>(const_cast<uint8_t*>(&buffer[0]));
+            if (row != nullptr)
+                previousRows.emplace(row->ValueAsGuid(signalIDColumn).GetValueOrDefault(), row);
+        }
+    }
 
-    if (source != nullptr)
+    // Copy added and changed rows
+    for (int32_t i = 0; i < activeMeasurements->RowCount(); i++)
     {
-        const SubscriberConnectionCallback temporalSubscriptionCanceledCallback = source->m_temporalSubscriptionCanceledCallback;
+        const DataRowPtr& row = activeMeasurements->Row(i);
 
-        if (temporalSubscriptionCanceledCallback != nullptr)
-            temporalSubscriptionCanceledCallback(source, connection->GetReference());
-    }
-}
+        if (row == nullptr)
+            continue;
 
-void DataPublisher::UserCommandDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer)
-{
-    UserCommandData* userCommandData = *reinterpret_cast<UserCommandData**>(const_cast<uint8_t*>(&buffer[0]));
+        const Guid signalID = row->ValueAsGuid(signalIDColumn).GetValueOrDefault();
+        const auto iterator = previousRows.find(signalID);
 
-    if (source != nullptr && userCommandData != nullptr)
-    {
-        const UserCommandCallback userCommandCallback = source->m_userCommandCallback;
+        if (iterator != previousRows.end())
+        {
+            const bool unchanged = RowValuesEqual(activeMeasurements, row, iterator->second);
+            previousRows.erase(iterator);
 
-        if (userCommandCallback != nullptr)
-            userCommandCallback(source, userCommandData->connection->GetReference(), userCommandData->command, userCommandData->data);
+            if (unchanged)
+                continue;
+        }
+
+        changedSignalIDs.insert(signalID);
+        changedMeasurements->AddRow(changedMeasurements->CloneRow(row));
     }
 
-    delete userCommandData;
-}
+    // Remaining previous rows were removed
+    for (const auto& pair : previousRows)
+        changedSignalIDs.insert(pair.first);
 
-int32_t DataPublisher::GetColumnIndex(const GSF::Data::DataTablePtr& table, const std::string& columnName)
-{
-        const DataColumnPtr& column = table->Column(columnName);
-    
-        if (column == nullptr)
-            throw PublisherException("Column name \"" + columnName + "\" was not found in table \"" + table->Name() + "\"");
-    
-        return column->Index();
+    changedMeasurements->CreateIndex("SignalID");
+    changedMeasurements->CreateIndex("ID");
+    changedMeasurements->CreateIndex("PointTag");
+
+    return changedMetadata;
 }
 
 void DataPublisher::DefineMetadata(const vector<DeviceMetadataPtr>& deviceMetadata, const vector<MeasurementMetadataPtr>& measurementMetadata, const vector<PhasorMetadataPtr>& phasorMetadata, const int32_t versionNumber)
@@ -723,13 +816,31 @@ void DataPublisher::DefineMetadata(const DataSetPtr& metadata)
 
             activeMeasurements->AddRow(am_row);
         }
+
+        // Index identifier columns commonly used to select specific measurements
+        activeMeasurements->CreateIndex("SignalID");
+        activeMeasurements->CreateIndex("ID");
+        activeMeasurements->CreateIndex("PointTag");
     }
 
     m_filteringMetadata.swap(filteringMetadata);
 
-    // Notify all subscribers that the configuration metadata has changed
     ReaderLock readLock(m_subscriberConnectionsLock);
 
+    if (!m_subscriberConnections.empty())
+    {
+        unordered_set<Guid> changedSignalIDs;
+        const DataSetPtr changedMetadata = GetChangedMetadata(filteringMetadata, m_filteringMetadata, changedSignalIDs);
+
+        // Re-apply subscription filters to measurements that were added, removed or changed
+        if (!changedSignalIDs.empty())
+        {
+            for (const auto& connection : m_subscriberConnections)
+                connection->UpdateSubscription(m_filteringMetadata, changedMetadata, changedSignalIDs);
+        }
+    }
+
+    // Notify all subscribers that the configuration metadata has changed
     for (const auto& connection : m_subscriberConnections)
         connection->SendResponse(ServerResponse::ConfigurationChanged, ServerCommand::Subscribe);
 }
@@ -893,6 +1004,16 @@ void DataPublisher::SetUseBaseTimeOffsets(bool value)
     m_useBaseTimeOffsets = value;
 }
 
+bool DataPublisher::GetUseCompactPacketDictionary() const
+{
+    return m_useCompactPacketDictionary;
+}
+
+void DataPublisher::SetUseCompactPacketDictionary(bool value)
+{
+    m_useCompactPacketDictionary = value;
+}
+
 void* DataPublisher::GetUserData() const
 {
     return m_userData;
@@ -939,6 +1060,18 @@ uint64_t DataPublisher::GetTotalMeasurementsSent()
     return totalMeasurementsSent;
 }
 
+PublicationStatistics DataPublisher::GetStatistics()
+{
+    PublicationStatistics statistics;
+
+    ReaderLock readLock(m_subscriberConnectionsLock);
+
+    for (const auto& connection : m_subscriberConnections)
+        statistics.Add(connection->GetStatistics());
+
+    return statistics;
+}
+
 void DataPublisher::RegisterStatusMessageCallback(const MessageCallback& statusMessageCallback)
 {
     m_statusMessageCallback = statusMessageCallback;
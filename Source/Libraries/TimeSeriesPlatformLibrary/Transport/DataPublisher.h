@@ -26,11 +26,13 @@
 
 #include "../Common/CommonTypes.h"
 #include "../Common/ThreadSafeQueue.h"
+#include "../Common/BufferPool.h"
 #include "../Data/DataSet.h"
 #include "SubscriberConnection.h"
 #include "RoutingTables.h"
 #include "TransportTypes.h"
 #include "Constants.h"
+#include <atomic>
 
 namespace GSF {
 namespace FilterExpressions
@@ -47,21 +49,36 @@ namespace Transport
     {
     public:
         // Function pointer types
-        typedef std::function<void(DataPublisher*, const std::vector<uint8_t>&)> DispatcherFunction;
         typedef std::function<void(DataPublisher*, const std::string&)> MessageCallback;
         typedef std::function<void(DataPublisher*, const SubscriberConnectionPtr&)> SubscriberConnectionCallback;
         typedef std::function<void(DataPublisher*, const SubscriberConnectionPtr&, uint32_t, const std::vector<uint8_t>&)> UserCommandCallback;
 
     private:
-        // Structure used to dispatch
-        // callbacks on the callback thread.
+        // Fixed set of callbacks that can
+        // be dispatched to the callback thread.
+        enum class DispatchType : uint8_t
+        {
+            StatusMessage,
+            ErrorMessage,
+            ClientConnected,
+            ClientDisconnected,
+            ProcessingIntervalChangeRequested,
+            TemporalSubscriptionRequested,
+            TemporalSubscriptionCanceled,
+            UserCommand
+        };
+
+        // Structure used to dispatch callbacks on the callback
+        // thread, moved through the queue rather than copied.
         struct CallbackDispatcher
         {
-            DataPublisher* Source;
-            SharedPtr<std::vector<uint8_t>> Data;
-            DispatcherFunction Function;
+            DispatchType Type;
+            std::string Message;
+            SubscriberConnectionPtr Connection;
+            uint32_t Command;
+            std::vector<uint8_t> Data;
 
-            CallbackDispatcher();
+            CallbackDispatcher(DispatchType type = DispatchType::StatusMessage);
         };
 
         GSF::Guid m_nodeID;
@@ -77,20 +94,25 @@ namespace Transport
         bool m_isNaNValueFilterForced;
         bool m_supportsTemporalSubscriptions;
         bool m_useBaseTimeOffsets;
+        bool m_useCompactPacketDictionary;
         uint32_t m_cipherKeyRotationPeriod;
         void* m_userData;
-        bool m_disposing;
+        GSF::SharedPtr<std::atomic<bool>> m_disposing;
 
         // Callback queue
+        GSF::Thread m_callbackThread;
         ThreadSafeQueue<CallbackDispatcher> m_callbackQueue;
+        BufferPool m_dispatchBufferPool;
 
         // Command channel
+        GSF::Thread m_commandChannelAcceptThread;
         GSF::IOContext m_commandChannelService;
         GSF::TcpAcceptor m_clientAcceptor;
+        GSF::TcpSocket m_clientSocket;
 
         // Command channel handlers
         void StartAccept();
-        void AcceptConnection(const SubscriberConnectionPtr& connection, const ErrorCode& error);
+        void AcceptConnection(const ErrorCode& error);
         void ConnectionTerminated(const SubscriberConnectionPtr& connection);
         void RemoveConnection(const SubscriberConnectionPtr& connection);
 
@@ -105,26 +127,22 @@ namespace Transport
         UserCommandCallback m_userCommandCallback;
 
         // Dispatchers
-        void Dispatch(const DispatcherFunction& function);
-        void Dispatch(const DispatcherFunction& function, const uint8_t* data, uint32_t offset, uint32_t length);
-        void DispatchStatusMessage(const std::string& message);
-        void DispatchErrorMessage(const std::string& message);
+        void Dispatch(CallbackDispatcher&& dispatcher);
+        void Dispatch(DispatchType type, SubscriberConnection* connection);
+        void DispatchStatusMessage(std::string message);
+        void DispatchErrorMessage(std::string message);
         void DispatchClientConnected(SubscriberConnection* connection);
         void DispatchClientDisconnected(SubscriberConnection* connection);
         void DispatchProcessingIntervalChangeRequested(SubscriberConnection* connection);
         void DispatchTemporalSubscriptionRequested(SubscriberConnection* connection);
         void DispatchTemporalSubscriptionCanceled(SubscriberConnection* connection);
         void DispatchUserCommand(SubscriberConnection* connection, uint32_t command, const uint8_t* data, uint32_t length);
+        void InvokeDispatcher(CallbackDispatcher& dispatcher);
 
-        static void StatusMessageDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer);
-        static void ErrorMessageDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer);
-        static void ClientConnectedDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer);
-        static void ClientDisconnectedDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer);
-        static void ProcessingIntervalChangeRequestedDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer);
-        static void TemporalSubscriptionRequestedDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer);
-        static void TemporalSubscriptionCanceledDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer);
-        static void UserCommandDispatcher(DataPublisher* source, const std::vector<uint8_t>& buffer);
         static int32_t GetColumnIndex(const GSF::Data::DataTablePtr& table, const std::string& columnName);
+
+        // Gets ActiveMeasurements rows that were added or changed since previous filtering metadata, changed signal IDs also include removed measurements
+        static GSF::Data::DataSetPtr GetChangedMetadata(const GSF::Data::DataSetPtr& previousFilteringMetadata, const GSF::Data::DataSetPtr& filteringMetadata, std::unordered_set<GSF::Guid>& changedSignalIDs);
     public:
         // Creates a new instance of the data publisher.
         DataPublisher(const GSF::TcpEndPoint& endpoint);
@@ -194,6 +212,11 @@ namespace Transport
         bool GetUseBaseTimeOffsets() const;
         void SetUseBaseTimeOffsets(bool value);
 
+        // Gets or sets flag that determines if compressed compact packets, used when requested by
+        // UDP subscribers, are primed with a dictionary derived from the signal index cache - defaults to false
+        bool GetUseCompactPacketDictionary() const;
+        void SetUseCompactPacketDictionary(bool value);
+
         // Gets or sets user defined data reference
         void* GetUserData() const;
         void SetUserData(void* userData);
@@ -203,6 +226,10 @@ namespace Transport
         uint64_t GetTotalDataChannelBytesSent();
         uint64_t GetTotalMeasurementsSent();
 
+        // Gets a snapshot of publication statistics totaled for all connections,
+        // use CalculateRates between two snapshots to derive rates and averages
+        PublicationStatistics GetStatistics();
+
         // Callback registration
         //
         // Callback functions are defined with the following signatures:
@@ -225,15 +225,19 @@ bool SubscriberConnector::GetAutoReconnect() const
 // --- DataSubscriber ---
 
 DataSubscriber::DataSubscriber() :
+    DataSubscriber(nullptr)
+{
+}
+
+DataSubscriber::DataSubscriber(SubscriberExecutorPtr executor) :
     m_subscriberID(Empty::Guid),
     m_compressPayloadData(true),
+    m_payloadCompressionMode(CompressionModes::TSSC),
     m_compressMetadata(true),
     m_compressSignalIndexCache(true),
+    m_trackCurrentValues(false),
     m_disconnecting(false),
     m_userData(nullptr),
-    m_totalCommandChannelBytesReceived(0UL),
-    m_totalDataChannelBytesReceived(0UL),
-    m_totalMeasurementsReceived(0UL),
     m_connected(false),
     m_subscribed(false),
     m_signalIndexCache(nullptr),
@@ -241,10 +245,18 @@ DataSubscriber::DataSubscriber() :
     m_baseTimeOffsets { 0, 0 },
     m_tsscResetRequested(false),
     m_tsscSequenceNumber(0),
-    m_commandChannelSocket(m_commandChannelService),
+    m_currentValueTable(nullptr),
+    m_frameAssembler(nullptr),
+    m_frameAssemblyLagTime(Ticks::PerSecond),
+    m_frameAssemblerStale(false),
+    m_executor(std::move(executor)),
+    m_ioContext(m_executor == nullptr ? m_commandChannelService : m_executor->GetIOContext()),
+    m_callbackStrand(m_executor == nullptr ? m_commandChannelService : m_executor->GetCallbackContext()),
+    m_commandChannelSocket(m_ioContext),
     m_readBuffer(Common::MaxPacketSize),
     m_writeBuffer(Common::MaxPacketSize),
-    m_dataChannelSocket(m_dataChannelService)
+    m_dataChannelSocket(m_executor == nullptr ? m_dataChannelService : m_ioContext),
+    m_frameAssemblyTimer(m_ioContext)
 {
 }
 
@@ -254,10 +266,9 @@ DataSubscriber::~DataSubscriber()
     Disconnect();
 }
 
-DataSubscriber::CallbackDispatcher::CallbackDispatcher() :
-    Source(nullptr),
-    Data(nullptr),
-    Function(nullptr)
+DataSubscriber::CallbackDispatcher::CallbackDispatcher(DispatchType type) :
+    Type(type),
+    Timestamp(0)
 {
 }
 
@@ -271,8 +282,8 @@ void DataSubscriber::RunCallbackThread()
         if (m_disconnecting)
             break;
 
-        const CallbackDispatcher dispatcher = m_callbackQueue.Dequeue();
-        dispatcher.Function(dispatcher.Source, *dispatcher.Data);
+        CallbackDispatcher dispatcher = m_callbackQueue.Dequeue();
+        InvokeDispatcher(dispatcher);
     }
 }
 
@@ -311,7 +322,7 @@ void DataSubscriber::ReadPayloadHeader(const ErrorCode& error, size_t bytesTrans
     }
 
     // Gather statistics
-    m_totalCommandChannelBytesReceived += Common::PayloadHeaderSize;
+    m_totalCommandChannelBytesReceived.Add(Common::PayloadHeaderSize);
 
     const uint32_t packetSize = EndianConverter::ToLittleEndian<uint32_t>(m_readBuffer.data(), PacketSizeOffset);
 
@@ -349,7 +360,8 @@ void DataSubscriber::ReadPacket(const ErrorCode& error, size_t bytesTransferred)
     }
 
     // Gather statistics
-    m_totalCommandChannelBytesReceived += bytesTransferred;
+    m_totalCommandChannelBytesReceived.Add(bytesTransferred);
+    m_totalCommandChannelPacketsReceived.Increment();
 
     // Process response
     ProcessServerResponse(&m_readBuffer[0], 0, ConvertUInt32(bytesTransferred));
@@ -385,12 +397,76 @@ void DataSubscriber::RunDataChannelResponseThread()
         }
 
         // Gather statistics
-        m_totalDataChannelBytesReceived += length;
+        m_totalDataChannelBytesReceived.Add(length);
+        m_totalDataChannelPacketsReceived.Increment();
 
         ProcessServerResponse(&buffer[0], 0, length);
     }
 }
 
+// Starts an asynchronous receive on the data channel, used instead of
+// the data channel thread when running on a shared executor.
+void DataSubscriber::ReadDataChannel()
+{
+    m_dataChannelSocket.async_receive_from(asio::buffer(m_dataChannelBuffer), m_dataChannelEndPoint, bind(&DataSubscriber::ReadDataChannelPacket, this, _1, _2));
+}
+
+// Callback for async receive on the data channel.
+void DataSubscriber::ReadDataChannelPacket(const ErrorCode& error, size_t bytesTransferred)
+{
+    if (m_disconnecting || error == error::operation_aborted)
+        return;
+
+    if (error)
+    {
+        stringstream errorMessageStream;
+        errorMessageStream << "Error reading data from data channel: ";
+        errorMessageStream << SystemError(error).what();
+        DispatchErrorMessage(errorMessageStream.str());
+        return;
+    }
+
+    // Gather statistics
+    m_totalDataChannelBytesReceived.Add(bytesTransferred);
+    m_totalDataChannelPacketsReceived.Increment();
+
+    ProcessServerResponse(&m_dataChannelBuffer[0], 0, ConvertUInt32(bytesTransferred));
+    ReadDataChannel();
+}
+
+// Waits for handlers already queued for this subscriber on the shared executor to complete.
+// Socket handlers for a subscriber all run on one single-threaded I/O context and callbacks
+// are serialized on a strand, so a marker posted to each will execute after prior work.
+void DataSubscriber::WaitForPendingHandlers()
+{
+    const auto waitFor = [](auto& executor)
+    {
+        // Cannot wait on ourselves, e.g., when disconnect is called from a callback
+        if (executor.running_in_this_thread())
+            return;
+
+        Mutex completedLock;
+        WaitHandle completedWaitHandle;
+        bool completed = false;
+
+        post(executor, [&]
+        {
+            ScopeLock lock(completedLock);
+            completed = true;
+            completedWaitHandle.notify_all();
+        });
+
+        UniqueLock lock(completedLock);
+
+        while (!completed)
+            completedWaitHandle.wait(lock);
+    };
+
+    IOContext::executor_type ioExecutor = m_ioContext.get_executor();
+    waitFor(ioExecutor);
+    waitFor(m_callbackStrand);
+}
+
 // Processes a response sent by the server. Response codes are defined in the header file "Constants.h".
 void DataSubscriber::ProcessServerResponse(uint8_t* buffer, uint32_t offset, uint32_t length)
 {
@@ -525,19 +601,25 @@ void DataSubscriber::HandleFailed(uint8_t commandCode, uint8_t* data, uint32_t o
 // Handles metadata refresh messages from the server.
 void DataSubscriber::HandleMetadataRefresh(uint8_t* data, uint32_t offset, uint32_t length)
 {
-    Dispatch(&MetadataDispatcher, data, offset, length);
+    CallbackDispatcher dispatcher(DispatchType::Metadata);
+    dispatcher.Data = m_dispatchBufferPool.Acquire(data + offset, length);
+    Dispatch(std::move(dispatcher));
 }
 
 // Handles data start time reported by the server at the beginning of a subscription.
 void DataSubscriber::HandleDataStartTime(uint8_t* data, uint32_t offset, uint32_t length)
 {
-    Dispatch(&DataStartTimeDispatcher, data, offset, length);
+    CallbackDispatcher dispatcher(DispatchType::DataStartTime);
+    dispatcher.Timestamp = EndianConverter::ToBigEndian<int64_t>(data, offset);
+    Dispatch(std::move(dispatcher));
 }
 
 // Handles processing complete message sent by the server at the end of a temporal session.
 void DataSubscriber::HandleProcessingComplete(uint8_t* data, uint32_t offset, uint32_t length)
 {
-    Dispatch(&ProcessingCompleteDispatcher, data, offset, length);
+    CallbackDispatcher dispatcher(DispatchType::ProcessingComplete);
+    dispatcher.Message.assign(reinterpret_cast<const char*>(data + offset), length);
+    Dispatch(std::move(dispatcher));
 }
 
 // Cache signal IDs sent by the server into the signal index cache.
@@ -567,7 +649,30 @@ void DataSubscriber::HandleUpdateSignalIndexCache(uint8_t* data, uint32_t offset
 
     SignalIndexCachePtr signalIndexCache = NewSharedPtr<SignalIndexCache>();
     signalIndexCache->Parse(uncompressedBuffer, m_subscriberID);
-    m_signalIndexCache.swap(signalIndexCache);
+
+    // Current value table is indexed by runtime ID so it must be replaced along with the cache,
+    // latest values of runtime IDs that keep their signal across the update are carried over
+    const CurrentValueTablePtr currentValueTable = boost::atomic_load(&m_currentValueTable);
+    CurrentValueTablePtr updatedValueTable = nullptr;
+
+    if (m_trackCurrentValues)
+    {
+        if (currentValueTable == nullptr)
+            updatedValueTable = NewSharedPtr<CurrentValueTable>(signalIndexCache);
+        else
+            updatedValueTable = NewSharedPtr<CurrentValueTable, SignalIndexCachePtr, const CurrentValueTable&>(signalIndexCache, *currentValueTable);
+    }
+
+    boost::atomic_store(&m_signalIndexCache, signalIndexCache);
+    boost::atomic_store(&m_currentValueTable, updatedValueTable);
+
+    // Frame positions are resolved by runtime ID, so frame assembler, and its pending
+    // frames, only need to be rebuilt when the update changes those positions
+    ScopeLock lock(m_frameAssemblyLock);
+    const DataFrameAssemblerPtr frameAssembler = boost::atomic_load(&m_frameAssembler);
+
+    if (frameAssembler == nullptr || !frameAssembler->HasSameFramePositions(*signalIndexCache))
+        m_frameAssemblerStale = true;
 }
 
 // Updates base time offsets.
@@ -589,16 +694,44 @@ void DataSubscriber::HandleUpdateBaseTimes(uint8_t* data, uint32_t offset, uint3
 // Handles configuration changed message sent by the server at the end of a temporal session.
 void DataSubscriber::HandleConfigurationChanged(uint8_t* data, uint32_t offset, uint32_t length)
 {
-    Dispatch(&ConfigurationChangedDispatcher);
+    Dispatch(CallbackDispatcher(DispatchType::ConfigurationChanged));
 }
 
 // Handles data packets from the server. Decodes the measurements and provides them to the user via the new measurements callback.
 void DataSubscriber::HandleDataPacket(uint8_t* data, uint32_t offset, uint32_t length)
 {
     const NewMeasurementsCallback newMeasurementsCallback = m_newMeasurementsCallback;
+    const NewDataFramesCallback newDataFramesCallback = m_newDataFramesCallback;
+    const bool frameAssemblerStale = newDataFramesCallback != nullptr && m_frameAssemblerStale;
+    DataFrameAssemblerPtr frameAssembler = nullptr;
+
+    // Stale flag is cleared before the snapshot is taken so any newer cache marks it stale again
+    if (frameAssemblerStale)
+        m_frameAssemblerStale = false;
+
+    // Cache is replaced by the command channel, use a single snapshot for the entire packet
+    const SignalIndexCachePtr signalIndexCache = boost::atomic_load(&m_signalIndexCache);
+
+    // Current value table is replaced separately from the cache, so values are only stored in a table
+    // indexed by the same cache snapshot, packets received while both are being replaced are skipped
+    CurrentValueTablePtr currentValueTable = boost::atomic_load(&m_currentValueTable);
+
+    if (currentValueTable != nullptr && currentValueTable->GetSignalIndexCache() != signalIndexCache)
+        currentValueTable = nullptr;
+
+    m_totalDataPacketsReceived.Increment();
+
+    if (newDataFramesCallback != nullptr)
+    {
+        if (frameAssemblerStale)
+            UpdateFrameAssembler(signalIndexCache);
+
+        frameAssembler = boost::atomic_load(&m_frameAssembler);
+    }
 
-    if (newMeasurementsCallback != nullptr)
+    if (newMeasurementsCallback != nullptr || currentValueTable != nullptr || frameAssembler != nullptr)
     {
+        const int64_t startTime = GetStatisticsTime();
         SubscriptionInfo& info = m_subscriptionInfo;
         uint8_t dataPacketFlags;
         int64_t frameLevelTimestamp = -1;
@@ -619,36 +752,102 @@ void DataSubscriber::HandleDataPacket(uint8_t* data, uint32_t offset, uint32_t l
 
         // Read measurement count and gather statistics
         const uint32_t count = EndianConverter::ToBigEndian<uint32_t>(data, offset);
-        m_totalMeasurementsReceived += count;
+        m_totalMeasurementsReceived.Add(count);
         offset += 4; //-V112
 
         vector<MeasurementPtr> measurements;
+        vector<uint16_t> signalIndexes;
+
+        measurements.reserve(count);
+        signalIndexes.reserve(count);
 
         if (dataPacketFlags & DataPacketFlags::Compressed)
-            ParseTSSCMeasurements(data, offset, length, measurements);
+        {
+            ParseCompressedMeasurements(signalIndexCache, data, offset, length, measurements, signalIndexes);
+        }
+        else if (dataPacketFlags & DataPacketFlags::PacketCompressed)
+        {
+            uint32_t packetLength;
+
+            try
+            {
+                m_compactPacketCodec.SetDictionarySource(signalIndexCache);
+                packetLength = m_compactPacketCodec.Decompress(data + offset, length - offset, m_compactPacketBuffer);
+            }
+            catch (SubscriberException& ex)
+            {
+                m_totalDecompressionFailures.Increment();
+                DispatchErrorMessage(string("Decompression failure: ") + ex.what());
+                return;
+            }
+
+            ParseCompactMeasurements(signalIndexCache, m_compactPacketBuffer.data(), 0, packetLength, includeTime, info.UseMillisecondResolution, frameLevelTimestamp, measurements, signalIndexes);
+        }
         else
-            ParseCompactMeasurements(data, offset, length, includeTime, info.UseMillisecondResolution, frameLevelTimestamp, measurements);
+        {
+            ParseCompactMeasurements(signalIndexCache, data, offset, length, includeTime, info.UseMillisecondResolution, frameLevelTimestamp, measurements, signalIndexes);
+        }
+
+        m_totalDecodeTime.Add(GetStatisticsTime() - startTime);
 
-        newMeasurementsCallback(this, measurements);
+        if (currentValueTable != nullptr || frameAssembler != nullptr)
+        {
+            if (currentValueTable != nullptr)
+            {
+                for (size_t i = 0; i < measurements.size(); i++)
+                {
+                    const Measurement& measurement = *measurements[i];
+                    currentValueTable->Update(signalIndexes[i], measurement.Timestamp, measurement.Value, static_cast<uint32_t>(measurement.Flags));
+                }
+            }
+
+            if (frameAssembler != nullptr)
+            {
+                // Lag timer also delivers frames, so callback is never invoked concurrently
+                ScopeLock deliveryLock(m_frameDeliveryLock);
+                vector<DataFramePtr> frames;
+
+                // Constrain assembly lock to assembly, callback is invoked without holding it
+                {
+                    ScopeLock lock(m_frameAssemblyLock);
+
+                    for (size_t i = 0; i < measurements.size(); i++)
+                    {
+                        const Measurement& measurement = *measurements[i];
+                        frameAssembler->Assign(signalIndexes[i], measurement.Timestamp, measurement.Value, static_cast<uint32_t>(measurement.Flags), frames);
+                    }
+
+                    frameAssembler->PublishLaggingFrames(frames);
+                }
+
+                if (!frames.empty())
+                    newDataFramesCallback(this, frames);
+            }
+        }
+
+        if (newMeasurementsCallback != nullptr)
+            newMeasurementsCallback(this, measurements);
     }
 }
 
-void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint32_t length, vector<MeasurementPtr>& measurements)
+void DataSubscriber::ParseCompressedMeasurements(const SignalIndexCachePtr& signalIndexCache, uint8_t* data, uint32_t offset, uint32_t length, vector<MeasurementPtr>& measurements, vector<uint16_t>& signalIndexes)
 {
-    MeasurementPtr measurement;
     string errorMessage;
 
-    if (data[offset] != 85)
+    const uint8_t version = data[offset];
+
+    if (version != CompressedPayloadVersion::TSSC && version != CompressedPayloadVersion::XOR64)
     {
         stringstream errorMessageStream;
 
-        errorMessageStream << "TSSC version not recognized: ";
-        errorMessageStream << ToHex(data[offset]);
+        errorMessageStream << "Compressed payload version not recognized: ";
+        errorMessageStream << ToHex(version);
 
         throw SubscriberException(errorMessageStream.str());
     }
     offset++;
 
+    const char* algorithm = version == CompressedPayloadVersion::XOR64 ? "XOR64" : "TSSC";
     const uint16_t sequenceNumber = EndianConverter::ToBigEndian<uint16_t>(data, offset);
     offset += 2;
 
@@ -657,14 +856,17 @@ void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint3
         if (!m_tsscResetRequested)
         {
             stringstream statusMessageStream;
-            statusMessageStream << "TSSC algorithm reset before sequence number: ";
+            statusMessageStream << algorithm;
+            statusMessageStream << " algorithm reset before sequence number: ";
             statusMessageStream << m_tsscSequenceNumber;
             DispatchStatusMessage(statusMessageStream.str());
         }
 
         m_tsscDecoder.Reset();
+        m_xor64Decoder.Reset();
         m_tsscSequenceNumber = 0;
         m_tsscResetRequested = false;
+        m_totalCompressionResets.Increment();
     }
 
     if (m_tsscSequenceNumber != sequenceNumber)
@@ -672,7 +874,8 @@ void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint3
         if (!m_tsscResetRequested)
         {
             stringstream errorMessageStream;
-            errorMessageStream << "TSSC is out of sequence. Expecting: ";
+            errorMessageStream << algorithm;
+            errorMessageStream << " is out of sequence. Expecting: ";
             errorMessageStream << m_tsscSequenceNumber;
             errorMessageStream << ", Received: ";
             errorMessageStream << sequenceNumber;
@@ -680,37 +883,16 @@ void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint3
         }
 
         // Ignore packets until the reset has occurred.
+        m_totalOutOfSequencePackets.Increment();
         return;
     }
 
     try
     {
-        m_tsscDecoder.SetBuffer(data, offset, length);
-
-        Guid signalID;
-        string measurementSource;
-        uint32_t measurementID;
-        uint16_t id;
-        int64_t time;
-        uint32_t quality;
-        float32_t value;
-
-        while (m_tsscDecoder.TryGetMeasurement(id, time, quality, value))
-        {
-            if (m_signalIndexCache->GetMeasurementKey(id, signalID, measurementSource, measurementID))
-            {
-                measurement = NewSharedPtr<Measurement>();
-
-                measurement->SignalID = signalID;
-                measurement->Source = measurementSource;
-                measurement->ID = measurementID;
-                measurement->Timestamp = time;
-                measurement->Flags = static_cast<MeasurementStateFlags>(quality);
-                measurement->Value = value;
-
-                measurements.push_back(measurement);
-            }
-        }
+        if (version == CompressedPayloadVersion::XOR64)
+            ParseXOR64Measurements(signalIndexCache, data, offset, length, measurements, signalIndexes);
+        else
+            ParseTSSCMeasurements(signalIndexCache, data, offset, length, measurements, signalIndexes);
     }
     catch (SubscriberException& ex)
     {
@@ -723,6 +905,8 @@ void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint3
 
     if (errorMessage.length() > 0)
     {
+        m_totalDecompressionFailures.Increment();
+
         stringstream errorMessageStream;
         errorMessageStream << "Decompression failure: ";
         errorMessageStream << errorMessage;
@@ -736,20 +920,87 @@ void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint3
         m_tsscSequenceNumber = 1;
 }
 
-void DataSubscriber::ParseCompactMeasurements(uint8_t* data, uint32_t offset, uint32_t length, bool includeTime, bool useMillisecondResolution, int64_t frameLevelTimestamp, vector<MeasurementPtr>& measurements)
+void DataSubscriber::ParseTSSCMeasurements(const SignalIndexCachePtr& signalIndexCache, uint8_t* data, uint32_t offset, uint32_t length, vector<MeasurementPtr>& measurements, vector<uint16_t>& signalIndexes)
+{
+    m_tsscDecoder.SetBuffer(data, offset, length);
+
+    Guid signalID;
+    string measurementSource;
+    uint32_t measurementID;
+    uint16_t id;
+    int64_t time;
+    uint32_t quality;
+    float32_t value;
+
+    while (m_tsscDecoder.TryGetMeasurement(id, time, quality, value))
+    {
+        if (signalIndexCache->GetMeasurementKey(id, signalID, measurementSource, measurementID))
+        {
+            MeasurementPtr measurement = NewSharedPtr<Measurement>();
+
+            measurement->SignalID = signalID;
+            measurement->Source = measurementSource;
+            measurement->ID = measurementID;
+            measurement->Timestamp = time;
+            measurement->Flags = static_cast<MeasurementStateFlags>(quality);
+            measurement->Value = value;
+            measurement->RuntimeID = id;
+
+            measurements.push_back(measurement);
+            signalIndexes.push_back(id);
+        }
+    }
+}
+
+void DataSubscriber::ParseXOR64Measurements(const SignalIndexCachePtr& signalIndexCache, uint8_t* data, uint32_t offset, uint32_t length, vector<MeasurementPtr>& measurements, vector<uint16_t>& signalIndexes)
+{
+    m_xor64Decoder.SetBuffer(data, offset, length);
+
+    Guid signalID;
+    string measurementSource;
+    uint32_t measurementID;
+    uint16_t id;
+    int64_t time;
+    uint32_t quality;
+    float64_t value;
+
+    while (m_xor64Decoder.TryGetMeasurement(id, time, quality, value))
+    {
+        if (signalIndexCache->GetMeasurementKey(id, signalID, measurementSource, measurementID))
+        {
+            MeasurementPtr measurement = NewSharedPtr<Measurement>();
+
+            measurement->SignalID = signalID;
+            measurement->Source = measurementSource;
+            measurement->ID = measurementID;
+            measurement->Timestamp = time;
+            measurement->Flags = static_cast<MeasurementStateFlags>(quality);
+            measurement->Value = value;
+            measurement->RuntimeID = id;
+
+            measurements.push_back(measurement);
+            signalIndexes.push_back(id);
+        }
+    }
+}
+
+void DataSubscriber::ParseCompactMeasurements(const SignalIndexCachePtr& signalIndexCache, uint8_t* data, uint32_t offset, uint32_t length, bool includeTime, bool useMillisecondResolution, int64_t frameLevelTimestamp, vector<MeasurementPtr>& measurements, vector<uint16_t>& signalIndexes)
 {
     const MessageCallback errorMessageCallback = m_errorMessageCallback;
 
-    if (m_signalIndexCache == nullptr)
+    if (signalIndexCache == nullptr)
         return;
 
     // Create measurement parser
-    CompactMeasurement parser(m_signalIndexCache, m_baseTimeOffsets, includeTime, useMillisecondResolution);
+    CompactMeasurement parser(signalIndexCache, m_baseTimeOffsets, includeTime, useMillisecondResolution);
 
     while (length != offset)
     {
         MeasurementPtr measurement;
 
+        // Runtime ID follows the compact state flags byte
+        const uint16_t signalIndex = length - offset > 2 ? EndianConverter::ToBigEndian<uint16_t>(data, offset + 1) : 0;
+
         if (!parser.TryParseMeasurement(data, offset, length, measurement))
         {
             if (errorMessageCallback != nullptr)
@@ -758,136 +1009,115 @@ void DataSubscriber::ParseCompactMeasurements(uint8_t* data, uint32_t offset, ui
             break;
         }
 
+        if (measurement == nullptr)
+            continue;
+
         if (frameLevelTimestamp > -1)
             measurement->Timestamp = frameLevelTimestamp;
 
         measurements.push_back(measurement);
+        signalIndexes.push_back(signalIndex);
     }
 }
 
-// Dispatches the given function to the callback thread.
-void DataSubscriber::Dispatch(const DispatcherFunction& function)
-{
-    Dispatch(function, nullptr, 0, 0);
-}
-
-// Dispatches the given function to the callback thread and provides the given data to that function when it is called.
-void DataSubscriber::Dispatch(const DispatcherFunction& function, const uint8_t* data, uint32_t offset, uint32_t length)
+// Dispatches the given callback record to the callback thread, taking ownership of its payload.
+void DataSubscriber::Dispatch(CallbackDispatcher&& dispatcher)
 {
-    CallbackDispatcher dispatcher;
-    SharedPtr<vector<uint8_t>> dataVector = NewSharedPtr<vector<uint8_t>>();
-
-    dataVector->resize(length);
-
-    if (data != nullptr)
+    if (m_executor != nullptr)
     {
-        for (uint32_t i = 0; i < length; ++i)
-            dataVector->at(i) = data[offset + i];
+        // Strand preserves callback order for this subscriber on the shared worker pool
+        post(m_callbackStrand, [this, dispatcher = std::move(dispatcher)]() mutable
+        {
+            if (!m_disconnecting)
+                InvokeDispatcher(dispatcher);
+        });
+    }
+    else
+    {
+        m_callbackQueue.Enqueue(std::move(dispatcher));
     }
-
-    dispatcher.Source = this;
-    dispatcher.Data = dataVector;
-    dispatcher.Function = function;
-
-    m_callbackQueue.Enqueue(dispatcher);
 }
 
 // Invokes the status message callback on the callback thread and provides the given message to it.
-void DataSubscriber::DispatchStatusMessage(const string& message)
+void DataSubscriber::DispatchStatusMessage(string message)
 {
-    const uint32_t messageSize = ConvertUInt32((message.size() + 1) * sizeof(char));
-    Dispatch(&StatusMessageDispatcher, reinterpret_cast<const uint8_t*>(message.c_str()), 0, messageSize);
+    CallbackDispatcher dispatcher(DispatchType::StatusMessage);
+    dispatcher.Message = std::move(message);
+    Dispatch(std::move(dispatcher));
 }
 
 // Invokes the error message callback on the callback thread and provides the given message to it.
-void DataSubscriber::DispatchErrorMessage(const string& message)
+void DataSubscriber::DispatchErrorMessage(string message)
 {
-    const uint32_t messageSize = ConvertUInt32((message.size() + 1) * sizeof(char));
-    Dispatch(&ErrorMessageDispatcher, reinterpret_cast<const uint8_t*>(message.c_str()), 0, messageSize);
+    CallbackDispatcher dispatcher(DispatchType::ErrorMessage);
+    dispatcher.Message = std::move(message);
+    Dispatch(std::move(dispatcher));
 }
 
-// Dispatcher function for status messages. Decodes the message and provides it to the user via the status message callback.
-void DataSubscriber::StatusMessageDispatcher(DataSubscriber* source, const vector<uint8_t>& buffer)
+// Provides a dispatched record to the user via its associated callback. This is only called from the callback thread.
+void DataSubscriber::InvokeDispatcher(CallbackDispatcher& dispatcher)
 {
-    if (source == nullptr)
-        return;
-    
-    const MessageCallback statusMessageCallback = source->m_statusMessageCallback;
-    
-    if (statusMessageCallback != nullptr)
-        statusMessageCallback(source, reinterpret_cast<const char*>(&buffer[0]));
-}
-
-// Dispatcher function for error messages. Decodes the message and provides it to the user via the error message callback.
-void DataSubscriber::ErrorMessageDispatcher(DataSubscriber* source, const vector<uint8_t>& buffer)
-{
-    if (source == nullptr)
-        return;
-
-    const MessageCallback errorMessageCallback = source->m_errorMessageCallback;
+    switch (dispatcher.Type)
+    {
+        case DispatchType::StatusMessage:
+        {
+            const MessageCallback statusMessageCallback = m_statusMessageCallback;
 
-    if (errorMessageCallback != nullptr)
-        errorMessageCallback(source, reinterpret_cast<const char*>(&buffer[0]));
-}
+            if (statusMessageCallback != nullptr)
+                statusMessageCallback(this, dispatcher.Message);
 
-// Dispatcher function for data start time. Decodes the start time and provides it to the user via the data start time callback.
-void DataSubscriber::DataStartTimeDispatcher(DataSubscriber* source, const vector<uint8_t>& buffer)
-{
-    if (source == nullptr)
-        return;
+            break;
+        }
+        case DispatchType::ErrorMessage:
+        {
+            const MessageCallback errorMessageCallback = m_errorMessageCallback;
 
-    const DataStartTimeCallback dataStartTimeCallback = source->m_dataStartTimeCallback;
+            if (errorMessageCallback != nullptr)
+                errorMessageCallback(this, dispatcher.Message);
 
-    if (dataStartTimeCallback != nullptr)
-    {
-        const int64_t dataStartTime = EndianConverter::ToBigEndian<int64_t>(buffer.data(), 0);
-        dataStartTimeCallback(source, dataStartTime);
-    }
-}
+            break;
+        }
+        case DispatchType::DataStartTime:
+        {
+            const DataStartTimeCallback dataStartTimeCallback = m_dataStartTimeCallback;
 
-// Dispatcher function for metadata. Provides encoded metadata to the user via the metadata callback.
-void DataSubscriber::MetadataDispatcher(DataSubscriber* source, const vector<uint8_t>& buffer)
-{
-    if (source == nullptr)
-        return;
+            if (dataStartTimeCallback != nullptr)
+                dataStartTimeCallback(this, dispatcher.Timestamp);
 
-    const MetadataCallback metadataCallback = source->m_metadataCallback;
+            break;
+        }
+        case DispatchType::Metadata:
+        {
+            const MetadataCallback metadataCallback = m_metadataCallback;
 
-    if (metadataCallback != nullptr)
-        metadataCallback(source, buffer);
-}
+            if (metadataCallback != nullptr)
+                metadataCallback(this, dispatcher.Data);
 
-// Dispatcher for processing complete message that is sent by the server at the end of a temporal session.
-void DataSubscriber::ProcessingCompleteDispatcher(DataSubscriber* source, const vector<uint8_t>& buffer)
-{
-    if (source == nullptr)
-        return;
+            m_dispatchBufferPool.Release(std::move(dispatcher.Data));
+            break;
+        }
+        case DispatchType::ProcessingComplete:
+        {
+            // Processing complete message is sent by the server at the end of a temporal session
+            const MessageCallback processingCompleteCallback = m_processingCompleteCallback;
 
-    const MessageCallback processingCompleteCallback = source->m_processingCompleteCallback;
+            if (processingCompleteCallback != nullptr)
+                processingCompleteCallback(this, dispatcher.Message);
 
-    if (processingCompleteCallback != nullptr)
-    {
-        stringstream messageStream;
+            break;
+        }
+        case DispatchType::ConfigurationChanged:
+        {
+            const ConfigurationChangedCallback configurationChangedCallback = m_configurationChangedCallback;
 
-        for (uint32_t i = 0; i < buffer.size(); ++i)
-            messageStream << buffer[i];
+            if (configurationChangedCallback != nullptr)
+                configurationChangedCallback(this);
 
-        processingCompleteCallback(source, messageStream.str());
+            break;
+        }
     }
 }
 
-// Dispatcher for processing complete message that is sent by the server at the end of a temporal session.
-void DataSubscriber::ConfigurationChangedDispatcher(DataSubscriber* source, const vector<uint8_t>& buffer)
-{
-    if (source == nullptr)
-        return;
-
-    const ConfigurationChangedCallback configurationChangedCallback = source->m_configurationChangedCallback;
-
-    if (configurationChangedCallback != nullptr)
-        source->m_configurationChangedCallback(source);
-}
-
 // Dispatcher for connection terminated. This is called from its own separate thread
 // in order to cleanly shut down the subscriber in case the connection was terminated
 // by the peer. Additionally, this allows the user to automatically reconnect in their
@@ -927,6 +1157,12 @@ void DataSubscriber::RegisterNewMeasurementsCallback(const NewMeasurementsCallba
     m_newMeasurementsCallback = newMeasurementsCallback;
 }
 
+// Registers the new data frames callback.
+void DataSubscriber::RegisterNewDataFramesCallback(const NewDataFramesCallback& newDataFramesCallback)
+{
+    m_newDataFramesCallback = newDataFramesCallback;
+}
+
 // Registers the processing complete callback.
 void DataSubscriber::RegisterProcessingCompleteCallback(const MessageCallback& processingCompleteCallback)
 {
@@ -956,7 +1192,7 @@ const Guid& DataSubscriber::GetSubscriberID() const
     return m_subscriberID;
 }
 
-// Returns true if payload data is compressed (TSSC only).
+// Returns true if payload data is compressed (TSSC or XOR64, per packet over UDP).
 bool DataSubscriber::IsPayloadDataCompressed() const
 {
     return m_compressPayloadData;
@@ -969,6 +1205,23 @@ void DataSubscriber::SetPayloadDataCompressed(bool compressed)
     m_compressPayloadData = compressed;
 }
 
+// Gets the compression mode requested for payload data, TSSC or XOR64.
+uint32_t DataSubscriber::GetPayloadCompressionMode() const
+{
+    return m_payloadCompressionMode;
+}
+
+// Sets the compression mode requested for payload data. XOR64 preserves full 64-bit
+// values where TSSC reduces values to 32-bit floating point.
+void DataSubscriber::SetPayloadCompressionMode(uint32_t compressionMode)
+{
+    if (compressionMode != CompressionModes::TSSC && compressionMode != CompressionModes::XOR64)
+        throw SubscriberException("Payload compression mode must be TSSC or XOR64");
+
+    // This operational mode can only be changed before connect - dynamic updates not supported
+    m_payloadCompressionMode = compressionMode;
+}
+
 // Returns true if metadata exchange is compressed (GZip only).
 bool DataSubscriber::IsMetadataCompressed() const
 {
@@ -999,6 +1252,116 @@ void DataSubscriber::SetSignalIndexCacheCompressed(bool compressed)
         SendOperationalModes();
 }
 
+// Returns true if the latest value of each subscribed signal is tracked.
+bool DataSubscriber::IsTrackingCurrentValues() const
+{
+    return m_trackCurrentValues;
+}
+
+// Set the value which determines whether the latest value of each subscribed signal is tracked.
+void DataSubscriber::SetTrackingCurrentValues(bool trackCurrentValues)
+{
+    // Table will be created, or no longer replaced, when next signal index cache is received
+    m_trackCurrentValues = trackCurrentValues;
+}
+
+// Gets the current value table, safe to call from any thread.
+CurrentValueTablePtr DataSubscriber::GetCurrentValueTable() const
+{
+    return boost::atomic_load(&m_currentValueTable);
+}
+
+// Gets the current signal index cache, safe to call from any thread.
+SignalIndexCachePtr DataSubscriber::GetSignalIndexCache() const
+{
+    return boost::atomic_load(&m_signalIndexCache);
+}
+
+// Defines the configuration frames used for data frame assembly.
+void DataSubscriber::SetConfigurationFrames(const vector<ConfigurationFramePtr>& configurationFrames)
+{
+    ScopeLock lock(m_frameAssemblyLock);
+    m_configurationFrames = configurationFrames;
+    m_frameAssemblerStale = true;
+}
+
+// Gets the data frame assembly lag time in seconds.
+float64_t DataSubscriber::GetFrameAssemblyLagTime() const
+{
+    return m_frameAssemblyLagTime / static_cast<float64_t>(Ticks::PerSecond);
+}
+
+// Sets the data frame assembly lag time in seconds.
+void DataSubscriber::SetFrameAssemblyLagTime(float64_t lagTime)
+{
+    ScopeLock lock(m_frameAssemblyLock);
+    m_frameAssemblyLagTime = static_cast<int64_t>(lagTime * Ticks::PerSecond);
+    m_frameAssemblerStale = true;
+}
+
+// Gets the frame assembly statistics for the current signal index cache.
+DataFrameStatistics DataSubscriber::GetFrameAssemblyStatistics() const
+{
+    // Counters are updated under assembly lock by the data thread and the lag timer
+    ScopeLock lock(m_frameAssemblyLock);
+    const DataFrameAssemblerPtr frameAssembler = boost::atomic_load(&m_frameAssembler);
+
+    if (frameAssembler == nullptr)
+        return DataFrameStatistics();
+
+    return frameAssembler->GetStatistics();
+}
+
+// Rebuilds frame assembler for given signal index cache and configuration frames, called from data thread.
+void DataSubscriber::UpdateFrameAssembler(const SignalIndexCachePtr& signalIndexCache)
+{
+    ScopeLock lock(m_frameAssemblyLock);
+    DataFrameAssemblerPtr frameAssembler = nullptr;
+
+    if (signalIndexCache != nullptr && !m_configurationFrames.empty())
+        frameAssembler = NewSharedPtr<DataFrameAssembler>(signalIndexCache, m_configurationFrames, m_frameAssemblyLagTime);
+
+    boost::atomic_store(&m_frameAssembler, frameAssembler);
+}
+
+// Schedules next lag check at half the lag time so frames pending when values stop
+// arriving are published within one and a half lag times, called with assembly lock held.
+void DataSubscriber::ScheduleFrameAssemblyTimer()
+{
+    const int64_t interval = m_frameAssemblyLagTime / Ticks::PerMillisecond / 2LL;
+
+    m_frameAssemblyTimer.expires_from_now(boost::posix_time::milliseconds(interval < 10LL ? 10LL : interval));
+    m_frameAssemblyTimer.async_wait(bind(&DataSubscriber::FrameAssemblyTimerElapsed, this, _1));
+}
+
+// Publishes lagging frames independent of packet arrival, called from command channel context.
+void DataSubscriber::FrameAssemblyTimerElapsed(const ErrorCode& error)
+{
+    if (error || m_disconnecting)
+        return;
+
+    const NewDataFramesCallback newDataFramesCallback = m_newDataFramesCallback;
+    const DataFrameAssemblerPtr frameAssembler = boost::atomic_load(&m_frameAssembler);
+    ScopeLock deliveryLock(m_frameDeliveryLock);
+    vector<DataFramePtr> frames;
+
+    // Constrain assembly lock to assembly and rescheduling, callback is invoked without holding it
+    {
+        ScopeLock lock(m_frameAssemblyLock);
+
+        if (m_disconnecting)
+            return;
+
+        if (newDataFramesCallback != nullptr && frameAssembler != nullptr)
+            frameAssembler->PublishLaggingFrames(frames);
+
+        ScheduleFrameAssemblyTimer();
+    }
+
+    if (!frames.empty())
+        newDataFramesCallback(this, frames);
+}
+
 // Gets user defined data reference
 void* DataSubscriber::GetUserData() const
 {
@@ -1024,21 +1387,34 @@ const SubscriptionInfo& DataSubscriber::GetSubscriptionInfo() const
 
 void DataSubscriber::SetSubscriptionInfo(const SubscriptionInfo& info)
 {
+    const bool udpDataChannelChanged = m_subscriptionInfo.UdpDataChannel != info.UdpDataChannel;
+
     m_subscriptionInfo = info;
+
+    // Requested payload compression mode depends on data channel type
+    if (udpDataChannelChanged && m_compressPayloadData && m_commandChannelSocket.is_open())
+        SendOperationalModes();
 }
 
 // Synchronously connects to publisher.
 void DataSubscriber::Connect(const string& hostname, const uint16_t port)
 {
-    DnsResolver resolver(m_commandChannelService);
+    DnsResolver resolver(m_ioContext);
     const DnsResolver::query query(hostname, to_string(port));
     const DnsResolver::iterator endpointIterator = resolver.resolve(query);
     DnsResolver::iterator hostEndpoint;
     ErrorCode error;
 
-    m_totalCommandChannelBytesReceived = 0UL;
-    m_totalDataChannelBytesReceived = 0UL;
-    m_totalMeasurementsReceived = 0UL;
+    m_totalCommandChannelBytesReceived.Reset();
+    m_totalDataChannelBytesReceived.Reset();
+    m_totalCommandChannelPacketsReceived.Reset();
+    m_totalDataChannelPacketsReceived.Reset();
+    m_totalDataPacketsReceived.Reset();
+    m_totalMeasurementsReceived.Reset();
+    m_totalDecodeTime.Reset();
+    m_totalCompressionResets.Reset();
+    m_totalOutOfSequencePackets.Reset();
+    m_totalDecompressionFailures.Reset();
 
     if (m_connected)
         throw SubscriberException("Subscriber is already connected; disconnect first");
@@ -1053,12 +1429,27 @@ void DataSubscriber::Connect(const string& hostname, const uint16_t port)
 
     m_hostAddress = hostEndpoint->endpoint().address();
 
-    m_commandChannelService.restart();
-    m_callbackThread = Thread(bind(&DataSubscriber::RunCallbackThread, this));
-    m_commandChannelResponseThread = Thread(bind(&DataSubscriber::RunCommandChannelResponseThread, this));
+    if (m_executor != nullptr)
+    {
+        // Shared executor is already running, just start reading the command channel
+        async_read(m_commandChannelSocket, buffer(m_readBuffer, Common::PayloadHeaderSize), bind(&DataSubscriber::ReadPayloadHeader, this, _1, _2));
+    }
+    else
+    {
+        m_commandChannelService.restart();
+        m_callbackThread = Thread(bind(&DataSubscriber::RunCallbackThread, this));
+        m_commandChannelResponseThread = Thread(bind(&DataSubscriber::RunCommandChannelResponseThread, this));
+    }
 
     SendOperationalModes();
     m_connected = true;
+
+    // Lag timer is only needed when values are assembled into frames
+    if (m_newDataFramesCallback != nullptr)
+    {
+        ScopeLock lock(m_frameAssemblyLock);
+        ScheduleFrameAssemblyTimer();
+    }
 }
 
 void DataSubscriber::Disconnect(bool autoReconnect)
@@ -1078,11 +1469,25 @@ void DataSubscriber::Disconnect(bool autoReconnect)
     m_dataChannelSocket.shutdown(UdpSocket::shutdown_receive, error);
     m_dataChannelSocket.close(error);
 
-    // Join with all threads to guarantee their completion
-    // before returning control to the caller
-    m_callbackThread.join();
-    m_commandChannelResponseThread.join();
-    m_dataChannelResponseThread.join();
+    // Timer handler checks disconnecting flag under the same lock before rescheduling
+    {
+        ScopeLock lock(m_frameAssemblyLock);
+        m_frameAssemblyTimer.cancel(error);
+    }
+
+    // Join with all threads, or wait for all queued handlers when using
+    // a shared executor, to guarantee their completion before returning
+    // control to the caller
+    if (m_executor != nullptr)
+    {
+        WaitForPendingHandlers();
+    }
+    else
+    {
+        m_callbackThread.join();
+        m_commandChannelResponseThread.join();
+        m_dataChannelResponseThread.join();
+    }
 
     // Empty queues and reset them so they can be used
     // again later if the user decides to reconnect
@@ -1104,7 +1509,9 @@ void DataSubscriber::Disconnect(bool autoReconnect)
     else
     {
         m_connector.Cancel();
-        m_commandChannelService.stop();
+
+        if (m_executor == nullptr)
+            m_commandChannelService.stop();
     }
 
     // Disconnect completed
@@ -1144,17 +1551,17 @@ void DataSubscriber::Subscribe()
     if (m_subscribed)
         Unsubscribe();
 
-    m_totalMeasurementsReceived = 0UL;
+    m_totalMeasurementsReceived.Reset();
 
     connectionStream << "trackLatestMeasurements=" << m_subscriptionInfo.Throttled << ";";
-    connectionStream << "publishInterval" << m_subscriptionInfo.PublishInterval << ";";
+    connectionStream << "publishInterval=" << m_subscriptionInfo.PublishInterval << ";";
     connectionStream << "includeTime=" << m_subscriptionInfo.IncludeTime << ";";
     connectionStream << "lagTime=" << m_subscriptionInfo.LagTime << ";";
     connectionStream << "leadTime=" << m_subscriptionInfo.LeadTime << ";";
     connectionStream << "useLocalClockAsRealTime=" << m_subscriptionInfo.UseLocalClockAsRealTime << ";";
     connectionStream << "processingInterval=" << m_subscriptionInfo.ProcessingInterval << ";";
     connectionStream << "useMillisecondResolution=" << m_subscriptionInfo.UseMillisecondResolution << ";";
-    connectionStream << "requestNaNValueFilter" << m_subscriptionInfo.RequestNaNValueFilter << ";";
+    connectionStream << "requestNaNValueFilter=" << m_subscriptionInfo.RequestNaNValueFilter << ";";
     connectionStream << "assemblyInfo={source=TimeSeriesPlatformLibrary; version=" GSFTS_VERSION "; buildDate=" GSFTS_BUILD_DATE "};";
 
     if (!m_subscriptionInfo.FilterExpression.empty())
@@ -1170,7 +1577,16 @@ void DataSubscriber::Subscribe()
         // Attempt to bind to local UDP port
         m_dataChannelSocket.open(ipVersion);
         m_dataChannelSocket.bind(udp::endpoint(ipVersion, m_subscriptionInfo.DataChannelLocalPort));
-        m_dataChannelResponseThread = Thread(bind(&DataSubscriber::RunDataChannelResponseThread, this));
+
+        if (m_executor != nullptr)
+        {
+            m_dataChannelBuffer.resize(Common::MaxPacketSize);
+            ReadDataChannel();
+        }
+        else
+        {
+            m_dataChannelResponseThread = Thread(bind(&DataSubscriber::RunDataChannelResponseThread, this));
+        }
 
         if (!m_dataChannelSocket.is_open())
             throw SubscriberException("Failed to bind to local port");
@@ -1210,7 +1626,7 @@ void DataSubscriber::Subscribe()
 
     SendServerCommand(ServerCommand::Subscribe, &buffer[0], 0, bufferSize);
 
-    // Reset TSSC decompresser on successful (re)subscription
+    // Reset TSSC and XOR64 decompressers on successful (re)subscription
     m_tsscResetRequested = true;
 }
 
@@ -1332,9 +1748,12 @@ void DataSubscriber::SendOperationalModes()
     operationalModes |= OperationalEncoding::UTF8;
     operationalModes |= OperationalModes::UseCommonSerializationFormat;
 
-    // TSSC compression only works with stateful connections
+    // TSSC and XOR64 compression only work with stateful connections, UDP
+    // data channels use independently compressed compact packets instead
     if (m_compressPayloadData && !m_subscriptionInfo.UdpDataChannel)
-        operationalModes |= OperationalModes::CompressPayloadData | CompressionModes::TSSC;
+        operationalModes |= OperationalModes::CompressPayloadData | m_payloadCompressionMode;
+    else if (m_compressPayloadData)
+        operationalModes |= OperationalModes::CompressCompactPackets;
 
     if (m_compressMetadata)
         operationalModes |= OperationalModes::CompressMetadata;
@@ -1349,22 +1768,41 @@ void DataSubscriber::SendOperationalModes()
 // Gets the total number of bytes received via the command channel since last connection.
 uint64_t DataSubscriber::GetTotalCommandChannelBytesReceived() const
 {
-    return m_totalCommandChannelBytesReceived;
+    return m_totalCommandChannelBytesReceived.Value();
 }
 
 // Gets the total number of bytes received via the data channel since last connection.
 uint64_t DataSubscriber::GetTotalDataChannelBytesReceived() const
 {
     if (m_subscriptionInfo.UdpDataChannel)
-        return m_totalDataChannelBytesReceived;
+        return m_totalDataChannelBytesReceived.Value();
 
-    return m_totalCommandChannelBytesReceived;
+    return m_totalCommandChannelBytesReceived.Value();
 }
 
 // Gets the total number of measurements received since last subscription.
 uint64_t DataSubscriber::GetTotalMeasurementsReceived() const
 {
-    return m_totalMeasurementsReceived;
+    return m_totalMeasurementsReceived.Value();
+}
+
+// Gets a snapshot of subscription statistics since last connection.
+SubscriptionStatistics DataSubscriber::GetStatistics() const
+{
+    SubscriptionStatistics statistics;
+
+    statistics.CommandChannelBytesReceived = m_totalCommandChannelBytesReceived.Value();
+    statistics.DataChannelBytesReceived = m_totalDataChannelBytesReceived.Value();
+    statistics.CommandChannelPacketsReceived = m_totalCommandChannelPacketsReceived.Value();
+    statistics.DataChannelPacketsReceived = m_totalDataChannelPacketsReceived.Value();
+    statistics.DataPacketsReceived = m_totalDataPacketsReceived.Value();
+    statistics.MeasurementsReceived = m_totalMeasurementsReceived.Value();
+    statistics.DecodeTime = m_totalDecodeTime.Value();
+    statistics.CompressionResets = m_totalCompressionResets.Value();
+    statistics.OutOfSequencePackets = m_totalOutOfSequencePackets.Value();
+    statistics.DecompressionFailures = m_totalDecompressionFailures.Value();
+
+    return statistics;
 }
 
 // Indicates whether the subscriber is connected.
@@ -28,8 +28,15 @@
 
 #include "TransportTypes.h"
 #include "SignalIndexCache.h"
+#include "CurrentValueTable.h"
+#include "DataFrameAssembler.h"
+#include "SubscriberExecutor.h"
 #include "TSSCDecoder.h"
+#include "XOR64Decoder.h"
+#include "CompactPacketCodec.h"
+#include "TransportStatistics.h"
 #include "../Common/ThreadSafeQueue.h"
+#include "../Common/BufferPool.h"
 
 namespace GSF {
 namespace TimeSeries {
@@ -141,24 +148,37 @@ namespace Transport
     {
     public:
         // Function pointer types
-        typedef std::function<void(DataSubscriber*, const std::vector<uint8_t>&)> DispatcherFunction;
         typedef std::function<void(DataSubscriber*, const std::string&)> MessageCallback;
         typedef std::function<void(DataSubscriber*, int64_t)> DataStartTimeCallback;
         typedef std::function<void(DataSubscriber*, const std::vector<uint8_t>&)> MetadataCallback;
         typedef std::function<void(DataSubscriber*, const std::vector<MeasurementPtr>&)> NewMeasurementsCallback;
+        typedef std::function<void(DataSubscriber*, const std::vector<DataFramePtr>&)> NewDataFramesCallback;
         typedef std::function<void(DataSubscriber*)> ConfigurationChangedCallback;
         typedef std::function<void(DataSubscriber*)> ConnectionTerminatedCallback;
 
     private:
-        // Structure used to dispatch
-        // callbacks on the callback thread.
+        // Fixed set of callbacks that can
+        // be dispatched to the callback thread.
+        enum class DispatchType : uint8_t
+        {
+            StatusMessage,
+            ErrorMessage,
+            DataStartTime,
+            Metadata,
+            ProcessingComplete,
+            ConfigurationChanged
+        };
+
+        // Structure used to dispatch callbacks on the callback
+        // thread, moved through the queue rather than copied.
         struct CallbackDispatcher
         {
-            DataSubscriber* Source;
-            SharedPtr<std::vector<uint8_t>> Data;
-            DispatcherFunction Function;
+            DispatchType Type;
+            std::string Message;
+            std::vector<uint8_t> Data;
+            int64_t Timestamp;
 
-            CallbackDispatcher();
+            CallbackDispatcher(DispatchType type = DispatchType::StatusMessage);
         };
 
         SubscriberConnector m_connector;
@@ -166,15 +186,24 @@ namespace Transport
         IPAddress m_hostAddress;
         Guid m_subscriberID;
         bool m_compressPayloadData;
+        uint32_t m_payloadCompressionMode;
         bool m_compressMetadata;
         bool m_compressSignalIndexCache;
+        bool m_trackCurrentValues;
         volatile bool m_disconnecting;
         void* m_userData;
 
-        // Statistics counters
-        uint64_t m_totalCommandChannelBytesReceived;
-        uint64_t m_totalDataChannelBytesReceived;
-        uint64_t m_totalMeasurementsReceived;
+        // Statistics counters, updated without locks from socket and parsing threads
+        StatisticsCounter m_totalCommandChannelBytesReceived;
+        StatisticsCounter m_totalDataChannelBytesReceived;
+        StatisticsCounter m_totalCommandChannelPacketsReceived;
+        StatisticsCounter m_totalDataChannelPacketsReceived;
+        StatisticsCounter m_totalDataPacketsReceived;
+        StatisticsCounter m_totalMeasurementsReceived;
+        StatisticsCounter m_totalDecodeTime;
+        StatisticsCounter m_totalCompressionResets;
+        StatisticsCounter m_totalOutOfSequencePackets;
+        StatisticsCounter m_totalDecompressionFailures;
         bool m_connected;
         bool m_subscribed;
 
@@ -183,24 +212,53 @@ namespace Transport
         int32_t m_timeIndex;
         int64_t m_baseTimeOffsets[2];
         TSSCDecoder m_tsscDecoder;
+        XOR64Decoder m_xor64Decoder;
+
+        // Independently compressed compact packets, only the data receive thread decompresses
+        CompactPacketCodec m_compactPacketCodec;
+        std::vector<uint8_t> m_compactPacketBuffer;
         bool m_tsscResetRequested;
         uint16_t m_tsscSequenceNumber;
 
+        // Latest value tracking, table is replaced with each signal index cache
+        CurrentValueTablePtr m_currentValueTable;
+
+        // Frame assembly, assembler is rebuilt on data thread when cache or configuration changes,
+        // assembly lock serializes assembler access between the data thread and the lag timer,
+        // delivery lock is held across assembly and callback so frames are delivered in order
+        std::vector<ConfigurationFramePtr> m_configurationFrames;
+        DataFrameAssemblerPtr m_frameAssembler;
+        mutable Mutex m_frameAssemblyLock;
+        Mutex m_frameDeliveryLock;
+        int64_t m_frameAssemblyLagTime;
+        volatile bool m_frameAssemblerStale;
+
         // Callback thread members
         Thread m_callbackThread;
         ThreadSafeQueue<CallbackDispatcher> m_callbackQueue;
+        BufferPool m_dispatchBufferPool;
+
+        // Shared executor, when defined, replaces the callback and channel threads
+        SubscriberExecutorPtr m_executor;
 
         // Command channel
         Thread m_commandChannelResponseThread;
         boost::asio::io_context m_commandChannelService;
+        boost::asio::io_context m_dataChannelService;
+        IOContext& m_ioContext;
+        Strand m_callbackStrand;
         TcpSocket m_commandChannelSocket;
         std::vector<uint8_t> m_readBuffer;
         std::vector<uint8_t> m_writeBuffer;
 
         // Data channel
         Thread m_dataChannelResponseThread;
-        boost::asio::io_context m_dataChannelService;
         UdpSocket m_dataChannelSocket;
+        std::vector<uint8_t> m_dataChannelBuffer;
+        boost::asio::ip::udp::endpoint m_dataChannelEndPoint;
+
+        // Publishes lagging frames when values stop arriving, runs on command channel context
+        DeadlineTimer m_frameAssemblyTimer;
 
         // Callbacks
         MessageCallback m_statusMessageCallback;
@@ -208,6 +266,7 @@ namespace Transport
         DataStartTimeCallback m_dataStartTimeCallback;
         MetadataCallback m_metadataCallback;
         NewMeasurementsCallback m_newMeasurementsCallback;
+        NewDataFramesCallback m_newDataFramesCallback;
         MessageCallback m_processingCompleteCallback;
         ConfigurationChangedCallback m_configurationChangedCallback;
         ConnectionTerminatedCallback m_connectionTerminatedCallback;
@@ -218,6 +277,11 @@ namespace Transport
         void RunCommandChannelResponseThread();
         void RunDataChannelResponseThread();
 
+        // Shared executor data channel handlers
+        void ReadDataChannel();
+        void ReadDataChannelPacket(const ErrorCode& error, size_t bytesTransferred);
+        void WaitForPendingHandlers();
+
         // Command channel callbacks
         void ReadPayloadHeader(const ErrorCode& error, size_t bytesTransferred);
         void ReadPacket(const ErrorCode& error, size_t bytesTransferred);
@@ -234,21 +298,19 @@ namespace Transport
         void HandleUpdateBaseTimes(uint8_t* data, uint32_t offset, uint32_t length);
         void HandleConfigurationChanged(uint8_t* data, uint32_t offset, uint32_t length);
         void HandleDataPacket(uint8_t* data, uint32_t offset, uint32_t length);
-        void ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint32_t length, std::vector<MeasurementPtr>& measurements);
-        void ParseCompactMeasurements(uint8_t* data, uint32_t offset, uint32_t length, bool includeTime, bool useMillisecondResolution, int64_t frameLevelTimestamp, std::vector<MeasurementPtr>& measurements);
+        void ParseCompressedMeasurements(const SignalIndexCachePtr& signalIndexCache, uint8_t* data, uint32_t offset, uint32_t length, std::vector<MeasurementPtr>& measurements, std::vector<uint16_t>& signalIndexes);
+        void ParseTSSCMeasurements(const SignalIndexCachePtr& signalIndexCache, uint8_t* data, uint32_t offset, uint32_t length, std::vector<MeasurementPtr>& measurements, std::vector<uint16_t>& signalIndexes);
+        void ParseXOR64Measurements(const SignalIndexCachePtr& signalIndexCache, uint8_t* data, uint32_t offset, uint32_t length, std::vector<MeasurementPtr>& measurements, std::vector<uint16_t>& signalIndexes);
+        void ParseCompactMeasurements(const SignalIndexCachePtr& signalIndexCache, uint8_t* data, uint32_t offset, uint32_t length, bool includeTime, bool useMillisecondResolution, int64_t frameLevelTimestamp, std::vector<MeasurementPtr>& measurements, std::vector<uint16_t>& signalIndexes);
+        void UpdateFrameAssembler(const SignalIndexCachePtr& signalIndexCache);
+        void ScheduleFrameAssemblyTimer();
+        void FrameAssemblyTimerElapsed(const ErrorCode& error);
 
         // Dispatchers
-        void Dispatch(const DispatcherFunction& function);
-        void Dispatch(const DispatcherFunction& function, const uint8_t* data, uint32_t offset, uint32_t length);
-        void DispatchStatusMessage(const std::string& message);
-        void DispatchErrorMessage(const std::string& message);
-
-        static void StatusMessageDispatcher(DataSubscriber* source, const std::vector<uint8_t>& buffer);
-        static void ErrorMessageDispatcher(DataSubscriber* source, const std::vector<uint8_t>& buffer);
-        static void DataStartTimeDispatcher(DataSubscriber* source, const std::vector<uint8_t>& buffer);
-        static void MetadataDispatcher(DataSubscriber* source, const std::vector<uint8_t>& buffer);
-        static void ProcessingCompleteDispatcher(DataSubscriber* source, const std::vector<uint8_t>& buffer);
-        static void ConfigurationChangedDispatcher(DataSubscriber* source, const std::vector<uint8_t>& buffer);
+        void Dispatch(CallbackDispatcher&& dispatcher);
+        void DispatchStatusMessage(std::string message);
+        void DispatchErrorMessage(std::string message);
+        void InvokeDispatcher(CallbackDispatcher& dispatcher);
 
         // The connection terminated callback is a special case that
         // must be called on its own separate thread so that it can
@@ -262,6 +324,10 @@ namespace Transport
         // Creates a new instance of the data subscriber.
         DataSubscriber();
 
+        // Creates a new instance of the data subscriber that runs its socket operations
+        // and callbacks on the provided shared executor instead of its own threads.
+        explicit DataSubscriber(SubscriberExecutorPtr executor);
+
         // Releases all threads and sockets
         // tied up by the subscriber.
         ~DataSubscriber();
@@ -274,6 +340,7 @@ namespace Transport
         //   void HandleDataStartTime(DataSubscriber* source, int64_t startTime)
         //   void HandleMetadata(DataSubscriber* source, const vector<uint8_t>& metadata)
         //   void HandleNewMeasurements(DataSubscriber* source, const vector<MeasurementPtr>& newMeasurements)
+        //   void HandleNewDataFrames(DataSubscriber* source, const vector<DataFramePtr>& newDataFrames)
         //   void HandleProcessingComplete(DataSubscriber* source, const string& message)
         //   void HandleConfigurationChanged(DataSubscriber* source)
         //   void HandleConnectionTerminated(DataSubscriber* source)
@@ -285,6 +352,7 @@ namespace Transport
         void RegisterDataStartTimeCallback(const DataStartTimeCallback& dataStartTimeCallback);
         void RegisterMetadataCallback(const MetadataCallback& metadataCallback);
         void RegisterNewMeasurementsCallback(const NewMeasurementsCallback& newMeasurementsCallback);
+        void RegisterNewDataFramesCallback(const NewDataFramesCallback& newDataFramesCallback);
         void RegisterProcessingCompleteCallback(const MessageCallback& processingCompleteCallback);
         void RegisterConfigurationChangedCallback(const ConfigurationChangedCallback& configurationChangedCallback);
         void RegisterConnectionTerminatedCallback(const ConnectionTerminatedCallback& connectionTerminatedCallback);
@@ -293,10 +361,16 @@ namespace Transport
         const Guid& GetSubscriberID() const;
 
         // Gets or sets value that determines whether
-        // payload data is compressed using TSSC.
+        // payload data is compressed using TSSC or XOR64,
+        // or with independently compressed packets over UDP.
         bool IsPayloadDataCompressed() const;
         void SetPayloadDataCompressed(bool compressed);
 
+        // Gets or sets the payload compression mode, CompressionModes::TSSC (default)
+        // or CompressionModes::XOR64 for full-precision 64-bit values.
+        uint32_t GetPayloadCompressionMode() const;
+        void SetPayloadCompressionMode(uint32_t compressionMode);
+
         // Gets or sets value that determines whether the
         // metadata transfer is compressed using GZip.
         bool IsMetadataCompressed() const;
@@ -307,6 +381,33 @@ namespace Transport
         bool IsSignalIndexCacheCompressed() const;
         void SetSignalIndexCacheCompressed(bool compressed);
 
+        // Gets or sets value that determines whether the latest value of
+        // each subscribed signal is maintained in a current value table.
+        // Should be set before subscribing.
+        bool IsTrackingCurrentValues() const;
+        void SetTrackingCurrentValues(bool trackCurrentValues);
+
+        // Gets the current value table, safe to call from any thread. Returns nullptr if
+        // tracking is disabled or no signal index cache has been received. A new table is
+        // created each time the signal index cache changes.
+        CurrentValueTablePtr GetCurrentValueTable() const;
+
+        // Gets the signal index cache that defines the runtime IDs of received measurements,
+        // safe to call from any thread. Returns nullptr if no cache has been received.
+        SignalIndexCachePtr GetSignalIndexCache() const;
+
+        // Defines the configuration frames used to assemble received values into data frames,
+        // frames are only assembled when a new data frames callback is registered.
+        void SetConfigurationFrames(const std::vector<ConfigurationFramePtr>& configurationFrames);
+
+        // Gets or sets the time, in seconds, a partial data frame is held, relative to the latest
+        // received timestamp, waiting for remaining values before it is published.
+        float64_t GetFrameAssemblyLagTime() const;
+        void SetFrameAssemblyLagTime(float64_t lagTime);
+
+        // Gets the frame assembly statistics for the current signal index cache.
+        DataFrameStatistics GetFrameAssemblyStatistics() const;
+
         // Gets or sets user defined data reference
         void* GetUserData() const;
         void SetUserData(void* userData);
@@ -361,6 +462,10 @@ namespace Transport
         uint64_t GetTotalCommandChannelBytesReceived() const;
         uint64_t GetTotalDataChannelBytesReceived() const;
         uint64_t GetTotalMeasurementsReceived() const;
+
+        // Gets a snapshot of subscription statistics, use CalculateRates
+        // between two snapshots to derive rates and averages
+        SubscriptionStatistics GetStatistics() const;
         bool IsConnected() const;
         bool IsSubscribed() const;
     };
@@ -0,0 +1,335 @@
+//******************************************************************************************************
+//  MetadataCache.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "MetadataCache.h"
+#include "../Common/Convert.h"
+#include "../Common/EndianConverter.h"
+#include <cstdio>
+#include <fstream>
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+namespace
+{
+    constexpr uint32_t FileSignature = 0x47534D43;  // "GSMC"
+    constexpr uint32_t FileVersion = 3;
+
+    void WriteString(vector<uint8_t>& buffer, const string& value)
+    {
+        EndianConverter::WriteBigEndianBytes(buffer, ConvertUInt32(value.size()));
+        WriteBytes(buffer, reinterpret_cast<const uint8_t*>(value.data()), 0, ConvertUInt32(value.size()));
+    }
+
+    void WriteTimestamp(vector<uint8_t>& buffer, const datetime_t& value)
+    {
+        EndianConverter::WriteBigEndianBytes(buffer, ToTicks(value));
+    }
+
+    // Bounds checked reader over a loaded cache file
+    class CacheReader
+    {
+    private:
+        const vector<uint8_t>& m_buffer;
+        size_t m_offset;
+
+        const uint8_t* Take(size_t length)
+        {
+            if (length > m_buffer.size() - m_offset)
+                throw SubscriberException("Metadata cache file is truncated");
+
+            const uint8_t* data = m_buffer.data() + m_offset;
+            m_offset += length;
+            return data;
+        }
+
+    public:
+        CacheReader(const vector<uint8_t>& buffer) :
+            m_buffer(buffer),
+            m_offset(0)
+        {
+        }
+
+        template<class T>
+        T Read()
+        {
+            return EndianConverter::ToBigEndian<T>(Take(sizeof(T)), 0);
+        }
+
+        string ReadString()
+        {
+            const uint32_t length = Read<uint32_t>();
+            return string(reinterpret_cast<const char*>(Take(length)), length);
+        }
+
+        Guid ReadGuid()
+        {
+            return ParseGuid(Take(16));
+        }
+
+        datetime_t ReadTimestamp()
+        {
+            return FromTicks(Read<int64_t>());
+        }
+
+        // Validates a record count against the smallest possible encoding of each record
+        uint32_t ReadCount(size_t minimumRecordSize)
+        {
+            const uint32_t count = Read<uint32_t>();
+
+            if (count > (m_buffer.size() - m_offset) / minimumRecordSize)
+                throw SubscriberException("Metadata cache file record count exceeds file length");
+
+            return count;
+        }
+    };
+}
+
+MetadataRecords::MetadataRecords() :
+    SchemaVersion(-1),
+    UpdatedOn(DateTime::MinValue),
+    FullRefreshedOn(DateTime::MinValue)
+{
+}
+
+uint32_t MetadataRecords::Merge(const MetadataRecords& records)
+{
+    StringMap<size_t> deviceIndexes;
+    unordered_map<Guid, size_t> measurementIndexes;
+    StringMap<size_t> phasorIndexes;
+    uint32_t changes = 0;
+
+    const auto phasorKey = [](const PhasorMetadataPtr& phasor) { return phasor->DeviceAcronym + "#" + ToString(phasor->SourceIndex); };
+
+    // Inserts new record or replaces existing record when its update time differs
+    const auto merge = [&changes](auto& target, auto& indexes, const auto& key, const auto& record)
+    {
+        auto iterator = indexes.find(key);
+
+        if (iterator == indexes.end())
+        {
+            indexes.emplace(key, target.size());
+            target.push_back(record);
+            changes++;
+        }
+        else if (target[iterator->second]->UpdatedOn != record->UpdatedOn)
+        {
+            target[iterator->second] = record;
+            changes++;
+        }
+    };
+
+    for (size_t i = 0; i < Devices.size(); i++)
+        deviceIndexes[Devices[i]->Acronym] = i;
+
+    measurementIndexes.reserve(Measurements.size());
+
+    for (size_t i = 0; i < Measurements.size(); i++)
+        measurementIndexes[Measurements[i]->SignalID] = i;
+
+    for (size_t i = 0; i < Phasors.size(); i++)
+        phasorIndexes[phasorKey(Phasors[i])] = i;
+
+    for (auto const& device : records.Devices)
+        merge(Devices, deviceIndexes, device->Acronym, device);
+
+    for (auto const& measurement : records.Measurements)
+        merge(Measurements, measurementIndexes, measurement->SignalID, measurement);
+
+    for (auto const& phasor : records.Phasors)
+        merge(Phasors, phasorIndexes, phasorKey(phasor), phasor);
+
+    if (!records.TableNames.empty())
+        TableNames = records.TableNames;
+
+    if (records.SchemaVersion > -1)
+        SchemaVersion = records.SchemaVersion;
+
+    if (records.UpdatedOn > UpdatedOn)
+        UpdatedOn = records.UpdatedOn;
+
+    return changes;
+}
+
+bool MetadataCache::TryLoad(const string& fileName, MetadataRecords& records)
+{
+    ifstream stream(fileName, ios::binary);
+
+    if (!stream)
+        return false;
+
+    vector<uint8_t> buffer;
+
+    stream.seekg(0, ios::end);
+    buffer.resize(static_cast<size_t>(stream.tellg()));
+    stream.seekg(0, ios::beg);
+    stream.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
+
+    CacheReader reader(buffer);
+
+    if (reader.Read<uint32_t>() != FileSignature || reader.Read<uint32_t>() != FileVersion)
+        throw SubscriberException("File \"" + fileName + "\" is not a supported metadata cache file");
+
+    records.SchemaVersion = reader.Read<int32_t>();
+    records.UpdatedOn = reader.ReadTimestamp();
+    records.FullRefreshedOn = reader.ReadTimestamp();
+
+    records.Devices.resize(reader.ReadCount(60));
+
+    for (auto& deviceMetadata : records.Devices)
+    {
+        deviceMetadata = NewSharedPtr<DeviceMetadata>();
+        deviceMetadata->Acronym = reader.ReadString();
+        deviceMetadata->Name = reader.ReadString();
+        deviceMetadata->UniqueID = reader.ReadGuid();
+        deviceMetadata->AccessID = reader.Read<uint16_t>();
+        deviceMetadata->ParentAcronym = reader.ReadString();
+        deviceMetadata->ProtocolName = reader.ReadString();
+        deviceMetadata->FramesPerSecond = reader.Read<uint16_t>();
+        deviceMetadata->CompanyAcronym = reader.ReadString();
+        deviceMetadata->VendorAcronym = reader.ReadString();
+        deviceMetadata->VendorDeviceName = reader.ReadString();
+        deviceMetadata->Longitude = reader.Read<float64_t>();
+        deviceMetadata->Latitude = reader.Read<float64_t>();
+        deviceMetadata->UpdatedOn = reader.ReadTimestamp();
+    }
+
+    records.Measurements.resize(reader.ReadCount(53));
+
+    for (auto& measurementMetadata : records.Measurements)
+    {
+        measurementMetadata = NewSharedPtr<MeasurementMetadata>();
+        measurementMetadata->DeviceAcronym = reader.ReadString();
+        measurementMetadata->ID = reader.ReadString();
+        measurementMetadata->SignalID = reader.ReadGuid();
+        measurementMetadata->PointTag = reader.ReadString();
+        measurementMetadata->Reference.SignalID = reader.ReadGuid();
+        measurementMetadata->Reference.Acronym = reader.ReadString();
+        measurementMetadata->Reference.Index = reader.Read<uint16_t>();
+        measurementMetadata->Reference.Kind = static_cast<SignalKind>(reader.Read<int32_t>());
+        measurementMetadata->PhasorSourceIndex = reader.Read<uint16_t>();
+        measurementMetadata->Description = reader.ReadString();
+        measurementMetadata->UpdatedOn = reader.ReadTimestamp();
+    }
+
+    records.Phasors.resize(reader.ReadCount(26));
+
+    for (auto& phasorMetadata : records.Phasors)
+    {
+        phasorMetadata = NewSharedPtr<PhasorMetadata>();
+        phasorMetadata->DeviceAcronym = reader.ReadString();
+        phasorMetadata->Label = reader.ReadString();
+        phasorMetadata->Type = reader.ReadString();
+        phasorMetadata->Phase = reader.ReadString();
+        phasorMetadata->SourceIndex = reader.Read<uint16_t>();
+        phasorMetadata->UpdatedOn = reader.ReadTimestamp();
+    }
+
+    records.TableNames.resize(reader.ReadCount(4));
+
+    for (auto& tableName : records.TableNames)
+        tableName = reader.ReadString();
+
+    return true;
+}
+
+void MetadataCache::Save(const string& fileName, const MetadataRecords& records)
+{
+    vector<uint8_t> buffer;
+
+    EndianConverter::WriteBigEndianBytes(buffer, FileSignature);
+    EndianConverter::WriteBigEndianBytes(buffer, FileVersion);
+    EndianConverter::WriteBigEndianBytes(buffer, records.SchemaVersion);
+    WriteTimestamp(buffer, records.UpdatedOn);
+    WriteTimestamp(buffer, records.FullRefreshedOn);
+
+    EndianConverter::WriteBigEndianBytes(buffer, ConvertUInt32(records.Devices.size()));
+
+    for (auto const& deviceMetadata : records.Devices)
+    {
+        WriteString(buffer, deviceMetadata->Acronym);
+        WriteString(buffer, deviceMetadata->Name);
+        WriteBytes(buffer, deviceMetadata->UniqueID);
+        EndianConverter::WriteBigEndianBytes(buffer, deviceMetadata->AccessID);
+        WriteString(buffer, deviceMetadata->ParentAcronym);
+        WriteString(buffer, deviceMetadata->ProtocolName);
+        EndianConverter::WriteBigEndianBytes(buffer, deviceMetadata->FramesPerSecond);
+        WriteString(buffer, deviceMetadata->CompanyAcronym);
+        WriteString(buffer, deviceMetadata->VendorAcronym);
+        WriteString(buffer, deviceMetadata->VendorDeviceName);
+        EndianConverter::WriteBigEndianBytes(buffer, deviceMetadata->Longitude);
+        EndianConverter::WriteBigEndianBytes(buffer, deviceMetadata->Latitude);
+        WriteTimestamp(buffer, deviceMetadata->UpdatedOn);
+    }
+
+    EndianConverter::WriteBigEndianBytes(buffer, ConvertUInt32(records.Measurements.size()));
+
+    for (auto const& measurementMetadata : records.Measurements)
+    {
+        WriteString(buffer, measurementMetadata->DeviceAcronym);
+        WriteString(buffer, measurementMetadata->ID);
+        WriteBytes(buffer, measurementMetadata->SignalID);
+        WriteString(buffer, measurementMetadata->PointTag);
+        WriteBytes(buffer, measurementMetadata->Reference.SignalID);
+        WriteString(buffer, measurementMetadata->Reference.Acronym);
+        EndianConverter::WriteBigEndianBytes(buffer, measurementMetadata->Reference.Index);
+        EndianConverter::WriteBigEndianBytes(buffer, static_cast<int32_t>(measurementMetadata->Reference.Kind));
+        EndianConverter::WriteBigEndianBytes(buffer, measurementMetadata->PhasorSourceIndex);
+        WriteString(buffer, measurementMetadata->Description);
+        WriteTimestamp(buffer, measurementMetadata->UpdatedOn);
+    }
+
+    EndianConverter::WriteBigEndianBytes(buffer, ConvertUInt32(records.Phasors.size()));
+
+    for (auto const& phasorMetadata : records.Phasors)
+    {
+        WriteString(buffer, phasorMetadata->DeviceAcronym);
+        WriteString(buffer, phasorMetadata->Label);
+        WriteString(buffer, phasorMetadata->Type);
+        WriteString(buffer, phasorMetadata->Phase);
+        EndianConverter::WriteBigEndianBytes(buffer, phasorMetadata->SourceIndex);
+        WriteTimestamp(buffer, phasorMetadata->UpdatedOn);
+    }
+
+    EndianConverter::WriteBigEndianBytes(buffer, ConvertUInt32(records.TableNames.size()));
+
+    for (auto const& tableName : records.TableNames)
+        WriteString(buffer, tableName);
+
+    const string tempFileName = fileName + ".tmp";
+
+    {
+        ofstream stream(tempFileName, ios::binary | ios::trunc);
+        stream.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+
+        if (!stream.flush())
+            throw SubscriberException("Failed to write metadata cache file \"" + tempFileName + "\"");
+    }
+
+    remove(fileName.c_str());
+
+    if (rename(tempFileName.c_str(), fileName.c_str()) != 0)
+        throw SubscriberException("Failed to replace metadata cache file \"" + fileName + "\"");
+}
@@ -0,0 +1,70 @@
+//******************************************************************************************************
+//  MetadataCache.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __METADATA_CACHE_H
+#define __METADATA_CACHE_H
+
+#include "../Common/CommonTypes.h"
+#include "TransportTypes.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Flat set of parsed metadata records, device records are not yet
+    // associated with their measurements or phasors.
+    struct MetadataRecords
+    {
+        std::vector<DeviceMetadataPtr> Devices;
+        std::vector<MeasurementMetadataPtr> Measurements;
+        std::vector<PhasorMetadataPtr> Phasors;
+        std::vector<std::string> TableNames;        // Names of all publisher metadata tables
+        int32_t SchemaVersion;                      // Publisher metadata schema version, -1 when not reported
+        datetime_t UpdatedOn;                       // Latest UpdatedOn value across all records
+        datetime_t FullRefreshedOn;                 // Time of last full refresh, incremental refresh cannot detect deleted records
+
+        MetadataRecords();
+
+        // Inserts or replaces records in this set with those in the given set, keyed by device acronym,
+        // measurement signal ID and phasor source index; existing records with a matching UpdatedOn
+        // value are considered unchanged. Table names are replaced when the given set reports any,
+        // FullRefreshedOn is left unchanged since merged records never remove existing records.
+        // Returns number of records inserted or replaced.
+        uint32_t Merge(const MetadataRecords& records);
+    };
+
+    // Persists parsed metadata records to a local binary file so that a subscriber
+    // can restore its configuration without waiting on a full metadata refresh.
+    class MetadataCache // NOLINT
+    {
+    public:
+        // Loads cached records from file, returns false if file does not exist;
+        // throws SubscriberException if file is not a valid cache
+        static bool TryLoad(const std::string& fileName, MetadataRecords& records);
+
+        // Saves records to file, written to a temporary file first so existing cache is replaced atomically
+        static void Save(const std::string& fileName, const MetadataRecords& records);
+    };
+}}}
+
+#endif
@@ -30,13 +30,19 @@ using namespace GSF::TimeSeries::Transport;
 
 RoutingTables::RoutingTables() :
     m_activeRoutes(NewSharedPtr<RoutingTable>()),
-    m_enabled(true)
+    m_enabled(NewSharedPtr<atomic<bool>>(true))
 {
-    Thread([&,this]()
+    // Operations hold connections, which hold the publisher that owns this instance, so releasing an
+    // operation can destroy this instance -- enabled state is shared so thread can check it afterward
+    m_routingTableOperationsThread = Thread([this, enabled = m_enabled]()
     {
-        while (m_enabled)
+        while (*enabled)
         {
             m_routingTableOperations.WaitForData();
+
+            if (!*enabled)
+                break;
+
             const auto operation = m_routingTableOperations.Dequeue();
             operation.first(*this, operation.second);
         }
@@ -45,8 +51,15 @@ RoutingTables::RoutingTables() :
 
 RoutingTables::~RoutingTables()
 {
-    m_enabled = false;
+    *m_enabled = false;
     m_routingTableOperations.Release();
+
+    // Operation thread references this instance, so it must exit before members are destroyed,
+    // unless this instance is being destroyed from the operation thread itself
+    if (m_routingTableOperationsThread.get_id() == boost::this_thread::get_id())
+        m_routingTableOperationsThread.detach();
+    else if (m_routingTableOperationsThread.joinable())
+        m_routingTableOperationsThread.join();
 }
 
 RoutingTables::RoutingTablePtr RoutingTables::CloneActiveRoutes()
@@ -62,6 +75,37 @@ void RoutingTables::SetActiveRoutes(RoutingTablePtr activeRoutes)
     m_activeRoutes = std::move(activeRoutes);
 }
 
+// Destination sets are shared with the published routing table, so they are copied before being modified
+void RoutingTables::AddDestination(RoutingTable& activeRoutes, const Guid& signalID, const SubscriberConnectionPtr& destination)
+{
+    DestinationsPtr destinations;
+
+    if (TryGetValue(activeRoutes, signalID, destinations, destinations))
+    {
+        if (destinations->find(destination) != destinations->end())
+            return;
+
+        destinations = NewSharedPtr<Destinations>(*destinations);
+    }
+    else
+    {
+        destinations = NewSharedPtr<Destinations>();
+    }
+
+    destinations->insert(destination);
+    activeRoutes[signalID] = destinations;
+}
+
+bool RoutingTables::RemoveDestination(DestinationsPtr& destinations, const SubscriberConnectionPtr& destination)
+{
+    if (destinations->find(destination) == destinations->end())
+        return false;
+
+    destinations = NewSharedPtr<Destinations>(*destinations);
+    destinations->erase(destination);
+    return true;
+}
+
 void RoutingTables::UpdateRoutesOperation(RoutingTables& routingTables, const DestinationRoutes& destinationRoutes)
 {
     const RoutingTablePtr activeRoutesPtr = routingTables.CloneActiveRoutes();
@@ -72,23 +116,26 @@ void RoutingTables::UpdateRoutesOperation(RoutingTables& routingTables, const De
     // Remove subscriber connection from undesired measurement route destinations
     for (auto& pair : activeRoutes)
     {
-        if (routes.find(pair.first) != routes.end())
-            pair.second->erase(destination);
+        if (routes.find(pair.first) == routes.end())
+            RemoveDestination(pair.second, destination);
     }
 
     // Add subscriber connection to desired measurement route destinations
     for (auto& signalID : routes)
-    {
-        DestinationsPtr destinations;
+        AddDestination(activeRoutes, signalID, destination);
 
-        if (!TryGetValue(activeRoutes, signalID, destinations, destinations))
-        {
-            destinations = NewSharedPtr<Destinations>();
-            activeRoutes.emplace(signalID, destinations);
-        }
+    routingTables.SetActiveRoutes(activeRoutesPtr);
+}
 
-        destinations->insert(destination);
-    }
+void RoutingTables::AddRoutesOperation(RoutingTables& routingTables, const DestinationRoutes& destinationRoutes)
+{
+    const RoutingTablePtr activeRoutesPtr = routingTables.CloneActiveRoutes();
+    RoutingTable& activeRoutes = *activeRoutesPtr;
+    const SubscriberConnectionPtr& destination = destinationRoutes.first;
+
+    // Add subscriber connection to specified measurement route destinations
+    for (auto& signalID : destinationRoutes.second)
+        AddDestination(activeRoutes, signalID, destination);
 
     routingTables.SetActiveRoutes(activeRoutesPtr);
 }
@@ -96,12 +143,30 @@ void RoutingTables::UpdateRoutesOperation(RoutingTables& routingTables, const De
 void RoutingTables::RemoveRoutesOperation(RoutingTables& routingTables, const DestinationRoutes& destinationRoutes)
 {
     const RoutingTablePtr activeRoutesPtr = routingTables.CloneActiveRoutes();
-    const RoutingTable& activeRoutes = *activeRoutesPtr;
+    RoutingTable& activeRoutes = *activeRoutesPtr;
     const SubscriberConnectionPtr& destination = destinationRoutes.first;
 
     // Remove subscriber connection from existing measurement route destinations
     for (auto& pair : activeRoutes)
-        pair.second->erase(destination);
+        RemoveDestination(pair.second, destination);
+
+    routingTables.SetActiveRoutes(activeRoutesPtr);
+}
+
+void RoutingTables::RemoveSelectedRoutesOperation(RoutingTables& routingTables, const DestinationRoutes& destinationRoutes)
+{
+    const RoutingTablePtr activeRoutesPtr = routingTables.CloneActiveRoutes();
+    RoutingTable& activeRoutes = *activeRoutesPtr;
+    const SubscriberConnectionPtr& destination = destinationRoutes.first;
+
+    // Remove subscriber connection from specified measurement route destinations
+    for (auto& signalID : destinationRoutes.second)
+    {
+        const auto iterator = activeRoutes.find(signalID);
+
+        if (iterator != activeRoutes.end() && RemoveDestination(iterator->second, destination) && iterator->second->empty())
+            activeRoutes.erase(iterator);
+    }
 
     routingTables.SetActiveRoutes(activeRoutesPtr);
 }
@@ -118,6 +183,16 @@ void RoutingTables::RemoveRoutes(const SubscriberConnectionPtr& destination)
     m_routingTableOperations.Enqueue(RoutingTableOperation(&RemoveRoutesOperation, DestinationRoutes(destination, unordered_set<Guid>())));
 }
 
+void RoutingTables::PatchRoutes(const SubscriberConnectionPtr& destination, const unordered_set<Guid>& addedRoutes, const unordered_set<Guid>& removedRoutes)
+{
+    // Queue selected route operations, leaving routes for unaffected measurements as they are
+    if (!removedRoutes.empty())
+        m_routingTableOperations.Enqueue(RoutingTableOperation(&RemoveSelectedRoutesOperation, DestinationRoutes(destination, removedRoutes)));
+
+    if (!addedRoutes.empty())
+        m_routingTableOperations.Enqueue(RoutingTableOperation(&AddRoutesOperation, DestinationRoutes(destination, addedRoutes)));
+}
+
 void RoutingTables::PublishMeasurements(const vector<MeasurementPtr>& measurements)
 {
     typedef vector<MeasurementPtr> Measurements;
@@ -27,6 +27,7 @@
 #include "../Common/CommonTypes.h"
 #include "../Common/ThreadSafeQueue.h"
 #include "SubscriberConnection.h"
+#include <atomic>
 
 namespace GSF {
 namespace TimeSeries {
@@ -44,14 +45,19 @@ namespace Transport
         typedef std::pair<RoutingTableOperationHandler, DestinationRoutes> RoutingTableOperation;
 
         GSF::ThreadSafeQueue<RoutingTableOperation> m_routingTableOperations;
+        GSF::Thread m_routingTableOperationsThread;
         RoutingTablePtr m_activeRoutes;
         GSF::SharedMutex m_activeRoutesLock;
-        volatile bool m_enabled;
+        GSF::SharedPtr<std::atomic<bool>> m_enabled;
 
         RoutingTablePtr CloneActiveRoutes();
         void SetActiveRoutes(RoutingTablePtr activeRoutes);
+        static void AddDestination(RoutingTable& activeRoutes, const GSF::Guid& signalID, const SubscriberConnectionPtr& destination);
+        static bool RemoveDestination(DestinationsPtr& destinations, const SubscriberConnectionPtr& destination);
         static void UpdateRoutesOperation(RoutingTables& routingTables, const DestinationRoutes& destinationRoutes);
+        static void AddRoutesOperation(RoutingTables& routingTables, const DestinationRoutes& destinationRoutes);
         static void RemoveRoutesOperation(RoutingTables& routingTables, const DestinationRoutes& destinationRoutes);
+        static void RemoveSelectedRoutesOperation(RoutingTables& routingTables, const DestinationRoutes& destinationRoutes);
 
     public:
         RoutingTables();
@@ -59,6 +65,9 @@ namespace Transport
 
         void UpdateRoutes(const SubscriberConnectionPtr& destination, const std::unordered_set<GSF::Guid>& routes);
         void RemoveRoutes(const SubscriberConnectionPtr& destination);
+
+        // Adds and removes the specified routes for a destination without touching its other routes
+        void PatchRoutes(const SubscriberConnectionPtr& destination, const std::unordered_set<GSF::Guid>& addedRoutes, const std::unordered_set<GSF::Guid>& removedRoutes);
         void PublishMeasurements(const std::vector<MeasurementPtr>& measurements);
     };
 }}}
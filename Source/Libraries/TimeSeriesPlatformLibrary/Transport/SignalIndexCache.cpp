@@ -33,19 +33,123 @@ using namespace GSF;
 using namespace GSF::TimeSeries;
 using namespace GSF::TimeSeries::Transport;
 
+// Signal IDs are random 128-bit values, so folding the two halves is sufficient for slot selection
+static uint32_t HashSignalID(const Guid& signalID)
+{
+    uint64_t lo, hi;
+
+    memcpy(&lo, signalID.data, sizeof(uint64_t));
+    memcpy(&hi, signalID.data + sizeof(uint64_t), sizeof(uint64_t));
+
+    uint64_t hash = lo ^ (hi * 0x9E3779B97F4A7C15ULL);
+    hash ^= hash >> 32;
+
+    return static_cast<uint32_t>(hash);
+}
+
 SignalIndexCache::SignalIndexCache() :
+    m_lastSourceIndex(NullEntry),
+    m_signalIDCount(0),
+    m_referenceCount(0),
     m_binaryLength(28)
 {
 }
 
-// Adds a measurement key to the cache.
-void SignalIndexCache::AddMeasurementKey(const uint16_t signalIndex, const Guid& signalID, const string& source, const uint32_t id, const uint32_t charSizeEstimate)
+uint32_t SignalIndexCache::InternSource(const char* source, const uint32_t length)
+{
+    // Consecutive keys nearly always share the same source, check last interned value first
+    if (m_lastSourceIndex != NullEntry)
+    {
+        const string& lastSource = m_sourceList[m_lastSourceIndex];
+
+        if (lastSource.size() == length && memcmp(lastSource.data(), source, length) == 0)
+            return m_lastSourceIndex;
+    }
+
+    string value(source, length);
+    const auto result = m_sourceLookup.find(value);
+
+    if (result != m_sourceLookup.end())
+    {
+        m_lastSourceIndex = result->second;
+    }
+    else
+    {
+        m_lastSourceIndex = ConvertUInt32(m_sourceList.size());
+        m_sourceLookup.emplace(value, m_lastSourceIndex);
+        m_sourceList.push_back(std::move(value));
+    }
+
+    return m_lastSourceIndex;
+}
+
+// Returns slot holding signal ID, or first empty slot in its probe sequence
+uint32_t SignalIndexCache::FindSignalIDSlot(const Guid& signalID) const
 {
-    m_reference.insert_or_assign(signalIndex, ConvertUInt32(m_signalIDList.size()));
+    const uint32_t mask = ConvertUInt32(m_signalIDSlots.size() - 1);
+    uint32_t slot = HashSignalID(signalID) & mask;
+
+    while (true)
+    {
+        const uint32_t entryIndex = m_signalIDSlots[slot];
+
+        if (entryIndex == NullEntry || m_signalIDList[entryIndex] == signalID)
+            return slot;
+
+        slot = (slot + 1) & mask;
+    }
+}
+
+void SignalIndexCache::GrowSignalIDSlots(const uint32_t count)
+{
+    size_t capacity = m_signalIDSlots.empty() ? 64 : m_signalIDSlots.size() * 2;
+
+    // Keep load factor at or below 50%
+    while (capacity < count * 2ULL)
+        capacity *= 2;
+
+    vector<uint32_t> slots;
+    slots.swap(m_signalIDSlots);
+    m_signalIDSlots.assign(capacity, NullEntry);
+
+    for (const uint32_t entryIndex : slots)
+    {
+        if (entryIndex != NullEntry)
+            m_signalIDSlots[FindSignalIDSlot(m_signalIDList[entryIndex])] = entryIndex;
+    }
+}
+
+void SignalIndexCache::AddEntry(const uint16_t signalIndex, const Guid& signalID, const uint32_t sourceIndex, const uint32_t id)
+{
+    const uint32_t entryIndex = ConvertUInt32(m_signalIDList.size());
+
+    if (signalIndex >= m_reference.size())
+        m_reference.resize(signalIndex + 1ULL, NullEntry);
+
+    if (m_reference[signalIndex] == NullEntry)
+        m_referenceCount++;
+
+    m_reference[signalIndex] = entryIndex;
+    m_signalIndexList.push_back(signalIndex);
     m_signalIDList.push_back(signalID);
-    m_sourceList.push_back(source);
+    m_sourceIndexList.push_back(sourceIndex);
     m_idList.push_back(id);
-    m_signalIDCache.insert_or_assign(signalID, signalIndex);
+
+    if ((m_signalIDCount + 1) * 2 > m_signalIDSlots.size())
+        GrowSignalIDSlots(m_signalIDCount + 1);
+
+    uint32_t& slot = m_signalIDSlots[FindSignalIDSlot(signalID)];
+
+    if (slot == NullEntry)
+        m_signalIDCount++;
+
+    slot = entryIndex;
+}
+
+// Adds a measurement key to the cache.
+void SignalIndexCache::AddMeasurementKey(const uint16_t signalIndex, const Guid& signalID, const string& source, const uint32_t id, const uint32_t charSizeEstimate)
+{
+    AddEntry(signalIndex, signalID, InternSource(source.data(), ConvertUInt32(source.size())), id);
 
     // Char size here helps provide a rough-estimate on binary length used to reserve
     // bytes for a vector, if exact size is needed call RecalculateBinaryLength first
@@ -56,28 +160,29 @@ void SignalIndexCache::AddMeasurementKey(const uint16_t signalIndex, const Guid&
 void SignalIndexCache::Clear()
 {
     m_reference.clear();
+    m_signalIndexList.clear();
     m_signalIDList.clear();
-    m_sourceList.clear();
+    m_sourceIndexList.clear();
     m_idList.clear();
-    m_signalIDCache.clear();
+    m_sourceList.clear();
+    m_sourceLookup.clear();
+    m_signalIDSlots.clear();
+    m_lastSourceIndex = NullEntry;
+    m_signalIDCount = 0;
+    m_referenceCount = 0;
 }
 
 // Determines whether an element with the given runtime ID exists in the signal index cache.
 bool SignalIndexCache::Contains(const uint16_t signalIndex) const
 {
-    return m_reference.find(signalIndex) != m_reference.end();
+    return signalIndex < m_reference.size() && m_reference[signalIndex] != NullEntry;
 }
 
 // Gets the globally unique signal ID associated with the given 16-bit runtime ID.
 Guid SignalIndexCache::GetSignalID(uint16_t signalIndex) const
 {
-    const auto result = m_reference.find(signalIndex);
-
-    if (result != m_reference.end())
-    {
-        const uint32_t vectorIndex = result->second;
-        return m_signalIDList[vectorIndex];
-    }
+    if (Contains(signalIndex))
+        return m_signalIDList[m_reference[signalIndex]];
 
     return Empty::Guid;
 }
@@ -91,13 +196,8 @@ unordered_set<Guid> SignalIndexCache::GetSignalIDs() const
 // key associated with the given 16-bit runtime ID.
 const string& SignalIndexCache::GetSource(const uint16_t signalIndex) const
 {
-    const auto result = m_reference.find(signalIndex);
-
-    if (result != m_reference.end())
-    {
-        const uint32_t vectorIndex = result->second;
-        return m_sourceList[vectorIndex];
-    }
+    if (Contains(signalIndex))
+        return m_sourceList[m_sourceIndexList[m_reference[signalIndex]]];
 
     return Empty::String;
 }
@@ -106,13 +206,8 @@ const string& SignalIndexCache::GetSource(const uint16_t signalIndex) const
 // key associated with the given 16-bit runtime ID.
 uint32_t SignalIndexCache::GetID(const uint16_t signalIndex) const
 {
-    const auto result = m_reference.find(signalIndex);
-
-    if (result != m_reference.end())
-    {
-        const uint32_t vectorIndex = result->second;
-        return m_idList[vectorIndex];
-    }
+    if (Contains(signalIndex))
+        return m_idList[m_reference[signalIndex]];
 
     return UInt32::MaxValue;
 }
@@ -121,37 +216,51 @@ uint32_t SignalIndexCache::GetID(const uint16_t signalIndex) const
 // measurement key associated with the given 16-bit runtime ID.
 bool SignalIndexCache::GetMeasurementKey(const uint16_t signalIndex, Guid& signalID, string& source, uint32_t& id) const
 {
-    const auto result = m_reference.find(signalIndex);
+    if (!Contains(signalIndex))
+        return false;
 
-    if (result != m_reference.end())
-    {
-        const uint32_t vectorIndex = result->second;
+    const uint32_t entryIndex = m_reference[signalIndex];
 
-        signalID = m_signalIDList[vectorIndex];
-        source = m_sourceList[vectorIndex];
-        id = m_idList[vectorIndex];
+    signalID = m_signalIDList[entryIndex];
+    source = m_sourceList[m_sourceIndexList[entryIndex]];
+    id = m_idList[entryIndex];
 
-        return true;
-    }
-
-    return false;
+    return true;
 }
 
 // Gets the 16-bit runtime ID associated with the given globally unique signal ID.
 uint16_t SignalIndexCache::GetSignalIndex(const Guid& signalID) const
 {
-    const auto result = m_signalIDCache.find(signalID);
-    uint16_t signalIndex = UInt16::MaxValue;
+    if (m_signalIDSlots.empty())
+        return UInt16::MaxValue;
+
+    const uint32_t entryIndex = m_signalIDSlots[FindSignalIDSlot(signalID)];
 
-    if (result != m_signalIDCache.end())
-        signalIndex = result->second;
+    if (entryIndex == NullEntry)
+        return UInt16::MaxValue;
 
-    return signalIndex;
+    return m_signalIndexList[entryIndex];
 }
 
 uint32_t SignalIndexCache::Count() const
 {
-    return ConvertUInt32(m_signalIDCache.size());
+    return m_signalIDCount;
+}
+
+uint32_t SignalIndexCache::GetSignalIndexCapacity() const
+{
+    return ConvertUInt32(m_reference.size());
+}
+
+void SignalIndexCache::Reserve(const uint32_t capacity)
+{
+    m_signalIndexList.reserve(capacity);
+    m_signalIDList.reserve(capacity);
+    m_sourceIndexList.reserve(capacity);
+    m_idList.reserve(capacity);
+
+    if (m_signalIDSlots.size() < capacity * 2ULL)
+        GrowSignalIDSlots(capacity);
 }
 
 uint32_t SignalIndexCache::GetBinaryLength() const
@@ -162,9 +271,15 @@ uint32_t SignalIndexCache::GetBinaryLength() const
 void SignalIndexCache::RecalculateBinaryLength(const SubscriberConnection& connection)
 {
     uint32_t binaryLength = 28;
+    vector<uint32_t> encodedSourceSizes;
+
+    encodedSourceSizes.reserve(m_sourceList.size());
+
+    for (size_t i = 0; i < m_sourceList.size(); i++)
+        encodedSourceSizes.push_back(ConvertUInt32(connection.EncodeString(m_sourceList[i]).size()));
 
     for (size_t i = 0; i < m_signalIDList.size(); i++)
-        binaryLength += ConvertUInt32(26 + connection.EncodeString(m_sourceList[i]).size()); //-V127
+        binaryLength += 26 + encodedSourceSizes[m_sourceIndexList[i]];
 
     m_binaryLength = binaryLength;
 }
@@ -172,47 +287,44 @@ void SignalIndexCache::RecalculateBinaryLength(const SubscriberConnection& conne
 void SignalIndexCache::Parse(const vector<uint8_t>& buffer, Guid& subscriberID)
 {
     const uint8_t* data = buffer.data();
-    stringstream sourceStream;
+    const uint32_t length = ConvertUInt32(buffer.size());
+
+    if (length < 24)
+        throw SubscriberException("Signal index cache buffer too small: " + ToString(length) + " bytes");
 
     // Skip 4-byte length and parse subscriber ID
     subscriberID = ParseGuid(data + 4);
 
-    const uint32_t* referenceCountPtr = reinterpret_cast<const uint32_t*>(data + 20);
-    const uint32_t referenceCount = EndianConverter::Default.ConvertBigEndian(*referenceCountPtr);
+    const uint32_t referenceCount = EndianConverter::ToBigEndian<uint32_t>(data, 20);
+    uint32_t offset = 24;
 
-    // Set up signalIndexPtr before entering the loop
-    const uint16_t* signalIndexPtr = reinterpret_cast<const uint16_t*>(referenceCountPtr + 1);
+    // Reference count is untrusted, only reserve for as many minimum sized 26-byte keys as buffer
+    // can hold, bounded by the number of distinct 16-bit runtime IDs
+    Reserve(min((length - offset) / 26, 65536U));
 
     for (uint32_t i = 0; i < referenceCount; ++i)
     {
-        // Begin setting up pointers
-        const uint8_t* signalIDPtr = reinterpret_cast<const uint8_t*>(signalIndexPtr + 1);
-        const uint32_t* sourceSizePtr = reinterpret_cast<const uint32_t*>(signalIDPtr + 16);
-
-        // Get the source size now so we can use it to find the ID
-        const uint32_t sourceSize = ConvertUInt32(EndianConverter::Default.ConvertBigEndian(*sourceSizePtr) / sizeof(char));
-
-        // Continue setting up pointers
-        const char* sourcePtr = reinterpret_cast<const char*>(sourceSizePtr + 1);
-        const uint32_t* idPtr = reinterpret_cast<const uint32_t*>(sourcePtr + sourceSize);
-
-        // Build string from binary data -- NOTE: this presumes subscriber code is always UTF8
-        for (const char* sourceIter = sourcePtr; sourceIter < sourcePtr + sourceSize; ++sourceIter)
-            sourceStream << *sourceIter;
-
-        // Set values for measurement key
-        const uint16_t signalIndex = EndianConverter::Default.ConvertBigEndian(*signalIndexPtr);
-        const Guid signalID = ParseGuid(signalIDPtr, true, true);
-        const string source = sourceStream.str();
-        const uint32_t id = EndianConverter::Default.ConvertBigEndian(*idPtr);
-
-        // Add measurement key to the cache
-        AddMeasurementKey(signalIndex, signalID, source, id);
-
-        // Advance signalIndexPtr to the next signal
-        // index and clear out the string stream
-        signalIndexPtr = reinterpret_cast<const uint16_t*>(idPtr + 1);
-        sourceStream.str("");
+        // Each key is a 2-byte runtime ID, 16-byte signal ID, 4-byte source size, source bytes and 4-byte ID
+        if (length - offset < 22)
+            throw SubscriberException("Signal index cache buffer truncated at key " + ToString(i));
+
+        const uint16_t signalIndex = EndianConverter::ToBigEndian<uint16_t>(data, offset);
+        const Guid signalID = ParseGuid(data + offset + 2, true, true);
+        const uint32_t sourceSize = EndianConverter::ToBigEndian<uint32_t>(data, offset + 18) / sizeof(char);
+        offset += 22;
+
+        if (length - offset < 4 || length - offset - 4 < sourceSize)
+            throw SubscriberException("Signal index cache buffer truncated at key " + ToString(i));
+
+        // Source is referenced directly from buffer -- NOTE: this presumes subscriber code is always UTF8
+        const uint32_t sourceIndex = InternSource(reinterpret_cast<const char*>(data + offset), sourceSize);
+        offset += sourceSize;
+
+        const uint32_t id = EndianConverter::ToBigEndian<uint32_t>(data, offset);
+        offset += 4;
+
+        AddEntry(signalIndex, signalID, sourceIndex, id);
+        m_binaryLength += 26 + sourceSize;
     }
 
     // There is additional data about unauthorized signal
@@ -224,6 +336,13 @@ void SignalIndexCache::Serialize(const SubscriberConnection& connection, vector<
     const uint32_t binaryLengthLocation = ConvertUInt32(buffer.size());
     uint32_t binaryLength = 28; // cache size + subscriber ID + ref count + unauthorized count
 
+    // Encode each interned source only once
+    vector<vector<uint8_t>> sourceBytesList;
+    sourceBytesList.reserve(m_sourceList.size());
+
+    for (size_t i = 0; i < m_sourceList.size(); i++)
+        sourceBytesList.push_back(connection.EncodeString(m_sourceList[i]));
+
     // Reserve space for binary byte length of cache
     WriteBytes(buffer, uint32_t(0));
 
@@ -233,23 +352,25 @@ void SignalIndexCache::Serialize(const SubscriberConnection& connection, vector<
     WriteBytes(buffer, subscriberID);
 
     // Encode number of references
-    EndianConverter::WriteBigEndianBytes(buffer, ConvertInt32(m_reference.size()));
+    EndianConverter::WriteBigEndianBytes(buffer, ConvertInt32(m_referenceCount));
 
     for (size_t i = 0; i < m_signalIDList.size(); i++)
     {
         Guid signalID = m_signalIDList[i];
 
         // Encode run-time signal index
-        EndianConverter::WriteBigEndianBytes(buffer, GetSignalIndex(signalID));
+        EndianConverter::WriteBigEndianBytes(buffer, m_signalIndexList[i]);
 
         // Encode signal ID
         SwapGuidEndianness(signalID, true);
         WriteBytes(buffer, signalID);
 
         // Encode source
-        vector<uint8_t> sourceBytes = connection.EncodeString(m_sourceList[i]);
+        const vector<uint8_t>& sourceBytes = sourceBytesList[m_sourceIndexList[i]];
         EndianConverter::WriteBigEndianBytes(buffer, ConvertInt32(sourceBytes.size()));
-        WriteBytes(buffer, sourceBytes);
+
+        if (!sourceBytes.empty())
+            WriteBytes(buffer, sourceBytes);
 
         // Encode ID
         EndianConverter::WriteBigEndianBytes(buffer, m_idList[i]);
@@ -42,13 +42,34 @@ namespace Transport
     class SignalIndexCache
     {
     private:
-        std::unordered_map<uint16_t, uint32_t> m_reference;
+        static constexpr uint32_t NullEntry = UInt32::MaxValue;
+
+        // Dense runtime ID to entry index map, runtime IDs are 16-bit so
+        // this is sized to largest defined runtime ID, unused slots hold NullEntry
+        std::vector<uint32_t> m_reference;
+
+        // Entry vectors, accessed in parallel by entry index
+        std::vector<uint16_t> m_signalIndexList;
         std::vector<GSF::Guid> m_signalIDList;
-        std::vector<std::string> m_sourceList;
+        std::vector<uint32_t> m_sourceIndexList;
         std::vector<uint32_t> m_idList;
-        std::unordered_map<GSF::Guid, uint16_t> m_signalIDCache;
+
+        // Interned source strings, most caches only have a handful of unique sources
+        std::vector<std::string> m_sourceList;
+        std::unordered_map<std::string, uint32_t> m_sourceLookup;
+        uint32_t m_lastSourceIndex;
+
+        // Open-addressed signal ID to entry index table, linear probing, power of two capacity
+        std::vector<uint32_t> m_signalIDSlots;
+        uint32_t m_signalIDCount;
+        uint32_t m_referenceCount;
         uint32_t m_binaryLength;
 
+        uint32_t InternSource(const char* source, uint32_t length);
+        uint32_t FindSignalIDSlot(const GSF::Guid& signalID) const;
+        void GrowSignalIDSlots(uint32_t count);
+        void AddEntry(uint16_t signalIndex, const GSF::Guid& signalID, uint32_t sourceIndex, uint32_t id);
+
     public:
         SignalIndexCache();
 
@@ -85,6 +106,13 @@ namespace Transport
         // Gets the mapped signal count
         uint32_t Count() const;
 
+        // Gets one more than the largest defined runtime ID, i.e., the
+        // number of slots needed by a table indexed by runtime ID
+        uint32_t GetSignalIndexCapacity() const;
+
+        // Pre-allocates storage for the specified number of signals.
+        void Reserve(uint32_t capacity);
+
         // Gets an estimated binary size of a serialized signal index cache useful for pre-allocating
         // a vector size, for an exact size call RecalculateBinaryLength first
         uint32_t GetBinaryLength() const;
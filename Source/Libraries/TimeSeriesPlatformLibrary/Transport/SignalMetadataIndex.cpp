@@ -0,0 +1,150 @@
+//******************************************************************************************************
+//  SignalMetadataIndex.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "SignalMetadataIndex.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+const SignalMetadataReference SignalMetadataIndex::NullReference;
+
+SignalMetadataReference::SignalMetadataReference() :
+    Kind(SignalKind::Unknown),
+    PhasorIndex(-1)
+{
+}
+
+SignalMetadataIndex::SignalMetadataIndex(SignalIndexCachePtr signalIndexCache, const unordered_map<Guid, MeasurementMetadataPtr>& measurements, const StringMap<ConfigurationFramePtr>& configurationFrames) :
+    m_signalIndexCache(std::move(signalIndexCache)),
+    m_references(m_signalIndexCache->GetSignalIndexCapacity()),
+    m_resolvedCount(0U)
+{
+    // Only frame members of subscribed signals are of interest, so map those to their positions first
+    unordered_map<Guid, SignalMetadataReference> frameMembers;
+
+    const auto addMember = [&](const MeasurementMetadataPtr& measurement, const ConfigurationFramePtr& frame, const PhasorReferencePtr& phasor, int32_t phasorIndex)
+    {
+        if (measurement == nullptr || !m_signalIndexCache->Contains(m_signalIndexCache->GetSignalIndex(measurement->SignalID)))
+            return;
+
+        SignalMetadataReference& reference = frameMembers[measurement->SignalID];
+
+        reference.Metadata = measurement;
+        reference.Frame = frame;
+        reference.Phasor = phasor;
+        reference.Kind = measurement->Reference.Kind;
+        reference.PhasorIndex = phasorIndex;
+    };
+
+    for (auto const& item : configurationFrames)
+    {
+        const ConfigurationFramePtr& frame = item.second;
+
+        addMember(frame->QualityFlags, frame, nullptr, -1);
+        addMember(frame->StatusFlags, frame, nullptr, -1);
+        addMember(frame->Frequency, frame, nullptr, -1);
+        addMember(frame->DfDt, frame, nullptr, -1);
+
+        for (size_t i = 0; i < frame->Phasors.size(); i++)
+        {
+            const PhasorReferencePtr& phasor = frame->Phasors[i];
+            addMember(phasor->Angle, frame, phasor, static_cast<int32_t>(i));
+            addMember(phasor->Magnitude, frame, phasor, static_cast<int32_t>(i));
+        }
+
+        for (auto const& analog : frame->Analogs)
+            addMember(analog, frame, nullptr, -1);
+
+        for (auto const& digital : frame->Digitals)
+            addMember(digital, frame, nullptr, -1);
+    }
+
+    for (uint32_t i = 0; i < m_references.size(); i++)
+    {
+        const uint16_t signalIndex = static_cast<uint16_t>(i);
+
+        if (!m_signalIndexCache->Contains(signalIndex))
+            continue;
+
+        const Guid signalID = m_signalIndexCache->GetSignalID(signalIndex);
+        const auto frameMember = frameMembers.find(signalID);
+
+        if (frameMember != frameMembers.end())
+        {
+            m_references[i] = frameMember->second;
+            m_resolvedCount++;
+            continue;
+        }
+
+        // Signals outside of configuration frames, e.g., statistics, only resolve to metadata
+        const auto measurement = measurements.find(signalID);
+
+        if (measurement != measurements.end())
+        {
+            SignalMetadataReference& reference = m_references[i];
+            reference.Metadata = measurement->second;
+            reference.Kind = measurement->second->Reference.Kind;
+            m_resolvedCount++;
+        }
+    }
+}
+
+const SignalIndexCachePtr& SignalMetadataIndex::GetSignalIndexCache() const
+{
+    return m_signalIndexCache;
+}
+
+bool SignalMetadataIndex::TryGetReference(const Measurement& measurement, const SignalMetadataReference*& reference) const
+{
+    if (measurement.RuntimeID >= 0)
+    {
+        const SignalMetadataReference& candidate = GetReference(static_cast<uint16_t>(measurement.RuntimeID));
+
+        // Runtime ID can be from a prior signal index cache, so verify signal identity
+        if (candidate.Metadata != nullptr && candidate.Metadata->SignalID == measurement.SignalID)
+        {
+            reference = &candidate;
+            return true;
+        }
+    }
+
+    return TryGetReference(measurement.SignalID, reference);
+}
+
+bool SignalMetadataIndex::TryGetReference(const Guid& signalID, const SignalMetadataReference*& reference) const
+{
+    const SignalMetadataReference& candidate = GetReference(m_signalIndexCache->GetSignalIndex(signalID));
+
+    if (candidate.Metadata == nullptr)
+        return false;
+
+    reference = &candidate;
+    return true;
+}
+
+uint32_t SignalMetadataIndex::GetResolvedCount() const
+{
+    return m_resolvedCount;
+}
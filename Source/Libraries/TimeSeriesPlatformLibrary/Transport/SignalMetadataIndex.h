@@ -0,0 +1,88 @@
+//******************************************************************************************************
+//  SignalMetadataIndex.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __SIGNAL_METADATA_INDEX_H
+#define __SIGNAL_METADATA_INDEX_H
+
+#include "../Common/CommonTypes.h"
+#include "TransportTypes.h"
+#include "SignalIndexCache.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Resolved metadata references for a subscribed signal.
+    struct SignalMetadataReference
+    {
+        MeasurementMetadataPtr Metadata;    // Measurement metadata, null when signal is not defined in metadata
+        ConfigurationFramePtr Frame;        // Owning configuration frame, null when signal is not a frame member
+        PhasorReferencePtr Phasor;          // Owning phasor for angle and magnitude signals, otherwise null
+        SignalKind Kind;                    // Signal classification
+        int32_t PhasorIndex;                // Zero-based index into Frame->Phasors, -1 when not a phasor signal
+
+        SignalMetadataReference();
+    };
+
+    // Maps the runtime IDs of a signal index cache to resolved metadata references so
+    // per-value metadata access for received measurements is a single array load. An
+    // index is immutable once built, a new index is built whenever metadata or the
+    // signal index cache changes.
+    class SignalMetadataIndex // NOLINT
+    {
+    private:
+        const SignalIndexCachePtr m_signalIndexCache;
+        std::vector<SignalMetadataReference> m_references;
+        uint32_t m_resolvedCount;
+
+        static const SignalMetadataReference NullReference;
+
+    public:
+        SignalMetadataIndex(SignalIndexCachePtr signalIndexCache, const std::unordered_map<Guid, MeasurementMetadataPtr>& measurements, const GSF::StringMap<ConfigurationFramePtr>& configurationFrames);
+
+        // Gets the signal index cache that defines the runtime IDs of this index.
+        const SignalIndexCachePtr& GetSignalIndexCache() const;
+
+        // Gets the reference for the given runtime ID, an unresolved reference
+        // with null metadata is returned when runtime ID is not defined.
+        const SignalMetadataReference& GetReference(uint16_t signalIndex) const
+        {
+            return signalIndex < m_references.size() ? m_references[signalIndex] : NullReference;
+        }
+
+        // Gets the reference for a received measurement using its runtime ID, falls
+        // back on a signal ID lookup when the runtime ID was not assigned from this
+        // index's signal index cache. Returns false if the signal has no metadata.
+        bool TryGetReference(const Measurement& measurement, const SignalMetadataReference*& reference) const;
+
+        // Gets the reference for the given signal ID, returns false if the signal has no metadata.
+        bool TryGetReference(const Guid& signalID, const SignalMetadataReference*& reference) const;
+
+        // Gets the number of runtime IDs resolved to measurement metadata.
+        uint32_t GetResolvedCount() const;
+    };
+
+    typedef SharedPtr<SignalMetadataIndex> SignalMetadataIndexPtr;
+}}}
+
+#endif
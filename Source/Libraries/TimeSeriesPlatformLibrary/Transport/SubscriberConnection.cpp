@@ -32,6 +32,7 @@
 #include "../FilterExpressions/FilterExpressionParser.h"
 
 using namespace std;
+using namespace boost::placeholders;
 using namespace boost::asio;
 using namespace boost::asio::ip;
 using namespace GSF;
@@ -58,6 +59,8 @@ SubscriberConnection::SubscriberConnection(DataPublisherPtr parent, IOContext& c
     m_processingInterval(-1),
     m_temporalSubscriptionCanceled(false),
     m_usingPayloadCompression(false),
+    m_usingXOR64Compression(false),
+    m_usingCompactPacketCompression(false),
     m_includeTime(true),
     m_useLocalClockAsRealTime(false),
     m_lagTime(DefaultLagTime),
@@ -73,12 +76,12 @@ SubscriberConnection::SubscriberConnection(DataPublisherPtr parent, IOContext& c
     m_stopped(true),
     m_commandChannelSocket(m_commandChannelService),
     m_readBuffer(Common::MaxPacketSize),
+    m_tcpWriteStartTime(0LL),
     m_udpPort(0),
     m_dataChannelSocket(m_dataChannelService),
     m_udpWriteStrand(m_dataChannelService),
-    m_totalCommandChannelBytesSent(0LL),
-    m_totalDataChannelBytesSent(0LL),
-    m_totalMeasurementsSent(0LL),
+    m_udpWriteStartTime(0LL),
+    m_filterIsIncremental(false),
     m_baseTimeRotationTimer(nullptr),
     m_timeIndex(0),
     m_baseTimeOffsets{ 0LL, 0LL },
@@ -98,7 +101,12 @@ SubscriberConnection::SubscriberConnection(DataPublisherPtr parent, IOContext& c
     m_pingTimer.SetUserData(this);
 }
 
-SubscriberConnection::~SubscriberConnection() = default;
+SubscriberConnection::~SubscriberConnection()
+{
+    // Data channel thread references connection members, so it cannot outlive the connection
+    if (m_dataChannelThread.joinable() && m_dataChannelThread.get_id() != boost::this_thread::get_id())
+        m_dataChannelThread.join();
+}
 
 const DataPublisherPtr& SubscriberConnection::GetParent() const
 {
@@ -343,32 +351,185 @@ void SubscriberConnection::SetSubscriptionInfo(const string& value)
     m_subscriptionInfo = source + " version " + version + " built on " + buildDate;
 }
 
-const SignalIndexCachePtr& SubscriberConnection::GetSignalIndexCache() const
+SignalIndexCachePtr SubscriberConnection::GetSignalIndexCache() const
 {
-    return m_signalIndexCache;
+    return boost::atomic_load(&m_signalIndexCache);
 }
 
 void SubscriberConnection::SetSignalIndexCache(SignalIndexCachePtr signalIndexCache)
 {
-    m_signalIndexCache = std::move(signalIndexCache);
+    boost::atomic_store(&m_signalIndexCache, signalIndexCache);
 
     // Update measurement routes for newly subscribed measurement signal IDs
-    m_parent->m_routingTables.UpdateRoutes(shared_from_this(), m_signalIndexCache->GetSignalIDs());
+    m_parent->m_routingTables.UpdateRoutes(shared_from_this(), signalIndexCache->GetSignalIDs());
+}
+
+void SubscriberConnection::UpdateSubscription(const DataSetPtr& filteringMetadata, const DataSetPtr& changedMetadata, const unordered_set<Guid>& changedSignalIDs)
+{
+    string filterExpression;
+    bool incremental;
+    SignalIndexCachePtr currentCache;
+
+    // Constrain lock to subscription state, filter evaluation should not hold up publication
+    {
+        ScopeLock lock(m_tsscEncoderLock);
+        filterExpression = m_filterExpression;
+        incremental = m_filterIsIncremental;
+        currentCache = boost::atomic_load(&m_signalIndexCache);
+    }
+
+    if (!m_isSubscribed || filterExpression.empty() || currentCache == nullptr)
+        return;
+
+    vector<DataRowPtr> rows;
+    string exceptionMessage;
+    bool filterIsIncremental;
+
+    // Row independent filters only need to be evaluated against the changed rows, all others are evaluated in full
+    if (!incremental || !EvaluateFilterExpression(filterExpression, changedMetadata, false, rows, filterIsIncremental, exceptionMessage))
+    {
+        incremental = false;
+        rows.clear();
+        exceptionMessage.clear();
+
+        if (!EvaluateFilterExpression(filterExpression, filteringMetadata, true, rows, filterIsIncremental, exceptionMessage))
+        {
+            m_parent->DispatchErrorMessage("Failed to update subscription for " + GetConnectionID() + " after metadata change: " + exceptionMessage);
+            return;
+        }
+    }
+
+    const DataTablePtr& activeMeasurements = (incremental ? changedMetadata : filteringMetadata)->Table("ActiveMeasurements");
+    const int32_t idColumn = DataPublisher::GetColumnIndex(activeMeasurements, "ID");
+    const int32_t signalIDColumn = DataPublisher::GetColumnIndex(activeMeasurements, "SignalID");
+    const uint32_t charSizeEstimate = GetCharSizeEstimate();
+    unordered_map<Guid, DataRowPtr> matchedRows;
+
+    for (const auto& row : rows)
+        matchedRows.emplace(row->ValueAsGuid(signalIDColumn).GetValueOrDefault(), row);
+
+    SignalIndexCachePtr signalIndexCache = NewSharedPtr<SignalIndexCache>();
+    unordered_set<Guid> addedSignalIDs, removedSignalIDs;
+    bool keysChanged = false;
+
+    signalIndexCache->Reserve(currentCache->Count());
+
+    // Signals that remain subscribed keep their runtime IDs
+    for (uint32_t i = 0; i < currentCache->GetSignalIndexCapacity(); i++)
+    {
+        const uint16_t signalIndex = static_cast<uint16_t>(i);
+        Guid signalID;
+        string source;
+        uint32_t id;
+
+        if (!currentCache->GetMeasurementKey(signalIndex, signalID, source, id))
+            continue;
+
+        if (incremental && changedSignalIDs.find(signalID) == changedSignalIDs.end())
+        {
+            signalIndexCache->AddMeasurementKey(signalIndex, signalID, source, id, charSizeEstimate);
+            continue;
+        }
+
+        const auto iterator = matchedRows.find(signalID);
+
+        if (iterator == matchedRows.end())
+        {
+            removedSignalIDs.insert(signalID);
+            continue;
+        }
+
+        string matchedSource;
+        uint32_t matchedID;
+
+        ParseMeasurementKey(iterator->second->ValueAsString(idColumn).GetValueOrDefault(), matchedSource, matchedID);
+        signalIndexCache->AddMeasurementKey(signalIndex, signalID, matchedSource, matchedID, charSizeEstimate);
+
+        if (matchedSource != source || matchedID != id)
+            keysChanged = true;
+    }
+
+    // Newly matched signals get runtime IDs unused by either cache, so packets encoded
+    // before the update cannot be attributed to a different signal by the subscriber
+    uint32_t nextIndex = 0U;
+
+    for (const auto& row : rows)
+    {
+        const Guid signalID = row->ValueAsGuid(signalIDColumn).GetValueOrDefault();
+
+        if (signalIndexCache->GetSignalIndex(signalID) != UInt16::MaxValue)
+            continue;
+
+        while (nextIndex < UInt16::MaxValue && (currentCache->Contains(static_cast<uint16_t>(nextIndex)) || signalIndexCache->Contains(static_cast<uint16_t>(nextIndex))))
+            nextIndex++;
+
+        if (nextIndex == UInt16::MaxValue)
+        {
+            m_parent->DispatchErrorMessage("WARNING: No runtime IDs remain available for new signals subscribed by " + GetConnectionID() + ", resubscribe to include all matched signals");
+            break;
+        }
+
+        string source;
+        uint32_t id;
+
+        ParseMeasurementKey(row->ValueAsString(idColumn).GetValueOrDefault(), source, id);
+        signalIndexCache->AddMeasurementKey(static_cast<uint16_t>(nextIndex), signalID, source, id, charSizeEstimate);
+        addedSignalIDs.insert(signalID);
+    }
+
+    if (addedSignalIDs.empty() && removedSignalIDs.empty() && !keysChanged)
+        return;
+
+    ScopeLock lock(m_tsscEncoderLock);
+
+    // A resubscription while filter was being evaluated has already applied current metadata
+    if (boost::atomic_load(&m_signalIndexCache) != currentCache)
+        return;
+
+    // Send updated signal index cache to client, TSSC and XOR64 encoders are not reset since existing runtime IDs are unchanged
+    SendResponse(ServerResponse::UpdateSignalIndexCache, ServerCommand::Subscribe, SerializeSignalIndexCache(*signalIndexCache));
+    boost::atomic_store(&m_signalIndexCache, signalIndexCache);
+
+    // Only routes for added and removed signals need to be updated
+    m_parent->m_routingTables.PatchRoutes(shared_from_this(), addedSignalIDs, removedSignalIDs);
+
+    m_parent->DispatchStatusMessage("Updated subscription for " + GetConnectionID() + " after metadata change: " + ToString(addedSignalIDs.size()) + " signals added, " + ToString(removedSignalIDs.size()) + " signals removed" + (incremental ? "" : " by full filter evaluation"));
 }
 
 uint64_t SubscriberConnection::GetTotalCommandChannelBytesSent() const
 {
-    return m_totalCommandChannelBytesSent;
+    return m_totalCommandChannelBytesSent.Value();
 }
 
 uint64_t SubscriberConnection::GetTotalDataChannelBytesSent() const
 {
-    return m_totalDataChannelBytesSent;
+    return m_totalDataChannelBytesSent.Value();
 }
 
 uint64_t SubscriberConnection::GetTotalMeasurementsSent() const
 {
-    return m_totalMeasurementsSent;
+    return m_totalMeasurementsSent.Value();
+}
+
+PublicationStatistics SubscriberConnection::GetStatistics() const
+{
+    PublicationStatistics statistics;
+
+    statistics.ConnectionCount = 1U;
+    statistics.CommandChannelBytesSent = m_totalCommandChannelBytesSent.Value();
+    statistics.DataChannelBytesSent = m_totalDataChannelBytesSent.Value();
+    statistics.CommandChannelPacketsSent = m_totalCommandChannelPacketsSent.Value();
+    statistics.DataChannelPacketsSent = m_totalDataChannelPacketsSent.Value();
+    statistics.DataPacketsSent = m_totalDataPacketsSent.Value();
+    statistics.MeasurementsSent = m_totalMeasurementsSent.Value();
+    statistics.EncodeTime = m_totalEncodeTime.Value();
+    statistics.SocketWrites = m_totalSocketWrites.Value();
+    statistics.SocketWaitTime = m_totalSocketWaitTime.Value();
+    statistics.WriteQueueDepth = m_writeQueueDepth.Value();
+    statistics.PeakWriteQueueDepth = m_writeQueueDepth.Peak();
+    statistics.CompressionResets = m_totalCompressionResets.Value();
+
+    return statistics;
 }
 
 bool SubscriberConnection::CipherKeysDefined() const
@@ -464,13 +625,7 @@ void SubscriberConnection::Stop(const bool shutdownSocket)
         m_commandChannelSocket.cancel();
 
         if (m_dataChannelActive)
-        {
-            m_dataChannelActive = false;
-            m_dataChannelWaitHandle.notify_all();
-            m_dataChannelService.stop();
-            m_dataChannelSocket.shutdown(socket_base::shutdown_type::shutdown_both);
-            m_dataChannelSocket.close();
-        }
+            StopDataChannel();
     }
     catch (...)
     {
@@ -511,10 +666,7 @@ void SubscriberConnection::PublishMeasurements(const vector<MeasurementPtr>& mea
     }
     else
     {
-        if (m_usingPayloadCompression)
-            PublishTSSCMeasurements(measurements);
-        else
-            PublishCompactMeasurements(measurements);
+        PublishDataPackets(measurements);
     }
 }
 
@@ -567,11 +719,14 @@ void SubscriberConnection::HandleSubscribe(uint8_t* data, uint32_t length)
                 if (byteLength > 0 && length >= byteLength + 6U)
                 {
                     uint32_t operationalModes = GetOperationalModes();
-                    m_usingPayloadCompression = (operationalModes & OperationalModes::CompressPayloadData) > 0 && (operationalModes & CompressionModes::TSSC) > 0;
+                    m_usingPayloadCompression = (operationalModes & OperationalModes::CompressPayloadData) > 0 && (operationalModes & (CompressionModes::TSSC | CompressionModes::XOR64)) > 0;
+
+                    // XOR64 takes precedence when requested since the subscriber asked for full-precision values
+                    m_usingXOR64Compression = m_usingPayloadCompression && (operationalModes & CompressionModes::XOR64) > 0;
                     const string connectionString = DecodeString(data, index, byteLength);
 
                     if (!m_usingPayloadCompression && ((flags & DataPacketFlags::Compact) == 0 || (operationalModes & OperationalModes::CompressPayloadData) > 0))
-                        m_parent->DispatchErrorMessage("WARNING: Data packets will be published in compact measurement format only when not compressing payload using TSSC.");
+                        m_parent->DispatchErrorMessage("WARNING: Data packets will be published in compact measurement format only when not compressing payload using TSSC or XOR64.");
 
                     m_parent->DispatchStatusMessage("Successfully decoded " + ToString(connectionString.size()) + " character connection string from " + ToString(byteLength) + " bytes...");
 
@@ -658,16 +813,20 @@ void SubscriberConnection::HandleSubscribe(uint8_t* data, uint32_t length)
                     }
 
                     SignalIndexCachePtr signalIndexCache = nullptr;
+                    string filterExpression;
+                    bool filterIsIncremental = false;
 
                     // Apply subscriber filter expression and build signal index cache
                     if (TryGetValue(settings, "inputMeasurementKeys", setting))
                     {
                         bool success;
                         
-                        signalIndexCache = ParseSubscriptionRequest(setting, success);
+                        signalIndexCache = ParseSubscriptionRequest(setting, filterIsIncremental, success);
 
                         if (!success)
                             return;
+
+                        filterExpression = setting;
                     }
 
                     // Pass subscriber assembly information to connection, if defined
@@ -692,12 +851,13 @@ void SubscriberConnection::HandleSubscribe(uint8_t* data, uint32_t length)
                         {
                             if (m_usingPayloadCompression)
                             {
-                                // TSSC is a stateful compression algorithm which will not reliably support UDP
-                                m_parent->DispatchErrorMessage("WARNING: Cannot use TSSC compression mode with UDP - special compression mode disabled");
+                                // TSSC and XOR64 are stateful compression algorithms which will not reliably support UDP
+                                m_parent->DispatchErrorMessage("WARNING: Cannot use TSSC or XOR64 compression modes with UDP - special compression mode disabled");
 
-                                // Disable TSSC compression processing
+                                // Disable TSSC and XOR64 compression processing
                                 m_usingPayloadCompression = false;
-                                operationalModes &= ~CompressionModes::TSSC;
+                                m_usingXOR64Compression = false;
+                                operationalModes &= ~(CompressionModes::TSSC | CompressionModes::XOR64);
                                 operationalModes &= ~OperationalModes::CompressPayloadData;
                                 SetOperationalModes(operationalModes);
                             }
@@ -708,34 +868,19 @@ void SubscriberConnection::HandleSubscribe(uint8_t* data, uint32_t length)
 
                                 // Reset UDP socket on resubscribe
                                 if (m_dataChannelActive)
-                                {
-                                    m_dataChannelActive = false;
-                                    m_dataChannelWaitHandle.notify_all();
-                                    m_dataChannelSocket.shutdown(socket_base::shutdown_type::shutdown_both);
-                                    m_dataChannelSocket.close();
-                                    m_dataChannelService.stop();
-                                }
+                                    StopDataChannel();
 
                                 m_dataChannelSocket.open(protocol);
                                 m_dataChannelSocket.bind(udp::endpoint(ip::address::from_string(networkInterface), 0));
                                 m_dataChannelSocket.connect(udp::endpoint(remoteEndPoint.address(), m_udpPort));
-                                m_dataChannelActive = true;
-                                
-                                Thread([&,this]
-                                {
-                                    UniqueLock lock(m_dataChannelMutex);
-
-                                    while (m_dataChannelActive)
-                                    {
-                                        m_dataChannelService.restart();
-                                        m_dataChannelService.run();                                        
-                                        m_dataChannelWaitHandle.wait(lock);
-                                    }
-                                });
+                                StartDataChannel();
                             }
                         }
                     }
 
+                    // Compact packets can be compressed independently when stateful compression is not in use, e.g., for UDP
+                    m_usingCompactPacketCompression = !m_usingPayloadCompression && (operationalModes & OperationalModes::CompressCompactPackets) > 0;
+
                     int32_t signalCount = 0;
 
                     if (signalIndexCache != nullptr)
@@ -748,8 +893,10 @@ void SubscriberConnection::HandleSubscribe(uint8_t* data, uint32_t length)
                    
                     m_tsscEncoderLock.lock();
 
-                    // Reset TSSC encoder on successful (re)subscription
+                    // Reset TSSC and XOR64 encoders on successful (re)subscription
                     m_tsscResetRequested = true;
+                    m_filterExpression = filterExpression;
+                    m_filterIsIncremental = filterIsIncremental;
                     SetSignalIndexCache(signalIndexCache);
 
                     m_tsscEncoderLock.unlock();
@@ -839,10 +986,7 @@ void SubscriberConnection::HandleSubscribe(uint8_t* data, uint32_t length)
 
                             m_latestMeasurementsLock.unlock();
 
-                            if (m_usingPayloadCompression)
-                                PublishTSSCMeasurements(measurements);
-                            else
-                                PublishCompactMeasurements(measurements);
+                            PublishDataPackets(measurements);
                         },
                         true);
 
@@ -850,7 +994,7 @@ void SubscriberConnection::HandleSubscribe(uint8_t* data, uint32_t length)
                     }
 
                     const string message = string("Client subscribed using ") + 
-                        (m_usingPayloadCompression ? "TSSC compression over " : "compact format over ") +
+                        (m_usingXOR64Compression ? "XOR64 compression over " : m_usingPayloadCompression ? "TSSC compression over " : m_usingCompactPacketCompression ? "compressed compact format over " : "compact format over ") +
                         (m_dataChannelActive ? "UDP" : "TCP") + " with " + ToString(signalCount) + " signals.";
 
                     SetIsSubscribed(true);
@@ -1028,17 +1172,56 @@ void SubscriberConnection::HandleUserCommand(uint32_t command, uint8_t* data, ui
     m_parent->DispatchUserCommand(this, command, data, length);
 }
 
-SignalIndexCachePtr SubscriberConnection::ParseSubscriptionRequest(const string& filterExpression, bool& success)
+SignalIndexCachePtr SubscriberConnection::ParseSubscriptionRequest(const string& filterExpression, bool& incremental, bool& success)
 {
-    string exceptionMessage, parsingException;
-    FilterExpressionParserPtr parser = NewSharedPtr<FilterExpressionParser>(filterExpression);
-
     // Define an empty schema if none has been defined
     if (m_parent->m_filteringMetadata == nullptr)
         m_parent->m_filteringMetadata = DataSet::FromXml(ActiveMeasurementsSchema, ActiveMeasurementsSchemaLength);
 
+    const DataSetPtr& filteringMetadata = m_parent->m_filteringMetadata;
+    vector<DataRowPtr> rows;
+    string exceptionMessage;
+
+    if (!EvaluateFilterExpression(filterExpression, filteringMetadata, true, rows, incremental, exceptionMessage))
+    {
+        SendResponse(ServerResponse::Failed, ServerCommand::Subscribe, exceptionMessage);
+        m_parent->DispatchErrorMessage(exceptionMessage);
+
+        success = false;
+        return nullptr;
+    }
+
+    const uint32_t charSizeEstimate = GetCharSizeEstimate();
+    const DataTablePtr& activeMeasurements = filteringMetadata->Table("ActiveMeasurements");
+    const int32_t idColumn = DataPublisher::GetColumnIndex(activeMeasurements, "ID");
+    const int32_t signalIDColumn = DataPublisher::GetColumnIndex(activeMeasurements, "SignalID");
+
+    // Create a new signal index cache for filtered measurements
+    SignalIndexCachePtr signalIndexCache = NewSharedPtr<SignalIndexCache>();
+
+    for (size_t i = 0; i < rows.size(); i++)
+    {
+        const DataRowPtr& row = rows[i];
+        const Guid signalID = row->ValueAsGuid(signalIDColumn).GetValueOrDefault();
+        string source;
+        uint32_t id;
+
+        ParseMeasurementKey(row->ValueAsString(idColumn).GetValueOrDefault(), source, id);
+        signalIndexCache->AddMeasurementKey(uint16_t(i), signalID, source, id, charSizeEstimate);
+    }
+
+    success = true;
+    return signalIndexCache;
+}
+
+bool SubscriberConnection::EvaluateFilterExpression(const string& filterExpression, const DataSetPtr& filteringMetadata, const bool useExpressionCache, vector<DataRowPtr>& rows, bool& incremental, string& exceptionMessage) const
+{
+    string parsingException;
+    FilterExpressionParserPtr parser = NewSharedPtr<FilterExpressionParser>(filterExpression);
+
     // Set filtering dataset, this schema contains a more flattened, denormalized view of available metadata for easier filtering
-    parser->SetDataSet(m_parent->m_filteringMetadata);
+    parser->SetDataSet(filteringMetadata);
+    parser->SetUseExpressionCache(useExpressionCache);
 
     // Manually specified signal ID and measurement key fields are expected to be searched against ActiveMeasurements table
     parser->SetTableIDFields("ActiveMeasurements", FilterExpressionParser::DefaultTableIDFields);
@@ -1050,6 +1233,16 @@ SignalIndexCachePtr SubscriberConnection::ParseSubscriptionRequest(const string&
     try
     {
         parser->Evaluate();
+        rows = parser->FilteredRows();
+
+        // Rows are matched independently of each other unless a TOP limit or ORDER BY clause is applied
+        incremental = true;
+
+        for (const auto& expressionTree : parser->GetExpressionTrees())
+        {
+            if (expressionTree->TopLimit > -1 || !expressionTree->OrderByTerms.empty())
+                incremental = false;
+        }
     }
     catch (const FilterExpressionParserException& ex)
     {
@@ -1064,58 +1257,47 @@ SignalIndexCachePtr SubscriberConnection::ParseSubscriptionRequest(const string&
         exceptionMessage = boost::current_exception_diagnostic_information(true);
     }
 
-    if (!exceptionMessage.empty())
-    {
-        if (!parsingException.empty())
-            exceptionMessage += "\n" + parsingException;
-
-        SendResponse(ServerResponse::Failed, ServerCommand::Subscribe, exceptionMessage);
-        m_parent->DispatchErrorMessage(exceptionMessage);
+    if (exceptionMessage.empty())
+        return true;
 
-        success = false;
-        return nullptr;
-    }
+    if (!parsingException.empty())
+        exceptionMessage += "\n" + parsingException;
 
-    uint32_t charSizeEstimate;
+    return false;
+}
 
+uint32_t SubscriberConnection::GetCharSizeEstimate() const
+{
     switch (GetEncoding())
     {
         case OperationalEncoding::ANSI:
         case OperationalEncoding::Unicode:
         case OperationalEncoding::BigEndianUnicode:
-            charSizeEstimate = 2U;
-            break;
+            return 2U;
         default:
-            charSizeEstimate = 1U;
-            break;
+            return 1U;
     }
+}
 
-    const DataTablePtr& activeMeasurements = m_parent->m_filteringMetadata->Table("ActiveMeasurements");
-    const vector<DataRowPtr>& rows = parser->FilteredRows();
-    const int32_t idColumn = DataPublisher::GetColumnIndex(activeMeasurements, "ID");
-    const int32_t signalIDColumn = DataPublisher::GetColumnIndex(activeMeasurements, "SignalID");
-
-    // Create a new signal index cache for filtered measurements
-    SignalIndexCachePtr signalIndexCache = NewSharedPtr<SignalIndexCache>();
-
-    for (size_t i = 0; i < rows.size(); i++)
-    {
-        const DataRowPtr& row = rows[i];
-        const Guid& signalID = row->ValueAsGuid(signalIDColumn).GetValueOrDefault();        
-        string source;
-        uint32_t id;
+void SubscriberConnection::PublishDataPackets(const std::vector<MeasurementPtr>& measurements)
+{
+    const int64_t startTime = GetStatisticsTime();
 
-        ParseMeasurementKey(row->ValueAsString(idColumn).GetValueOrDefault(), source, id);
-        signalIndexCache->AddMeasurementKey(uint16_t(i), signalID, source, id, charSizeEstimate);
-    }
+    if (m_usingXOR64Compression)
+        PublishXOR64Measurements(measurements);
+    else if (m_usingPayloadCompression)
+        PublishTSSCMeasurements(measurements);
+    else
+        PublishCompactMeasurements(measurements);
 
-    success = true;
-    return signalIndexCache;
+    m_totalEncodeTime.Add(GetStatisticsTime() - startTime);
 }
 
 void SubscriberConnection::PublishCompactMeasurements(const std::vector<MeasurementPtr>& measurements)
 {
-    CompactMeasurement serializer(m_signalIndexCache, m_baseTimeOffsets, m_includeTime, m_useMillisecondResolution, m_timeIndex);
+    // Cache may be replaced by a metadata update while publishing, so a single snapshot is used
+    const SignalIndexCachePtr signalIndexCache = boost::atomic_load(&m_signalIndexCache);
+    CompactMeasurement serializer(signalIndexCache, m_baseTimeOffsets, m_includeTime, m_useMillisecondResolution, m_timeIndex);
     vector<uint8_t> packet, buffer;
     int32_t count = 0;
 
@@ -1126,7 +1308,7 @@ void SubscriberConnection::PublishCompactMeasurements(const std::vector<Measurem
     {
         const Measurement& measurement = *measurements[i];
         const int64_t timestamp = measurement.Timestamp;
-        const uint16_t runtimeID = m_signalIndexCache->GetSignalIndex(measurement.SignalID);
+        const uint16_t runtimeID = signalIndexCache->GetSignalIndex(measurement.SignalID);
 
         if (runtimeID == UInt16::MaxValue)
             continue;
@@ -1138,7 +1320,7 @@ void SubscriberConnection::PublishCompactMeasurements(const std::vector<Measurem
 
         if (packet.size() + length > MaxPacketSize)
         {
-            PublishCompactDataPacket(packet, count);
+            PublishCompactDataPacket(packet, count, signalIndexCache);
             packet.clear();
             count = 0;
         }
@@ -1153,10 +1335,10 @@ void SubscriberConnection::PublishCompactMeasurements(const std::vector<Measurem
     }
 
     if (count > 0)
-        PublishCompactDataPacket(packet, count);
+        PublishCompactDataPacket(packet, count, signalIndexCache);
 }
 
-void SubscriberConnection::PublishCompactDataPacket(const vector<uint8_t>& packet, const int32_t count)
+void SubscriberConnection::PublishCompactDataPacket(const vector<uint8_t>& packet, const int32_t count, const SignalIndexCachePtr& signalIndexCache)
 {
     vector<uint8_t> buffer;
     buffer.reserve(packet.size() + 5);
@@ -1167,8 +1349,23 @@ void SubscriberConnection::PublishCompactDataPacket(const vector<uint8_t>& packe
     // Serialize total number of measurement values to follow
     EndianConverter::WriteBigEndianBytes(buffer, count);
 
-    // Serialize measurements to data buffer
-    WriteBytes(buffer, packet);
+    // Serialize measurements to data buffer, packets that do not shrink when compressed are sent as is
+    if (m_usingCompactPacketCompression)
+    {
+        ScopeLock lock(m_compactPacketCodecLock);
+        m_compactPacketCodec.SetDictionarySource(m_parent->GetUseCompactPacketDictionary() ? signalIndexCache : nullptr);
+        m_compactPacketCodec.Compress(packet.data(), ConvertUInt32(packet.size()), buffer);
+    }
+
+    if (buffer.size() > 5 && buffer.size() - 5 < packet.size())
+    {
+        buffer[0] |= DataPacketFlags::PacketCompressed;
+    }
+    else
+    {
+        buffer.resize(5);
+        WriteBytes(buffer, packet);
+    }
 
     // Publish data packet to client
     SendResponse(ServerResponse::DataPacket, ServerCommand::Subscribe, buffer);
@@ -1176,8 +1373,9 @@ void SubscriberConnection::PublishCompactDataPacket(const vector<uint8_t>& packe
     // Track last publication time
     m_lastPublishTime = UtcNow();
 
-    // Track total number of published measurements
-    m_totalMeasurementsSent += count;
+    // Track total number of published data packets and measurements
+    m_totalDataPacketsSent.Increment();
+    m_totalMeasurementsSent.Add(count);
 }
 
 void SubscriberConnection::PublishTSSCMeasurements(const std::vector<MeasurementPtr>& measurements)
@@ -1185,48 +1383,93 @@ void SubscriberConnection::PublishTSSCMeasurements(const std::vector<Measurement
     m_tsscEncoderLock.lock();
 
     if (m_tsscResetRequested)
+        ResetCompressionState();
+
+    m_tsscEncoder.SetBuffer(m_tsscWorkingBuffer, 0, TSSCBufferSize);
+
+    const SignalIndexCachePtr signalIndexCache = boost::atomic_load(&m_signalIndexCache);
+    int32_t count = 0;
+
+    for (const auto& measurement : measurements)
     {
-        m_tsscResetRequested = false;
-        m_tsscEncoder.Reset();
+        const uint16_t index = signalIndexCache->GetSignalIndex(measurement->SignalID);
 
-        for (size_t i = 0; i < TSSCBufferSize; i++)
-            m_tsscWorkingBuffer[i] = static_cast<uint8_t>(0);
+        if (index == UInt16::MaxValue)
+            continue;
 
-        if (m_tsscSequenceNumber != 0)
+        if (!m_tsscEncoder.TryAddMeasurement(index, measurement->Timestamp, static_cast<uint32_t>(measurement->Flags), static_cast<float32_t>(measurement->AdjustedValue())))
         {
-            m_parent->DispatchStatusMessage("TSSC algorithm reset before sequence number: " + ToString(m_tsscSequenceNumber));
-            m_tsscSequenceNumber = 0;
+            PublishCompressedDataPacket(CompressedPayloadVersion::TSSC, m_tsscEncoder.FinishBlock(), count);
+            count = 0;
+            m_tsscEncoder.SetBuffer(m_tsscWorkingBuffer, 0, TSSCBufferSize);
+            m_tsscEncoder.TryAddMeasurement(index, measurement->Timestamp, static_cast<uint32_t>(measurement->Flags), static_cast<float32_t>(measurement->AdjustedValue()));
         }
+
+        count++; //-V127
     }
 
-    m_tsscEncoder.SetBuffer(m_tsscWorkingBuffer, 0, TSSCBufferSize);
+    if (count > 0)
+        PublishCompressedDataPacket(CompressedPayloadVersion::TSSC, m_tsscEncoder.FinishBlock(), count);
+
+    m_tsscEncoderLock.unlock();
+}
 
+void SubscriberConnection::PublishXOR64Measurements(const std::vector<MeasurementPtr>& measurements)
+{
+    m_tsscEncoderLock.lock();
+
+    if (m_tsscResetRequested)
+        ResetCompressionState();
+
+    m_xor64Encoder.SetBuffer(m_tsscWorkingBuffer, 0, TSSCBufferSize);
+
+    const SignalIndexCachePtr signalIndexCache = boost::atomic_load(&m_signalIndexCache);
     int32_t count = 0;
 
     for (const auto& measurement : measurements)
     {
-        const uint16_t index = m_signalIndexCache->GetSignalIndex(measurement->SignalID);
+        const uint16_t index = signalIndexCache->GetSignalIndex(measurement->SignalID);
 
-        if (!m_tsscEncoder.TryAddMeasurement(index, measurement->Timestamp, static_cast<uint32_t>(measurement->Flags), static_cast<float32_t>(measurement->AdjustedValue())))
+        if (index == UInt16::MaxValue)
+            continue;
+
+        if (!m_xor64Encoder.TryAddMeasurement(index, measurement->Timestamp, static_cast<uint32_t>(measurement->Flags), measurement->AdjustedValue()))
         {
-            PublishTSSCDataPacket(count);
+            PublishCompressedDataPacket(CompressedPayloadVersion::XOR64, m_xor64Encoder.FinishBlock(), count);
             count = 0;
-            m_tsscEncoder.SetBuffer(m_tsscWorkingBuffer, 0, TSSCBufferSize);
-            m_tsscEncoder.TryAddMeasurement(index, measurement->Timestamp, static_cast<uint32_t>(measurement->Flags), static_cast<float32_t>(measurement->AdjustedValue()));
+            m_xor64Encoder.SetBuffer(m_tsscWorkingBuffer, 0, TSSCBufferSize);
+            m_xor64Encoder.TryAddMeasurement(index, measurement->Timestamp, static_cast<uint32_t>(measurement->Flags), measurement->AdjustedValue());
         }
 
         count++; //-V127
     }
 
     if (count > 0)
-        PublishTSSCDataPacket(count);
+        PublishCompressedDataPacket(CompressedPayloadVersion::XOR64, m_xor64Encoder.FinishBlock(), count);
 
     m_tsscEncoderLock.unlock();
 }
 
-void SubscriberConnection::PublishTSSCDataPacket(int32_t count)
+// Caller must hold the encoder lock
+void SubscriberConnection::ResetCompressionState()
+{
+    m_tsscResetRequested = false;
+    m_totalCompressionResets.Increment();
+    m_tsscEncoder.Reset();
+    m_xor64Encoder.Reset();
+
+    for (size_t i = 0; i < TSSCBufferSize; i++)
+        m_tsscWorkingBuffer[i] = static_cast<uint8_t>(0);
+
+    if (m_tsscSequenceNumber != 0)
+    {
+        m_parent->DispatchStatusMessage(string(m_usingXOR64Compression ? "XOR64" : "TSSC") + " algorithm reset before sequence number: " + ToString(m_tsscSequenceNumber));
+        m_tsscSequenceNumber = 0;
+    }
+}
+
+void SubscriberConnection::PublishCompressedDataPacket(uint8_t version, uint32_t length, int32_t count)
 {
-    const uint32_t length = m_tsscEncoder.FinishBlock();
     vector<uint8_t> buffer;
     buffer.reserve(length + 8);
 
@@ -1237,7 +1480,7 @@ void SubscriberConnection::PublishTSSCDataPacket(int32_t count)
     EndianConverter::WriteBigEndianBytes(buffer, count);
 
     // Add a version number
-    buffer.push_back(85);
+    buffer.push_back(version);
 
     EndianConverter::WriteBigEndianBytes(buffer, m_tsscSequenceNumber);
     m_tsscSequenceNumber++;
@@ -1255,8 +1498,9 @@ void SubscriberConnection::PublishTSSCDataPacket(int32_t count)
     // Track last publication time
     m_lastPublishTime = UtcNow();
 
-    // Track total number of published measurements
-    m_totalMeasurementsSent += count;
+    // Track total number of published data packets and measurements
+    m_totalDataPacketsSent.Increment();
+    m_totalMeasurementsSent.Add(count);
 }
 
 bool SubscriberConnection::SendDataStartTime(uint64_t timestamp)
@@ -1533,6 +1777,7 @@ void SubscriberConnection::CommandChannelSendAsync()
         return;
 
     vector<uint8_t>& data = *m_tcpWriteBuffers[0];
+    m_tcpWriteStartTime = GetStatisticsTime();
     async_write(m_commandChannelSocket, buffer(&data[0], data.size()), bind_executor(m_tcpWriteStrand, bind(&SubscriberConnection::CommandChannelWriteHandler, this, _1, _2)));
 }
 
@@ -1542,6 +1787,9 @@ void SubscriberConnection::CommandChannelWriteHandler(const ErrorCode& error, si
         return;
 
     m_tcpWriteBuffers.pop_front();
+    m_writeQueueDepth.Decrement();
+    m_totalSocketWrites.Increment();
+    m_totalSocketWaitTime.Add(GetStatisticsTime() - m_tcpWriteStartTime);
 
     // Stop cleanly, i.e., don't report, on these errors
     if (error == error::connection_aborted || error == error::connection_reset || error == error::eof)
@@ -1568,12 +1816,58 @@ void SubscriberConnection::CommandChannelWriteHandler(const ErrorCode& error, si
         CommandChannelSendAsync();
 }
 
+void SubscriberConnection::StartDataChannel()
+{
+    // Thread from any prior data channel may still be joinable when it was stopped from its own handler
+    if (m_dataChannelThread.joinable() && m_dataChannelThread.get_id() != boost::this_thread::get_id())
+        m_dataChannelThread.join();
+
+    m_dataChannelActive = true;
+
+    m_dataChannelThread = Thread([this]
+    {
+        UniqueLock lock(m_dataChannelMutex);
+
+        while (m_dataChannelActive)
+        {
+            m_dataChannelService.restart();
+            m_dataChannelService.run();
+
+            if (m_dataChannelActive)
+                m_dataChannelWaitHandle.wait(lock);
+        }
+    });
+}
+
+void SubscriberConnection::StopDataChannel()
+{
+    m_dataChannelActive = false;
+    m_dataChannelService.stop();
+
+    // When stopped from a data channel handler, thread exits once the handler returns
+    if (m_dataChannelThread.get_id() != boost::this_thread::get_id())
+    {
+        // Notify under lock so the wake-up cannot be missed between the active check and the wait
+        {
+            ScopeLock lock(m_dataChannelMutex);
+            m_dataChannelWaitHandle.notify_all();
+        }
+
+        if (m_dataChannelThread.joinable())
+            m_dataChannelThread.join();
+    }
+
+    m_dataChannelSocket.shutdown(socket_base::shutdown_type::shutdown_both);
+    m_dataChannelSocket.close();
+}
+
 void SubscriberConnection::DataChannelSendAsync()
 {
     if (m_stopped)
         return;
 
     vector<uint8_t>& data = *m_udpWriteBuffers[0];
+    m_udpWriteStartTime = GetStatisticsTime();
     m_dataChannelSocket.async_send(buffer(&data[0], data.size()), bind_executor(m_udpWriteStrand, bind(&SubscriberConnection::DataChannelWriteHandler, this, _1, _2)));
 }
 
@@ -1583,6 +1877,9 @@ void SubscriberConnection::DataChannelWriteHandler(const ErrorCode& error, size_
         return;
 
     m_udpWriteBuffers.pop_front();
+    m_writeQueueDepth.Decrement();
+    m_totalSocketWrites.Increment();
+    m_totalSocketWaitTime.Add(GetStatisticsTime() - m_udpWriteStartTime);
 
     // Stop cleanly, i.e., don't report, on these errors
     if (error == error::connection_aborted || error == error::connection_reset || error == error::eof)
@@ -1674,7 +1971,9 @@ bool SubscriberConnection::SendResponse(uint8_t responseCode, uint8_t commandCod
         // Data packets and buffer blocks can be published on a UDP data channel, so check for this...
         if (useDataChannel)
         {
-            m_totalDataChannelBytesSent += buffer.size();
+            m_totalDataChannelBytesSent.Add(buffer.size());
+            m_totalDataChannelPacketsSent.Increment();
+            m_writeQueueDepth.Increment();
 
             post(m_udpWriteStrand, [this, bufferPtr] {
                 m_udpWriteBuffers.push_back(bufferPtr);
@@ -1687,7 +1986,9 @@ bool SubscriberConnection::SendResponse(uint8_t responseCode, uint8_t commandCod
         }
         else
         {
-            m_totalCommandChannelBytesSent += buffer.size();
+            m_totalCommandChannelBytesSent.Add(buffer.size());
+            m_totalCommandChannelPacketsSent.Increment();
+            m_writeQueueDepth.Increment();
 
             post(m_tcpWriteStrand, [this, bufferPtr] {
                 m_tcpWriteBuffers.push_back(bufferPtr);
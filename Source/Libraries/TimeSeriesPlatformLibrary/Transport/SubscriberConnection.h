@@ -30,6 +30,9 @@
 #include "SignalIndexCache.h"
 #include "TransportTypes.h"
 #include "TSSCEncoder.h"
+#include "XOR64Encoder.h"
+#include "CompactPacketCodec.h"
+#include "TransportStatistics.h"
 #include <deque>
 
 namespace GSF {
@@ -63,6 +66,8 @@ namespace Transport
         int32_t m_processingInterval;
         bool m_temporalSubscriptionCanceled;
         bool m_usingPayloadCompression;
+        bool m_usingXOR64Compression;
+        bool m_usingCompactPacketCompression;
         bool m_includeTime;
         bool m_useLocalClockAsRealTime;
         float64_t m_lagTime;
@@ -81,6 +86,7 @@ namespace Transport
         GSF::TcpSocket m_commandChannelSocket;
         std::vector<uint8_t> m_readBuffer;
         std::deque<SharedPtr<std::vector<uint8_t>>> m_tcpWriteBuffers;
+        int64_t m_tcpWriteStartTime;
         GSF::IPAddress m_ipAddress;
         std::string m_hostName;
 
@@ -90,18 +96,30 @@ namespace Transport
         GSF::WaitHandle m_dataChannelWaitHandle;
         GSF::IOContext m_dataChannelService;
         GSF::UdpSocket m_dataChannelSocket;
+        GSF::Thread m_dataChannelThread;
         GSF::Strand m_udpWriteStrand;
         std::deque<SharedPtr<std::vector<uint8_t>>> m_udpWriteBuffers;
+        int64_t m_udpWriteStartTime;
         std::vector<uint8_t> m_keys[2];
         std::vector<uint8_t> m_ivs[2];
 
-        // Statistics counters
-        uint64_t m_totalCommandChannelBytesSent;
-        uint64_t m_totalDataChannelBytesSent;
-        uint64_t m_totalMeasurementsSent;
-
-        // Measurement parsing
+        // Statistics counters, updated without locks from publication and socket write threads
+        StatisticsCounter m_totalCommandChannelBytesSent;
+        StatisticsCounter m_totalDataChannelBytesSent;
+        StatisticsCounter m_totalCommandChannelPacketsSent;
+        StatisticsCounter m_totalDataChannelPacketsSent;
+        StatisticsCounter m_totalDataPacketsSent;
+        StatisticsCounter m_totalMeasurementsSent;
+        StatisticsCounter m_totalEncodeTime;
+        StatisticsCounter m_totalSocketWrites;
+        StatisticsCounter m_totalSocketWaitTime;
+        StatisticsCounter m_totalCompressionResets;
+        StatisticsGauge m_writeQueueDepth;
+
+        // Measurement parsing, signal index cache is only accessed with atomic load and store
         SignalIndexCachePtr m_signalIndexCache;
+        std::string m_filterExpression;
+        bool m_filterIsIncremental;
         TimerPtr m_baseTimeRotationTimer;
         int32_t m_timeIndex;
         int64_t m_baseTimeOffsets[2];
@@ -111,6 +129,12 @@ namespace Transport
         GSF::Mutex m_latestMeasurementsLock;
         TimerPtr m_throttledPublicationTimer;
         TSSCEncoder m_tsscEncoder;
+        XOR64Encoder m_xor64Encoder;
+
+        CompactPacketCodec m_compactPacketCodec;
+        GSF::Mutex m_compactPacketCodecLock;
+
+        // Lock, working buffer, reset flag and sequence number are shared by TSSC and XOR64 encoders
         GSF::Mutex m_tsscEncoderLock;
         uint8_t m_tsscWorkingBuffer[TSSCBufferSize];
         bool m_tsscResetRequested;
@@ -126,11 +150,16 @@ namespace Transport
         void HandleDefineOperationalModes(uint8_t* data, uint32_t length);
         void HandleUserCommand(uint32_t command, uint8_t* data, uint32_t length);
 
-        SignalIndexCachePtr ParseSubscriptionRequest(const std::string& filterExpression, bool& success);
+        SignalIndexCachePtr ParseSubscriptionRequest(const std::string& filterExpression, bool& incremental, bool& success);
+        bool EvaluateFilterExpression(const std::string& filterExpression, const GSF::Data::DataSetPtr& filteringMetadata, bool useExpressionCache, std::vector<GSF::Data::DataRowPtr>& rows, bool& incremental, std::string& exceptionMessage) const;
+        uint32_t GetCharSizeEstimate() const;
+        void PublishDataPackets(const std::vector<MeasurementPtr>& measurements);
         void PublishCompactMeasurements(const std::vector<MeasurementPtr>& measurements);
-        void PublishCompactDataPacket(const std::vector<uint8_t>& packet, int32_t count);
+        void PublishCompactDataPacket(const std::vector<uint8_t>& packet, int32_t count, const SignalIndexCachePtr& signalIndexCache);
         void PublishTSSCMeasurements(const std::vector<MeasurementPtr>& measurements);
-        void PublishTSSCDataPacket(int32_t count);
+        void PublishXOR64Measurements(const std::vector<MeasurementPtr>& measurements);
+        void ResetCompressionState();
+        void PublishCompressedDataPacket(uint8_t version, uint32_t length, int32_t count);
         bool SendDataStartTime(uint64_t timestamp);
         void ReadCommandChannel();
         void ReadPayloadHeader(const ErrorCode& error, size_t bytesTransferred);
@@ -140,6 +169,8 @@ namespace Transport
         GSF::Data::DataSetPtr FilterClientMetadata(const StringMap<GSF::FilterExpressions::ExpressionTreePtr>& filterExpressions) const;
         void CommandChannelSendAsync();
         void CommandChannelWriteHandler(const ErrorCode& error, size_t bytesTransferred);
+        void StartDataChannel();
+        void StopDataChannel();
         void DataChannelSendAsync();
         void DataChannelWriteHandler(const ErrorCode& error, size_t bytesTransferred);
 
@@ -247,15 +278,23 @@ namespace Transport
         const std::string& GetSubscriptionInfo() const;
         void SetSubscriptionInfo(const std::string& value);
 
-        // Gets or sets signal index cache for subscriber representing run-time mappings for subscribed points
-        const SignalIndexCachePtr& GetSignalIndexCache() const;
+        // Gets or sets signal index cache for subscriber representing run-time mappings for subscribed points,
+        // cache is replaced atomically so it is safe to get from any thread
+        SignalIndexCachePtr GetSignalIndexCache() const;
         void SetSignalIndexCache(SignalIndexCachePtr signalIndexCache);
 
+        // Re-applies subscription filter expression after publisher metadata changes, only rows for the changed signal IDs
+        // are evaluated when possible, runtime IDs of signals that remain subscribed are kept so compression state survives
+        void UpdateSubscription(const GSF::Data::DataSetPtr& filteringMetadata, const GSF::Data::DataSetPtr& changedMetadata, const std::unordered_set<GSF::Guid>& changedSignalIDs);
+
         // Statistical functions
         uint64_t GetTotalCommandChannelBytesSent() const;
         uint64_t GetTotalDataChannelBytesSent() const;
         uint64_t GetTotalMeasurementsSent() const;
 
+        // Gets a snapshot of publication statistics for this connection
+        PublicationStatistics GetStatistics() const;
+
         bool CipherKeysDefined() const;
         std::vector<uint8_t> Keys(int32_t cipherIndex);
         std::vector<uint8_t> IVs(int32_t cipherIndex);
@@ -0,0 +1,97 @@
+//******************************************************************************************************
+//  SubscriberExecutor.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "SubscriberExecutor.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+SubscriberExecutor::SubscriberExecutor(uint32_t ioThreadCount, uint32_t callbackThreadCount) :
+    m_callbackWorkGuard(boost::asio::make_work_guard(m_callbackContext)),
+    m_nextIOContext(0)
+{
+    const uint32_t processorCount = std::max(Thread::hardware_concurrency(), 1U);
+
+    if (ioThreadCount == 0)
+        ioThreadCount = processorCount;
+
+    if (callbackThreadCount == 0)
+        callbackThreadCount = processorCount;
+
+    // Each I/O context is run by a single thread so that all socket
+    // handlers for a given subscriber execute sequentially
+    for (uint32_t i = 0; i < ioThreadCount; i++)
+    {
+        SharedPtr<IOContext> ioContext = NewSharedPtr<IOContext>(1);
+        m_workGuards.push_back(boost::asio::make_work_guard(*ioContext));
+        m_ioContexts.push_back(ioContext);
+        m_threads.push_back(NewSharedPtr<Thread>([ioContext] { ioContext->run(); }));
+    }
+
+    for (uint32_t i = 0; i < callbackThreadCount; i++)
+        m_threads.push_back(NewSharedPtr<Thread>([this] { m_callbackContext.run(); }));
+}
+
+SubscriberExecutor::~SubscriberExecutor()
+{
+    Stop();
+}
+
+IOContext& SubscriberExecutor::GetIOContext()
+{
+    ScopeLock lock(m_nextIOContextLock);
+    IOContext& ioContext = *m_ioContexts[m_nextIOContext];
+    m_nextIOContext = (m_nextIOContext + 1) % ConvertUInt32(m_ioContexts.size());
+    return ioContext;
+}
+
+IOContext& SubscriberExecutor::GetCallbackContext()
+{
+    return m_callbackContext;
+}
+
+uint32_t SubscriberExecutor::GetIOContextCount() const
+{
+    return ConvertUInt32(m_ioContexts.size());
+}
+
+void SubscriberExecutor::Stop()
+{
+    for (WorkGuard& workGuard : m_workGuards)
+        workGuard.reset();
+
+    m_callbackWorkGuard.reset();
+
+    for (const SharedPtr<IOContext>& ioContext : m_ioContexts)
+        ioContext->stop();
+
+    m_callbackContext.stop();
+
+    for (const SharedPtr<Thread>& thread : m_threads)
+    {
+        if (thread->joinable() && thread->get_id() != boost::this_thread::get_id())
+            thread->join();
+    }
+}
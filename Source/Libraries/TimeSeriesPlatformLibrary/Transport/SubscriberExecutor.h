@@ -0,0 +1,75 @@
+//******************************************************************************************************
+//  SubscriberExecutor.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __SUBSCRIBER_EXECUTOR_H
+#define __SUBSCRIBER_EXECUTOR_H
+
+#include "../Common/CommonTypes.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Externally owned set of threads that can be shared by many DataSubscriber instances so
+    // that each subscriber does not need its own callback, command channel and data channel
+    // threads. Socket operations for each subscriber are assigned, round-robin, to one of a
+    // pool of single-threaded I/O contexts. Callbacks run on a worker pool, serialized per
+    // subscriber with a strand so callback ordering is preserved. The executor must outlive
+    // all subscribers constructed against it.
+    class SubscriberExecutor // NOLINT
+    {
+    private:
+        typedef boost::asio::executor_work_guard<IOContext::executor_type> WorkGuard;
+
+        std::vector<SharedPtr<IOContext>> m_ioContexts;
+        std::vector<WorkGuard> m_workGuards;
+        IOContext m_callbackContext;
+        WorkGuard m_callbackWorkGuard;
+        std::vector<SharedPtr<Thread>> m_threads;
+        uint32_t m_nextIOContext;
+        Mutex m_nextIOContextLock;
+
+    public:
+        // Creates a new executor, thread counts of zero default to hardware concurrency.
+        SubscriberExecutor(uint32_t ioThreadCount = 0, uint32_t callbackThreadCount = 0);
+
+        // Stops all contexts and joins threads.
+        ~SubscriberExecutor();
+
+        // Gets the next I/O context to assign to a subscriber.
+        IOContext& GetIOContext();
+
+        // Gets the context of the callback worker pool.
+        IOContext& GetCallbackContext();
+
+        // Gets the number of I/O contexts.
+        uint32_t GetIOContextCount() const;
+
+        // Stops all contexts and waits for threads to exit.
+        void Stop();
+    };
+
+    typedef SharedPtr<SubscriberExecutor> SubscriberExecutorPtr;
+}}}
+
+#endif
@@ -34,21 +34,212 @@ using namespace GSF;
 using namespace GSF::TimeSeries;
 using namespace GSF::TimeSeries::Transport;
 
+namespace
+{
+    // Minimum number of measurement records handled by each metadata conversion thread
+    constexpr size_t MinimumRecordsPerThread = 8192;
+
+    // Metadata record fields, listed in the order serialized by the publisher
+    enum DeviceField { DeviceUniqueID, DeviceAcronym, DeviceName, DeviceAccessID, DeviceParentAcronym, DeviceProtocolName, DeviceFramesPerSecond, DeviceCompanyAcronym, DeviceVendorAcronym, DeviceVendorDeviceName, DeviceLongitude, DeviceLatitude, DeviceUpdatedOn, DeviceFieldCount };
+    const char* const DeviceFieldNames[DeviceFieldCount] = { "UniqueID", "Acronym", "Name", "AccessID", "ParentAcronym", "ProtocolName", "FramesPerSecond", "CompanyAcronym", "VendorAcronym", "VendorDeviceName", "Longitude", "Latitude", "UpdatedOn" };
+
+    enum MeasurementField { MeasurementDeviceAcronym, MeasurementID, MeasurementSignalID, MeasurementPointTag, MeasurementSignalReference, MeasurementPhasorSourceIndex, MeasurementDescription, MeasurementUpdatedOn, MeasurementFieldCount };
+    const char* const MeasurementFieldNames[MeasurementFieldCount] = { "DeviceAcronym", "ID", "SignalID", "PointTag", "SignalReference", "PhasorSourceIndex", "Description", "UpdatedOn" };
+
+    enum PhasorField { PhasorDeviceAcronym, PhasorLabel, PhasorType, PhasorPhase, PhasorSourceIndex, PhasorUpdatedOn, PhasorFieldCount };
+    const char* const PhasorFieldNames[PhasorFieldCount] = { "DeviceAcronym", "Label", "Type", "Phase", "SourceIndex", "UpdatedOn" };
+
+    // Gathers the values of the named child elements of a metadata record in a single pass. Since records list
+    // their fields in a consistent order, the name search for each element starts just after the previous match.
+    template<size_t N>
+    void ReadRecordFields(const xml_node& record, const char* const (&names)[N], const char* (&values)[N])
+    {
+        size_t next = 0;
+
+        for (size_t i = 0; i < N; i++)
+            values[i] = "";
+
+        for (xml_node field = record.first_child(); field; field = field.next_sibling())
+        {
+            const char* name = field.name();
+
+            for (size_t i = 0; i < N; i++)
+            {
+                const size_t index = (next + i) % N;
+
+                if (strcmp(name, names[index]) == 0)
+                {
+                    values[index] = field.child_value();
+                    next = index + 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    int32_t ParseInt32(const char* value, int32_t defaultValue)
+    {
+        char* end;
+        const long result = strtol(value, &end, 10);
+
+        // Empty or malformed values, i.e., no digits were read, use default value
+        return end == value ? defaultValue : static_cast<int32_t>(result);
+    }
+
+    float64_t ParseFloat64(const char* value)
+    {
+        return value[0] == '\0' ? 0.0 : strtod(value, nullptr);
+    }
+
+    DeviceMetadataPtr ParseDeviceDetail(const xml_node& record)
+    {
+        const char* values[DeviceFieldCount];
+        ReadRecordFields(record, DeviceFieldNames, values);
+
+        DeviceMetadataPtr deviceMetadata = NewSharedPtr<DeviceMetadata>();
+
+        deviceMetadata->Acronym = values[DeviceAcronym];
+        deviceMetadata->Name = values[DeviceName];
+        deviceMetadata->UniqueID = ParseGuid(values[DeviceUniqueID]);
+        deviceMetadata->AccessID = ParseInt32(values[DeviceAccessID], 0);
+        deviceMetadata->ParentAcronym = values[DeviceParentAcronym];
+        deviceMetadata->ProtocolName = values[DeviceProtocolName];
+        deviceMetadata->FramesPerSecond = ParseInt32(values[DeviceFramesPerSecond], 30);
+        deviceMetadata->CompanyAcronym = values[DeviceCompanyAcronym];
+        deviceMetadata->VendorAcronym = values[DeviceVendorAcronym];
+        deviceMetadata->VendorDeviceName = values[DeviceVendorDeviceName];
+        deviceMetadata->Longitude = ParseFloat64(values[DeviceLongitude]);
+        deviceMetadata->Latitude = ParseFloat64(values[DeviceLatitude]);
+        deviceMetadata->UpdatedOn = ParseTimestamp(values[DeviceUpdatedOn]);
+
+        return deviceMetadata;
+    }
+
+    MeasurementMetadataPtr ParseMeasurementDetail(const xml_node& record)
+    {
+        const char* values[MeasurementFieldCount];
+        ReadRecordFields(record, MeasurementFieldNames, values);
+
+        MeasurementMetadataPtr measurementMetadata = NewSharedPtr<MeasurementMetadata>();
+
+        measurementMetadata->DeviceAcronym = values[MeasurementDeviceAcronym];
+        measurementMetadata->ID = values[MeasurementID];
+        measurementMetadata->SignalID = ParseGuid(values[MeasurementSignalID]);
+        measurementMetadata->PointTag = values[MeasurementPointTag];
+        measurementMetadata->Reference = SignalReference(string(values[MeasurementSignalReference]));
+        measurementMetadata->PhasorSourceIndex = ParseInt32(values[MeasurementPhasorSourceIndex], 0);
+        measurementMetadata->Description = values[MeasurementDescription];
+        measurementMetadata->UpdatedOn = ParseTimestamp(values[MeasurementUpdatedOn]);
+
+        return measurementMetadata;
+    }
+
+    PhasorMetadataPtr ParsePhasorDetail(const xml_node& record)
+    {
+        const char* values[PhasorFieldCount];
+        ReadRecordFields(record, PhasorFieldNames, values);
+
+        PhasorMetadataPtr phasorMetadata = NewSharedPtr<PhasorMetadata>();
+
+        phasorMetadata->DeviceAcronym = values[PhasorDeviceAcronym];
+        phasorMetadata->Label = values[PhasorLabel];
+        phasorMetadata->Type = values[PhasorType];
+        phasorMetadata->Phase = values[PhasorPhase];
+        phasorMetadata->SourceIndex = ParseInt32(values[PhasorSourceIndex], 0);
+        phasorMetadata->UpdatedOn = ParseTimestamp(values[PhasorUpdatedOn]);
+
+        return phasorMetadata;
+    }
+
+    // Converts a range of metadata records into the matching range of results
+    template<class T>
+    void ParseRecords(const vector<xml_node>& records, vector<T>& results, size_t begin, size_t end, T (*parseRecord)(const xml_node&))
+    {
+        for (size_t i = begin; i < end; i++)
+            results[i] = parseRecord(records[i]);
+    }
+
+    // Runs the given tasks across available processors, the first task executing on the calling thread
+    void RunTasks(const vector<function<void()>>& tasks)
+    {
+        if (tasks.size() < 2 || Thread::hardware_concurrency() < 2)
+        {
+            for (auto const& task : tasks)
+                task();
+
+            return;
+        }
+
+        vector<exception_ptr> exceptions(tasks.size());
+        vector<Thread> threads;
+
+        threads.reserve(tasks.size() - 1);
+
+        for (size_t i = 1; i < tasks.size(); i++)
+        {
+            threads.emplace_back([&tasks, &exceptions, i]
+            {
+                try
+                {
+                    tasks[i]();
+                }
+                catch (...)
+                {
+                    exceptions[i] = current_exception();
+                }
+            });
+        }
+
+        try
+        {
+            tasks[0]();
+        }
+        catch (...)
+        {
+            exceptions[0] = current_exception();
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        for (auto const& exception : exceptions)
+        {
+            if (exception)
+                rethrow_exception(exception);
+        }
+    }
+
+    float64_t ElapsedMilliseconds(const datetime_t& startTime, const datetime_t& endTime)
+    {
+        return (endTime - startTime).total_microseconds() / 1000.0;
+    }
+}
+
 SubscriberInstance::SubscriberInstance() :
+    SubscriberInstance(nullptr)
+{
+}
+
+SubscriberInstance::SubscriberInstance(SubscriberExecutorPtr executor) :
     m_hostname("localhost"),
     m_port(6165),
     m_udpPort(0U),
     m_autoReconnect(true),
     m_autoParseMetadata(true),
+    m_assembleDataFrames(false),
     m_maxRetries(-1),
     m_retryInterval(2000),
     m_filterExpression(SubscribeAllNoStatsExpression),
     m_startTime(""),
     m_stopTime(""),
-    m_userData(nullptr)
+    m_userData(nullptr),
+    m_signalMetadataIndex(nullptr),
+    m_metadataFullRefreshInterval(86400U),
+    m_incrementalMetadataRequested(false),
+    m_subscriptionRequested(false)
 {
     // Reference this SubscriberInstance in DataSubsciber user data
-    m_subscriber = NewSharedPtr<DataSubscriber>();
+    m_subscriber = NewSharedPtr<DataSubscriber>(std::move(executor));
     m_subscriber->SetUserData(this);
 }
 
@@ -86,6 +277,16 @@ void SubscriberInstance::SetAutoParseMetadata(bool autoParseMetadata)
     m_autoParseMetadata = autoParseMetadata;
 }
 
+bool SubscriberInstance::GetAssembleDataFrames() const
+{
+    return m_assembleDataFrames;
+}
+
+void SubscriberInstance::SetAssembleDataFrames(bool assembleDataFrames)
+{
+    m_assembleDataFrames = assembleDataFrames;
+}
+
 int16_t SubscriberInstance::GetMaxRetries() const
 {
     return m_maxRetries;
@@ -139,6 +340,26 @@ void SubscriberInstance::SetMetadataFilters(const std::string& metadataFilters)
     m_metadataFilters = metadataFilters;
 }
 
+const std::string& SubscriberInstance::GetMetadataCachePath() const
+{
+    return m_metadataCachePath;
+}
+
+void SubscriberInstance::SetMetadataCachePath(const std::string& metadataCachePath)
+{
+    m_metadataCachePath = metadataCachePath;
+}
+
+uint32_t SubscriberInstance::GetMetadataFullRefreshInterval() const
+{
+    return m_metadataFullRefreshInterval;
+}
+
+void SubscriberInstance::SetMetadataFullRefreshInterval(const uint32_t metadataFullRefreshInterval)
+{
+    m_metadataFullRefreshInterval = metadataFullRefreshInterval;
+}
+
 void SubscriberInstance::ConnectAsync()
 {
     Thread(bind(&SubscriberInstance::Connect, this));
@@ -161,6 +382,9 @@ void SubscriberInstance::Connect()
     m_subscriber->RegisterConfigurationChangedCallback(&HandleConfigurationChanged);
     m_subscriber->RegisterConnectionTerminatedCallback(&HandleConnectionTerminated);
 
+    if (m_assembleDataFrames)
+        m_subscriber->RegisterNewDataFramesCallback(&HandleNewDataFrames);
+
     if (!m_startTime.empty() && !m_stopTime.empty())
     {
         m_subscriber->RegisterProcessingCompleteCallback(&HandleProcessingComplete);
@@ -183,7 +407,7 @@ void SubscriberInstance::Connect()
         // after metadata is handled the SubscriberInstance will then initiate subscribe;
         // otherwise, initiate subscribe immediately
         if (m_autoParseMetadata)
-            SendMetadataRefreshCommand();
+            RequestMetadata();
         else
             m_subscriber->Subscribe();
     }
@@ -227,6 +451,16 @@ void SubscriberInstance::SetPayloadDataCompressed(bool compressed) const
     m_subscriber->SetPayloadDataCompressed(compressed);
 }
 
+uint32_t SubscriberInstance::GetPayloadCompressionMode() const
+{
+    return m_subscriber->GetPayloadCompressionMode();
+}
+
+void SubscriberInstance::SetPayloadCompressionMode(uint32_t compressionMode) const
+{
+    m_subscriber->SetPayloadCompressionMode(compressionMode);
+}
+
 bool SubscriberInstance::IsMetadataCompressed() const
 {
     return m_subscriber->IsMetadataCompressed();
@@ -247,6 +481,21 @@ void SubscriberInstance::SetSignalIndexCacheCompressed(bool compressed) const
     m_subscriber->SetSignalIndexCacheCompressed(compressed);
 }
 
+bool SubscriberInstance::IsTrackingCurrentValues() const
+{
+    return m_subscriber->IsTrackingCurrentValues();
+}
+
+void SubscriberInstance::SetTrackingCurrentValues(bool trackCurrentValues) const
+{
+    m_subscriber->SetTrackingCurrentValues(trackCurrentValues);
+}
+
+CurrentValueTablePtr SubscriberInstance::GetCurrentValueTable() const
+{
+    return m_subscriber->GetCurrentValueTable();
+}
+
 uint64_t SubscriberInstance::GetTotalCommandChannelBytesReceived() const
 {
     return m_subscriber->GetTotalCommandChannelBytesReceived();
@@ -262,6 +511,11 @@ uint64_t SubscriberInstance::GetTotalMeasurementsReceived() const
     return m_subscriber->GetTotalMeasurementsReceived();
 }
 
+SubscriptionStatistics SubscriberInstance::GetStatistics() const
+{
+    return m_subscriber->GetStatistics();
+}
+
 bool SubscriberInstance::IsConnected() const
 {
     return m_subscriber->IsConnected();
@@ -400,6 +654,16 @@ bool SubscriberInstance::TryGetConfigurationFrame(const string& deviceAcronym, C
 
 bool SubscriberInstance::TryFindTargetConfigurationFrame(const Guid& signalID, ConfigurationFramePtr& targetFrame)
 {
+    // Subscribed signals resolve directly from runtime ID index
+    const SignalMetadataIndexPtr signalMetadataIndex = GetSignalMetadataIndex();
+    const SignalMetadataReference* reference;
+
+    if (signalMetadataIndex != nullptr && signalMetadataIndex->TryGetReference(signalID, reference) && reference->Frame != nullptr)
+    {
+        targetFrame = reference->Frame;
+        return true;
+    }
+
     bool found = false;
 
     m_configurationUpdateLock.lock();
@@ -422,6 +686,34 @@ bool SubscriberInstance::TryFindTargetConfigurationFrame(const Guid& signalID, C
     return found;
 }
 
+SignalMetadataIndexPtr SubscriberInstance::GetSignalMetadataIndex() const
+{
+    return boost::atomic_load(&m_signalMetadataIndex);
+}
+
+// Replaces runtime ID index when signal index cache has changed, called from data thread
+void SubscriberInstance::UpdateSignalMetadataIndex()
+{
+    const SignalIndexCachePtr signalIndexCache = m_subscriber->GetSignalIndexCache();
+
+    if (signalIndexCache == nullptr)
+        return;
+
+    const SignalMetadataIndexPtr signalMetadataIndex = GetSignalMetadataIndex();
+
+    if (signalMetadataIndex != nullptr && signalMetadataIndex->GetSignalIndexCache() == signalIndexCache)
+        return;
+
+    ScopeLock lock(m_configurationUpdateLock);
+    BuildSignalMetadataIndex(signalIndexCache);
+}
+
+// Caller must hold configuration update lock
+void SubscriberInstance::BuildSignalMetadataIndex(const SignalIndexCachePtr& signalIndexCache)
+{
+    boost::atomic_store(&m_signalMetadataIndex, NewSharedPtr<SignalMetadataIndex>(signalIndexCache, m_measurements, m_configurationFrames));
+}
+
 bool SubscriberInstance::TryGetMeasurementMetdataFromConfigurationFrame(const Guid& signalID, const ConfigurationFramePtr& sourceFrame, MeasurementMetadataPtr& measurementMetadata)
 {
     if (sourceFrame == nullptr)
@@ -577,16 +869,26 @@ void SubscriberInstance::ReceivedMetadata(const vector<uint8_t>& payload)
         return;
     }
 
+    const datetime_t startTime = UtcNow();
     vector<uint8_t> uncompressedBuffer;
 
     // Step 1: Decompress meta-data if needed
     if (IsMetadataCompressed())
     {
+        // GZip trailer holds uncompressed size (modulo 2^32), use it to pre-size buffer when reasonable
+        if (payload.size() > 18)
+        {
+            const uint32_t uncompressedSize = EndianConverter::ToLittleEndian<uint32_t>(payload.data(), ConvertUInt32(payload.size() - 4));
+
+            if (uncompressedSize / 1024 < payload.size())
+                uncompressedBuffer.reserve(uncompressedSize);
+        }
+
         // Perform zlib decompression on buffer
         const MemoryStream memoryStream(payload);
         StreamBuffer streamBuffer;
 
-        streamBuffer.push(GZipDecompressor());
+        streamBuffer.push(GZipDecompressor(boost::iostreams::gzip::default_window_bits, 65536), 65536);
         streamBuffer.push(memoryStream);
 
         CopyStream(&streamBuffer, uncompressedBuffer);
@@ -594,11 +896,12 @@ void SubscriberInstance::ReceivedMetadata(const vector<uint8_t>& payload)
     else
     {
         // Copy payload to a local non-constant buffer, pugi load_buffer_inplace can modify buffer
-        for (size_t i = 0; i < payload.size(); i++)
-            uncompressedBuffer.push_back(payload[i]);
+        uncompressedBuffer.assign(payload.begin(), payload.end());
     }
 
-    // Step 2: Load string into an XML parser
+    const datetime_t decompressTime = UtcNow();
+
+    // Step 2: Parse XML in-place, strings in document reference decompressed buffer
     xml_document document;
 
     const xml_parse_result result = document.load_buffer_inplace(static_cast<void*>(uncompressedBuffer.data()), uncompressedBuffer.size());
@@ -611,76 +914,179 @@ void SubscriberInstance::ReceivedMetadata(const vector<uint8_t>& payload)
         return;
     }
 
-    // Find root node
-    xml_node rootNode = document.document_element();
-
-    // Query DeviceDetail records from metadata
-    StringMap<DeviceMetadataPtr> devices;
+    // Find root node and collect DeviceDetail, MeasurementDetail and PhasorDetail records
+    const xml_node rootNode = document.document_element();
+    vector<xml_node> deviceRecords, measurementRecords, phasorRecords;
+    MetadataRecords records;
 
-    for (xml_node device = rootNode.child("DeviceDetail"); device; device = device.next_sibling("DeviceDetail"))
+    for (xml_node record = rootNode.first_child(); record; record = record.next_sibling())
     {
-        DeviceMetadataPtr deviceMetadata = NewSharedPtr<DeviceMetadata>();
+        const char* name = record.name();
+
+        if (strcmp(name, "MeasurementDetail") == 0)
+            measurementRecords.push_back(record);
+        else if (strcmp(name, "PhasorDetail") == 0)
+            phasorRecords.push_back(record);
+        else if (strcmp(name, "DeviceDetail") == 0)
+            deviceRecords.push_back(record);
+        else if (strcmp(name, "SchemaVersion") == 0)
+            records.SchemaVersion = ParseInt32(record.child_value("VersionNumber"), -1);
+        else if (EndsWith(name, "schema", false))
+        {
+            // Schema defines every publisher table, including those where a filter matched no rows,
+            // as elements of the dataset's choice node
+            const xml_node choiceNode = record.find_node([](const xml_node& node) { return EndsWith(node.name(), "choice", false); });
 
-        deviceMetadata->Acronym = device.child_value("Acronym");
-        deviceMetadata->Name = device.child_value("Name");
-        deviceMetadata->UniqueID = ParseGuid(device.child_value("UniqueID"));
-        deviceMetadata->AccessID = stoi(Coalesce(device.child_value("AccessID"), "0"));
-        deviceMetadata->ParentAcronym = device.child_value("ParentAcronym");
-        deviceMetadata->ProtocolName = device.child_value("ProtocolName");
-        deviceMetadata->FramesPerSecond = stoi(Coalesce(device.child_value("FramesPerSecond"), "30"));
-        deviceMetadata->CompanyAcronym = device.child_value("CompanyAcronym");
-        deviceMetadata->VendorAcronym = device.child_value("vendorAcronym");
-        deviceMetadata->VendorDeviceName = device.child_value("VendorDeviceName");
-        deviceMetadata->Longitude = stod(Coalesce(device.child_value("Longitude"), "0.0"));
-        deviceMetadata->Latitude = stod(Coalesce(device.child_value("Latitude"), "0.0"));
-        deviceMetadata->UpdatedOn = ParseTimestamp(device.child_value("UpdatedOn"));
+            for (xml_node table = choiceNode.first_child(); table; table = table.next_sibling())
+                records.TableNames.emplace_back(table.attribute("name").value());
+        }
+    }
 
-        devices.insert_or_assign(deviceMetadata->Acronym, deviceMetadata);
+    const datetime_t parseTime = UtcNow();
+
+    // Step 3: Convert records of the three tables into metadata in parallel, measurement records split across processors
+    vector<DeviceMetadataPtr>& deviceList = records.Devices;
+    vector<MeasurementMetadataPtr>& measurementList = records.Measurements;
+    vector<PhasorMetadataPtr>& phasorList = records.Phasors;
+    vector<function<void()>> tasks;
+
+    deviceList.resize(deviceRecords.size());
+    measurementList.resize(measurementRecords.size());
+    phasorList.resize(phasorRecords.size());
+
+    tasks.emplace_back([&] { ParseRecords(deviceRecords, deviceList, 0, deviceList.size(), &ParseDeviceDetail); });
+    tasks.emplace_back([&] { ParseRecords(phasorRecords, phasorList, 0, phasorList.size(), &ParsePhasorDetail); });
+
+    const size_t measurementThreads = max<size_t>(1, min<size_t>(Thread::hardware_concurrency(), measurementList.size() / MinimumRecordsPerThread));
+    const size_t measurementsPerThread = measurementList.size() / measurementThreads + 1;
+
+    for (size_t begin = 0; begin < measurementList.size(); begin += measurementsPerThread)
+    {
+        const size_t end = min(begin + measurementsPerThread, measurementList.size());
+        tasks.emplace_back([&, begin, end] { ParseRecords(measurementRecords, measurementList, begin, end, &ParseMeasurementDetail); });
     }
 
-    // Query MeasurementDetail records from metadata
-    unordered_map<Guid, MeasurementMetadataPtr> measurements;
+    RunTasks(tasks);
+
+    for (auto const& deviceMetadata : deviceList)
+        records.UpdatedOn = max(records.UpdatedOn, deviceMetadata->UpdatedOn);
+
+    for (auto const& measurementMetadata : measurementList)
+        records.UpdatedOn = max(records.UpdatedOn, measurementMetadata->UpdatedOn);
+
+    for (auto const& phasorMetadata : phasorList)
+        records.UpdatedOn = max(records.UpdatedOn, phasorMetadata->UpdatedOn);
 
-    for (xml_node device = rootNode.child("MeasurementDetail"); device; device = device.next_sibling("MeasurementDetail"))
+    const datetime_t convertTime = UtcNow();
+
+    // Step 4: Merge records from an incremental refresh into current meta-data
+    const bool incremental = m_incrementalMetadataRequested;
+    m_incrementalMetadataRequested = false;
+
+    if (incremental)
     {
-        MeasurementMetadataPtr measurementMetadata = NewSharedPtr<MeasurementMetadata>();
+        if (records.SchemaVersion != m_metadataRecords.SchemaVersion)
+        {
+            StatusMessage("Publisher meta data schema version changed, requesting full meta data refresh...");
+            m_metadataRecords = MetadataRecords();
+            SendMetadataRefreshCommand();
+            return;
+        }
 
-        measurementMetadata->DeviceAcronym = device.child_value("DeviceAcronym");
-        measurementMetadata->ID = device.child_value("ID");
-        measurementMetadata->SignalID = ParseGuid(device.child_value("SignalID"));
-        measurementMetadata->PointTag = device.child_value("PointTag");
-        measurementMetadata->Reference = SignalReference(string(device.child_value("SignalReference")));
-        measurementMetadata->PhasorSourceIndex = stoi(Coalesce(device.child_value("PhasorSourceIndex"), "0"));
-        measurementMetadata->Description = device.child_value("Description");
-        measurementMetadata->UpdatedOn = ParseTimestamp(device.child_value("UpdatedOn"));
+        MetadataRecords mergedRecords = m_metadataRecords;
+        const uint32_t changes = mergedRecords.Merge(records);
 
-        measurements.insert_or_assign(measurementMetadata->SignalID, measurementMetadata);
+        if (changes == 0)
+        {
+            StatusMessage("Cached meta data is current, no publisher records were updated.");
+            return;
+        }
 
-        // Lookup associated device
-        auto iterator = devices.find(measurementMetadata->DeviceAcronym);
+        // Current device records are associated with their measurements and phasors, so copies are associated
+        for (auto& deviceMetadata : mergedRecords.Devices)
+        {
+            deviceMetadata = NewSharedPtr<DeviceMetadata>(*deviceMetadata);
+            deviceMetadata->Measurements.clear();
+            deviceMetadata->Phasors.clear();
+        }
 
-        if (iterator != devices.end())
+        StatusMessage("Merged " + ToString(changes) + " meta data records updated since cached meta data...");
+        records = std::move(mergedRecords);
+    }
+    else
+    {
+        // Full refresh replaces all records, so records deleted at the publisher are now removed
+        records.FullRefreshedOn = startTime;
+    }
+
+    // Step 5: Associate measurements and phasors with their devices
+    ApplyMetadata(records);
+
+    const datetime_t endTime = UtcNow();
+
+    stringstream message;
+    message << fixed << setprecision(1);
+    message << "Meta data processed in " << ElapsedMilliseconds(startTime, endTime) << "ms: ";
+    message << "decompress " << ElapsedMilliseconds(startTime, decompressTime) << "ms, ";
+    message << "XML parse " << ElapsedMilliseconds(decompressTime, parseTime) << "ms, ";
+    message << "record conversion " << ElapsedMilliseconds(parseTime, convertTime) << "ms, ";
+    message << "association and configuration frames " << ElapsedMilliseconds(convertTime, endTime) << "ms";
+    StatusMessage(message.str());
+
+    // Persist updated meta-data for next session
+    if (!m_metadataCachePath.empty())
+    {
+        try
+        {
+            MetadataCache::Save(m_metadataCachePath, m_metadataRecords);
+        }
+        catch (const SubscriberException& ex)
         {
-            // Add measurement to device's measurement list
-            DeviceMetadataPtr& deviceMetaData = iterator->second;
-            deviceMetaData->Measurements.push_back(measurementMetadata);
+            ErrorMessage(ex.what());
         }
     }
 
-    // Query PhasorDetail records from metadata
-    uint16_t phasorCount = 0;
+    // Notify derived class that meta-data has been parsed and is now available
+    ParsedMetadata();
+}
+
+// Replaces current meta-data with the given records, associating measurements
+// and phasors with their devices and constructing configuration frames
+void SubscriberInstance::ApplyMetadata(const MetadataRecords& records)
+{
+    StringMap<DeviceMetadataPtr> devices;
+
+    for (auto const& deviceMetadata : records.Devices)
+        devices.insert_or_assign(deviceMetadata->Acronym, deviceMetadata);
 
-    for (xml_node device = rootNode.child("PhasorDetail"); device; device = device.next_sibling("PhasorDetail"))
+    unordered_map<Guid, MeasurementMetadataPtr> measurements;
+    measurements.reserve(records.Measurements.size());
+
+    // Measurement records are normally grouped by device, so repeat device lookups are skipped
+    const string* lastDeviceAcronym = nullptr;
+    DeviceMetadata* lastDevice = nullptr;
+
+    for (auto const& measurementMetadata : records.Measurements)
     {
-        PhasorMetadataPtr phasorMetadata = NewSharedPtr<PhasorMetadata>();
+        measurements.insert_or_assign(measurementMetadata->SignalID, measurementMetadata);
 
-        phasorMetadata->DeviceAcronym = device.child_value("DeviceAcronym");
-        phasorMetadata->Label = device.child_value("Label");
-        phasorMetadata->Type = device.child_value("Type");
-        phasorMetadata->Phase = device.child_value("Phase");
-        phasorMetadata->SourceIndex = stoi(Coalesce(device.child_value("SourceIndex"), "0"));
-        phasorMetadata->UpdatedOn = ParseTimestamp(device.child_value("UpdatedOn"));
+        // Lookup associated device
+        if (lastDeviceAcronym == nullptr || *lastDeviceAcronym != measurementMetadata->DeviceAcronym)
+        {
+            auto iterator = devices.find(measurementMetadata->DeviceAcronym);
+            lastDeviceAcronym = &measurementMetadata->DeviceAcronym;
+            lastDevice = iterator == devices.end() ? nullptr : iterator->second.get();
+        }
 
+        // Add measurement to device's measurement list
+        if (lastDevice != nullptr)
+            lastDevice->Measurements.push_back(measurementMetadata);
+    }
+
+    uint32_t phasorCount = 0;
+
+    for (auto const& phasorMetadata : records.Phasors)
+    {
         // Create a new phasor reference
         PhasorReferencePtr phasorReference = NewSharedPtr<PhasorReference>();
         phasorReference->Phasor = phasorMetadata;
@@ -742,25 +1148,125 @@ void SubscriberInstance::ReceivedMetadata(const vector<uint8_t>& payload)
     StringMap<ConfigurationFramePtr> configurationFrames;
     ConstructConfigurationFrames(devices, measurements, configurationFrames);
 
+    vector<ConfigurationFramePtr> frames;
+
+    if (m_assembleDataFrames)
+    {
+        frames.reserve(configurationFrames.size());
+
+        for (auto const& configurationFrame : configurationFrames)
+            frames.push_back(configurationFrame.second);
+    }
+
+    stringstream message;
+    message << "Loaded " << devices.size() << " devices, " << measurements.size() << " measurements and " << phasorCount << " phasors from GEP meta data...";
+
     m_configurationUpdateLock.lock();
 
-    m_configurationFrames = configurationFrames;    // Replace the configuration frames list
-    m_devices = devices;                            // Replace the device metadata list
-    m_measurements = measurements;                  // Replace the measurement metadata list
+    m_configurationFrames.swap(configurationFrames);    // Replace the configuration frames list
+    m_devices.swap(devices);                            // Replace the device metadata list
+    m_measurements.swap(measurements);                  // Replace the measurement metadata list
+
+    // Rebuild runtime ID index for new metadata, when no signal index cache has been
+    // received yet, index will be built when first measurements are received
+    const SignalIndexCachePtr signalIndexCache = m_subscriber->GetSignalIndexCache();
+
+    if (signalIndexCache != nullptr)
+        BuildSignalMetadataIndex(signalIndexCache);
 
     m_configurationUpdateLock.unlock();
 
+    m_metadataRecords = records;
+
+    if (m_assembleDataFrames)
+        m_subscriber->SetConfigurationFrames(frames);
+
+    StatusMessage(message.str());
+}
+
+// Restores cached meta-data, returns true if cache was loaded
+bool SubscriberInstance::LoadMetadataCache()
+{
+    const datetime_t startTime = UtcNow();
+    MetadataRecords records;
+
+    try
+    {
+        if (!MetadataCache::TryLoad(m_metadataCachePath, records))
+            return false;
+    }
+    catch (const SubscriberException& ex)
+    {
+        ErrorMessage("Failed to load meta data cache, full meta data refresh will be requested: " + string(ex.what()));
+        return false;
+    }
+
+    ApplyMetadata(records);
+
     stringstream message;
-    message << "Loaded " << devices.size() << " devices, " << measurements.size() << " measurements and " << phasorCount << " phasors from GEP meta data...";
+    message << fixed << setprecision(1);
+    message << "Restored cached meta data from \"" << m_metadataCachePath << "\" in " << ElapsedMilliseconds(startTime, UtcNow()) << "ms";
     StatusMessage(message.str());
 
     // Notify derived class that meta-data has been parsed and is now available
     ParsedMetadata();
+
+    return true;
+}
+
+// Requests meta-data after connection, subscription follows meta-data handling unless meta-data was
+// already available, in which case subscription starts immediately and meta-data is refreshed in turn.
+// Subscription is requested once per connection, any follow-up refresh only updates meta-data
+void SubscriberInstance::RequestMetadata()
+{
+    if (!m_metadataCachePath.empty() && m_metadataRecords.Measurements.empty())
+        LoadMetadataCache();
+
+    SendMetadataRefreshCommand();
+
+    m_subscriptionRequested = m_incrementalMetadataRequested;
+
+    if (m_subscriptionRequested)
+        m_subscriber->Subscribe();
 }
 
 void SubscriberInstance::SendMetadataRefreshCommand()
 {
-    if (m_metadataFilters.empty())
+    string metadataFilters = m_metadataFilters;
+
+    // When current meta-data is cached, only request records updated since its latest update
+    m_incrementalMetadataRequested = !m_metadataCachePath.empty() && m_metadataFilters.empty() && !m_metadataRecords.Measurements.empty();
+
+    // Incremental refresh only receives updated records, so periodically request all records to remove deleted ones
+    if (m_incrementalMetadataRequested && ElapsedMilliseconds(m_metadataRecords.FullRefreshedOn, UtcNow()) >= m_metadataFullRefreshInterval * 1000.0)
+    {
+        StatusMessage("Cached meta data exceeded full refresh interval, requesting full meta data refresh...");
+        m_incrementalMetadataRequested = false;
+    }
+
+    if (m_incrementalMetadataRequested)
+    {
+        const string updatedOn = ToString(m_metadataRecords.UpdatedOn, "%Y-%m-%d %H:%M:%S%F");
+
+        for (auto const& tableName : { "DeviceDetail", "MeasurementDetail", "PhasorDetail" })
+        {
+            if (!metadataFilters.empty())
+                metadataFilters.append("; ");
+
+            metadataFilters.append("FILTER ").append(tableName).append(" WHERE UpdatedOn >= '").append(updatedOn).append("'");
+        }
+
+        // Other tables are not merged, so only request their schema to avoid sending them in full
+        for (auto const& tableName : m_metadataRecords.TableNames)
+        {
+            if (IsEqual(tableName, "DeviceDetail") || IsEqual(tableName, "MeasurementDetail") || IsEqual(tableName, "PhasorDetail") || IsEqual(tableName, "SchemaVersion"))
+                continue;
+
+            metadataFilters.append("; FILTER ").append(tableName).append(" WHERE 1 = 0");
+        }
+    }
+
+    if (metadataFilters.empty())
     {
         m_subscriber->SendServerCommand(ServerCommand::MetadataRefresh);
         return;
@@ -769,8 +1275,8 @@ void SubscriberInstance::SendMetadataRefreshCommand()
     // Send meta-data filters when some are specified
     vector<uint8_t> buffer;
     
-    const uint8_t* metadataFiltersPtr = reinterpret_cast<uint8_t*>(&m_metadataFilters[0]);
-    const uint32_t metadataFiltersSize = ConvertUInt32(m_metadataFilters.size() * sizeof(char));
+    const uint8_t* metadataFiltersPtr = reinterpret_cast<uint8_t*>(&metadataFilters[0]);
+    const uint32_t metadataFiltersSize = ConvertUInt32(metadataFilters.size() * sizeof(char));
     const uint32_t bufferSize = 4 + metadataFiltersSize;
 
     buffer.reserve(bufferSize);
@@ -995,6 +1501,10 @@ void SubscriberInstance::ReceivedNewMeasurements(const vector<MeasurementPtr>& m
 {
 }
 
+void SubscriberInstance::ReceivedNewDataFrames(const vector<DataFramePtr>& dataFrames)
+{
+}
+
 void SubscriberInstance::ConfigurationChanged()
 {
 }
@@ -1029,7 +1539,7 @@ void SubscriberInstance::HandleResubscribe(DataSubscriber* source)
         // after metadata is handled the SubscriberInstance will then initiate subscribe;
         // otherwise, initiate subscribe immediately
         if (instance->m_autoParseMetadata)
-            instance->SendMetadataRefreshCommand();
+            instance->RequestMetadata();
         else
             source->Subscribe();
     }
@@ -1071,17 +1581,32 @@ void SubscriberInstance::HandleMetadata(DataSubscriber* source, const vector<uin
     // Call virtual method to handle metadata payload
     instance->ReceivedMetadata(payload);
 
-    // When auto-parsing metadata, start subscription after successful user meta-data handling
-    if (instance->m_autoParseMetadata)
+    // When auto-parsing metadata, start subscription after successful user meta-data handling,
+    // unless subscription was already requested on this connection, e.g., from cached meta-data
+    // before a full refresh that followed a schema change. Meta-data refreshed while subscribed,
+    // e.g., after a publisher configuration change, only updates meta-data since the publisher
+    // updates active subscriptions itself, resubscribing would reset compression state
+    if (instance->m_autoParseMetadata && !instance->m_subscriptionRequested && !source->IsSubscribed())
+    {
+        instance->m_subscriptionRequested = true;
         source->Subscribe();
+    }
 }
 
 void SubscriberInstance::HandleNewMeasurements(DataSubscriber* source, const vector<MeasurementPtr>& measurements)
 {
     SubscriberInstance* instance = static_cast<SubscriberInstance*>(source->GetUserData());
+    instance->UpdateSignalMetadataIndex();
     instance->ReceivedNewMeasurements(measurements);
 }
 
+void SubscriberInstance::HandleNewDataFrames(DataSubscriber* source, const vector<DataFramePtr>& dataFrames)
+{
+    SubscriberInstance* instance = static_cast<SubscriberInstance*>(source->GetUserData());
+    instance->UpdateSignalMetadataIndex();
+    instance->ReceivedNewDataFrames(dataFrames);
+}
+
 void SubscriberInstance::HandleConfigurationChanged(DataSubscriber* source)
 {
     SubscriberInstance* instance = static_cast<SubscriberInstance*>(source->GetUserData());
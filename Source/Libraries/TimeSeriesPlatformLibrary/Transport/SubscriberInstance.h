@@ -25,6 +25,8 @@
 #define __SUBSCRIBERINSTANCE_H
 
 #include "DataSubscriber.h"
+#include "MetadataCache.h"
+#include "SignalMetadataIndex.h"
 
 namespace GSF {
 namespace TimeSeries {
@@ -41,6 +43,7 @@ namespace Transport
         uint16_t m_udpPort;
         bool m_autoReconnect;
         bool m_autoParseMetadata;
+        bool m_assembleDataFrames;
         int16_t m_maxRetries;
         int16_t m_retryInterval;
         std::string m_filterExpression;
@@ -55,7 +58,22 @@ namespace Transport
         Mutex m_configurationUpdateLock;
         void* m_userData;
 
+        // Runtime ID to metadata index, replaced when metadata or signal index cache changes
+        SignalMetadataIndexPtr m_signalMetadataIndex;
+
+        // Flat records of current metadata, basis for incremental refresh and local cache
+        MetadataRecords m_metadataRecords;
+        std::string m_metadataCachePath;
+        uint32_t m_metadataFullRefreshInterval;
+        bool m_incrementalMetadataRequested;
+        bool m_subscriptionRequested;
+
+        void RequestMetadata();
         void SendMetadataRefreshCommand();
+        bool LoadMetadataCache();
+        void ApplyMetadata(const MetadataRecords& records);
+        void UpdateSignalMetadataIndex();
+        void BuildSignalMetadataIndex(const SignalIndexCachePtr& signalIndexCache);
 
         static void ConstructConfigurationFrames(const GSF::StringMap<DeviceMetadataPtr>& devices, const std::unordered_map<Guid, MeasurementMetadataPtr>& measurements, GSF::StringMap<ConfigurationFramePtr>& configurationFrames);
         static bool TryFindMeasurement(const std::vector<MeasurementMetadataPtr>& measurements, SignalKind kind, uint16_t index, MeasurementMetadataPtr& measurementMetadata);
@@ -69,6 +87,7 @@ namespace Transport
         static void HandleDataStartTime(DataSubscriber* source, int64_t startTime);
         static void HandleMetadata(DataSubscriber* source, const std::vector<uint8_t>& payload);
         static void HandleNewMeasurements(DataSubscriber* source, const std::vector<MeasurementPtr>& measurements);
+        static void HandleNewDataFrames(DataSubscriber* source, const std::vector<DataFramePtr>& dataFrames);
         static void HandleProcessingComplete(DataSubscriber* source, const std::string& message);
         static void HandleConfigurationChanged(DataSubscriber* source);
         static void HandleConnectionTerminated(DataSubscriber* source);
@@ -83,6 +102,7 @@ namespace Transport
         virtual void ReceivedMetadata(const std::vector<uint8_t>& payload);
         virtual void ParsedMetadata();
         virtual void ReceivedNewMeasurements(const std::vector<MeasurementPtr>& measurements);
+        virtual void ReceivedNewDataFrames(const std::vector<DataFramePtr>& dataFrames);
         virtual void ConfigurationChanged();
         virtual void HistoricalReadComplete();
         virtual void ConnectionEstablished();
@@ -90,6 +110,9 @@ namespace Transport
 
         SubscriberInstance();
 
+        // Creates an instance whose subscriber runs on the provided shared executor.
+        explicit SubscriberInstance(SubscriberExecutorPtr executor);
+
     public:
         virtual ~SubscriberInstance();
 
@@ -123,6 +146,13 @@ namespace Transport
         bool GetAutoParseMetadata() const;
         void SetAutoParseMetadata(bool autoParseMetadata);
 
+        // Gets or sets flag that determines if received measurements should be assembled
+        // into per-device data frames, based on the parsed configuration frames, and
+        // delivered to ReceivedNewDataFrames. Requires auto-parsed metadata and must be
+        // set before calling Connect.
+        bool GetAssembleDataFrames() const;
+        void SetAssembleDataFrames(bool assembleDataFrames);
+
         // Gets or sets maximum connection retries
         int16_t GetMaxRetries() const;
         void SetMaxRetries(int16_t maxRetries);
@@ -160,6 +190,21 @@ namespace Transport
         const std::string& GetMetadataFilters() const;
         void SetMetadataFilters(const std::string& metadataFilters);
 
+        // Gets or sets the local file used to persist parsed metadata between sessions. When defined,
+        // cached metadata is loaded on first connection and subscription starts immediately, then only
+        // records updated since the cached version are requested and merged. A change in publisher
+        // schema version causes a full refresh. Records deleted at the publisher are not detected by
+        // incremental refresh, these are removed by the periodic full refresh defined below or by
+        // deleting the cache file. Incremental refresh is not used when metadata filters are defined.
+        const std::string& GetMetadataCachePath() const;
+        void SetMetadataCachePath(const std::string& metadataCachePath);
+
+        // Gets or sets maximum number of seconds since the last full metadata refresh before a full
+        // refresh is requested in place of an incremental one, defaults to one day. Zero disables
+        // incremental refresh.
+        uint32_t GetMetadataFullRefreshInterval() const;
+        void SetMetadataFullRefreshInterval(uint32_t metadataFullRefreshInterval);
+
         // Starts the connection cycle to a GEP publisher. Upon connection, meta-data will be requested,
         // when received, a subscription will be established
         void Connect();
@@ -182,10 +227,16 @@ namespace Transport
         void SetUserData(void* userData);
 
         // Gets or sets value that determines whether
-        // payload data is compressed using TSSC.
+        // payload data is compressed using TSSC or XOR64,
+        // or with independently compressed packets over UDP.
         bool IsPayloadDataCompressed() const;
         void SetPayloadDataCompressed(bool compressed) const;
 
+        // Gets or sets the payload compression mode, CompressionModes::TSSC (default)
+        // or CompressionModes::XOR64 for full-precision 64-bit values.
+        uint32_t GetPayloadCompressionMode() const;
+        void SetPayloadCompressionMode(uint32_t compressionMode) const;
+
         // Gets or sets value that determines whether the
         // metadata transfer is compressed using GZip.
         bool IsMetadataCompressed() const;
@@ -196,10 +247,20 @@ namespace Transport
         bool IsSignalIndexCacheCompressed() const;
         void SetSignalIndexCacheCompressed(bool compressed) const;
 
+        // Gets or sets value that determines whether the latest value of
+        // each subscribed signal is maintained in a current value table.
+        bool IsTrackingCurrentValues() const;
+        void SetTrackingCurrentValues(bool trackCurrentValues) const;
+
+        // Gets the current value table for polling latest values from any thread,
+        // returns nullptr if tracking is disabled or not yet subscribed.
+        CurrentValueTablePtr GetCurrentValueTable() const;
+
         // Statistical functions
         uint64_t GetTotalCommandChannelBytesReceived() const;
         uint64_t GetTotalDataChannelBytesReceived() const;
         uint64_t GetTotalMeasurementsReceived() const;
+        SubscriptionStatistics GetStatistics() const;
         bool IsConnected() const;
         bool IsSubscribed() const;
 
@@ -227,6 +288,19 @@ namespace Transport
         bool TryGetConfigurationFrame(const std::string& deviceAcronym, ConfigurationFramePtr& configurationFrame);
         bool TryFindTargetConfigurationFrame(const Guid& signalID, ConfigurationFramePtr& targetFrame);
 
+        // Gets the index of resolved metadata references for the runtime IDs of received measurements,
+        // safe to call from any thread. Returns nullptr until both metadata and a signal index cache
+        // have been received. Per-value access is a single array load, e.g.:
+        //
+        //   const SignalMetadataIndexPtr index = GetSignalMetadataIndex();
+        //   const SignalMetadataReference* reference;
+        //
+        //   if (index && index->TryGetReference(*measurement, reference))
+        //       HandleValue(reference->Frame, reference->Kind, reference->PhasorIndex, measurement->Value);
+        //
+        // Hold the returned pointer while using references, a new index is created on configuration change.
+        SignalMetadataIndexPtr GetSignalMetadataIndex() const;
+
         // Configuration frame limits the required search range for measurement metadata,
         // searching the frame members for a matching signal ID should normally be much
         // faster than executing a lookup in the full measurement map cache.
@@ -42,17 +42,18 @@ TSSCDecoder::TSSCDecoder() :
     m_prevTimeDelta2(Int64::MaxValue),
     m_prevTimeDelta3(Int64::MaxValue),
     m_prevTimeDelta4(Int64::MaxValue),    
+    m_lastPoint(&m_initialPoint),
     m_bitStreamCount(0),
     m_bitStreamCache(0)
 {
-    m_lastPoint = NewTSSCPointMetadata();
 }
 
 void TSSCDecoder::Reset()
 {
     m_data = nullptr;
     m_points.clear();
-    m_lastPoint = NewTSSCPointMetadata();
+    m_initialPoint = TSSCPointMetadata();
+    m_lastPoint = &m_initialPoint;
     m_position = 0;
     m_lastPosition = 0;
     ClearBitStream();
@@ -64,9 +65,22 @@ void TSSCDecoder::Reset()
     m_prevTimestamp2 = 0LL;
 }
 
-TSSCPointMetadataPtr TSSCDecoder::NewTSSCPointMetadata()
+// Adds state for all points up to and including the given ID, each new
+// point starts with its next point ID predicted as the following ID
+void TSSCDecoder::AddPoints(uint16_t id)
 {
-    return NewSharedPtr<TSSCPointMetadata>([&,this]() { return ReadBit(); }, [&,this]() { return ReadBits5(); });
+    // Last point can reference an element of points, so it is restored after resize
+    const bool lastPointInPoints = m_lastPoint != &m_initialPoint;
+    const size_t lastPointIndex = lastPointInPoints ? m_lastPoint - m_points.data() : 0;
+    const size_t count = m_points.size();
+
+    m_points.resize(static_cast<size_t>(id) + 1);
+
+    for (size_t i = count; i < m_points.size(); i++)
+        m_points[i].PrevNextPointId1 = static_cast<uint16_t>(i + 1);
+
+    if (lastPointInPoints)
+        m_lastPoint = &m_points[lastPointIndex];
 }
 
 void TSSCDecoder::SetBuffer(uint8_t* data, uint32_t offset, uint32_t length)
@@ -95,7 +109,7 @@ bool TSSCDecoder::TryGetMeasurement(uint16_t& id, int64_t& timestamp, uint32_t&
     //      measurements generally have some sort of sequence to them, 
     //      this still ends up being a good enough assumption.
 
-    int32_t code = m_lastPoint->ReadCode();
+    int32_t code = m_lastPoint->ReadCode(*this);
 
     if (code == TSSCCodeWords::EndOfStream)
     {
@@ -109,61 +123,23 @@ bool TSSCDecoder::TryGetMeasurement(uint16_t& id, int64_t& timestamp, uint32_t&
 
     if (code <= TSSCCodeWords::PointIDXOR16)
     {
-        DecodePointID(code, m_lastPoint);
-        code = m_lastPoint->ReadCode();
+        DecodePointID(code, *m_lastPoint);
+        code = m_lastPoint->ReadCode(*this);
         
         if (code < TSSCCodeWords::TimeDelta1Forward)
-        {
-            stringstream errorMessageStream;
-
-            errorMessageStream << "Expecting code >= ";
-            errorMessageStream << static_cast<int>(TSSCCodeWords::TimeDelta1Forward);
-            errorMessageStream << " Received ";
-            errorMessageStream << static_cast<int>(code);
-            errorMessageStream << " at position ";
-            errorMessageStream << static_cast<int>(m_position);
-            errorMessageStream << " with last position ";
-            errorMessageStream << static_cast<int>(m_lastPosition);
-
-            throw SubscriberException(errorMessageStream.str());
-        }
+            ThrowUnexpectedCode(code, TSSCCodeWords::TimeDelta1Forward);
     }
 
     id = m_lastPoint->PrevNextPointId1;    
-    TSSCPointMetadataPtr nextPoint = id >= m_points.size() ? nullptr : m_points[id];
-    
-    if (nextPoint == nullptr)
-    {
-        nextPoint = NewTSSCPointMetadata();
-
-        if (id >= m_points.size())
-            m_points.resize(id + 1, nullptr);
-
-        m_points[id] = nextPoint;
-        
-        nextPoint->PrevNextPointId1 = static_cast<uint16_t>(id + 1);
-    }
+    TSSCPointMetadata& nextPoint = GetPoint(id);
 
     if (code <= TSSCCodeWords::TimeXOR7Bit)
     {
         timestamp = DecodeTimestamp(code);
-        code = m_lastPoint->ReadCode();
+        code = m_lastPoint->ReadCode(*this);
 
         if (code < TSSCCodeWords::Quality2)
-        {
-            stringstream errorMessageStream;
-
-            errorMessageStream << "Expecting code >= ";
-            errorMessageStream << static_cast<int>(TSSCCodeWords::Quality2);
-            errorMessageStream << " Received ";
-            errorMessageStream << static_cast<int>(code);
-            errorMessageStream << " at position ";
-            errorMessageStream << static_cast<int>(m_position);
-            errorMessageStream << " with last position ";
-            errorMessageStream << static_cast<int>(m_lastPosition);
-
-            throw SubscriberException(errorMessageStream.str());
-        }
+            ThrowUnexpectedCode(code, TSSCCodeWords::Quality2);
     }
     else
     {
@@ -173,27 +149,14 @@ bool TSSCDecoder::TryGetMeasurement(uint16_t& id, int64_t& timestamp, uint32_t&
     if (code <= TSSCCodeWords::Quality7Bit32)
     {
         quality = DecodeQuality(code, nextPoint);
-        code = m_lastPoint->ReadCode();
+        code = m_lastPoint->ReadCode(*this);
         
         if (code < TSSCCodeWords::Value1)
-        {
-            stringstream errorMessageStream;
-
-            errorMessageStream << "Expecting code >= ";
-            errorMessageStream << static_cast<int>(TSSCCodeWords::Value1);
-            errorMessageStream << " Received ";
-            errorMessageStream << static_cast<int>(code);
-            errorMessageStream << " at position ";
-            errorMessageStream << static_cast<int>(m_position);
-            errorMessageStream << " with last position ";
-            errorMessageStream << static_cast<int>(m_lastPosition);
-
-            throw SubscriberException(errorMessageStream.str());
-        }
+            ThrowUnexpectedCode(code, TSSCCodeWords::Value1);
     }
     else
     {
-        quality = nextPoint->PrevQuality1;
+        quality = nextPoint.PrevQuality1;
     }
 
     //Since value will almost always change, 
@@ -202,106 +165,128 @@ bool TSSCDecoder::TryGetMeasurement(uint16_t& id, int64_t& timestamp, uint32_t&
 
     if (code == TSSCCodeWords::Value1)
     {
-        valueRaw = nextPoint->PrevValue1;
+        valueRaw = nextPoint.PrevValue1;
     }
     else if (code == TSSCCodeWords::Value2)
     {
-        valueRaw = nextPoint->PrevValue2;
-        nextPoint->PrevValue2 = nextPoint->PrevValue1;
-        nextPoint->PrevValue1 = valueRaw;
+        valueRaw = nextPoint.PrevValue2;
+        nextPoint.PrevValue2 = nextPoint.PrevValue1;
+        nextPoint.PrevValue1 = valueRaw;
     }
     else if (code == TSSCCodeWords::Value3)
     {
-        valueRaw = nextPoint->PrevValue3;
-        nextPoint->PrevValue3 = nextPoint->PrevValue2;
-        nextPoint->PrevValue2 = nextPoint->PrevValue1;
-        nextPoint->PrevValue1 = valueRaw;
+        valueRaw = nextPoint.PrevValue3;
+        nextPoint.PrevValue3 = nextPoint.PrevValue2;
+        nextPoint.PrevValue2 = nextPoint.PrevValue1;
+        nextPoint.PrevValue1 = valueRaw;
     }
     else if (code == TSSCCodeWords::ValueZero)
     {
         valueRaw = 0;
-        nextPoint->PrevValue3 = nextPoint->PrevValue2;
-        nextPoint->PrevValue2 = nextPoint->PrevValue1;
-        nextPoint->PrevValue1 = valueRaw;
+        nextPoint.PrevValue3 = nextPoint.PrevValue2;
+        nextPoint.PrevValue2 = nextPoint.PrevValue1;
+        nextPoint.PrevValue1 = valueRaw;
     }
     else
     {
         switch (code)
         {
             case TSSCCodeWords::ValueXOR4:
-                valueRaw = static_cast<uint32_t>(ReadBits4()) ^ nextPoint->PrevValue1;
+                valueRaw = static_cast<uint32_t>(ReadBits4()) ^ nextPoint.PrevValue1;
                 break;
             case TSSCCodeWords::ValueXOR8:
-                valueRaw = static_cast<uint32_t>(m_data[m_position]) ^ nextPoint->PrevValue1;
+                valueRaw = static_cast<uint32_t>(m_data[m_position]) ^ nextPoint.PrevValue1;
                 m_position++;
                 break;
             case TSSCCodeWords::ValueXOR12:
-                valueRaw = static_cast<uint32_t>(ReadBits4()) ^ static_cast<uint32_t>(m_data[m_position] << 4) ^ nextPoint->PrevValue1;
+                valueRaw = static_cast<uint32_t>(ReadBits4()) ^ static_cast<uint32_t>(m_data[m_position] << 4) ^ nextPoint.PrevValue1;
                 m_position++;
                 break;
             case TSSCCodeWords::ValueXOR16:
-                valueRaw = static_cast<uint32_t>(m_data[m_position]) ^ static_cast<uint32_t>(m_data[m_position + 1] << 8) ^ nextPoint->PrevValue1;
+                valueRaw = static_cast<uint32_t>(m_data[m_position]) ^ static_cast<uint32_t>(m_data[m_position + 1] << 8) ^ nextPoint.PrevValue1;
                 m_position += 2;
                 break;
             case TSSCCodeWords::ValueXOR20:
-                valueRaw = static_cast<uint32_t>(ReadBits4()) ^ static_cast<uint32_t>(m_data[m_position] << 4) ^ static_cast<uint32_t>(m_data[m_position + 1] << 12) ^ nextPoint->PrevValue1;
+                valueRaw = static_cast<uint32_t>(ReadBits4()) ^ static_cast<uint32_t>(m_data[m_position] << 4) ^ static_cast<uint32_t>(m_data[m_position + 1] << 12) ^ nextPoint.PrevValue1;
                 m_position += 2;
                 break;
             case TSSCCodeWords::ValueXOR24:
-                valueRaw = static_cast<uint32_t>(m_data[m_position]) ^ static_cast<uint32_t>(m_data[m_position + 1] << 8) ^ static_cast<uint32_t>(m_data[m_position + 2] << 16) ^ nextPoint->PrevValue1;
+                valueRaw = static_cast<uint32_t>(m_data[m_position]) ^ static_cast<uint32_t>(m_data[m_position + 1] << 8) ^ static_cast<uint32_t>(m_data[m_position + 2] << 16) ^ nextPoint.PrevValue1;
                 m_position += 3;
                 break;
             case TSSCCodeWords::ValueXOR28:
-                valueRaw = static_cast<uint32_t>(ReadBits4()) ^ static_cast<uint32_t>(m_data[m_position] << 4) ^ static_cast<uint32_t>(m_data[m_position + 1] << 12) ^ static_cast<uint32_t>(m_data[m_position + 2] << 20) ^ nextPoint->PrevValue1;
+                valueRaw = static_cast<uint32_t>(ReadBits4()) ^ static_cast<uint32_t>(m_data[m_position] << 4) ^ static_cast<uint32_t>(m_data[m_position + 1] << 12) ^ static_cast<uint32_t>(m_data[m_position + 2] << 20) ^ nextPoint.PrevValue1;
                 m_position += 3;
                 break;
             case TSSCCodeWords::ValueXOR32:
-                valueRaw = static_cast<uint32_t>(m_data[m_position]) ^ static_cast<uint32_t>(m_data[m_position + 1] << 8) ^ static_cast<uint32_t>(m_data[m_position + 2] << 16) ^ static_cast<uint32_t>(m_data[m_position + 3] << 24) ^ nextPoint->PrevValue1;
+                valueRaw = static_cast<uint32_t>(m_data[m_position]) ^ static_cast<uint32_t>(m_data[m_position + 1] << 8) ^ static_cast<uint32_t>(m_data[m_position + 2] << 16) ^ static_cast<uint32_t>(m_data[m_position + 3] << 24) ^ nextPoint.PrevValue1;
                 m_position += 4;
                 break;
             default:
-                stringstream errorMessageStream;
-
-                errorMessageStream << "Invalid code received ";
-                errorMessageStream << static_cast<int>(code);
-                errorMessageStream << " at position ";
-                errorMessageStream << static_cast<int>(m_position);
-                errorMessageStream << " with last position ";
-                errorMessageStream << static_cast<int>(m_lastPosition);
-
-                throw SubscriberException(errorMessageStream.str());
+                ThrowInvalidCode(code);
         }
 
-        nextPoint->PrevValue3 = nextPoint->PrevValue2;
-        nextPoint->PrevValue2 = nextPoint->PrevValue1;
-        nextPoint->PrevValue1 = valueRaw;
+        nextPoint.PrevValue3 = nextPoint.PrevValue2;
+        nextPoint.PrevValue2 = nextPoint.PrevValue1;
+        nextPoint.PrevValue1 = valueRaw;
     }
 
     value = *reinterpret_cast<float32_t*>(&valueRaw);
-    m_lastPoint = nextPoint;
+    m_lastPoint = &nextPoint;
 
     return true;
 }
 
-void TSSCDecoder::DecodePointID(uint8_t code, const TSSCPointMetadataPtr& lastPoint)
+// Error handlers are kept out of line so they do not burden the decode loop
+void TSSCDecoder::ThrowUnexpectedCode(int32_t code, int32_t minimumCode) const
+{
+    stringstream errorMessageStream;
+
+    errorMessageStream << "Expecting code >= ";
+    errorMessageStream << minimumCode;
+    errorMessageStream << " Received ";
+    errorMessageStream << code;
+    errorMessageStream << " at position ";
+    errorMessageStream << static_cast<int>(m_position);
+    errorMessageStream << " with last position ";
+    errorMessageStream << static_cast<int>(m_lastPosition);
+
+    throw SubscriberException(errorMessageStream.str());
+}
+
+void TSSCDecoder::ThrowInvalidCode(int32_t code) const
+{
+    stringstream errorMessageStream;
+
+    errorMessageStream << "Invalid code received ";
+    errorMessageStream << code;
+    errorMessageStream << " at position ";
+    errorMessageStream << static_cast<int>(m_position);
+    errorMessageStream << " with last position ";
+    errorMessageStream << static_cast<int>(m_lastPosition);
+
+    throw SubscriberException(errorMessageStream.str());
+}
+
+void TSSCDecoder::DecodePointID(uint8_t code, TSSCPointMetadata& lastPoint)
 {
     if (code == TSSCCodeWords::PointIDXOR4)
     {
-        lastPoint->PrevNextPointId1 ^= static_cast<uint16_t>(ReadBits4());
+        lastPoint.PrevNextPointId1 ^= static_cast<uint16_t>(ReadBits4());
     }
     else if (code == TSSCCodeWords::PointIDXOR8)
     {
-        lastPoint->PrevNextPointId1 ^= static_cast<uint16_t>(m_data[m_position++]);
+        lastPoint.PrevNextPointId1 ^= static_cast<uint16_t>(m_data[m_position++]);
     }
     else if (code == TSSCCodeWords::PointIDXOR12)
     {
-        lastPoint->PrevNextPointId1 ^= static_cast<uint16_t>(ReadBits4());
-        lastPoint->PrevNextPointId1 ^= static_cast<uint16_t>(m_data[m_position++] << 4);
+        lastPoint.PrevNextPointId1 ^= static_cast<uint16_t>(ReadBits4());
+        lastPoint.PrevNextPointId1 ^= static_cast<uint16_t>(m_data[m_position++] << 4);
     }
     else
     {
-        lastPoint->PrevNextPointId1 ^= static_cast<uint16_t>(m_data[m_position++]);
-        lastPoint->PrevNextPointId1 ^= static_cast<uint16_t>(m_data[m_position++] << 8);
+        lastPoint.PrevNextPointId1 ^= static_cast<uint16_t>(m_data[m_position++]);
+        lastPoint.PrevNextPointId1 ^= static_cast<uint16_t>(m_data[m_position++] << 8);
     }
 }
 
@@ -385,21 +370,21 @@ int64_t TSSCDecoder::DecodeTimestamp(uint8_t code)
     return timestamp;
 }
 
-uint32_t TSSCDecoder::DecodeQuality(uint8_t code, const TSSCPointMetadataPtr& nextPoint)
+uint32_t TSSCDecoder::DecodeQuality(uint8_t code, TSSCPointMetadata& nextPoint)
 {
     uint32_t quality;
 
     if (code == TSSCCodeWords::Quality2)
     {
-        quality = nextPoint->PrevQuality2;
+        quality = nextPoint.PrevQuality2;
     }
     else
     {
         quality = Decode7BitUInt32(&m_data[0], m_position);
     }
 
-    nextPoint->PrevQuality2 = nextPoint->PrevQuality1;
-    nextPoint->PrevQuality1 = quality;
+    nextPoint.PrevQuality2 = nextPoint.PrevQuality1;
+    nextPoint.PrevQuality1 = quality;
 
     return quality;
 }
@@ -415,29 +400,6 @@ void TSSCDecoder::ClearBitStream()
     m_bitStreamCache = 0;
 }
 
-int32_t TSSCDecoder::ReadBit()
-{
-    if (m_bitStreamCount == 0)
-    {
-        m_bitStreamCount = 8;
-        m_bitStreamCache = static_cast<int32_t>(m_data[m_position++]);
-    }
-
-    m_bitStreamCount--;
-    
-    return (m_bitStreamCache >> m_bitStreamCount) & 1;
-}
-
-int32_t TSSCDecoder::ReadBits4()
-{
-    return ReadBit() << 3 | ReadBit() << 2 | ReadBit() << 1 | ReadBit();;
-}
-
-int32_t TSSCDecoder::ReadBits5()
-{
-    return ReadBit() << 4 | ReadBit() << 3 | ReadBit() << 2 | ReadBit() << 1 | ReadBit();;
-}
-
 uint32_t Decode7BitUInt32(const uint8_t* stream, uint32_t& position)
 {
     stream += position;    
@@ -24,7 +24,7 @@
 #ifndef __TSSC_DECODER_H
 #define __TSSC_DECODER_H
 
-#include "TransportTypes.h"
+#include "TSSCPointMetadata.h"
 
 namespace GSF {
 namespace TimeSeries {
@@ -46,28 +46,45 @@ namespace Transport
         int64_t m_prevTimeDelta3;
         int64_t m_prevTimeDelta4;
 
-        TSSCPointMetadataPtr m_lastPoint;
-        std::vector<TSSCPointMetadataPtr> m_points;
+        // Point state indexed by point ID, last point references initial point or an element of points
+        TSSCPointMetadata m_initialPoint;
+        TSSCPointMetadata* m_lastPoint;
+        std::vector<TSSCPointMetadata> m_points;
 
         // The number of bits in m_bitStreamCache that are valid. 0 Means the bitstream is empty.
         int32_t m_bitStreamCount;
 
-        // A cache of bits that need to be flushed to m_buffer when full. Bits filled starting from the right moving left.
-        int32_t m_bitStreamCache;
+        // The current bit stream byte, the low m_bitStreamCount bits are yet to be read.
+        uint32_t m_bitStreamCache;
 
-        void DecodePointID(uint8_t code, const TSSCPointMetadataPtr& lastPoint);
+        void DecodePointID(uint8_t code, TSSCPointMetadata& lastPoint);
         int64_t DecodeTimestamp(uint8_t code);
-        uint32_t DecodeQuality(uint8_t code, const TSSCPointMetadataPtr& nextPoint);
+        uint32_t DecodeQuality(uint8_t code, TSSCPointMetadata& nextPoint);
+
+        [[noreturn]] void ThrowUnexpectedCode(int32_t code, int32_t minimumCode) const;
+        [[noreturn]] void ThrowInvalidCode(int32_t code) const;
 
         bool BitStreamIsEmpty() const;
         void ClearBitStream();
 
-        TSSCPointMetadataPtr NewTSSCPointMetadata();
+        TSSCPointMetadata& GetPoint(uint16_t id)
+        {
+            if (id >= m_points.size())
+                AddPoints(id);
+
+            return m_points[id];
+        }
+
+        void AddPoints(uint16_t id);
 
     public:
         // Creates a new instance of the TSSC decoder.
         TSSCDecoder();
 
+        // Decoder references its own point state, so it cannot be copied.
+        TSSCDecoder(const TSSCDecoder&) = delete;
+        TSSCDecoder& operator=(const TSSCDecoder&) = delete;
+
         // Resets the TSSC Decoder to the initial state.
         void Reset();
 
@@ -77,9 +94,50 @@ namespace Transport
         // Reads the next measurement from the stream. If the end of the stream has been encountered, return false.
         bool TryGetMeasurement(uint16_t& id, int64_t& timestamp, uint32_t& quality, float32_t& value);
 
-        int32_t ReadBit();
-        int32_t ReadBits4();
-        int32_t ReadBits5();
+        // Gets the next 8 bits of the bit stream without consuming them. Bit stream bytes are interleaved
+        // with other encoded bytes, but while a single code or value is read, the byte following the current
+        // bit stream byte is always the next bit stream byte. Bits past the end of the buffer read as zero.
+        uint32_t PeekBits8() const
+        {
+            const uint32_t nextByte = m_position < m_lastPosition ? m_data[m_position] : 0U;
+            return (m_bitStreamCache << 8 | nextByte) >> m_bitStreamCount & 0xFFU;
+        }
+
+        // Consumes up to 8 bits from the bit stream.
+        void SkipBits(int32_t count)
+        {
+            if (count <= m_bitStreamCount)
+            {
+                m_bitStreamCount -= count;
+                return;
+            }
+
+            m_bitStreamCache = m_data[m_position++];
+            m_bitStreamCount += 8 - count;
+        }
+
+        // Reads up to 8 bits from the bit stream.
+        int32_t ReadBits(int32_t count)
+        {
+            const int32_t bits = static_cast<int32_t>(PeekBits8() >> (8 - count));
+            SkipBits(count);
+            return bits;
+        }
+
+        int32_t ReadBit()
+        {
+            return ReadBits(1);
+        }
+
+        int32_t ReadBits4()
+        {
+            return ReadBits(4);
+        }
+
+        int32_t ReadBits5()
+        {
+            return ReadBits(5);
+        }
     };
 }}}
 
@@ -42,18 +42,19 @@ TSSCEncoder::TSSCEncoder() :
     m_prevTimeDelta2(Int64::MaxValue),
     m_prevTimeDelta3(Int64::MaxValue),
     m_prevTimeDelta4(Int64::MaxValue),    
+    m_lastPoint(&m_initialPoint),
     m_bitStreamBufferIndex(-1),
     m_bitStreamCacheBitCount(0),
     m_bitStreamCache(0)
 {
-    m_lastPoint = NewTSSCPointMetadata();
 }
 
 void TSSCEncoder::Reset()
 {
     m_data = nullptr;
     m_points.clear();
-    m_lastPoint = NewTSSCPointMetadata();
+    m_initialPoint = TSSCPointMetadata();
+    m_lastPoint = &m_initialPoint;
     m_position = 0;
     m_lastPosition = 0;
     ClearBitStream();
@@ -86,19 +87,7 @@ bool TSSCEncoder::TryAddMeasurement(uint16_t id, int64_t timestamp, uint32_t qua
     if (m_lastPosition - m_position < 100)
         return false;
 
-    TSSCPointMetadataPtr point = id >= m_points.size() ? nullptr : m_points[id];
-    
-    if (point == nullptr)
-    {
-        point = NewTSSCPointMetadata();
-
-        if (id >= m_points.size())
-            m_points.resize(id + 1, nullptr);
-
-        point->PrevNextPointId1 = static_cast<uint16_t>(id + 1);
-        
-        m_points[id] = point;
-    }
+    TSSCPointMetadata& point = GetPoint(id);
 
     //Note: since I will not know the incoming pointID. The most recent
     //      measurement received will be the one that contains the 
@@ -112,54 +101,54 @@ bool TSSCEncoder::TryAddMeasurement(uint16_t id, int64_t timestamp, uint32_t qua
     if (m_prevTimestamp1 != timestamp)
         WriteTimestampChange(timestamp);
 
-    if (point->PrevQuality1 != quality)
+    if (point.PrevQuality1 != quality)
         WriteQualityChange(quality, point);
 
     const uint32_t valueRaw = *reinterpret_cast<uint32_t*>(&value);
 
-    if (point->PrevValue1 == valueRaw)
+    if (point.PrevValue1 == valueRaw)
     {
-        m_lastPoint->WriteCode(TSSCCodeWords::Value1);
+        m_lastPoint->WriteCode(*this, TSSCCodeWords::Value1);
     }
-    else if (point->PrevValue2 == valueRaw)
+    else if (point.PrevValue2 == valueRaw)
     {
-        m_lastPoint->WriteCode(TSSCCodeWords::Value2);
-        point->PrevValue2 = point->PrevValue1;
-        point->PrevValue1 = valueRaw;
+        m_lastPoint->WriteCode(*this, TSSCCodeWords::Value2);
+        point.PrevValue2 = point.PrevValue1;
+        point.PrevValue1 = valueRaw;
     }
-    else if (point->PrevValue3 == valueRaw)
+    else if (point.PrevValue3 == valueRaw)
     {
-        m_lastPoint->WriteCode(TSSCCodeWords::Value3);
-        point->PrevValue3 = point->PrevValue2;
-        point->PrevValue2 = point->PrevValue1;
-        point->PrevValue1 = valueRaw;
+        m_lastPoint->WriteCode(*this, TSSCCodeWords::Value3);
+        point.PrevValue3 = point.PrevValue2;
+        point.PrevValue2 = point.PrevValue1;
+        point.PrevValue1 = valueRaw;
     }
     else if (valueRaw == 0)
     {
-        m_lastPoint->WriteCode(TSSCCodeWords::ValueZero);
-        point->PrevValue3 = point->PrevValue2;
-        point->PrevValue2 = point->PrevValue1;
-        point->PrevValue1 = 0;
+        m_lastPoint->WriteCode(*this, TSSCCodeWords::ValueZero);
+        point.PrevValue3 = point.PrevValue2;
+        point.PrevValue2 = point.PrevValue1;
+        point.PrevValue1 = 0;
     }
     else
     {
-        const uint32_t bitsChanged = valueRaw ^ point->PrevValue1;
+        const uint32_t bitsChanged = valueRaw ^ point.PrevValue1;
 
         if (bitsChanged <= Bits4)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR4);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::ValueXOR4);
             WriteBits(static_cast<uint8_t>(bitsChanged) & 15, 4);
         }
         else if (bitsChanged <= Bits8)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR8);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::ValueXOR8);
 
             m_data[m_position] = static_cast<uint8_t>(bitsChanged);
             m_position++;
         }
         else if (bitsChanged <= Bits12)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR12);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::ValueXOR12);
             WriteBits(static_cast<uint8_t>(bitsChanged) & 15, 4);
 
             m_data[m_position] = static_cast<uint8_t>(bitsChanged >> 4);
@@ -167,14 +156,14 @@ bool TSSCEncoder::TryAddMeasurement(uint16_t id, int64_t timestamp, uint32_t qua
         }
         else if (bitsChanged <= Bits16)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR16);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::ValueXOR16);
             m_data[m_position] = static_cast<uint8_t>(bitsChanged);
             m_data[m_position + 1] = static_cast<uint8_t>(bitsChanged >> 8);
             m_position = m_position + 2;
         }
         else if (bitsChanged <= Bits20)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR20);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::ValueXOR20);
             WriteBits(static_cast<uint8_t>(bitsChanged) & 15, 4);
 
             m_data[m_position] = static_cast<uint8_t>(bitsChanged >> 4);
@@ -183,7 +172,7 @@ bool TSSCEncoder::TryAddMeasurement(uint16_t id, int64_t timestamp, uint32_t qua
         }
         else if (bitsChanged <= Bits24)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR24);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::ValueXOR24);
 
             m_data[m_position] = static_cast<uint8_t>(bitsChanged);
             m_data[m_position + 1] = static_cast<uint8_t>(bitsChanged >> 8);
@@ -192,7 +181,7 @@ bool TSSCEncoder::TryAddMeasurement(uint16_t id, int64_t timestamp, uint32_t qua
         }
         else if (bitsChanged <= Bits28)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR28);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::ValueXOR28);
             WriteBits(static_cast<uint8_t>(bitsChanged) & 15, 4);
 
             m_data[m_position] = static_cast<uint8_t>(bitsChanged >> 4);
@@ -202,7 +191,7 @@ bool TSSCEncoder::TryAddMeasurement(uint16_t id, int64_t timestamp, uint32_t qua
         }
         else
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::ValueXOR32);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::ValueXOR32);
 
             m_data[m_position] = static_cast<uint8_t>(bitsChanged);
             m_data[m_position + 1] = static_cast<uint8_t>(bitsChanged >> 8);
@@ -211,19 +200,32 @@ bool TSSCEncoder::TryAddMeasurement(uint16_t id, int64_t timestamp, uint32_t qua
             m_position = m_position + 4;
         }
 
-        point->PrevValue3 = point->PrevValue2;
-        point->PrevValue2 = point->PrevValue1;
-        point->PrevValue1 = valueRaw;
+        point.PrevValue3 = point.PrevValue2;
+        point.PrevValue2 = point.PrevValue1;
+        point.PrevValue1 = valueRaw;
     }
 
-    m_lastPoint = point;
+    m_lastPoint = &point;
 
     return true;
 }
 
-TSSCPointMetadataPtr TSSCEncoder::NewTSSCPointMetadata()
+// Adds state for all points up to and including the given ID, each new
+// point starts with its next point ID predicted as the following ID
+void TSSCEncoder::AddPoints(uint16_t id)
 {
-    return NewSharedPtr<TSSCPointMetadata>([&,this](int32_t code, int32_t length) { return WriteBits(code, length); });
+    // Last point can reference an element of points, so it is restored after resize
+    const bool lastPointInPoints = m_lastPoint != &m_initialPoint;
+    const size_t lastPointIndex = lastPointInPoints ? m_lastPoint - m_points.data() : 0;
+    const size_t count = m_points.size();
+
+    m_points.resize(static_cast<size_t>(id) + 1);
+
+    for (size_t i = count; i < m_points.size(); i++)
+        m_points[i].PrevNextPointId1 = static_cast<uint16_t>(i + 1);
+
+    if (lastPointInPoints)
+        m_lastPoint = &m_points[lastPointIndex];
 }
 
 void TSSCEncoder::WritePointIdChange(uint16_t id)
@@ -232,18 +234,18 @@ void TSSCEncoder::WritePointIdChange(uint16_t id)
 
     if (bitsChanged <= Bits4)
     {
-        m_lastPoint->WriteCode(TSSCCodeWords::PointIDXOR4);
+        m_lastPoint->WriteCode(*this, TSSCCodeWords::PointIDXOR4);
         WriteBits(static_cast<uint8_t>(bitsChanged) & 15, 4);
     }
     else if (bitsChanged <= Bits8)
     {
-        m_lastPoint->WriteCode(TSSCCodeWords::PointIDXOR8);
+        m_lastPoint->WriteCode(*this, TSSCCodeWords::PointIDXOR8);
         m_data[m_position] = static_cast<uint8_t>(bitsChanged);
         m_position++;
     }
     else if (bitsChanged <= Bits12)
     {
-        m_lastPoint->WriteCode(TSSCCodeWords::PointIDXOR12);
+        m_lastPoint->WriteCode(*this, TSSCCodeWords::PointIDXOR12);
         WriteBits(static_cast<uint8_t>(bitsChanged) & 15, 4);
 
         m_data[m_position] = static_cast<uint8_t>(bitsChanged >> 4);
@@ -251,7 +253,7 @@ void TSSCEncoder::WritePointIdChange(uint16_t id)
     }
     else
     {
-        m_lastPoint->WriteCode(TSSCCodeWords::PointIDXOR16);
+        m_lastPoint->WriteCode(*this, TSSCCodeWords::PointIDXOR16);
         m_data[m_position] = static_cast<uint8_t>(bitsChanged);
         m_data[m_position + 1] = static_cast<uint8_t>(bitsChanged >> 8);
         m_position += 2;
@@ -264,29 +266,29 @@ void TSSCEncoder::WriteTimestampChange(int64_t timestamp)
 {
     if (m_prevTimestamp2 == timestamp)
     {
-        m_lastPoint->WriteCode(TSSCCodeWords::Timestamp2);
+        m_lastPoint->WriteCode(*this, TSSCCodeWords::Timestamp2);
     }
     else if (m_prevTimestamp1 < timestamp)
     {
         if (m_prevTimestamp1 + m_prevTimeDelta1 == timestamp)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta1Forward);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::TimeDelta1Forward);
         }
         else if (m_prevTimestamp1 + m_prevTimeDelta2 == timestamp)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta2Forward);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::TimeDelta2Forward);
         }
         else if (m_prevTimestamp1 + m_prevTimeDelta3 == timestamp)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta3Forward);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::TimeDelta3Forward);
         }
         else if (m_prevTimestamp1 + m_prevTimeDelta4 == timestamp)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta4Forward);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::TimeDelta4Forward);
         }
         else
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::TimeXOR7Bit);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::TimeXOR7Bit);
             Encode7BitUInt64(m_data, m_position, static_cast<uint64_t>(timestamp ^ m_prevTimestamp1));
         }
     }
@@ -294,23 +296,23 @@ void TSSCEncoder::WriteTimestampChange(int64_t timestamp)
     {
         if (m_prevTimestamp1 - m_prevTimeDelta1 == timestamp)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta1Reverse);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::TimeDelta1Reverse);
         }
         else if (m_prevTimestamp1 - m_prevTimeDelta2 == timestamp)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta2Reverse);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::TimeDelta2Reverse);
         }
         else if (m_prevTimestamp1 - m_prevTimeDelta3 == timestamp)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta3Reverse);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::TimeDelta3Reverse);
         }
         else if (m_prevTimestamp1 - m_prevTimeDelta4 == timestamp)
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::TimeDelta4Reverse);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::TimeDelta4Reverse);
         }
         else
         {
-            m_lastPoint->WriteCode(TSSCCodeWords::TimeXOR7Bit);
+            m_lastPoint->WriteCode(*this, TSSCCodeWords::TimeXOR7Bit);
             Encode7BitUInt64(m_data, m_position, static_cast<uint64_t>(timestamp ^ m_prevTimestamp1));
         }
     }
@@ -351,20 +353,20 @@ void TSSCEncoder::WriteTimestampChange(int64_t timestamp)
     m_prevTimestamp1 = timestamp;
 }
 
-void TSSCEncoder::WriteQualityChange(uint32_t quality, const TSSCPointMetadataPtr& point)
+void TSSCEncoder::WriteQualityChange(uint32_t quality, TSSCPointMetadata& point)
 {
-    if (point->PrevQuality2 == quality)
+    if (point.PrevQuality2 == quality)
     {
-        m_lastPoint->WriteCode(TSSCCodeWords::Quality2);
+        m_lastPoint->WriteCode(*this, TSSCCodeWords::Quality2);
     }
     else
     {
-        m_lastPoint->WriteCode(TSSCCodeWords::Quality7Bit32);
+        m_lastPoint->WriteCode(*this, TSSCCodeWords::Quality7Bit32);
         Encode7BitUInt32(m_data, m_position, quality);
     }
     
-    point->PrevQuality2 = point->PrevQuality1;
-    point->PrevQuality1 = quality;
+    point.PrevQuality2 = point.PrevQuality1;
+    point.PrevQuality1 = quality;
 }
 
 void TSSCEncoder::ClearBitStream()
@@ -374,18 +376,6 @@ void TSSCEncoder::ClearBitStream()
     m_bitStreamCache = 0;
 }
 
-void TSSCEncoder::WriteBits(int32_t code, int32_t length)
-{
-    if (m_bitStreamBufferIndex < 0)
-        m_bitStreamBufferIndex = static_cast<int32_t>(m_position++);
-
-    m_bitStreamCache = (m_bitStreamCache << length) | code;
-    m_bitStreamCacheBitCount += length;
-
-    if (m_bitStreamCacheBitCount > 7)
-        BitStreamEnd();
-}
-
 void TSSCEncoder::BitStreamFlush()
 {
     if (m_bitStreamCacheBitCount > 0)
@@ -393,7 +383,7 @@ void TSSCEncoder::BitStreamFlush()
         if (m_bitStreamBufferIndex < 0)
             m_bitStreamBufferIndex = static_cast<int32_t>(m_position++);
 
-        m_lastPoint->WriteCode(TSSCCodeWords::EndOfStream);
+        m_lastPoint->WriteCode(*this, TSSCCodeWords::EndOfStream);
 
         if (m_bitStreamCacheBitCount > 7)
             BitStreamEnd();
@@ -410,20 +400,6 @@ void TSSCEncoder::BitStreamFlush()
     }
 }
 
-void TSSCEncoder::BitStreamEnd()
-{
-    while (m_bitStreamCacheBitCount > 7)
-    {
-        m_data[m_bitStreamBufferIndex] = static_cast<uint8_t>(m_bitStreamCache >> (m_bitStreamCacheBitCount - 8));
-        m_bitStreamCacheBitCount -= 8;
-
-        if (m_bitStreamCacheBitCount > 0)
-            m_bitStreamBufferIndex = static_cast<int32_t>(m_position++);
-        else
-            m_bitStreamBufferIndex = -1;
-    }
-}
-
 void Encode7BitUInt32(uint8_t* stream, uint32_t & position, uint32_t value)
 {
     if (value < 128UL)
@@ -24,7 +24,7 @@
 #ifndef __TSSC_ENCODER_H
 #define __TSSC_ENCODER_H
 
-#include "TransportTypes.h"
+#include "TSSCPointMetadata.h"
 
 namespace GSF {
 namespace TimeSeries {
@@ -55,8 +55,10 @@ namespace Transport
         int64_t m_prevTimeDelta3;
         int64_t m_prevTimeDelta4;
 
-        TSSCPointMetadataPtr m_lastPoint;
-        std::vector<TSSCPointMetadataPtr> m_points;
+        // Point state indexed by point ID, last point references initial point or an element of points
+        TSSCPointMetadata m_initialPoint;
+        TSSCPointMetadata* m_lastPoint;
+        std::vector<TSSCPointMetadata> m_points;
 
         // The position in m_buffer where the bit stream should be flushed, -1 means no bit stream position has been assigned.
         int32_t m_bitStreamBufferIndex;
@@ -65,24 +67,63 @@ namespace Transport
         int32_t m_bitStreamCacheBitCount;
 
         // A cache of bits that need to be flushed to m_buffer when full. Bits filled starting from the right moving left.
-        int32_t m_bitStreamCache;
+        uint32_t m_bitStreamCache;
 
         void WritePointIdChange(uint16_t id);
         void WriteTimestampChange(int64_t timestamp);
-        void WriteQualityChange(uint32_t quality, const TSSCPointMetadataPtr& point);
+        void WriteQualityChange(uint32_t quality, TSSCPointMetadata& point);
 
         // Resets the stream so it can be reused. All measurements must be registered again.
         void ClearBitStream();
-        void WriteBits(int32_t code, int32_t length);
         void BitStreamFlush();
-        void BitStreamEnd();
 
-        TSSCPointMetadataPtr NewTSSCPointMetadata();
+        void WriteBits(int32_t code, int32_t length)
+        {
+            if (m_bitStreamBufferIndex < 0)
+                m_bitStreamBufferIndex = static_cast<int32_t>(m_position++);
+
+            m_bitStreamCache = m_bitStreamCache << length | static_cast<uint32_t>(code);
+            m_bitStreamCacheBitCount += length;
+
+            if (m_bitStreamCacheBitCount > 7)
+                BitStreamEnd();
+        }
+
+        // Writes the completed bit stream byte. At most 7 bits are pending before a write of
+        // up to 8 bits, so no more than one byte is ever completed.
+        void BitStreamEnd()
+        {
+            m_bitStreamCacheBitCount -= 8;
+            m_data[m_bitStreamBufferIndex] = static_cast<uint8_t>(m_bitStreamCache >> m_bitStreamCacheBitCount);
+            m_bitStreamCache &= (1U << m_bitStreamCacheBitCount) - 1U;
+
+            // Next bit stream byte is reserved as soon as it holds a pending bit
+            if (m_bitStreamCacheBitCount > 0)
+                m_bitStreamBufferIndex = static_cast<int32_t>(m_position++);
+            else
+                m_bitStreamBufferIndex = -1;
+        }
+
+        TSSCPointMetadata& GetPoint(uint16_t id)
+        {
+            if (id >= m_points.size())
+                AddPoints(id);
+
+            return m_points[id];
+        }
+
+        void AddPoints(uint16_t id);
+
+        friend class TSSCPointMetadata;
 
     public:
         // Creates a new instance of the TSSC encoder.
         TSSCEncoder();
 
+        // Encoder references its own point state, so it cannot be copied.
+        TSSCEncoder(const TSSCEncoder&) = delete;
+        TSSCEncoder& operator=(const TSSCEncoder&) = delete;
+
         // Resets the TSSC Encoder to the initial state. 
         void Reset();
 
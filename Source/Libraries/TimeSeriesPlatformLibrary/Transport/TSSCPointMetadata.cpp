@@ -0,0 +1,160 @@
+//******************************************************************************************************
+//  TSSCPointMetadata.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "TSSCPointMetadata.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+static constexpr array<array<uint16_t, 256>, 4> CreateCodeTable()
+{
+    array<array<uint16_t, 256>, 4> table {};
+
+    for (int32_t mode = 1; mode <= 4; mode++)
+    {
+        const int32_t prefixCount = mode - 1;
+
+        for (int32_t bits = 0; bits < 256; bits++)
+        {
+            // Number of leading zero bits selects prefix code
+            int32_t zeros = 0;
+
+            while (zeros < prefixCount && (bits & (0x80 >> zeros)) == 0)
+                zeros++;
+
+            // Prefix codes are flagged with 0x80, see PrefixCodeFlag
+            if (zeros < prefixCount)
+                table[mode - 1][bits] = static_cast<uint16_t>((zeros + 1) << 8 | 0x80 | zeros);
+            else
+                table[mode - 1][bits] = static_cast<uint16_t>((prefixCount + 5) << 8 | (bits >> (3 - prefixCount) & 0x1F));
+        }
+    }
+
+    return table;
+}
+
+const array<array<uint16_t, 256>, 4> TSSCPointMetadata::CodeTable = CreateCodeTable();
+
+TSSCPointMetadata::TSSCPointMetadata() :
+    m_commandStats(),
+    m_commandsSentSinceLastChange(0),
+    m_mode(4),
+    m_prefixCodes { TSSCCodeWords::Value1, TSSCCodeWords::Value2, TSSCCodeWords::Value3 },
+    m_startupMode(0),
+    PrevNextPointId1(0),
+    PrevQuality1(0),
+    PrevQuality2(0),
+    PrevValue1(0),
+    PrevValue2(0),
+    PrevValue3(0)
+{
+}
+
+void TSSCPointMetadata::AdaptCommands()
+{
+    uint8_t code1 = 0;
+    int32_t count1 = 0;
+
+    uint8_t code2 = 1;
+    int32_t count2 = 0;
+
+    uint8_t code3 = 2;
+    int32_t count3 = 0;
+
+    int32_t total = 0;
+
+    for (int32_t i = 0; i < CommandStatsLength; i++)
+    {
+        const int32_t count = m_commandStats[i];
+        m_commandStats[i] = 0;
+
+        total += count;
+
+        if (count > count3)
+        {
+            if (count > count1)
+            {
+                code3 = code2;
+                count3 = count2;
+
+                code2 = code1;
+                count2 = count1;
+
+                code1 = static_cast<uint8_t>(i);
+                count1 = count;
+            }
+            else if (count > count2)
+            {
+                code3 = code2;
+                count3 = count2;
+
+                code2 = static_cast<uint8_t>(i);
+                count2 = count;
+            }
+            else
+            {
+                code3 = static_cast<uint8_t>(i);
+                count3 = count;
+            }
+        }
+    }
+
+    const int32_t mode1Size = total * 5;
+    const int32_t mode2Size = count1 * 1 + (total - count1) * 6;
+    const int32_t mode3Size = count1 * 1 + count2 * 2 + (total - count1 - count2) * 7;
+    const int32_t mode4Size = count1 * 1 + count2 * 2 + count3 * 3 + (total - count1 - count2 - count3) * 8;
+
+    int32_t minSize = Int32::MaxValue;
+
+    minSize = min(minSize, mode1Size);
+    minSize = min(minSize, mode2Size);
+    minSize = min(minSize, mode3Size);
+    minSize = min(minSize, mode4Size);
+
+    if (minSize == mode1Size)
+    {
+        m_mode = 1;
+    }
+    else if (minSize == mode2Size)
+    {
+        m_mode = 2;
+        m_prefixCodes[0] = code1;
+    }
+    else if (minSize == mode3Size)
+    {
+        m_mode = 3;
+        m_prefixCodes[0] = code1;
+        m_prefixCodes[1] = code2;
+    }
+    else
+    {
+        m_mode = 4;
+        m_prefixCodes[0] = code1;
+        m_prefixCodes[1] = code2;
+        m_prefixCodes[2] = code3;
+    }
+
+    m_commandsSentSinceLastChange = 0;
+}
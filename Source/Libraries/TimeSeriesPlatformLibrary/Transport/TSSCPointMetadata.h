@@ -0,0 +1,128 @@
+//******************************************************************************************************
+//  TSSCPointMetadata.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __TSSC_POINT_METADATA_H
+#define __TSSC_POINT_METADATA_H
+
+#include "TransportTypes.h"
+#include <array>
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // The metadata kept for each pointID. Points are stored by value in a flat array indexed
+    // by point ID, so state is packed into a single cache line. Bits are written and read through
+    // the encoder or decoder passed to WriteCode and ReadCode, calls are resolved at compile time
+    // so bit I/O is inlined into the encode and decode loops.
+    class alignas(64) TSSCPointMetadata
+    {
+    private:
+        static constexpr const uint8_t CommandStatsLength = 32;
+
+        uint8_t m_commandStats[CommandStatsLength];
+
+        // Code statistics are adapted after at most 101 commands, so a byte suffices
+        uint8_t m_commandsSentSinceLastChange;
+
+        //Bit codes for the 4 modes of encoding. 
+        uint8_t m_mode;
+
+        // Codes assigned 1, 2 and 3 bit prefixes, mode N uses the first N - 1 codes.
+        // Other codes are written as N - 1 zero bits followed by the 5-bit code.
+        //(Mode 1 means no prefix.)
+        uint8_t m_prefixCodes[3];
+
+        uint8_t m_startupMode;
+
+        void UpdatedCodeStatistics(int32_t code)
+        {
+            m_commandsSentSinceLastChange++;
+            m_commandStats[code]++;
+
+            // Codes are adapted after 5, then 20, then every 100 commands
+            if (m_commandsSentSinceLastChange > AdaptThresholds[m_startupMode])
+            {
+                if (m_startupMode < 2)
+                    m_startupMode++;
+
+                AdaptCommands();
+            }
+        }
+
+        void AdaptCommands();
+
+        // Code decoding table indexed by mode - 1 and the next 8 bits of the stream. Each entry holds the
+        // code length in the high byte and in the low byte either a prefix code index, flagged with
+        // PrefixCodeFlag, or the 5-bit code itself.
+        static const std::array<std::array<uint16_t, 256>, 4> CodeTable;
+        static constexpr const uint16_t PrefixCodeFlag = 0x80;
+        static constexpr const uint8_t AdaptThresholds[3] = { 5, 20, 100 };
+
+    public:
+        TSSCPointMetadata();
+
+        uint16_t PrevNextPointId1;
+
+        uint32_t PrevQuality1;
+        uint32_t PrevQuality2;
+        uint32_t PrevValue1;
+        uint32_t PrevValue2;
+        uint32_t PrevValue3;
+
+        // Writes code using writer.WriteBits(code, length).
+        template<typename TBitWriter>
+        void WriteCode(TBitWriter& writer, int32_t code)
+        {
+            const int32_t prefixCount = m_mode - 1;
+            int32_t index = 0;
+
+            while (index < prefixCount && code != m_prefixCodes[index])
+                index++;
+
+            if (index < prefixCount)
+                writer.WriteBits(1, index + 1);
+            else
+                writer.WriteBits(code, prefixCount + 5);
+
+            UpdatedCodeStatistics(code);
+        }
+
+        // Reads code using reader.PeekBits8() and reader.SkipBits(count).
+        template<typename TBitReader>
+        int32_t ReadCode(TBitReader& reader)
+        {
+            const uint16_t entry = CodeTable[m_mode - 1][reader.PeekBits8()];
+            const int32_t code = entry & PrefixCodeFlag ? m_prefixCodes[entry & 3] : entry & 0x1F;
+
+            reader.SkipBits(entry >> 8);
+
+            UpdatedCodeStatistics(code);
+            return code;
+        }
+    };
+
+    static_assert(sizeof(TSSCPointMetadata) == 64, "TSSC point metadata should occupy a single cache line");
+}}}
+
+#endif
@@ -0,0 +1,171 @@
+//******************************************************************************************************
+//  TransportStatistics.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#include "TransportStatistics.h"
+#include "../Common/Convert.h"
+#include <chrono>
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries::Transport;
+
+// Counter difference clamped at zero, counters are reset on reconnect
+static uint64_t Delta(uint64_t previous, uint64_t current)
+{
+    return current > previous ? current - previous : 0ULL;
+}
+
+static float64_t Ratio(float64_t numerator, float64_t denominator)
+{
+    return denominator > 0.0 ? numerator / denominator : 0.0;
+}
+
+int64_t GSF::TimeSeries::Transport::GetStatisticsTime()
+{
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+PublicationStatistics::PublicationStatistics() :
+    Timestamp(ToTicks(UtcNow())),
+    ConnectionCount(0U),
+    CommandChannelBytesSent(0ULL),
+    DataChannelBytesSent(0ULL),
+    CommandChannelPacketsSent(0ULL),
+    DataChannelPacketsSent(0ULL),
+    DataPacketsSent(0ULL),
+    MeasurementsSent(0ULL),
+    EncodeTime(0ULL),
+    SocketWrites(0ULL),
+    SocketWaitTime(0ULL),
+    WriteQueueDepth(0LL),
+    PeakWriteQueueDepth(0LL),
+    CompressionResets(0ULL)
+{
+}
+
+void PublicationStatistics::Add(const PublicationStatistics& other)
+{
+    ConnectionCount += other.ConnectionCount;
+    CommandChannelBytesSent += other.CommandChannelBytesSent;
+    DataChannelBytesSent += other.DataChannelBytesSent;
+    CommandChannelPacketsSent += other.CommandChannelPacketsSent;
+    DataChannelPacketsSent += other.DataChannelPacketsSent;
+    DataPacketsSent += other.DataPacketsSent;
+    MeasurementsSent += other.MeasurementsSent;
+    EncodeTime += other.EncodeTime;
+    SocketWrites += other.SocketWrites;
+    SocketWaitTime += other.SocketWaitTime;
+    WriteQueueDepth += other.WriteQueueDepth;
+    PeakWriteQueueDepth = max(PeakWriteQueueDepth, other.PeakWriteQueueDepth);
+    CompressionResets += other.CompressionResets;
+}
+
+PublicationRates::PublicationRates() :
+    Interval(0.0),
+    BytesPerSecond(0.0),
+    PacketsPerSecond(0.0),
+    DataPacketsPerSecond(0.0),
+    MeasurementsPerSecond(0.0),
+    MeasurementsPerPacket(0.0),
+    EncodeTimePerPacket(0.0),
+    SocketWaitTimePerWrite(0.0),
+    EncodeUtilization(0.0)
+{
+}
+
+PublicationRates GSF::TimeSeries::Transport::CalculateRates(const PublicationStatistics& previous, const PublicationStatistics& current)
+{
+    PublicationRates rates;
+
+    rates.Interval = (current.Timestamp - previous.Timestamp) / static_cast<float64_t>(Ticks::PerSecond);
+
+    const float64_t bytes = static_cast<float64_t>(Delta(previous.CommandChannelBytesSent, current.CommandChannelBytesSent) + Delta(previous.DataChannelBytesSent, current.DataChannelBytesSent));
+    const float64_t packets = static_cast<float64_t>(Delta(previous.CommandChannelPacketsSent, current.CommandChannelPacketsSent) + Delta(previous.DataChannelPacketsSent, current.DataChannelPacketsSent));
+    const float64_t dataPackets = static_cast<float64_t>(Delta(previous.DataPacketsSent, current.DataPacketsSent));
+    const float64_t measurements = static_cast<float64_t>(Delta(previous.MeasurementsSent, current.MeasurementsSent));
+    const float64_t encodeTime = static_cast<float64_t>(Delta(previous.EncodeTime, current.EncodeTime));
+    const float64_t socketWrites = static_cast<float64_t>(Delta(previous.SocketWrites, current.SocketWrites));
+    const float64_t socketWaitTime = static_cast<float64_t>(Delta(previous.SocketWaitTime, current.SocketWaitTime));
+
+    rates.BytesPerSecond = Ratio(bytes, rates.Interval);
+    rates.PacketsPerSecond = Ratio(packets, rates.Interval);
+    rates.DataPacketsPerSecond = Ratio(dataPackets, rates.Interval);
+    rates.MeasurementsPerSecond = Ratio(measurements, rates.Interval);
+    rates.MeasurementsPerPacket = Ratio(measurements, dataPackets);
+    rates.EncodeTimePerPacket = Ratio(encodeTime, dataPackets) / 1000.0;
+    rates.SocketWaitTimePerWrite = Ratio(socketWaitTime, socketWrites) / 1000.0;
+    rates.EncodeUtilization = Ratio(encodeTime / 1.0E9, rates.Interval);
+
+    return rates;
+}
+
+SubscriptionStatistics::SubscriptionStatistics() :
+    Timestamp(ToTicks(UtcNow())),
+    CommandChannelBytesReceived(0ULL),
+    DataChannelBytesReceived(0ULL),
+    CommandChannelPacketsReceived(0ULL),
+    DataChannelPacketsReceived(0ULL),
+    DataPacketsReceived(0ULL),
+    MeasurementsReceived(0ULL),
+    DecodeTime(0ULL),
+    CompressionResets(0ULL),
+    OutOfSequencePackets(0ULL),
+    DecompressionFailures(0ULL)
+{
+}
+
+SubscriptionRates::SubscriptionRates() :
+    Interval(0.0),
+    BytesPerSecond(0.0),
+    PacketsPerSecond(0.0),
+    DataPacketsPerSecond(0.0),
+    MeasurementsPerSecond(0.0),
+    MeasurementsPerPacket(0.0),
+    DecodeTimePerPacket(0.0),
+    DecodeUtilization(0.0)
+{
+}
+
+SubscriptionRates GSF::TimeSeries::Transport::CalculateRates(const SubscriptionStatistics& previous, const SubscriptionStatistics& current)
+{
+    SubscriptionRates rates;
+
+    rates.Interval = (current.Timestamp - previous.Timestamp) / static_cast<float64_t>(Ticks::PerSecond);
+
+    const float64_t bytes = static_cast<float64_t>(Delta(previous.CommandChannelBytesReceived, current.CommandChannelBytesReceived) + Delta(previous.DataChannelBytesReceived, current.DataChannelBytesReceived));
+    const float64_t packets = static_cast<float64_t>(Delta(previous.CommandChannelPacketsReceived, current.CommandChannelPacketsReceived) + Delta(previous.DataChannelPacketsReceived, current.DataChannelPacketsReceived));
+    const float64_t dataPackets = static_cast<float64_t>(Delta(previous.DataPacketsReceived, current.DataPacketsReceived));
+    const float64_t measurements = static_cast<float64_t>(Delta(previous.MeasurementsReceived, current.MeasurementsReceived));
+    const float64_t decodeTime = static_cast<float64_t>(Delta(previous.DecodeTime, current.DecodeTime));
+
+    rates.BytesPerSecond = Ratio(bytes, rates.Interval);
+    rates.PacketsPerSecond = Ratio(packets, rates.Interval);
+    rates.DataPacketsPerSecond = Ratio(dataPackets, rates.Interval);
+    rates.MeasurementsPerSecond = Ratio(measurements, rates.Interval);
+    rates.MeasurementsPerPacket = Ratio(measurements, dataPackets);
+    rates.DecodeTimePerPacket = Ratio(decodeTime, dataPackets) / 1000.0;
+    rates.DecodeUtilization = Ratio(decodeTime / 1.0E9, rates.Interval);
+
+    return rates;
+}
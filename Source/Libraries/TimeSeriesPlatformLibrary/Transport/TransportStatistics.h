@@ -0,0 +1,160 @@
+//******************************************************************************************************
+//  TransportStatistics.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#ifndef __TRANSPORT_STATISTICS_H
+#define __TRANSPORT_STATISTICS_H
+
+#include "../Common/CommonTypes.h"
+#include <atomic>
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Hot path statistics counter. Updates use relaxed atomic operations, so any thread can update a
+    // counter without ordering cost; readers see recent, but not mutually consistent, counter values.
+    class StatisticsCounter
+    {
+    private:
+        std::atomic<uint64_t> m_value;
+
+    public:
+        StatisticsCounter() : m_value(0ULL) { }
+
+        void Add(uint64_t value) { m_value.fetch_add(value, std::memory_order_relaxed); }
+        void Increment() { m_value.fetch_add(1ULL, std::memory_order_relaxed); }
+        uint64_t Value() const { return m_value.load(std::memory_order_relaxed); }
+        void Reset() { m_value.store(0ULL, std::memory_order_relaxed); }
+    };
+
+    // Hot path statistics level, e.g., a queue depth, with its peak value since last reset.
+    class StatisticsGauge
+    {
+    private:
+        std::atomic<int64_t> m_value;
+        std::atomic<int64_t> m_peak;
+
+    public:
+        StatisticsGauge() : m_value(0LL), m_peak(0LL) { }
+
+        void Increment()
+        {
+            const int64_t value = m_value.fetch_add(1LL, std::memory_order_relaxed) + 1LL;
+            int64_t peak = m_peak.load(std::memory_order_relaxed);
+
+            while (value > peak && !m_peak.compare_exchange_weak(peak, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void Decrement() { m_value.fetch_sub(1LL, std::memory_order_relaxed); }
+        int64_t Value() const { return m_value.load(std::memory_order_relaxed); }
+        int64_t Peak() const { return m_peak.load(std::memory_order_relaxed); }
+        void Reset() { m_peak.store(m_value.load(std::memory_order_relaxed), std::memory_order_relaxed); }
+    };
+
+    // Gets a monotonic time, in nanoseconds, for measuring elapsed time on the hot path.
+    int64_t GetStatisticsTime();
+
+    // Snapshot of data publication statistics for a subscriber connection, or the total for all
+    // connections of a data publisher. Counters are cumulative since the connection was accepted.
+    struct PublicationStatistics
+    {
+        int64_t Timestamp;                      // Time of snapshot, in ticks
+        uint32_t ConnectionCount;
+        uint64_t CommandChannelBytesSent;
+        uint64_t DataChannelBytesSent;
+        uint64_t CommandChannelPacketsSent;     // All responses sent over TCP, including data packets
+        uint64_t DataChannelPacketsSent;        // Data packets sent over UDP
+        uint64_t DataPacketsSent;
+        uint64_t MeasurementsSent;
+        uint64_t EncodeTime;                    // Nanoseconds spent serializing, compressing and queuing data packets
+        uint64_t SocketWrites;
+        uint64_t SocketWaitTime;                // Nanoseconds from socket write start to completion
+        int64_t WriteQueueDepth;                // Packets queued for, or being written to, a socket
+        int64_t PeakWriteQueueDepth;
+        uint64_t CompressionResets;             // TSSC or XOR64 stream resets
+
+        PublicationStatistics();
+
+        // Accumulates statistics from another connection.
+        void Add(const PublicationStatistics& other);
+    };
+
+    // Publication rates and averages between two statistics snapshots.
+    struct PublicationRates
+    {
+        float64_t Interval;                     // Seconds between snapshots
+        float64_t BytesPerSecond;
+        float64_t PacketsPerSecond;
+        float64_t DataPacketsPerSecond;
+        float64_t MeasurementsPerSecond;
+        float64_t MeasurementsPerPacket;
+        float64_t EncodeTimePerPacket;          // Microseconds per data packet
+        float64_t SocketWaitTimePerWrite;       // Microseconds per socket write
+        float64_t EncodeUtilization;            // Fraction of interval spent encoding
+
+        PublicationRates();
+    };
+
+    PublicationRates CalculateRates(const PublicationStatistics& previous, const PublicationStatistics& current);
+
+    // Snapshot of data subscription statistics for a data subscriber,
+    // counters are cumulative since the subscriber last connected.
+    struct SubscriptionStatistics
+    {
+        int64_t Timestamp;                      // Time of snapshot, in ticks
+        uint64_t CommandChannelBytesReceived;
+        uint64_t DataChannelBytesReceived;
+        uint64_t CommandChannelPacketsReceived;
+        uint64_t DataChannelPacketsReceived;
+        uint64_t DataPacketsReceived;
+        uint64_t MeasurementsReceived;          // Since last subscription
+        uint64_t DecodeTime;                    // Nanoseconds spent decompressing and parsing data packets
+        uint64_t CompressionResets;             // TSSC or XOR64 stream resets
+        uint64_t OutOfSequencePackets;          // Compressed packets ignored for unexpected sequence number
+        uint64_t DecompressionFailures;
+
+        SubscriptionStatistics();
+    };
+
+    // Subscription rates and averages between two statistics snapshots.
+    struct SubscriptionRates
+    {
+        float64_t Interval;                     // Seconds between snapshots
+        float64_t BytesPerSecond;
+        float64_t PacketsPerSecond;
+        float64_t DataPacketsPerSecond;
+        float64_t MeasurementsPerSecond;
+        float64_t MeasurementsPerPacket;
+        float64_t DecodeTimePerPacket;          // Microseconds per data packet
+        float64_t DecodeUtilization;            // Fraction of interval spent decoding
+
+        SubscriptionRates();
+    };
+
+    SubscriptionRates CalculateRates(const SubscriptionStatistics& previous, const SubscriptionStatistics& current);
+}}}
+
+#endif
@@ -57,7 +57,8 @@ Measurement::Measurement() :
     Adder(0),
     Multiplier(1),
     Timestamp(0),
-    Flags(MeasurementStateFlags::Normal)
+    Flags(MeasurementStateFlags::Normal),
+    RuntimeID(-1)
 {
 }
 
@@ -89,6 +90,7 @@ MeasurementPtr TimeSeries::ToPtr(const Measurement& source)
     destination->Multiplier = source.Multiplier;
     destination->Timestamp = source.Timestamp;
     destination->Flags = source.Flags;
+    destination->RuntimeID = source.RuntimeID;
 
     return destination;
 }
@@ -295,239 +297,15 @@ SignalKind GSF::TimeSeries::ParseSignalKind(const string& acronym)
     return SignalKind::Unknown;
 }
 
-TSSCPointMetadata::TSSCPointMetadata(function<void(int32_t, int32_t)> writeBits) :
-    TSSCPointMetadata::TSSCPointMetadata(
-        std::move(writeBits),
-        function<int32_t()>(nullptr),
-        function<int32_t()>(nullptr))
-{
-}
-
-TSSCPointMetadata::TSSCPointMetadata(function<int32_t()> readBit, function<int32_t()> readBits5) :
-    TSSCPointMetadata::TSSCPointMetadata(
-        function<void(int32_t, int32_t)>(nullptr),
-        std::move(readBit),
-        std::move(readBits5))
-{
-}
-
-TSSCPointMetadata::TSSCPointMetadata(
-    function<void(int32_t, int32_t)> writeBits,
-    function<int32_t()> readBit,
-    function<int32_t()> readBits5) :
-    m_commandsSentSinceLastChange(0),
-    m_mode(4),
-    m_mode21(0),
-    m_mode31(0),
-    m_mode301(0),
-    m_mode41(TSSCCodeWords::Value1),
-    m_mode401(TSSCCodeWords::Value2),
-    m_mode4001(TSSCCodeWords::Value3),
-    m_startupMode(0),
-    m_writeBits(std::move(writeBits)),
-    m_readBit(std::move(readBit)),
-    m_readBits5(std::move(readBits5)),
-    PrevNextPointId1(0),
-    PrevQuality1(0),
-    PrevQuality2(0),
-    PrevValue1(0),
-    PrevValue2(0),
-    PrevValue3(0)
-{
-    for (uint8_t i = 0; i < CommandStatsLength; i++)
-        m_commandStats[i] = 0;
-}
-
-void TSSCPointMetadata::WriteCode(int32_t code)
-{
-    switch (m_mode)
-    {
-        case 1:
-            m_writeBits(code, 5);
-            break;
-        case 2:
-            if (code == m_mode21)
-                m_writeBits(1, 1);
-            else
-                m_writeBits(code, 6);
-            break;
-        case 3:
-            if (code == m_mode31)
-                m_writeBits(1, 1);
-            else if (code == m_mode301)
-                m_writeBits(1, 2);
-            else
-                m_writeBits(code, 7);
-            break;
-        case 4:
-            if (code == m_mode41)
-                m_writeBits(1, 1);
-            else if (code == m_mode401)
-                m_writeBits(1, 2);
-            else if (code == m_mode4001)
-                m_writeBits(1, 3);
-            else
-                m_writeBits(code, 8);
-            break;
-        default:
-            throw PublisherException("Coding Error");
-    }
-
-    UpdatedCodeStatistics(code);
-}
-
-int32_t TSSCPointMetadata::ReadCode()
+DataFrame::DataFrame() :
+    Configuration(nullptr),
+    Timestamp(0),
+    ReceivedCount(0),
+    ExpectedCount(0)
 {
-    int32_t code;
-
-    switch (m_mode)
-    {
-        case 1:
-            code = m_readBits5();
-            break;
-        case 2:
-            if (m_readBit() == 1)
-                code = m_mode21;
-            else
-                code = m_readBits5();
-            break;
-        case 3:
-            if (m_readBit() == 1)
-                code = m_mode31;
-            else if (m_readBit() == 1)
-                code = m_mode301;
-            else
-                code = m_readBits5();
-            break;
-        case 4:
-            if (m_readBit() == 1)
-                code = m_mode41;
-            else if (m_readBit() == 1)
-                code = m_mode401;
-            else if (m_readBit() == 1)
-                code = m_mode4001;
-            else
-                code = m_readBits5();
-            break;
-        default:
-            throw SubscriberException("Unsupported compression mode");
-    }
-
-    UpdatedCodeStatistics(code);
-    return code;
 }
 
-void TSSCPointMetadata::UpdatedCodeStatistics(int32_t code)
+bool DataFrame::IsComplete() const
 {
-    m_commandsSentSinceLastChange++;
-    m_commandStats[code]++;
-
-    if (m_startupMode == 0 && m_commandsSentSinceLastChange > 5)
-    {
-        m_startupMode++;
-        AdaptCommands();
-    }
-    else if (m_startupMode == 1 && m_commandsSentSinceLastChange > 20)
-    {
-        m_startupMode++;
-        AdaptCommands();
-    }
-    else if (m_startupMode == 2 && m_commandsSentSinceLastChange > 100)
-    {
-        AdaptCommands();
-    }
+    return ReceivedCount >= ExpectedCount;
 }
-
-void TSSCPointMetadata::AdaptCommands()
-{
-    uint8_t code1 = 0;
-    int32_t count1 = 0;
-
-    uint8_t code2 = 1;
-    int32_t count2 = 0;
-
-    uint8_t code3 = 2;
-    int32_t count3 = 0;
-
-    int32_t total = 0;
-
-    for (int32_t i = 0; i < CommandStatsLength; i++)
-    {
-        const int32_t count = m_commandStats[i];
-        m_commandStats[i] = 0;
-
-        total += count;
-
-        if (count > count3)
-        {
-            if (count > count1)
-            {
-                code3 = code2;
-                count3 = count2;
-
-                code2 = code1;
-                count2 = count1;
-
-                code1 = static_cast<uint8_t>(i);
-                count1 = count;
-            }
-            else if (count > count2)
-            {
-                code3 = code2;
-                count3 = count2;
-
-                code2 = static_cast<uint8_t>(i);
-                count2 = count;
-            }
-            else
-            {
-                code3 = static_cast<uint8_t>(i);
-                count3 = count;
-            }
-        }
-    }
-
-    const int32_t mode1Size = total * 5;
-    const int32_t mode2Size = count1 * 1 + (total - count1) * 6;
-    const int32_t mode3Size = count1 * 1 + count2 * 2 + (total - count1 - count2) * 7;
-    const int32_t mode4Size = count1 * 1 + count2 * 2 + count3 * 3 + (total - count1 - count2 - count3) * 8;
-
-    int32_t minSize = Int32::MaxValue;
-
-    minSize = min(minSize, mode1Size);
-    minSize = min(minSize, mode2Size);
-    minSize = min(minSize, mode3Size);
-    minSize = min(minSize, mode4Size);
-
-    if (minSize == mode1Size)
-    {
-        m_mode = 1;
-    }
-    else if (minSize == mode2Size)
-    {
-        m_mode = 2;
-        m_mode21 = code1;
-    }
-    else if (minSize == mode3Size)
-    {
-        m_mode = 3;
-        m_mode31 = code1;
-        m_mode301 = code2;
-    }
-    else if (minSize == mode4Size)
-    {
-        m_mode = 4;
-        m_mode41 = code1;
-        m_mode401 = code2;
-        m_mode4001 = code3;
-    }
-    else
-    {
-        if (m_writeBits == nullptr)
-            throw SubscriberException("Coding Error");
-        else
-            throw PublisherException("Coding Error");
-    }
-
-    m_commandsSentSinceLastChange = 0;
-}
\ No newline at end of file
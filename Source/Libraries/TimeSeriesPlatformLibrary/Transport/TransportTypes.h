@@ -90,6 +90,10 @@ namespace TimeSeries
         // as reported by the device that took it.
         MeasurementStateFlags Flags;
 
+        // Runtime ID assigned by the signal index cache
+        // used to decode the measurement, -1 when unknown.
+        int32_t RuntimeID;
+
         // Creates a new instance.
         Measurement();
 
@@ -269,92 +273,41 @@ namespace TimeSeries
     // flags measurement is not available the QualityFlags measurement data pointer will
     // be null and consuming code should check for this expected condition.
 
-    //struct Phasor
-    //{
-    //	Measurement Angle;
-    //	Measurement Magnitude;
-    //};
-    
-    // Holds the actual values, in order, for a device frame at a specific timestamp
-    //struct DataFrame
-    //{
-    //	string DeviceAcronym;
-    //	DateTime SOC;
-    //	int milliseconds;
-    //	Measurement StatusFlags;
-    //  Measurement QualityFlags;
-    //	Measurement Frequency;
-    //	vector<Phasor> Phasors;
-    //	vector<Measurement> Analogs;
-    //	vector<Measurement> Digitals;
-    //};
-}}
-
-namespace GSF {
-namespace TimeSeries {
-namespace Transport
-{
-    // The metadata kept for each pointID.
-    class TSSCPointMetadata
+    // Holds the angle and magnitude values for a phasor of a data frame
+    struct Phasor
     {
-    private:
-        static const uint8_t CommandStatsLength = 32;
-
-        uint8_t m_commandStats[CommandStatsLength];
-        int32_t m_commandsSentSinceLastChange;
-
-        //Bit codes for the 4 modes of encoding. 
-        uint8_t m_mode;
-
-        //(Mode 1 means no prefix.)
-        uint8_t m_mode21;
-
-        uint8_t m_mode31;
-        uint8_t m_mode301;
-
-        uint8_t m_mode41;
-        uint8_t m_mode401;
-        uint8_t m_mode4001;
-
-        int32_t m_startupMode;
-
-        std::function<void(int32_t, int32_t)> m_writeBits;
-        std::function<int32_t()> m_readBit;
-        std::function<int32_t()> m_readBits5;
-
-        void UpdatedCodeStatistics(int32_t code);
-        void AdaptCommands();
-
-        TSSCPointMetadata(
-            std::function<void(int32_t, int32_t)> writeBits,
-            std::function<int32_t()> readBit,
-            std::function<int32_t()> readBits5
-        );
-
-    public:
-        TSSCPointMetadata(
-            std::function<void(int32_t, int32_t)> writeBits
-        );
+        Measurement Angle;
+        Measurement Magnitude;
+    };
 
-        TSSCPointMetadata(
-            std::function<int32_t()> readBit,
-            std::function<int32_t()> readBits5
-        );
+    // Holds the actual values, in order, for a device frame at a specific timestamp. Values
+    // that were not received for the frame timestamp will have a Timestamp of zero.
+    struct DataFrame
+    {
+        ConfigurationFramePtr Configuration;
+        std::string DeviceAcronym;
+        int64_t Timestamp;
+        Measurement QualityFlags;
+        Measurement StatusFlags;
+        Measurement Frequency;
+        Measurement DfDt;
+        std::vector<Phasor> Phasors;
+        std::vector<Measurement> Analogs;
+        std::vector<Measurement> Digitals;
 
-        uint16_t PrevNextPointId1;
+        // Number of values received for the frame timestamp
+        uint32_t ReceivedCount;
 
-        uint32_t PrevQuality1;
-        uint32_t PrevQuality2;
-        uint32_t PrevValue1;
-        uint32_t PrevValue2;
-        uint32_t PrevValue3;
+        // Number of subscribed values that map to the frame
+        uint32_t ExpectedCount;
 
-        void WriteCode(int32_t code);
+        DataFrame();
 
-        int32_t ReadCode();
+        // Determines if all subscribed values for the frame were received.
+        bool IsComplete() const;
     };
 
-    typedef SharedPtr<TSSCPointMetadata> TSSCPointMetadataPtr;
-}}}
+    typedef SharedPtr<DataFrame> DataFramePtr;
+}}
 
 #endif
\ No newline at end of file
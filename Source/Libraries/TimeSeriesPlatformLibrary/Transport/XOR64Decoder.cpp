@@ -0,0 +1,200 @@
+//******************************************************************************************************
+//  XOR64Decoder.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#include "XOR64Decoder.h"
+#include <cstring>
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+XOR64Decoder::XOR64Decoder() :
+    m_data(nullptr),
+    m_position(0),
+    m_lastPosition(0),
+    m_bitCache(0ULL),
+    m_bitCount(0),
+    m_lastPoint(&m_initialPoint)
+{
+}
+
+void XOR64Decoder::Reset()
+{
+    m_data = nullptr;
+    m_points.clear();
+    m_initialPoint = XOR64PointMetadata();
+    m_lastPoint = &m_initialPoint;
+    m_position = 0;
+    m_lastPosition = 0;
+    m_bitCache = 0ULL;
+    m_bitCount = 0;
+}
+
+// Adds state for all points up to and including the given ID, each new
+// point starts with its next point ID predicted as the following ID
+void XOR64Decoder::AddPoints(uint16_t id)
+{
+    // Last point can reference an element of points, so it is restored after resize
+    const bool lastPointInPoints = m_lastPoint != &m_initialPoint;
+    const size_t lastPointIndex = lastPointInPoints ? m_lastPoint - m_points.data() : 0;
+    const size_t count = m_points.size();
+
+    m_points.resize(static_cast<size_t>(id) + 1);
+
+    for (size_t i = count; i < m_points.size(); i++)
+        m_points[i].NextPointID = static_cast<uint16_t>(i + 1);
+
+    if (lastPointInPoints)
+        m_lastPoint = &m_points[lastPointIndex];
+}
+
+void XOR64Decoder::SetBuffer(uint8_t* data, uint32_t offset, uint32_t length)
+{
+    m_data = data;
+    m_position = offset;
+    m_lastPosition = length;
+    m_bitCache = 0ULL;
+    m_bitCount = 0;
+}
+
+bool XOR64Decoder::TryGetMeasurement(uint16_t& id, int64_t& timestamp, uint32_t& quality, float64_t& value)
+{
+    if (ReadBits(1) == 0ULL)
+    {
+        id = m_lastPoint->NextPointID;
+    }
+    else
+    {
+        // Remaining bits of block are padding after end of stream code
+        if (ReadBits(1) == 1ULL)
+            return false;
+
+        id = static_cast<uint16_t>(ReadBits(XOR64Codes::PointIDExplicitBits));
+        m_lastPoint->NextPointID = id;
+    }
+
+    XOR64PointMetadata& point = GetPoint(id);
+
+    timestamp = ReadTimestamp(point);
+
+    if (ReadBits(1) == 1ULL)
+        point.PrevQuality = static_cast<uint32_t>(ReadBits(32));
+
+    quality = point.PrevQuality;
+    value = ReadValue(point);
+    m_lastPoint = &point;
+
+    return true;
+}
+
+int64_t XOR64Decoder::ReadTimestamp(XOR64PointMetadata& point)
+{
+    uint64_t zigZag;
+
+    if (ReadBits(1) == 0ULL)
+    {
+        zigZag = 0ULL;
+    }
+    else if (ReadBits(1) == 0ULL)
+    {
+        zigZag = ReadBits(XOR64Codes::TimeDeltaBits1);
+    }
+    else if (ReadBits(1) == 0ULL)
+    {
+        zigZag = ReadBits(XOR64Codes::TimeDeltaBits2);
+    }
+    else if (ReadBits(1) == 0ULL)
+    {
+        zigZag = ReadBits(XOR64Codes::TimeDeltaBits3);
+    }
+    else
+    {
+        // Full timestamp restarts the delta sequence for the point
+        point.PrevTimestamp = static_cast<int64_t>(ReadBits64(64));
+        point.PrevTimeDelta = 0LL;
+        return point.PrevTimestamp;
+    }
+
+    // Unsigned arithmetic keeps wrap-around well defined for arbitrary timestamps
+    const uint64_t deltaOfDelta = zigZag >> 1 ^ (0ULL - (zigZag & 1ULL));
+    const uint64_t delta = static_cast<uint64_t>(point.PrevTimeDelta) + deltaOfDelta;
+
+    point.PrevTimestamp = static_cast<int64_t>(static_cast<uint64_t>(point.PrevTimestamp) + delta);
+    point.PrevTimeDelta = static_cast<int64_t>(delta);
+
+    return point.PrevTimestamp;
+}
+
+float64_t XOR64Decoder::ReadValue(XOR64PointMetadata& point)
+{
+    if (ReadBits(1) == 1ULL)
+    {
+        uint64_t xorValue;
+
+        if (ReadBits(1) == 0ULL)
+        {
+            if (point.PrevLeadingZeros == 64)
+                ThrowInvalidStream("value window used before it was defined");
+
+            // Changed bits fit within the previous meaningful bit window
+            xorValue = ReadBits64(64 - point.PrevLeadingZeros - point.PrevTrailingZeros) << point.PrevTrailingZeros;
+        }
+        else
+        {
+            const int32_t leadingZeros = static_cast<int32_t>(ReadBits(XOR64Codes::WindowFieldBits));
+            const int32_t significantBits = static_cast<int32_t>(ReadBits(XOR64Codes::WindowFieldBits)) + 1;
+            const int32_t trailingZeros = 64 - leadingZeros - significantBits;
+
+            if (trailingZeros < 0)
+                ThrowInvalidStream("value window exceeds 64 bits");
+
+            xorValue = ReadBits64(significantBits) << trailingZeros;
+
+            point.PrevLeadingZeros = static_cast<uint8_t>(leadingZeros);
+            point.PrevTrailingZeros = static_cast<uint8_t>(trailingZeros);
+        }
+
+        point.PrevValue ^= xorValue;
+    }
+
+    float64_t value;
+    memcpy(&value, &point.PrevValue, sizeof(float64_t));
+
+    return value;
+}
+
+void XOR64Decoder::ThrowInvalidStream(const char* reason) const
+{
+    stringstream errorMessageStream;
+
+    errorMessageStream << "Invalid XOR64 stream, ";
+    errorMessageStream << reason;
+    errorMessageStream << " at position ";
+    errorMessageStream << static_cast<int>(m_position);
+    errorMessageStream << " with last position ";
+    errorMessageStream << static_cast<int>(m_lastPosition);
+
+    throw SubscriberException(errorMessageStream.str());
+}
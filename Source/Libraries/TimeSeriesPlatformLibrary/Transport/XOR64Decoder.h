@@ -0,0 +1,117 @@
+//******************************************************************************************************
+//  XOR64Decoder.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#ifndef __XOR64_DECODER_H
+#define __XOR64_DECODER_H
+
+#include "XOR64PointMetadata.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Decoder for full-precision 64-bit measurement values, see XOR64PointMetadata for the encoding.
+    class XOR64Decoder
+    {
+    private:
+        uint8_t* m_data;
+        uint32_t m_position;
+        uint32_t m_lastPosition;
+
+        // Bits read from m_data but not yet consumed, the low m_bitCount bits are valid.
+        uint64_t m_bitCache;
+        int32_t m_bitCount;
+
+        // Point state indexed by point ID, last point references initial point or an element of points
+        XOR64PointMetadata m_initialPoint;
+        XOR64PointMetadata* m_lastPoint;
+        std::vector<XOR64PointMetadata> m_points;
+
+        int64_t ReadTimestamp(XOR64PointMetadata& point);
+        float64_t ReadValue(XOR64PointMetadata& point);
+
+        [[noreturn]] void ThrowInvalidStream(const char* reason) const;
+
+        // Reads up to 32 bits. Cache is refilled a byte at a time to at least 57 bits,
+        // or to the end of the buffer, so most reads do not touch the buffer.
+        uint64_t ReadBits(int32_t count)
+        {
+            if (m_bitCount < count)
+            {
+                while (m_bitCount < 57 && m_position < m_lastPosition)
+                {
+                    m_bitCache = m_bitCache << 8 | m_data[m_position++];
+                    m_bitCount += 8;
+                }
+
+                if (m_bitCount < count)
+                    ThrowInvalidStream("stream ended before end of stream code");
+            }
+
+            m_bitCount -= count;
+            return m_bitCache >> m_bitCount & ((1ULL << count) - 1ULL);
+        }
+
+        // Reads up to 64 bits.
+        uint64_t ReadBits64(int32_t count)
+        {
+            if (count > 32)
+            {
+                const uint64_t high = ReadBits(count - 32);
+                return high << 32 | ReadBits(32);
+            }
+
+            return ReadBits(count);
+        }
+
+        XOR64PointMetadata& GetPoint(uint16_t id)
+        {
+            if (id >= m_points.size())
+                AddPoints(id);
+
+            return m_points[id];
+        }
+
+        void AddPoints(uint16_t id);
+
+    public:
+        // Creates a new instance of the XOR64 decoder.
+        XOR64Decoder();
+
+        // Decoder references its own point state, so it cannot be copied.
+        XOR64Decoder(const XOR64Decoder&) = delete;
+        XOR64Decoder& operator=(const XOR64Decoder&) = delete;
+
+        // Resets the XOR64 decoder to the initial state.
+        void Reset();
+
+        // Sets the internal buffer to read data from.
+        void SetBuffer(uint8_t* data, uint32_t offset, uint32_t length);
+
+        // Reads the next measurement from the stream. If the end of the stream has been encountered, return false.
+        bool TryGetMeasurement(uint16_t& id, int64_t& timestamp, uint32_t& quality, float64_t& value);
+    };
+}}}
+
+#endif
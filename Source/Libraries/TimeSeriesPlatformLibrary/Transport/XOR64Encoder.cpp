@@ -0,0 +1,198 @@
+//******************************************************************************************************
+//  XOR64Encoder.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#include "XOR64Encoder.h"
+#include <cstring>
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+XOR64Encoder::XOR64Encoder() :
+    m_data(nullptr),
+    m_position(0),
+    m_lastPosition(0),
+    m_bitCache(0ULL),
+    m_bitCount(0),
+    m_lastPoint(&m_initialPoint)
+{
+}
+
+void XOR64Encoder::Reset()
+{
+    m_data = nullptr;
+    m_points.clear();
+    m_initialPoint = XOR64PointMetadata();
+    m_lastPoint = &m_initialPoint;
+    m_position = 0;
+    m_lastPosition = 0;
+    m_bitCache = 0ULL;
+    m_bitCount = 0;
+}
+
+// Adds state for all points up to and including the given ID, each new
+// point starts with its next point ID predicted as the following ID
+void XOR64Encoder::AddPoints(uint16_t id)
+{
+    // Last point can reference an element of points, so it is restored after resize
+    const bool lastPointInPoints = m_lastPoint != &m_initialPoint;
+    const size_t lastPointIndex = lastPointInPoints ? m_lastPoint - m_points.data() : 0;
+    const size_t count = m_points.size();
+
+    m_points.resize(static_cast<size_t>(id) + 1);
+
+    for (size_t i = count; i < m_points.size(); i++)
+        m_points[i].NextPointID = static_cast<uint16_t>(i + 1);
+
+    if (lastPointInPoints)
+        m_lastPoint = &m_points[lastPointIndex];
+}
+
+void XOR64Encoder::SetBuffer(uint8_t* data, uint32_t offset, uint32_t length)
+{
+    m_data = data;
+    m_position = offset;
+    m_lastPosition = offset + length;
+    m_bitCache = 0ULL;
+    m_bitCount = 0;
+}
+
+uint32_t XOR64Encoder::FinishBlock()
+{
+    // End of stream code followed by zero padding to the next byte boundary
+    WriteBits(3, 2);
+
+    if (m_bitCount > 0)
+        WriteBits(0, 8 - m_bitCount);
+
+    return m_position;
+}
+
+bool XOR64Encoder::TryAddMeasurement(uint16_t id, int64_t timestamp, uint32_t quality, float64_t value)
+{
+    if (m_lastPosition - m_position < XOR64Codes::MaxMeasurementSize)
+        return false;
+
+    XOR64PointMetadata& point = GetPoint(id);
+
+    if (id == m_lastPoint->NextPointID)
+    {
+        WriteBits(0, 1);
+    }
+    else
+    {
+        WriteBits(2U << XOR64Codes::PointIDExplicitBits | id, 2 + XOR64Codes::PointIDExplicitBits);
+        m_lastPoint->NextPointID = id;
+    }
+
+    WriteTimestamp(timestamp, point);
+
+    if (quality == point.PrevQuality)
+    {
+        WriteBits(0, 1);
+    }
+    else
+    {
+        WriteBits64(1ULL << 32 | quality, 33);
+        point.PrevQuality = quality;
+    }
+
+    WriteValue(value, point);
+    m_lastPoint = &point;
+
+    return true;
+}
+
+void XOR64Encoder::WriteTimestamp(int64_t timestamp, XOR64PointMetadata& point)
+{
+    // Unsigned arithmetic keeps wrap-around well defined for arbitrary timestamps
+    uint64_t delta = static_cast<uint64_t>(timestamp) - static_cast<uint64_t>(point.PrevTimestamp);
+    const uint64_t deltaOfDelta = delta - static_cast<uint64_t>(point.PrevTimeDelta);
+    const uint64_t zigZag = deltaOfDelta << 1 ^ static_cast<uint64_t>(static_cast<int64_t>(deltaOfDelta) >> 63);
+
+    if (zigZag == 0ULL)
+    {
+        WriteBits(0, 1);
+    }
+    else if (zigZag < 1ULL << XOR64Codes::TimeDeltaBits1)
+    {
+        WriteBits(2ULL << XOR64Codes::TimeDeltaBits1 | zigZag, 2 + XOR64Codes::TimeDeltaBits1);
+    }
+    else if (zigZag < 1ULL << XOR64Codes::TimeDeltaBits2)
+    {
+        WriteBits(6ULL << XOR64Codes::TimeDeltaBits2 | zigZag, 3 + XOR64Codes::TimeDeltaBits2);
+    }
+    else if (zigZag < 1ULL << XOR64Codes::TimeDeltaBits3)
+    {
+        WriteBits(14, 4);
+        WriteBits(zigZag, XOR64Codes::TimeDeltaBits3);
+    }
+    else
+    {
+        // Full timestamp restarts the delta sequence for the point
+        WriteBits(15, 4);
+        WriteBits64(static_cast<uint64_t>(timestamp), 64);
+        delta = 0ULL;
+    }
+
+    point.PrevTimestamp = timestamp;
+    point.PrevTimeDelta = static_cast<int64_t>(delta);
+}
+
+void XOR64Encoder::WriteValue(float64_t value, XOR64PointMetadata& point)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(uint64_t));
+
+    const uint64_t xorValue = bits ^ point.PrevValue;
+
+    if (xorValue == 0ULL)
+    {
+        WriteBits(0, 1);
+        return;
+    }
+
+    const int32_t leadingZeros = LeadingZeros64(xorValue);
+    const int32_t trailingZeros = TrailingZeros64(xorValue);
+
+    if (leadingZeros >= point.PrevLeadingZeros && trailingZeros >= point.PrevTrailingZeros)
+    {
+        // Changed bits fit within the previous meaningful bit window
+        WriteBits(2, 2);
+        WriteBits64(xorValue >> point.PrevTrailingZeros, 64 - point.PrevLeadingZeros - point.PrevTrailingZeros);
+    }
+    else
+    {
+        const int32_t significantBits = 64 - leadingZeros - trailingZeros;
+
+        WriteBits(3U << 2 * XOR64Codes::WindowFieldBits | leadingZeros << XOR64Codes::WindowFieldBits | (significantBits - 1), 2 + 2 * XOR64Codes::WindowFieldBits);
+        WriteBits64(xorValue >> trailingZeros, significantBits);
+
+        point.PrevLeadingZeros = static_cast<uint8_t>(leadingZeros);
+        point.PrevTrailingZeros = static_cast<uint8_t>(trailingZeros);
+    }
+
+    point.PrevValue = bits;
+}
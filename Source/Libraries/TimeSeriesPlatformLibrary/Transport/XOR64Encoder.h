@@ -0,0 +1,114 @@
+//******************************************************************************************************
+//  XOR64Encoder.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#ifndef __XOR64_ENCODER_H
+#define __XOR64_ENCODER_H
+
+#include "XOR64PointMetadata.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Encoder for full-precision 64-bit measurement values, see XOR64PointMetadata for the
+    // encoding. Unlike TSSC, values are not reduced to 32-bit floating point.
+    class XOR64Encoder
+    {
+    private:
+        uint8_t* m_data;
+        uint32_t m_position;
+        uint32_t m_lastPosition;
+
+        // Pending bits not yet written to m_data, the low m_bitCount bits are valid.
+        uint64_t m_bitCache;
+        int32_t m_bitCount;
+
+        // Point state indexed by point ID, last point references initial point or an element of points
+        XOR64PointMetadata m_initialPoint;
+        XOR64PointMetadata* m_lastPoint;
+        std::vector<XOR64PointMetadata> m_points;
+
+        void WriteTimestamp(int64_t timestamp, XOR64PointMetadata& point);
+        void WriteValue(float64_t value, XOR64PointMetadata& point);
+
+        // Writes up to 32 bits, value must not have bits set above count. At most 7 bits
+        // are pending before a write, so the cache never holds more than 39 bits.
+        void WriteBits(uint64_t value, int32_t count)
+        {
+            m_bitCache = m_bitCache << count | value;
+            m_bitCount += count;
+
+            while (m_bitCount > 7)
+            {
+                m_bitCount -= 8;
+                m_data[m_position++] = static_cast<uint8_t>(m_bitCache >> m_bitCount);
+            }
+        }
+
+        // Writes up to 64 bits, value must not have bits set above count.
+        void WriteBits64(uint64_t value, int32_t count)
+        {
+            if (count > 32)
+            {
+                WriteBits(value >> 32, count - 32);
+                value &= 0xFFFFFFFFULL;
+                count = 32;
+            }
+
+            WriteBits(value, count);
+        }
+
+        XOR64PointMetadata& GetPoint(uint16_t id)
+        {
+            if (id >= m_points.size())
+                AddPoints(id);
+
+            return m_points[id];
+        }
+
+        void AddPoints(uint16_t id);
+
+    public:
+        // Creates a new instance of the XOR64 encoder.
+        XOR64Encoder();
+
+        // Encoder references its own point state, so it cannot be copied.
+        XOR64Encoder(const XOR64Encoder&) = delete;
+        XOR64Encoder& operator=(const XOR64Encoder&) = delete;
+
+        // Resets the XOR64 encoder to the initial state.
+        void Reset();
+
+        // Sets the internal buffer to write data to.
+        void SetBuffer(uint8_t* data, uint32_t offset, uint32_t length);
+
+        // Finishes the current block and returns position after the last byte written.
+        uint32_t FinishBlock();
+
+        // Adds the supplied measurement to the stream. If the stream is full, this method returns false.
+        bool TryAddMeasurement(uint16_t id, int64_t timestamp, uint32_t quality, float64_t value);
+    };
+}}}
+
+#endif
@@ -0,0 +1,99 @@
+//******************************************************************************************************
+//  XOR64PointMetadata.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/18/2026 - agent
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+
+#ifndef __XOR64_POINT_METADATA_H
+#define __XOR64_POINT_METADATA_H
+
+#include "TransportTypes.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Per point state shared by the XOR64 encoder and decoder. Timestamps are encoded as the
+    // delta-of-delta from the previous timestamp of the same point and values as the XOR of
+    // the 64-bit value with the previous value of the same point.
+    struct XOR64PointMetadata
+    {
+        int64_t PrevTimestamp = 0LL;
+        int64_t PrevTimeDelta = 0LL;
+        uint64_t PrevValue = 0ULL;
+        uint32_t PrevQuality = 0U;
+
+        // Point ID that followed this point last time, used to predict the next point ID
+        uint16_t NextPointID = 0;
+
+        // Meaningful bit window of the last non-zero value XOR, 64 means no window
+        uint8_t PrevLeadingZeros = 64;
+        uint8_t PrevTrailingZeros = 64;
+    };
+
+    // Bit codes used by the XOR64 encoder and decoder, written most significant bit first.
+    struct XOR64Codes
+    {
+        // Point ID codes: 0 = predicted, 10 + 16-bit ID, 11 = end of stream
+        static constexpr int32_t PointIDExplicitBits = 16;
+
+        // Timestamp delta-of-delta codes (zig-zag encoded): 0 = unchanged delta, 10 + 7 bits,
+        // 110 + 16 bits, 1110 + 32 bits, 1111 + full 64-bit timestamp
+        static constexpr int32_t TimeDeltaBits1 = 7;
+        static constexpr int32_t TimeDeltaBits2 = 16;
+        static constexpr int32_t TimeDeltaBits3 = 32;
+
+        // Quality codes: 0 = unchanged, 1 + 32-bit quality
+
+        // Value codes: 0 = unchanged, 10 + bits within previous window,
+        // 11 + 6-bit leading zeros + 6-bit (significant bits - 1) + significant bits
+        static constexpr int32_t WindowFieldBits = 6;
+
+        // Largest possible encoded measurement, in bytes, including end of stream code
+        static constexpr uint32_t MaxMeasurementSize = 32U;
+    };
+
+    inline int32_t LeadingZeros64(uint64_t value)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        return _BitScanReverse64(&index, value) ? 63 - static_cast<int32_t>(index) : 64;
+#else
+        return value == 0ULL ? 64 : __builtin_clzll(value);
+#endif
+    }
+
+    inline int32_t TrailingZeros64(uint64_t value)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        return _BitScanForward64(&index, value) ? static_cast<int32_t>(index) : 64;
+#else
+        return value == 0ULL ? 64 : __builtin_ctzll(value);
+#endif
+    }
+}}}
+
+#endif